@@ -930,11 +930,8 @@ bool BestPractices::ValidateCreateComputePipelineArm(const VkComputePipelineCrea
     auto entrypoint = FindEntrypoint(module, createInfo.stage.pName, createInfo.stage.stage);
     if (entrypoint == module->end()) return false;
 
-    bool has_writeable_descriptors = false;
-    bool has_atomic_descriptors = false;
-    auto accessible_ids = MarkAccessibleIds(module, entrypoint);
-    auto descriptor_uses =
-        CollectInterfaceByDescriptorSlot(module, accessible_ids, &has_writeable_descriptors, &has_atomic_descriptors);
+    auto resources = module->GetEntryPointResources(entrypoint);
+    const auto &descriptor_uses = resources->descriptor_uses;
 
     unsigned dimensions = 0;
     if (x > 1) dimensions++;
@@ -128,6 +128,7 @@ IMAGE_STATE::IMAGE_STATE(VkDevice dev, VkImage img, const VkImageCreateInfo *pCr
       create_from_swapchain(VK_NULL_HANDLE),
       bind_swapchain(VK_NULL_HANDLE),
       bind_swapchain_imageIndex(0),
+      layout_slot(kNoImageLayoutSlot),
       range_encoder(full_range),
       disjoint(false),
       plane0_memory_requirements_checked(false),
@@ -571,8 +572,9 @@ bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(RenderPassCreateVersion r
 
             // Cast pCB to const because we don't want to create entries that don't exist here (in case the key changes to something
             // in common with the non-const version.)
-            const ImageSubresourceLayoutMap *subresource_map =
-                (attachment_initial_layout != VK_IMAGE_LAYOUT_UNDEFINED) ? GetImageSubresourceLayoutMap(const_pCB, image) : nullptr;
+            const ImageSubresourceLayoutMap *subresource_map = (attachment_initial_layout != VK_IMAGE_LAYOUT_UNDEFINED)
+                                                                   ? GetImageSubresourceLayoutMap(const_pCB, *image_state)
+                                                                   : nullptr;
 
             if (subresource_map) {  // If no layout information for image yet, will be checked at QueueSubmit time
                 LayoutUseCheckAndMessage layout_check(subresource_map);
@@ -919,7 +921,7 @@ bool CoreChecks::ValidateBarriersToImages(const CMD_BUFFER_STATE *cb_state, uint
                 }
             }
 
-            const auto *subresource_map = GetImageSubresourceLayoutMap(cb_state, img_barrier.image);
+            const auto *subresource_map = GetImageSubresourceLayoutMap(cb_state, *image_state);
             if (img_barrier.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
                 // TODO: Set memory invalid which is in mem_tracker currently
                 // Not sure if this needs to be in the ForRange traversal, pulling it out as it is currently invariant with
@@ -1073,12 +1075,8 @@ void CoreChecks::RecordBarrierArrayValidationInfo(const char *func_name, CMD_BUF
             bool mode_concurrent = handle_state ? handle_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT : false;
             if (!mode_concurrent) {
                 const auto typed_handle = BarrierTypedHandle(barrier);
-                cb_state->queue_submit_functions.emplace_back(
-                    [func_name, cb_state, typed_handle, src_queue_family, dst_queue_family](
-                        const ValidationStateTracker *device_data, const QUEUE_STATE *queue_state) {
-                        return ValidateConcurrentBarrierAtSubmit(device_data, queue_state, func_name, cb_state, typed_handle,
-                                                                 src_queue_family, dst_queue_family);
-                    });
+                cb_state->submit_time_barrier_checks.emplace_back(func_name, cb_state, typed_handle, src_queue_family,
+                                                                  dst_queue_family);
             }
         }
     }
@@ -1274,7 +1272,7 @@ bool CoreChecks::VerifyImageLayout(const CMD_BUFFER_STATE *cb_node, const IMAGE_
     const auto image = image_state->image;
     bool skip = false;
 
-    const auto *subresource_map = GetImageSubresourceLayoutMap(cb_node, image);
+    const auto *subresource_map = GetImageSubresourceLayoutMap(cb_node, *image_state);
     if (subresource_map) {
         bool subres_skip = false;
         LayoutUseCheckAndMessage layout_check(subresource_map, aspect_mask);
@@ -1889,6 +1887,7 @@ void CoreChecks::PostCallRecordCreateImage(VkDevice device, const VkImageCreateI
     StateTracker::PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     auto image_state = Get<IMAGE_STATE>(*pImage);
     AddInitialLayoutintoImageLayoutMap(*image_state, imageLayoutMap);
+    image_state->global_layout_change_count = ++image_layout_map_change_count;
 }
 
 bool CoreChecks::PreCallValidateDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) const {
@@ -1972,7 +1971,7 @@ bool CoreChecks::VerifyClearImageLayout(const CMD_BUFFER_STATE *cb_node, const I
     }
 
     // Cast to const to prevent creation at validate time.
-    const auto *subresource_map = GetImageSubresourceLayoutMap(cb_node, image_state->image);
+    const auto *subresource_map = GetImageSubresourceLayoutMap(cb_node, *image_state);
     if (subresource_map) {
         bool subres_skip = false;
         LayoutUseCheckAndMessage layout_check(subresource_map);
@@ -3822,23 +3821,30 @@ const GlobalImageLayoutRangeMap *GetLayoutRangeMap(const GlobalImageLayoutMap &m
 }
 
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
+// With layouts_validated set, the initial layouts are known to match the global layouts (from a cached earlier submission) and
+// only the overlay map is updated.
 bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const GlobalImageLayoutMap &globalImageLayoutMap,
-                                            GlobalImageLayoutMap *overlayLayoutMap_arg) const {
+                                            GlobalImageLayoutMap *overlayLayoutMap_arg, bool layouts_validated) const {
     if (disabled[image_layout_validation]) return false;
     bool skip = false;
     GlobalImageLayoutMap &overlayLayoutMap = *overlayLayoutMap_arg;
     // Iterate over the layout maps for each referenced image
     GlobalImageLayoutRangeMap empty_map(1);
     for (const auto &layout_map_entry : pCB->image_layout_map) {
-        const auto image = layout_map_entry.first;
-        const auto *image_state = GetImageState(image);
+        const auto image = layout_map_entry.image;
+        const auto *image_state = GetImageStateFromLayoutSlot(layout_map_entry.slot, image);
         if (!image_state) continue;  // Can't check layouts of a dead image
-        const auto &subres_map = layout_map_entry.second;
+        const auto &subres_map = layout_map_entry.layout_map;
         const auto &initial_layout_map = subres_map->GetInitialLayoutMap();
         // Validate the initial_uses for each subresource referenced
         if (initial_layout_map.empty()) continue;
 
         auto *overlay_map = GetLayoutRangeMap(&overlayLayoutMap, *image_state);
+        if (layouts_validated) {
+            sparse_container::splice(overlay_map, subres_map->GetCurrentLayoutMap(),
+                                     sparse_container::value_precedence::prefer_source);
+            continue;
+        }
         const auto *global_map = GetLayoutRangeMap(globalImageLayoutMap, image);
         if (global_map == nullptr) {
             global_map = &empty_map;
@@ -3898,14 +3904,26 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const G
     return skip;
 }
 
+// Whether earlier command buffers of the same submission changed the layout of any image this command buffer has initial layouts
+// for, s.t. it must be validated against the overlay and not just the global layouts.
+bool CoreChecks::OverlayHasCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const GlobalImageLayoutMap &overlayLayoutMap) const {
+    if (overlayLayoutMap.empty()) return false;
+    for (const auto &layout_map_entry : pCB->image_layout_map) {
+        if (overlayLayoutMap.count(layout_map_entry.image)) return true;
+    }
+    return false;
+}
+
 void CoreChecks::UpdateCmdBufImageLayouts(CMD_BUFFER_STATE *pCB) {
     for (const auto &layout_map_entry : pCB->image_layout_map) {
-        const auto image = layout_map_entry.first;
-        const auto &subres_map = layout_map_entry.second;
-        const auto *image_state = GetImageState(image);
+        const auto &subres_map = layout_map_entry.layout_map;
+        auto *image_state = GetImageStateFromLayoutSlot(layout_map_entry.slot, layout_map_entry.image);
         if (!image_state) continue;  // Can't set layouts of a dead image
         auto *global_map = GetLayoutRangeMap(&imageLayoutMap, *image_state);
-        sparse_container::splice(global_map, subres_map->GetCurrentLayoutMap(), sparse_container::value_precedence::prefer_source);
+        if (sparse_container::splice(global_map, subres_map->GetCurrentLayoutMap(),
+                                     sparse_container::value_precedence::prefer_source)) {
+            image_state->global_layout_change_count = ++image_layout_map_change_count;
+        }
     }
 }
 
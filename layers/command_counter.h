@@ -24,6 +24,9 @@ class CommandCounter : public ValidationObject {
     virtual ~CommandCounter() {}
 
     virtual write_lock_guard_t write_lock() { return coreChecks->write_lock(); }
+    virtual CmdBufferLockGuard cmd_buffer_write_lock(VkCommandBuffer command_buffer) {
+        return coreChecks->cmd_buffer_write_lock(command_buffer);
+    }
 
 #include "command_counter_helper.h"
 
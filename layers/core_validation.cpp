@@ -157,27 +157,48 @@ static std::unique_ptr<ImageSubresourceLayoutMap> LayoutMapFactory(const IMAGE_S
     return map;
 }
 
-// The const variant only need the image as it is the key for the map
-const ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(const CMD_BUFFER_STATE *cb_state, VkImage image) {
-    auto it = cb_state->image_layout_map.find(image);
-    if (it == cb_state->image_layout_map.cend()) {
-        return nullptr;
+uint32_t CommandBufferImageLayoutMap::EntryIndex(const IMAGE_STATE &image_state) const {
+    const uint32_t slot = image_state.layout_slot;
+    if (slot >= slot_entries_.size()) return kNoEntry;
+    const uint32_t index = slot_entries_[slot];
+    // A slot recycled from a destroyed image can still index the entry of that image
+    if ((index == kNoEntry) || (entries_[index].image != image_state.image)) return kNoEntry;
+    return index;
+}
+
+ImageSubresourceLayoutMap *CommandBufferImageLayoutMap::FindOrCreate(const IMAGE_STATE &image_state) {
+    uint32_t index = EntryIndex(image_state);
+    if (index == kNoEntry) {
+        // Empty slot... fill it in.
+        const uint32_t slot = image_state.layout_slot;
+        assert(slot != kNoImageLayoutSlot);
+        if (slot >= slot_entries_.size()) {
+            slot_entries_.resize(slot + 1, static_cast<uint32_t>(kNoEntry));
+        }
+        index = static_cast<uint32_t>(entries_.size());
+        entries_.emplace_back(image_state.image, slot, LayoutMapFactory(image_state));
+        slot_entries_[slot] = index;
     }
-    return it->second.get();
+    return entries_[index].layout_map.get();
 }
 
-// The non-const variant only needs the image state, as the factory requires it to construct a new entry
-ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(CMD_BUFFER_STATE *cb_state, const IMAGE_STATE &image_state) {
-    auto it = cb_state->image_layout_map.find(image_state.image);
-    if (it == cb_state->image_layout_map.end()) {
-        // Empty slot... fill it in.
-        auto insert_pair = cb_state->image_layout_map.insert(std::make_pair(image_state.image, LayoutMapFactory(image_state)));
-        assert(insert_pair.second);
-        ImageSubresourceLayoutMap *new_map = insert_pair.first->second.get();
-        assert(new_map);
-        return new_map;
+void CommandBufferImageLayoutMap::clear() {
+    for (const auto &entry : entries_) {
+        slot_entries_[entry.slot] = kNoEntry;
     }
-    return it->second.get();
+    entries_.clear();
+}
+
+// The const variant doesn't create entries for images not referenced by the command buffer
+const ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(const CMD_BUFFER_STATE *cb_state, const IMAGE_STATE &image_state) {
+    return cb_state->image_layout_map.Find(image_state);
+}
+
+// The non-const variant constructs a new entry on first reference of the image
+ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(CMD_BUFFER_STATE *cb_state, const IMAGE_STATE &image_state) {
+    ImageSubresourceLayoutMap *map = cb_state->image_layout_map.FindOrCreate(image_state);
+    assert(map);
+    return map;
 }
 
 void AddInitialLayoutintoImageLayoutMap(const IMAGE_STATE &image_state, GlobalImageLayoutMap &image_layout_map) {
@@ -196,6 +217,14 @@ void CoreChecks::InitDeviceValidationObject(bool add_obj, ValidationObject *inst
             dev_obj->object_dispatch.emplace_back(command_counter);
         }
         ValidationStateTracker::InitDeviceValidationObject(add_obj, inst_obj, dev_obj);
+        fine_grained_locking_enabled = enabled[fine_grained_locking];
+        if (enabled[parallel_descriptor_updates]) {
+            // The calling thread works on the batch too
+            const uint32_t hardware_threads = std::thread::hardware_concurrency();
+            if (hardware_threads > 1) {
+                descriptor_update_workers.reset(new ValidationWorkerPool(std::min(hardware_threads - 1, 7u)));
+            }
+        }
     }
 }
 
@@ -1004,10 +1033,27 @@ static bool VerifySetLayoutCompatibility(const debug_report_data *report_data, c
     return cvdescriptorset::VerifySetLayoutCompatibility(report_data, layout_node, descriptor_set->GetLayout().get(), &errorMsg);
 }
 
+// Return true if any set statically used by pipe is not the one (or contents/image layouts) last validated at draw time
+static bool DescriptorSetsChangedSinceLastDraw(const CMD_BUFFER_STATE *cb_node, const LAST_BOUND_STATE &state,
+                                               const PIPELINE_STATE *pipe, bool check_image_layouts) {
+    for (const auto &set_binding_pair : pipe->active_slots) {
+        const uint32_t setIndex = set_binding_pair.first;
+        if (state.per_set.size() <= setIndex) return true;
+        const auto &per_set = state.per_set[setIndex];
+        if (!per_set.bound_descriptor_set || (per_set.validated_set != per_set.bound_descriptor_set) ||
+            (per_set.validated_set_change_count != per_set.bound_descriptor_set->GetChangeCount()) ||
+            (check_image_layouts && (per_set.validated_set_image_layout_change_count != cb_node->image_layout_change_count))) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // Validate overall state at the time of a draw call
 bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TYPE cmd_type, const bool indexed,
                                          const VkPipelineBindPoint bind_point, const char *function) const {
     const DrawDispatchVuid vuid = GetDrawDispatchVuid(cmd_type);
+    cb_node->draw_validated_mask = CBDIRTY_NONE;
     const auto last_bound_it = cb_node->lastBound.find(bind_point);
     const PIPELINE_STATE *pPipe = nullptr;
     if (last_bound_it != cb_node->lastBound.cend()) {
@@ -1026,6 +1072,18 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
     auto const &state = last_bound_it->second;
     std::vector<VkImageView> attachment_views;
 
+    // Only rerun the check groups reading state that changed since the last draw recorded on this bind point. A recorded draw
+    // passed validation, so its checks can only fail again once one of their inputs changes. Descriptor set contents and image
+    // layouts are versioned rather than tracked by a dirty bit.
+    const CBDrawDirtyFlags dirty =
+        state.draw_dirty_mask | ((VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) ? cb_node->draw_dirty_mask : CBDIRTY_NONE);
+    const bool validate_descriptors = (dirty & (CBDIRTY_PIPELINE | CBDIRTY_DESCRIPTOR_SETS | CBDIRTY_SUBPASS)) ||
+                                      DescriptorSetsChangedSinceLastDraw(cb_node, state, pPipe, !disabled[image_layout_validation]);
+    // The groups UpdateDrawState may mark clean once the draw is recorded. Any message logged by a check group keeps the groups
+    // it reads dirty, even if the callback did not skip the call, so the next draw reports it again.
+    CBDrawDirtyFlags validated = CBDIRTY_ALL;
+    uint64_t logged_count = ThreadLoggedMsgCount();
+
     if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) {
         // First check flag states
         result |= ValidateDrawStateFlags(cb_node, pPipe, indexed, vuid.dynamic_state);
@@ -1034,7 +1092,8 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
         // Mismatch between fs and descriptor set is checked in createGraphicsPipeline
         if (cb_node->activeRenderPass && cb_node->activeFramebuffer) {
             const auto &subpass = cb_node->activeRenderPass->createInfo.pSubpasses[cb_node->activeSubpass];
-            if (subpass.inputAttachmentCount) {
+            logged_count = ThreadLoggedMsgCount();
+            if (subpass.inputAttachmentCount && (dirty & (CBDIRTY_PIPELINE | CBDIRTY_SUBPASS))) {
                 for (const auto &stage : pPipe->stage_state) {
                     if (stage.stage_flag == VK_SHADER_STAGE_FRAGMENT_BIT) {
                         std::vector<bool> subpass_input_in_fs(subpass.inputAttachmentCount, false);
@@ -1072,9 +1131,30 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
                     }
                 }
             }
-            attachment_views = cb_node->activeFramebuffer->GetUsedAttachments(subpass, cb_node->imagelessFramebufferAttachments);
+            if (ThreadLoggedMsgCount() != logged_count) validated &= ~(CBDIRTY_PIPELINE | CBDIRTY_SUBPASS);
+            if (validate_descriptors) {
+                attachment_views =
+                    cb_node->activeFramebuffer->GetUsedAttachments(subpass, cb_node->imagelessFramebufferAttachments);
+            }
         }
     }
+    // Check general pipeline state that needs to be validated at drawtime
+    if ((VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) &&
+        (dirty & (CBDIRTY_PIPELINE | CBDIRTY_DYNAMIC_STATE | CBDIRTY_VERTEX_BUFFERS | CBDIRTY_SUBPASS))) {
+        logged_count = ThreadLoggedMsgCount();
+        result |= ValidatePipelineDrawtimeState(state, cb_node, cmd_type, pPipe, function);
+        if (ThreadLoggedMsgCount() != logged_count) {
+            validated &= ~(CBDIRTY_PIPELINE | CBDIRTY_DYNAMIC_STATE | CBDIRTY_VERTEX_BUFFERS | CBDIRTY_SUBPASS);
+        }
+    }
+
+    // The remaining checks all read the bound descriptor sets
+    if (!validate_descriptors) {
+        cb_node->draw_validated_mask = validated;
+        return result;
+    }
+    logged_count = ThreadLoggedMsgCount();
+
     // Now complete other state checks
     string errorString;
     auto const &pipeline_layout = pPipe->pipeline_layout.get();
@@ -1159,10 +1239,8 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
         }
     }
 
-    // Check general pipeline state that needs to be validated at drawtime
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point)
-        result |= ValidatePipelineDrawtimeState(state, cb_node, cmd_type, pPipe, function);
-
+    if (ThreadLoggedMsgCount() != logged_count) validated &= ~(CBDIRTY_PIPELINE | CBDIRTY_DESCRIPTOR_SETS | CBDIRTY_SUBPASS);
+    cb_node->draw_validated_mask = validated;
     return result;
 }
 
@@ -2706,6 +2784,73 @@ bool CoreChecks::ValidateMaxTimelineSemaphoreValueDifference(VkSemaphore semapho
     return skip;
 }
 
+// Whether the global layouts of every image the command buffer references are unchanged since the cached validation
+bool CoreChecks::CmdBufImageLayoutsUnchanged(const CMD_BUFFER_STATE *cb_node,
+                                             const CMD_BUFFER_STATE::SubmitValidationCache &cache) const {
+    if (cache.image_layout_change_counts.size() != cb_node->image_layout_map.size()) return false;
+    auto cached = cache.image_layout_change_counts.cbegin();
+    for (const auto &layout_map_entry : cb_node->image_layout_map) {
+        const auto *image_state = GetImageStateFromLayoutSlot(layout_map_entry.slot, layout_map_entry.image);
+        if ((image_state != cached->first) || (image_state && (image_state->global_layout_change_count != cached->second))) {
+            return false;
+        }
+        ++cached;
+    }
+    return true;
+}
+
+void CoreChecks::RecordCmdBufImageLayoutChangeCounts(const CMD_BUFFER_STATE *cb_node,
+                                                     CMD_BUFFER_STATE::SubmitValidationCache *cache) const {
+    cache->image_layout_change_counts.clear();
+    for (const auto &layout_map_entry : cb_node->image_layout_map) {
+        const auto *image_state = GetImageStateFromLayoutSlot(layout_map_entry.slot, layout_map_entry.image);
+        cache->image_layout_change_counts.emplace_back(image_state, image_state ? image_state->global_layout_change_count : 0);
+    }
+}
+
+// Validate the update after bind descriptor sets used by the command buffer, unless they are unchanged since last validated clean
+bool CoreChecks::ValidateSubmitDescriptorSets(const CMD_BUFFER_STATE *cb_node,
+                                              CMD_BUFFER_STATE::SubmitValidationCache *cache) const {
+    const auto &descriptor_sets = cb_node->validate_descriptorsets_in_queuesubmit;
+    if (cache->descriptor_sets_clean && (cache->descriptor_set_change_counts.size() == descriptor_sets.size())) {
+        bool unchanged = true;
+        auto cached = cache->descriptor_set_change_counts.cbegin();
+        for (const auto &descriptor_set : descriptor_sets) {
+            const cvdescriptorset::DescriptorSet *set_node = GetSetNode(descriptor_set.first);
+            if ((set_node != cached->first) || (set_node && (set_node->GetChangeCount() != cached->second))) {
+                unchanged = false;
+                break;
+            }
+            ++cached;
+        }
+        if (unchanged) return false;
+    }
+
+    bool skip = false;
+    const uint64_t logged_count = ThreadLoggedMsgCount();
+    cache->descriptor_set_change_counts.clear();
+    for (const auto &descriptorSet : descriptor_sets) {
+        const cvdescriptorset::DescriptorSet *set_node = GetSetNode(descriptorSet.first);
+        cache->descriptor_set_change_counts.emplace_back(set_node, set_node ? set_node->GetChangeCount() : 0);
+        if (set_node) {
+            for (const auto &cmd_info : descriptorSet.second) {
+                std::string function = "vkQueueSubmit(), ";
+                function += cmd_info.function;
+                for (const auto &binding : cmd_info.binding_infos) {
+                    std::vector<uint32_t> dynamicOffsets;
+                    // dynamic data isn't allowed in UPDATE_AFTER_BIND, so dynamicOffsets is always empty.
+                    skip |= ValidateDescriptorSetBindingData(cb_node, set_node, dynamicOffsets, binding.binding,
+                                                             binding.requirements, cmd_info.framebuffer, cmd_info.attachment_views,
+                                                             function.c_str(), GetDrawDispatchVuid(cmd_info.cmd_type));
+                }
+            }
+        }
+    }
+    // A message the callback did not skip still has to be reported by the next submit
+    cache->descriptor_sets_clean = !skip && (ThreadLoggedMsgCount() == logged_count);
+    return skip;
+}
+
 bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo *submit,
                                                  GlobalImageLayoutMap *overlayImageLayoutMap_arg,
                                                  QueryMap *local_query_to_state_map,
@@ -2726,46 +2871,62 @@ bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitIn
     for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
         const auto *cb_node = GetCBState(submit->pCommandBuffers[i]);
         if (cb_node) {
-            skip |= ValidateCmdBufImageLayouts(cb_node, imageLayoutMap, &overlayLayoutMap);
+            // The checks of the recorded contents are skipped if they were clean when last run and nothing they depend on has
+            // changed since, which is the common case for command buffers recorded once and submitted every frame. A check is
+            // only clean if it logged nothing, as the callback may have reported an error without skipping the call.
+            std::lock_guard<std::mutex> cache_lock(cb_node->submit_validation_cache_lock);
+            auto &cache = cb_node->submit_validation_cache;
+
+            const bool overlay_used = OverlayHasCmdBufImageLayouts(cb_node, overlayLayoutMap);
+            const bool layouts_validated =
+                cache.image_layouts_clean && !overlay_used && CmdBufImageLayoutsUnchanged(cb_node, cache);
+            uint64_t logged_count = ThreadLoggedMsgCount();
+            const bool layout_skip = ValidateCmdBufImageLayouts(cb_node, imageLayoutMap, &overlayLayoutMap, layouts_validated);
+            if (!layouts_validated) {
+                // Only results validated against the global layouts alone can be reused
+                cache.image_layouts_clean = !layout_skip && !overlay_used && (ThreadLoggedMsgCount() == logged_count);
+                RecordCmdBufImageLayoutChangeCounts(cb_node, &cache);
+            }
+            skip |= layout_skip;
+
             current_cmds.push_back(submit->pCommandBuffers[i]);
             skip |= ValidatePrimaryCommandBufferState(
                 cb_node, (int)std::count(current_cmds.begin(), current_cmds.end(), submit->pCommandBuffers[i]),
                 &qfo_image_scoreboards, &qfo_buffer_scoreboards);
-            skip |= ValidateQueueFamilyIndices(cb_node, queue);
-
-            for (auto descriptorSet : cb_node->validate_descriptorsets_in_queuesubmit) {
-                const cvdescriptorset::DescriptorSet *set_node = GetSetNode(descriptorSet.first);
-                if (set_node) {
-                    for (auto cmd_info : descriptorSet.second) {
-                        std::string function = "vkQueueSubmit(), ";
-                        function += cmd_info.function;
-                        for (auto binding : cmd_info.binding_infos) {
-                            std::string error;
-                            std::vector<uint32_t> dynamicOffsets;
-                            // dynamic data isn't allowed in UPDATE_AFTER_BIND, so dynamicOffsets is always empty.
-                            skip |= ValidateDescriptorSetBindingData(
-                                cb_node, set_node, dynamicOffsets, binding.binding, binding.requirements, cmd_info.framebuffer,
-                                cmd_info.attachment_views, function.c_str(), GetDrawDispatchVuid(cmd_info.cmd_type));
-                        }
-                    }
-                }
+
+            const uint32_t queue_family_index = queue_state ? queue_state->queueFamilyIndex : 0;
+            if (!cache.queue_family_clean || (cache.queue_family_index != queue_family_index)) {
+                logged_count = ThreadLoggedMsgCount();
+                const bool queue_family_skip = ValidateQueueFamilyIndices(cb_node, queue);
+                cache.queue_family_clean = !queue_family_skip && (ThreadLoggedMsgCount() == logged_count);
+                cache.queue_family_index = queue_family_index;
+                skip |= queue_family_skip;
             }
 
+            skip |= ValidateSubmitDescriptorSets(cb_node, &cache);
+
             // Potential early exit here as bad object state may crash in delayed function calls
             if (skip) {
                 return true;
             }
 
-            // Call submit-time functions to validate or update local mirrors of state (to preserve const-ness at validate time)
-            for (auto &function : cb_node->queue_submit_functions) {
-                skip |= function(this, queue_state);
+            // Replay the submit-time operations to validate or update local mirrors of state (to preserve const-ness at validate
+            // time)
+            for (const auto &check : cb_node->submit_time_barrier_checks) {
+                skip |= ValidateConcurrentBarrierAtSubmit(this, queue_state, check.func_name, check.cb_state, check.typed_handle,
+                                                          check.src_queue_family, check.dst_queue_family);
             }
-            for (auto &function : cb_node->eventUpdates) {
-                skip |= function(this, /*do_validate*/ true, &localEventToStageMap);
+            for (const auto &update : cb_node->eventUpdates) {
+                if (update.type == EventUpdate::kValidateWait) {
+                    skip |= ValidateEventStageMask(this, cb_node, update.event_count, update.first_event_index, update.stage_mask,
+                                                   &localEventToStageMap);
+                } else {
+                    ApplyEventUpdate(update, &localEventToStageMap);
+                }
             }
             VkQueryPool first_perf_query_pool = VK_NULL_HANDLE;
-            for (auto &function : cb_node->queryUpdates) {
-                skip |= function(this, /*do_validate*/ true, first_perf_query_pool, perf_pass, local_query_to_state_map);
+            for (const auto &update : cb_node->queryUpdates) {
+                skip |= ValidateQueryUpdate(this, update, first_perf_query_pool, perf_pass, local_query_to_state_map);
             }
         }
     }
@@ -7399,14 +7560,7 @@ void CoreChecks::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint3
                                              imageMemoryBarrierCount, pImageMemoryBarriers);
     auto event_added_count = cb_state->events.size() - first_event_index;
 
-    const CMD_BUFFER_STATE *cb_state_const = cb_state;
-    cb_state->eventUpdates.emplace_back(
-        [cb_state_const, event_added_count, first_event_index, sourceStageMask](
-            const ValidationStateTracker *device_data, bool do_validate, EventToStageMap *localEventToStageMap) {
-            if (!do_validate) return false;
-            return ValidateEventStageMask(device_data, cb_state_const, event_added_count, first_event_index, sourceStageMask,
-                                          localEventToStageMap);
-        });
+    cb_state->eventUpdates.emplace_back(EventUpdate::ValidateWait(first_event_index, event_added_count, sourceStageMask));
     TransitionImageLayouts(cb_state, imageMemoryBarrierCount, pImageMemoryBarriers);
 }
 
@@ -7692,17 +7846,7 @@ void CoreChecks::EnqueueVerifyBeginQuery(VkCommandBuffer command_buffer, const Q
     CMD_BUFFER_STATE *cb_state = GetCBState(command_buffer);
 
     // Enqueue the submit time validation here, ahead of the submit time state update in the StateTracker's PostCallRecord
-    cb_state->queryUpdates.emplace_back([command_buffer, query_obj, func_name](const ValidationStateTracker *device_data,
-                                                                               bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                                                               uint32_t perfPass, QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        bool skip = false;
-        skip |= ValidatePerformanceQuery(device_data, command_buffer, query_obj, func_name, firstPerfQueryPool, perfPass,
-                                         localQueryToStateMap);
-        skip |= VerifyQueryIsReset(device_data, command_buffer, query_obj, func_name, firstPerfQueryPool, perfPass,
-                                   localQueryToStateMap);
-        return skip;
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kVerifyBegin, command_buffer, query_obj, func_name));
 }
 
 void CoreChecks::PreCallRecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot, VkFlags flags) {
@@ -7715,23 +7859,52 @@ void CoreChecks::EnqueueVerifyEndQuery(VkCommandBuffer command_buffer, const Que
     CMD_BUFFER_STATE *cb_state = GetCBState(command_buffer);
 
     // Enqueue the submit time validation here, ahead of the submit time state update in the StateTracker's PostCallRecord
-    cb_state->queryUpdates.emplace_back([command_buffer, query_obj](const ValidationStateTracker *device_data, bool do_validate,
-                                                                    VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                                    QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        bool skip = false;
-        const CMD_BUFFER_STATE *cb_state = device_data->GetCBState(command_buffer);
-        const auto *query_pool_state = device_data->GetQueryPoolState(query_obj.pool);
-        if (query_pool_state->has_perf_scope_command_buffer && (cb_state->commandCount - 1) != query_obj.endCommandIndex) {
-            skip |= device_data->LogError(command_buffer, "VUID-vkCmdEndQuery-queryPool-03227",
-                                          "vkCmdEndQuery: Query pool %s was created with a counter of scope"
-                                          "VK_QUERY_SCOPE_COMMAND_BUFFER_KHR but the end of the query is not the last "
-                                          "command in the command buffer %s.",
-                                          device_data->report_data->FormatHandle(query_obj.pool).c_str(),
-                                          device_data->report_data->FormatHandle(command_buffer).c_str());
-        }
-        return skip;
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kVerifyEnd, command_buffer, query_obj, nullptr));
+}
+
+bool CoreChecks::VerifyEndQueryScope(const ValidationStateTracker *state_data, VkCommandBuffer command_buffer,
+                                     const QueryObject &query_obj) {
+    bool skip = false;
+    const CMD_BUFFER_STATE *cb_state = state_data->GetCBState(command_buffer);
+    const auto *query_pool_state = state_data->GetQueryPoolState(query_obj.pool);
+    if (query_pool_state->has_perf_scope_command_buffer && (cb_state->commandCount - 1) != query_obj.endCommandIndex) {
+        skip |= state_data->LogError(command_buffer, "VUID-vkCmdEndQuery-queryPool-03227",
+                                     "vkCmdEndQuery: Query pool %s was created with a counter of scope"
+                                     "VK_QUERY_SCOPE_COMMAND_BUFFER_KHR but the end of the query is not the last "
+                                     "command in the command buffer %s.",
+                                     state_data->report_data->FormatHandle(query_obj.pool).c_str(),
+                                     state_data->report_data->FormatHandle(command_buffer).c_str());
+    }
+    return skip;
+}
+
+// Validate, or apply the state update of, one deferred query operation at submit time
+bool CoreChecks::ValidateQueryUpdate(const ValidationStateTracker *state_data, const QueryUpdate &update,
+                                     VkQueryPool &firstPerfQueryPool, uint32_t perfPass, QueryMap *localQueryToStateMap) {
+    bool skip = false;
+    switch (update.type) {
+        case QueryUpdate::kVerifyBegin:
+            skip |= ValidatePerformanceQuery(state_data, update.command_buffer, update.query, update.func_name, firstPerfQueryPool,
+                                             perfPass, localQueryToStateMap);
+            skip |= VerifyQueryIsReset(state_data, update.command_buffer, update.query, update.func_name, firstPerfQueryPool,
+                                       perfPass, localQueryToStateMap);
+            break;
+        case QueryUpdate::kVerifyEnd:
+            skip |= VerifyEndQueryScope(state_data, update.command_buffer, update.query);
+            break;
+        case QueryUpdate::kVerifyReset:
+            skip |= VerifyQueryIsReset(state_data, update.command_buffer, update.query, update.func_name, firstPerfQueryPool,
+                                       perfPass, localQueryToStateMap);
+            break;
+        case QueryUpdate::kValidateCopyResults:
+            skip |= ValidateCopyQueryPoolResults(state_data, update.command_buffer, update.query.pool, update.query.query,
+                                                 update.query_count, perfPass, update.flags, localQueryToStateMap);
+            break;
+        default:
+            ApplyQueryUpdate(update, perfPass, localQueryToStateMap);
+            break;
+    }
+    return skip;
 }
 
 bool CoreChecks::ValidateCmdEndQuery(const CMD_BUFFER_STATE *cb_state, const QueryObject &query_obj, CMD_TYPE cmd,
@@ -7943,13 +8116,7 @@ void CoreChecks::PreCallRecordCmdCopyQueryPoolResults(VkCommandBuffer commandBuf
                                                       VkDeviceSize stride, VkQueryResultFlags flags) {
     if (disabled[query_validation]) return;
     auto cb_state = GetCBState(commandBuffer);
-    cb_state->queryUpdates.emplace_back([commandBuffer, queryPool, firstQuery, queryCount, flags](
-                                            const ValidationStateTracker *device_data, bool do_validate,
-                                            VkQueryPool &firstPerfQueryPool, uint32_t perfPass, QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return ValidateCopyQueryPoolResults(device_data, commandBuffer, queryPool, firstQuery, queryCount, perfPass, flags,
-                                            localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::ValidateCopyResults(commandBuffer, queryPool, firstQuery, queryCount, flags));
 }
 
 bool CoreChecks::PreCallValidateCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
@@ -8034,13 +8201,8 @@ void CoreChecks::PreCallRecordCmdWriteTimestamp(VkCommandBuffer commandBuffer, V
     // Enqueue the submit time validation check here, before the submit time state update in StateTracker::PostCall...
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     QueryObject query = {queryPool, slot};
-    const char *func_name = "vkCmdWriteTimestamp()";
-    cb_state->queryUpdates.emplace_back([commandBuffer, query, func_name](const ValidationStateTracker *device_data,
-                                                                          bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                                                          uint32_t perfPass, QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return VerifyQueryIsReset(device_data, commandBuffer, query, func_name, firstPerfQueryPool, perfPass, localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(
+        QueryUpdate::Verify(QueryUpdate::kVerifyReset, commandBuffer, query, "vkCmdWriteTimestamp()"));
 }
 
 bool CoreChecks::MatchUsage(uint32_t count, const VkAttachmentReference2KHR *attachments, const VkFramebufferCreateInfo *fbci,
@@ -10501,15 +10663,15 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
         // initial layout usage of secondary command buffers resources must match parent command buffer
         const auto *const_cb_state = static_cast<const CMD_BUFFER_STATE *>(cb_state);
         for (const auto &sub_layout_map_entry : sub_cb_state->image_layout_map) {
-            const auto image = sub_layout_map_entry.first;
-            const auto *image_state = GetImageState(image);
+            const auto image = sub_layout_map_entry.image;
+            const auto *image_state = GetImageStateFromLayoutSlot(sub_layout_map_entry.slot, image);
             if (!image_state) continue;  // Can't set layouts of a dead image
 
-            const auto *cb_subres_map = GetImageSubresourceLayoutMap(const_cb_state, image);
+            const auto *cb_subres_map = GetImageSubresourceLayoutMap(const_cb_state, *image_state);
             // Const getter can be null in which case we have nothing to check against for this image...
             if (!cb_subres_map) continue;
 
-            const auto &sub_cb_subres_map = sub_layout_map_entry.second;
+            const auto &sub_cb_subres_map = sub_layout_map_entry.layout_map;
             // Validate the initial_uses, that they match the current state of the primary cb, or absent a current state,
             // that the match any initial_layout.
             for (const auto &subres_layout : *sub_cb_subres_map) {
@@ -11876,6 +12038,7 @@ void CoreChecks::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchai
         for (; new_swapchain_image_index < *pSwapchainImageCount; ++new_swapchain_image_index) {
             auto image_state = Get<IMAGE_STATE>(pSwapchainImages[new_swapchain_image_index]);
             AddInitialLayoutintoImageLayoutMap(*image_state, imageLayoutMap);
+            image_state->global_layout_change_count = ++image_layout_map_change_count;
         }
     }
 }
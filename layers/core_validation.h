@@ -82,6 +82,11 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<VkImageMemoryBarrier> qfo_release_image_barrier_map;
     GlobalQFOTransferBarrierMap<VkBufferMemoryBarrier> qfo_release_buffer_barrier_map;
     GlobalImageLayoutMap imageLayoutMap;
+    // Sequence stamped into IMAGE_STATE::global_layout_change_count on every change to an image's entry in imageLayoutMap, to key
+    // the cached submit time image layout validation
+    uint64_t image_layout_map_change_count = 0;
+    // Validates large vkUpdateDescriptorSets batches in parallel, when VALIDATION_CHECK_ENABLE_PARALLEL_DESCRIPTOR_UPDATES is set
+    std::unique_ptr<ValidationWorkerPool> descriptor_update_workers;
 
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
@@ -234,6 +239,10 @@ class CoreChecks : public ValidationStateTracker {
     static bool ValidatePerformanceQuery(const ValidationStateTracker* state_data, VkCommandBuffer commandBuffer,
                                          QueryObject query_obj, const char* func_name, VkQueryPool& firstPerfQueryPool,
                                          uint32_t perfPass, QueryMap* localQueryToStateMap);
+    static bool VerifyEndQueryScope(const ValidationStateTracker* state_data, VkCommandBuffer command_buffer,
+                                    const QueryObject& query_obj);
+    static bool ValidateQueryUpdate(const ValidationStateTracker* state_data, const QueryUpdate& update,
+                                    VkQueryPool& firstPerfQueryPool, uint32_t perfPass, QueryMap* localQueryToStateMap);
     bool ValidateImportSemaphore(VkSemaphore semaphore, const char* caller_name) const;
     bool ValidateBeginQuery(const CMD_BUFFER_STATE* cb_state, const QueryObject& query_obj, VkFlags flags, CMD_TYPE cmd,
                             const char* cmd_name, const ValidateBeginQueryVuids* vuids) const;
@@ -410,6 +419,8 @@ class CoreChecks : public ValidationStateTracker {
                                         const cvdescriptorset::AllocateDescriptorSetsData*) const;
     bool ValidateUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet* p_wds, uint32_t copy_count,
                                       const VkCopyDescriptorSet* p_cds, const char* func_name) const;
+    bool ValidateDescriptorSetWrite(const VkWriteDescriptorSet* p_wd, const char* func_name) const;
+    bool ValidateDescriptorSetCopy(const VkCopyDescriptorSet* p_cd, const char* func_name) const;
 
     // Stuff from shader_validation
     bool ValidateGraphicsPipelineShaderState(const PIPELINE_STATE* pPipeline) const;
@@ -619,7 +630,11 @@ class CoreChecks : public ValidationStateTracker {
                                    VkFilter filter);
 
     bool ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE* pCB, const GlobalImageLayoutMap& globalImageLayoutMap,
-                                    GlobalImageLayoutMap* overlayLayoutMap_arg) const;
+                                    GlobalImageLayoutMap* overlayLayoutMap_arg, bool layouts_validated = false) const;
+    bool OverlayHasCmdBufImageLayouts(const CMD_BUFFER_STATE* pCB, const GlobalImageLayoutMap& overlayLayoutMap) const;
+    bool ValidateSubmitDescriptorSets(const CMD_BUFFER_STATE* cb_node, CMD_BUFFER_STATE::SubmitValidationCache* cache) const;
+    bool CmdBufImageLayoutsUnchanged(const CMD_BUFFER_STATE* cb_node, const CMD_BUFFER_STATE::SubmitValidationCache& cache) const;
+    void RecordCmdBufImageLayoutChangeCounts(const CMD_BUFFER_STATE* cb_node, CMD_BUFFER_STATE::SubmitValidationCache* cache) const;
 
     void UpdateCmdBufImageLayouts(CMD_BUFFER_STATE* pCB);
 
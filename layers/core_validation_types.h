@@ -66,8 +66,13 @@ class DescriptorSet;
 // Only CoreChecks uses this, but the state tracker stores it.
 constexpr static auto kInvalidLayout = image_layout_map::kInvalidLayout;
 using ImageSubresourceLayoutMap = image_layout_map::ImageSubresourceLayoutMap;
+// IMAGE_STATE::layout_slot of an image not (yet) tracked by the state tracker
+constexpr static uint32_t kNoImageLayoutSlot = ~0U;
 
 struct CMD_BUFFER_STATE;
+class FENCE_STATE;
+class SEMAPHORE_STATE;
+class QUEUE_STATE;
 class CoreChecks;
 class ValidationStateTracker;
 
@@ -414,6 +419,8 @@ class IMAGE_STATE : public BINDABLE {
     VkSwapchainKHR create_from_swapchain;
     VkSwapchainKHR bind_swapchain;
     uint32_t bind_swapchain_imageIndex;
+    uint32_t layout_slot;  // Dense per-device index, recycled on destruction, keying the command buffer image layout tables
+    uint64_t global_layout_change_count = 0;  // Core validation's stamp of the last change to the image's global layouts
     image_layout_map::Encoder range_encoder;
     VkFormatFeatureFlags format_features = 0;
     // Need to memory requirments for each plane if image is disjoint
@@ -659,6 +666,21 @@ enum CBStatusFlagBits {
     // clang-format on
 };
 
+// CB draw dirty bits -- groups of state that changed since the last draw recorded (i.e. validated without error) on a bind point.
+// ValidateCmdBufDrawState only reruns the draw time checks that read a dirty group.
+typedef VkFlags CBDrawDirtyFlags;
+enum CBDrawDirtyFlagBits {
+    // clang-format off
+    CBDIRTY_NONE                             = 0x00000000,
+    CBDIRTY_PIPELINE                         = 0x00000001,   // Pipeline bound
+    CBDIRTY_DESCRIPTOR_SETS                  = 0x00000002,   // Descriptor sets bound or pushed
+    CBDIRTY_DYNAMIC_STATE                    = 0x00000004,   // Any vkCmdSet* dynamic state
+    CBDIRTY_VERTEX_BUFFERS                   = 0x00000008,   // Vertex buffers bound
+    CBDIRTY_SUBPASS                          = 0x00000010,   // Render pass, framebuffer or subpass changed
+    CBDIRTY_ALL                              = 0x0000001F,
+    // clang-format on
+};
+
 struct QueryObject {
     VkQueryPool pool;
     uint32_t query;
@@ -1005,12 +1027,15 @@ struct LAST_BOUND_STATE {
     };
 
     std::vector<PER_SET> per_set;
+    // Pipeline and descriptor set groups changed since the last draw/dispatch on this bind point (see CBDrawDirtyFlagBits)
+    CBDrawDirtyFlags draw_dirty_mask;
 
     void reset() {
         pipeline_state = nullptr;
         pipeline_layout = VK_NULL_HANDLE;
         push_descriptor_set = nullptr;
         per_set.clear();
+        draw_dirty_mask = CBDIRTY_ALL;
     }
 
     void UnbindAndResetPushDescriptorSet(cvdescriptorset::DescriptorSet *ds) {
@@ -1169,12 +1194,135 @@ typedef std::map<QueryObject, QueryState> QueryMap;
 typedef std::unordered_map<VkEvent, VkPipelineStageFlags> EventToStageMap;
 typedef ImageSubresourceLayoutMap::LayoutMap GlobalImageLayoutRangeMap;
 typedef std::unordered_map<VkImage, std::unique_ptr<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
-typedef std::unordered_map<VkImage, std::unique_ptr<ImageSubresourceLayoutMap>> CommandBufferImageLayoutMap;
+
+// The image layout maps of a command buffer. Entries are kept contiguously in order of first reference and are found through
+// the per-device IMAGE_STATE::layout_slot, s.t. the record time lookups are an array index rather than a hash, and the submit
+// time validation and merge are a linear walk. The slot index only grows to the largest slot referenced, and clear() resets only
+// the slots in use, s.t. a re-recorded command buffer reuses both allocations.
+class CommandBufferImageLayoutMap {
+  public:
+    struct Entry {
+        VkImage image;
+        uint32_t slot;
+        std::unique_ptr<ImageSubresourceLayoutMap> layout_map;
+        Entry(VkImage image_, uint32_t slot_, std::unique_ptr<ImageSubresourceLayoutMap> &&layout_map_)
+            : image(image_), slot(slot_), layout_map(std::move(layout_map_)) {}
+    };
+    using Entries = std::vector<Entry>;
+
+    const ImageSubresourceLayoutMap *Find(const IMAGE_STATE &image_state) const {
+        const uint32_t index = EntryIndex(image_state);
+        return (index != kNoEntry) ? entries_[index].layout_map.get() : nullptr;
+    }
+    ImageSubresourceLayoutMap *FindOrCreate(const IMAGE_STATE &image_state);
+    void clear();
+
+    bool empty() const { return entries_.empty(); }
+    size_t size() const { return entries_.size(); }
+    Entries::const_iterator begin() const { return entries_.cbegin(); }
+    Entries::const_iterator end() const { return entries_.cend(); }
+
+  private:
+    static const uint32_t kNoEntry = ~0U;
+    uint32_t EntryIndex(const IMAGE_STATE &image_state) const;
+
+    Entries entries_;
+    std::vector<uint32_t> slot_entries_;  // Indexed by IMAGE_STATE::layout_slot
+};
+
+// The event and query operations of a command buffer that can only be applied (or validated) at queue submit time. They are
+// recorded in command order as plain tagged records (rather than as closures) s.t. recording doesn't allocate per command, and
+// submit time replay is a loop over contiguous memory. The StateTracker records the state updates, and CoreChecks the checks
+// that interleave with them.
+struct EventUpdate {
+    enum Type : uint8_t {
+        kSetStageMask,  // vkCmdSetEvent/vkCmdResetEvent, with stage_mask 0 for reset
+        kValidateWait,  // vkCmdWaitEvents, checking source_stage_mask against the events waited
+    };
+    Type type;
+    VkEvent event;
+    VkPipelineStageFlags stage_mask;  // stage mask set, or wait sourceStageMask
+    size_t first_event_index;         // kValidateWait range in CMD_BUFFER_STATE::events
+    size_t event_count;
+
+    static EventUpdate SetStageMask(VkEvent event_, VkPipelineStageFlags stage_mask_) {
+        return EventUpdate(kSetStageMask, event_, stage_mask_, 0, 0);
+    }
+    static EventUpdate ValidateWait(size_t first_event_index_, size_t event_count_, VkPipelineStageFlags source_stage_mask) {
+        return EventUpdate(kValidateWait, VK_NULL_HANDLE, source_stage_mask, first_event_index_, event_count_);
+    }
+
+  private:
+    EventUpdate(Type type_, VkEvent event_, VkPipelineStageFlags stage_mask_, size_t first_event_index_, size_t event_count_)
+        : type(type_), event(event_), stage_mask(stage_mask_), first_event_index(first_event_index_), event_count(event_count_) {}
+};
+
+struct QueryUpdate {
+    enum Type : uint8_t {
+        kSetState,             // query state update, for the query
+        kSetStateRange,        // query state update, for query_count queries from query
+        kVerifyBegin,          // vkCmdBeginQuery* performance query and reset checks
+        kVerifyEnd,            // vkCmdEndQuery* performance query scope check
+        kVerifyReset,          // vkCmdWriteTimestamp reset check
+        kValidateCopyResults,  // vkCmdCopyQueryPoolResults checks, for query_count queries from query
+    };
+    Type type;
+    QueryState state;  // state set by kSetState*
+    uint32_t query_count;
+    VkQueryResultFlags flags;
+    VkCommandBuffer command_buffer;  // command buffer recording the operation, for the checks (may be a secondary)
+    const char *func_name;
+    QueryObject query;
+
+    static QueryUpdate SetState(const QueryObject &query_, QueryState state_) {
+        return QueryUpdate(kSetState, query_, state_, 1, 0, VK_NULL_HANDLE, nullptr);
+    }
+    static QueryUpdate SetStateRange(VkQueryPool pool, uint32_t first_query, uint32_t query_count_, QueryState state_) {
+        return QueryUpdate(kSetStateRange, QueryObject(pool, first_query), state_, query_count_, 0, VK_NULL_HANDLE, nullptr);
+    }
+    static QueryUpdate Verify(Type type_, VkCommandBuffer command_buffer_, const QueryObject &query_, const char *func_name_) {
+        return QueryUpdate(type_, query_, QUERYSTATE_UNKNOWN, 1, 0, command_buffer_, func_name_);
+    }
+    static QueryUpdate ValidateCopyResults(VkCommandBuffer command_buffer_, VkQueryPool pool, uint32_t first_query,
+                                           uint32_t query_count_, VkQueryResultFlags flags_) {
+        return QueryUpdate(kValidateCopyResults, QueryObject(pool, first_query), QUERYSTATE_UNKNOWN, query_count_, flags_,
+                           command_buffer_, nullptr);
+    }
+
+  private:
+    QueryUpdate(Type type_, const QueryObject &query_, QueryState state_, uint32_t query_count_, VkQueryResultFlags flags_,
+                VkCommandBuffer command_buffer_, const char *func_name_)
+        : type(type_),
+          state(state_),
+          query_count(query_count_),
+          flags(flags_),
+          command_buffer(command_buffer_),
+          func_name(func_name_),
+          query(query_) {}
+};
+
+// Queue family ownership transfer barrier of an exclusive resource, checked against the queue family at submit time
+struct SubmitTimeBarrierCheck {
+    const char *func_name;
+    const CMD_BUFFER_STATE *cb_state;
+    VulkanTypedHandle typed_handle;
+    uint32_t src_queue_family;
+    uint32_t dst_queue_family;
+    SubmitTimeBarrierCheck(const char *func_name_, const CMD_BUFFER_STATE *cb_state_, const VulkanTypedHandle &typed_handle_,
+                           uint32_t src_queue_family_, uint32_t dst_queue_family_)
+        : func_name(func_name_),
+          cb_state(cb_state_),
+          typed_handle(typed_handle_),
+          src_queue_family(src_queue_family_),
+          dst_queue_family(dst_queue_family_) {}
+};
 
 class FRAMEBUFFER_STATE;
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
 struct CMD_BUFFER_STATE : public BASE_NODE {
     VkCommandBuffer commandBuffer;
+    // Held around vkCmd* hooks when fine grained locking is enabled
+    std::mutex recording_lock;
     VkCommandBufferAllocateInfo createInfo = {};
     VkCommandBufferBeginInfo beginInfo;
     VkCommandBufferInheritanceInfo inheritanceInfo;
@@ -1193,6 +1341,10 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     CBStatusFlags status;                              // Track status of various bindings on cmd buffer
     CBStatusFlags static_status;                       // All state bits provided by current graphics pipeline
                                                        // rather than dynamic state
+    CBDrawDirtyFlags draw_dirty_mask;                  // Graphics state groups changed since the last draw (see LAST_BOUND_STATE)
+    // The dirty groups whose checks logged nothing in the draw time validation of the command being recorded. Set by
+    // CoreChecks::ValidateCmdBufDrawState, and consumed by UpdateDrawState when the command is recorded.
+    mutable CBDrawDirtyFlags draw_validated_mask;
     // Currently storing "lastBound" objects on per-CB basis
     //  long-term may want to create caches of "lastBound" states and could have
     //  each individual CMD_NODE referencing its own "lastBound" state
@@ -1214,6 +1366,32 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     };
     std::unordered_map<VkDescriptorSet, std::vector<CmdDrawDispatchInfo>> validate_descriptorsets_in_queuesubmit;
 
+    // Clean (no error) results of the queue submit checks which depend only on the recorded commands and on state with change
+    // counts, s.t. resubmitting an unchanged command buffer can skip them. Cleared with the rest of the recorded state, and
+    // updated from the (const) submit time validation, under submit_validation_cache_lock.
+    struct SubmitValidationCache {
+        bool image_layouts_clean;
+        // Per image_layout_map entry, in iteration order: the image and the stamp of its global layouts validated against
+        std::vector<std::pair<const IMAGE_STATE *, uint64_t>> image_layout_change_counts;
+        bool queue_family_clean;
+        uint32_t queue_family_index;
+        bool descriptor_sets_clean;
+        // Per validate_descriptorsets_in_queuesubmit entry, in iteration order
+        std::vector<std::pair<const cvdescriptorset::DescriptorSet *, uint64_t>> descriptor_set_change_counts;
+
+        SubmitValidationCache() { Reset(); }
+        void Reset() {
+            image_layouts_clean = false;
+            image_layout_change_counts.clear();
+            queue_family_clean = false;
+            queue_family_index = 0;
+            descriptor_sets_clean = false;
+            descriptor_set_change_counts.clear();
+        }
+    };
+    mutable std::mutex submit_validation_cache_lock;
+    mutable SubmitValidationCache submit_validation_cache;
+
     uint32_t viewportMask;
     uint32_t viewportWithCountMask;
     uint32_t scissorMask;
@@ -1249,17 +1427,12 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     // If primary, the secondary command buffers we will call.
     // If secondary, the primary command buffers we will be called by.
     std::unordered_set<CMD_BUFFER_STATE *> linkedCommandBuffers;
-    // Validation functions run at primary CB queue submit time
-    std::vector<std::function<bool(const ValidationStateTracker *device_data, const class QUEUE_STATE *queue_state)>>
-        queue_submit_functions;
+    // Barrier checks run at primary CB queue submit time
+    std::vector<SubmitTimeBarrierCheck> submit_time_barrier_checks;
     // Validation functions run when secondary CB is executed in primary
     std::vector<std::function<bool(const CMD_BUFFER_STATE *, const FRAMEBUFFER_STATE *)>> cmd_execute_commands_functions;
-    std::vector<
-        std::function<bool(const ValidationStateTracker *device_data, bool do_validate, EventToStageMap *localEventToStageMap)>>
-        eventUpdates;
-    std::vector<std::function<bool(const ValidationStateTracker *device_data, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                   uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
-        queryUpdates;
+    std::vector<EventUpdate> eventUpdates;
+    std::vector<QueryUpdate> queryUpdates;
     std::unordered_set<cvdescriptorset::DescriptorSet *> validated_descriptor_sets;
     // Contents valid only after an index buffer is bound (CBSTATUS_INDEX_BUFFER_BOUND set)
     IndexBufferBinding index_buffer_binding;
@@ -1302,22 +1475,26 @@ struct SEMAPHORE_WAIT {
     VkQueue queue;
     uint64_t payload;
     uint64_t seq;
+    // Resolved at submit time so retiring the wait needs no map lookups
+    std::shared_ptr<SEMAPHORE_STATE> semaphore_state;
+    QUEUE_STATE *queue_state;
 };
 
 struct SEMAPHORE_SIGNAL {
     VkSemaphore semaphore;
     uint64_t payload;
     uint64_t seq;
+    std::shared_ptr<SEMAPHORE_STATE> semaphore_state;
 };
 
 struct CB_SUBMISSION {
-    CB_SUBMISSION(std::vector<VkCommandBuffer> const &cbs, std::vector<SEMAPHORE_WAIT> const &waitSemaphores,
-                  std::vector<SEMAPHORE_SIGNAL> const &signalSemaphores, std::vector<VkSemaphore> const &externalSemaphores,
+    CB_SUBMISSION(std::vector<VkCommandBuffer> &&cbs, std::vector<SEMAPHORE_WAIT> &&waitSemaphores,
+                  std::vector<SEMAPHORE_SIGNAL> &&signalSemaphores, std::vector<VkSemaphore> &&externalSemaphores,
                   VkFence fence, uint32_t perf_submit_pass)
-        : cbs(cbs),
-          waitSemaphores(waitSemaphores),
-          signalSemaphores(signalSemaphores),
-          externalSemaphores(externalSemaphores),
+        : cbs(std::move(cbs)),
+          waitSemaphores(std::move(waitSemaphores)),
+          signalSemaphores(std::move(signalSemaphores)),
+          externalSemaphores(std::move(externalSemaphores)),
           fence(fence),
           perf_submit_pass(perf_submit_pass) {}
 
@@ -1327,6 +1504,12 @@ struct CB_SUBMISSION {
     std::vector<VkSemaphore> externalSemaphores;
     VkFence fence;
     uint32_t perf_submit_pass;
+
+    // State objects for the handles above, captured when the submission is recorded. Holding references keeps
+    // RetireWorkOnQueue free of handle lookups, and still correct if a handle is destroyed (or reused) while in flight.
+    std::vector<std::shared_ptr<CMD_BUFFER_STATE>> cb_states;
+    std::vector<std::shared_ptr<SEMAPHORE_STATE>> external_semaphore_states;
+    std::shared_ptr<FENCE_STATE> fence_state;
 };
 
 struct MT_FB_ATTACHMENT_INFO {
@@ -1394,7 +1577,7 @@ enum BarrierOperationsType {
 };
 
 ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(CMD_BUFFER_STATE *cb_state, const IMAGE_STATE &image_state);
-const ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(const CMD_BUFFER_STATE *cb_state, VkImage image);
+const ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(const CMD_BUFFER_STATE *cb_state, const IMAGE_STATE &image_state);
 void AddInitialLayoutintoImageLayoutMap(const IMAGE_STATE &image_state, GlobalImageLayoutMap &image_layout_map);
 
 #endif  // CORE_VALIDATION_TYPES_H_
@@ -142,6 +142,8 @@ void DebugPrintf::ResetCommandBuffer(VkCommandBuffer commandBuffer) {
     if (aborted) {
         return;
     }
+    // Output of a deferred readback must be read before the buffers holding it are freed.
+    UtilProcessDeferredReadbacks(this, false, commandBuffer);
     auto debug_printf_buffer_list = GetBufferInfo(commandBuffer);
     for (auto buffer_info : debug_printf_buffer_list) {
         vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
@@ -277,6 +279,23 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
     using namespace spvtools;
     spv_target_env target_env = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
+
+    // Reuse the result of an earlier instrumentation of the same code if the cache has one. Otherwise instrument with a
+    // placeholder shader id that the cache can find and replace on later hits.
+    uint32_t shader_id = unique_shader_module_id;
+    uint64_t cache_key = 0;
+    if (instrumentation_cache.Enabled()) {
+        std::vector<uint32_t> cache_options = {static_cast<uint32_t>(container_type), static_cast<uint32_t>(target_env),
+                                               desc_set_bind_index};
+        UtilInstrumentationCache::AppendValidatorOptions(device_extensions, enabled_features, cache_options);
+        cache_key = instrumentation_cache.MakeKey(new_pgm, cache_options);
+        if (instrumentation_cache.Lookup(cache_key, unique_shader_module_id, new_pgm)) {
+            *unique_shader_id = unique_shader_module_id++;
+            return true;
+        }
+        shader_id = UtilInstrumentationCache::PickShaderIdPlaceholder(new_pgm);
+    }
+
     spvtools::ValidatorOptions options;
     AdjustValidatorOptions(device_extensions, enabled_features, options);
     Optimizer optimizer(target_env);
@@ -294,10 +313,12 @@ bool DebugPrintf::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
         }
     };
     optimizer.SetMessageConsumer(DebugPrintfConsoleMessageConsumer);
-    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, unique_shader_module_id));
+    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, shader_id));
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, options, false);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (instrumentation_cache.Enabled()) {
+        instrumentation_cache.Store(cache_key, shader_id, unique_shader_module_id, new_pgm);
     }
     *unique_shader_id = unique_shader_module_id++;
     return pass;
@@ -581,14 +602,25 @@ void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
 #pragma GCC diagnostic pop
 #endif
 
+// A simultaneous use command buffer may still have output waiting to be read back from a previous submission.
+void DebugPrintf::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        const VkSubmitInfo *submit = &pSubmits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+            UtilProcessDeferredReadbacks(this, false, submit->pCommandBuffers[i]);
+        }
+    }
+}
+
 // Issue a memory barrier to make GPU-written data available to host.
-// Wait for the queue to complete execution.
+// Wait for the queue to complete execution, or with deferred readback, for a fence signaled after it.
 // Check the debug buffers for all the command buffers that were submitted.
 void DebugPrintf::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                             VkResult result) {
     ValidationStateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
 
     if (aborted || (result != VK_SUCCESS)) return;
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
     bool buffers_present = false;
     // Don't QueueWaitIdle if there's nothing to process
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
@@ -603,20 +635,33 @@ void DebugPrintf::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     }
     if (!buffers_present) return;
 
-    UtilSubmitBarrier(queue, this);
+    UtilReadbackSubmission(queue, submitCount, pSubmits, this);
+}
 
-    DispatchQueueWaitIdle(queue);
+void DebugPrintf::ProcessInstrumentationBuffers(VkQueue queue, VkCommandBuffer command_buffer) {
+    UtilProcessInstrumentationBuffer(queue, command_buffer, this);
+}
 
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        const VkSubmitInfo *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            auto cb_node = GetCBState(submit->pCommandBuffers[i]);
-            UtilProcessInstrumentationBuffer(queue, cb_node, this);
-            for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
-                UtilProcessInstrumentationBuffer(queue, secondaryCmdBuffer, this);
-            }
-        }
-    }
+// Pick up deferred readbacks that have completed by the time the application waits on the device.
+void DebugPrintf::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                              uint64_t timeout, VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
+}
+
+void DebugPrintf::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    ValidationStateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
+}
+
+void DebugPrintf::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
+}
+
+void DebugPrintf::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    ValidationStateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
 }
 
 void DebugPrintf::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
@@ -91,6 +91,10 @@ class DebugPrintf : public ValidationStateTracker {
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     VmaAllocator vmaAllocator = {};
     std::map<VkQueue, UtilQueueBarrierCommandInfo> queue_barrier_command_infos;
+    bool deferred_readback = false;
+    std::map<VkQueue, std::deque<UtilDeferredReadback>> deferred_readbacks;
+    std::vector<VkFence> deferred_readback_fences;
+    UtilInstrumentationCache instrumentation_cache;
     std::vector<DPFBufferInfo>& GetBufferInfo(const VkCommandBuffer command_buffer) {
         auto buffer_list = command_buffer_map.find(command_buffer);
         if (buffer_list == command_buffer_map.end()) {
@@ -227,7 +231,14 @@ class DebugPrintf : public ValidationStateTracker {
                                                const VkStridedBufferRegionKHR* pHitShaderBindingTable,
                                                const VkStridedBufferRegionKHR* pCallableShaderBindingTable, VkBuffer buffer,
                                                VkDeviceSize offset);
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence);
     void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                    VkResult result);
+    void ProcessInstrumentationBuffers(VkQueue queue, VkCommandBuffer command_buffer);
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result);
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result);
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result);
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result);
     void AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point);
 };
@@ -584,6 +584,47 @@ void cvdescriptorset::AllocateDescriptorSetsData::Init(uint32_t count) {
     }
 }
 
+// Number of DescriptorBackingStore units taken by one descriptor of class T
+template <typename T>
+static constexpr size_t DescriptorStoreUnits() {
+    return (sizeof(T) + sizeof(cvdescriptorset::DescriptorBackingStore) - 1) / sizeof(cvdescriptorset::DescriptorBackingStore);
+}
+
+static size_t DescriptorStoreUnitsFromType(VkDescriptorType type) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            return DescriptorStoreUnits<cvdescriptorset::SamplerDescriptor>();
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            return DescriptorStoreUnits<cvdescriptorset::ImageSamplerDescriptor>();
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            return DescriptorStoreUnits<cvdescriptorset::ImageDescriptor>();
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return DescriptorStoreUnits<cvdescriptorset::TexelDescriptor>();
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return DescriptorStoreUnits<cvdescriptorset::BufferDescriptor>();
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            return DescriptorStoreUnits<cvdescriptorset::InlineUniformDescriptor>();
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            return DescriptorStoreUnits<cvdescriptorset::AccelerationStructureDescriptor>();
+        default:
+            return 0;
+    }
+}
+
+// Construct a T at the next free position in the backing store, and advance past it
+template <typename T, typename... Args>
+static T *PlaceDescriptor(cvdescriptorset::DescriptorBackingStore **free_descriptor, Args &&... args) {
+    T *descriptor = new (*free_descriptor) T(std::forward<Args>(args)...);
+    *free_descriptor += DescriptorStoreUnits<T>();
+    return descriptor;
+}
+
 cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIPTOR_POOL_STATE *pool_state,
                                               const std::shared_ptr<DescriptorSetLayout const> &layout, uint32_t variable_count,
                                               const cvdescriptorset::DescriptorSet::StateTracker *state_data)
@@ -591,12 +632,22 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
       set_(set),
       pool_state_(pool_state),
       p_layout_(layout),
+      binding_change_counts_(layout->GetBindingCount(), 0),
       state_data_(state_data),
       variable_count_(variable_count),
       change_count_(0) {
+    // Size the backing store by what each binding's descriptor class actually needs, and note where each binding starts in it
+    binding_stores_.resize(p_layout_->GetBindingCount());
+    uint32_t store_units = 0;
+    for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
+        auto &binding_store = binding_stores_[i];
+        binding_store.global_index_start = p_layout_->GetGlobalIndexRangeFromIndex(i).start;
+        binding_store.store_offset = store_units;
+        binding_store.store_units = static_cast<uint32_t>(DescriptorStoreUnitsFromType(p_layout_->GetTypeFromIndex(i)));
+        store_units += binding_store.store_units * p_layout_->GetDescriptorCountFromIndex(i);
+    }
     // Foreach binding, create default descriptors of given type
-    descriptors_.reserve(p_layout_->GetTotalDescriptorCount());
-    descriptor_store_.resize(p_layout_->GetTotalDescriptorCount());
+    descriptor_store_.resize(store_units);
     auto free_descriptor = descriptor_store_.data();
     for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
         auto type = p_layout_->GetTypeFromIndex(i);
@@ -605,11 +656,10 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
                 auto immut_sampler = p_layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut_sampler) {
-                        descriptors_.emplace_back(new ((free_descriptor++)->Sampler())
-                                                      SamplerDescriptor(state_data, immut_sampler + di));
+                        PlaceDescriptor<SamplerDescriptor>(&free_descriptor, state_data, immut_sampler + di);
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else
-                        descriptors_.emplace_back(new ((free_descriptor++)->Sampler()) SamplerDescriptor(state_data, nullptr));
+                        PlaceDescriptor<SamplerDescriptor>(&free_descriptor, state_data, nullptr);
                 }
                 break;
             }
@@ -617,12 +667,10 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
                 auto immut = p_layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut) {
-                        descriptors_.emplace_back(new ((free_descriptor++)->ImageSampler())
-                                                      ImageSamplerDescriptor(state_data, immut + di));
+                        PlaceDescriptor<ImageSamplerDescriptor>(&free_descriptor, state_data, immut + di);
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else
-                        descriptors_.emplace_back(new ((free_descriptor++)->ImageSampler())
-                                                      ImageSamplerDescriptor(state_data, nullptr));
+                        PlaceDescriptor<ImageSamplerDescriptor>(&free_descriptor, state_data, nullptr);
                 }
                 break;
             }
@@ -631,28 +679,27 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new ((free_descriptor++)->Image()) ImageDescriptor(type));
+                    PlaceDescriptor<ImageDescriptor>(&free_descriptor, type);
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new ((free_descriptor++)->Texel()) TexelDescriptor(type));
+                    PlaceDescriptor<TexelDescriptor>(&free_descriptor, type);
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new ((free_descriptor++)->Buffer()) BufferDescriptor(type));
+                    PlaceDescriptor<BufferDescriptor>(&free_descriptor, type);
                 break;
             case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new ((free_descriptor++)->InlineUniform()) InlineUniformDescriptor(type));
+                    PlaceDescriptor<InlineUniformDescriptor>(&free_descriptor, type);
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new ((free_descriptor++)->AccelerationStructure())
-                                                  AccelerationStructureDescriptor(type));
+                    PlaceDescriptor<AccelerationStructureDescriptor>(&free_descriptor, type);
                 break;
             default:
                 assert(0);  // Bad descriptor type specified
@@ -661,7 +708,25 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
     }
 }
 
-cvdescriptorset::DescriptorSet::~DescriptorSet() {}
+cvdescriptorset::DescriptorSet::~DescriptorSet() {
+    // The descriptors were placement new'd into descriptor_store_, so only their destructors need to run
+    for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
+        for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
+            GetDescriptorFromIndex(i, di)->Destroy();
+        }
+    }
+}
+
+const cvdescriptorset::Descriptor *cvdescriptorset::DescriptorSet::GetDescriptorFromGlobalIndex(const uint32_t index) const {
+    // Bindings are in global index order, so the one holding index is the last one starting at or before it. Empty bindings
+    // start where the following binding does, so they are never the last such binding.
+    auto binding_store = std::upper_bound(binding_stores_.cbegin(), binding_stores_.cend(), index,
+                                          [](uint32_t i, const BindingStore &store) { return i < store.global_index_start; });
+    assert(binding_store != binding_stores_.cbegin());
+    --binding_store;
+    return reinterpret_cast<const Descriptor *>(
+        &descriptor_store_[binding_store->store_offset + (index - binding_store->global_index_start) * binding_store->store_units]);
+}
 
 static std::string StringDescriptorReqViewType(descriptor_req req) {
     std::string result("");
@@ -1234,8 +1299,10 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *
         // Loop over the updates for a single binding at a time
         uint32_t update_count = std::min(descriptors_remaining, current_binding.GetDescriptorCount() - offset);
         for (uint32_t di = 0; di < update_count; ++di, ++update_index) {
-            descriptors_[global_idx + di]->WriteUpdate(state_data_, update, update_index);
+            GetDescriptorFromIndex(current_binding.GetIndex(), offset + di)->WriteUpdate(state_data_, update, update_index);
         }
+        // change_count_ is advanced once for the whole update, below
+        binding_change_counts_[current_binding.GetIndex()] = change_count_ + 1;
         // Roll over to next binding in case of consecutive update
         descriptors_remaining -= update_count;
         if (descriptors_remaining) {
@@ -1467,8 +1534,8 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
     auto dst_start_idx = p_layout_->GetGlobalIndexRangeFromBinding(update->dstBinding).start + update->dstArrayElement;
     // Update parameters all look good so perform update
     for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-        auto src = src_set->descriptors_[src_start_idx + di].get();
-        auto dst = descriptors_[dst_start_idx + di].get();
+        auto src = src_set->GetDescriptorFromGlobalIndex(src_start_idx + di);
+        auto dst = const_cast<Descriptor *>(GetDescriptorFromGlobalIndex(dst_start_idx + di));
         if (src->updated) {
             dst->CopyUpdate(state_data_, src);
             some_update_ = true;
@@ -1477,6 +1544,15 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
             dst->updated = false;
         }
     }
+    if (update->descriptorCount) {
+        // Mark every binding the copy rolled over into as changed, including descriptors that were reset to not updated
+        change_count_++;
+        const auto dst_end_idx = dst_start_idx + update->descriptorCount;
+        for (auto binding = DescriptorSetLayout::ConstBindingIterator(p_layout_.get(), update->dstBinding);
+             !binding.AtEnd() && (binding.GetGlobalIndexRange().start < dst_end_idx); ++binding) {
+            binding_change_counts_[binding.GetIndex()] = change_count_;
+        }
+    }
 
     if (!(p_layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT))) {
@@ -1531,9 +1607,8 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
             }
             continue;
         }
-        auto range = p_layout_->GetGlobalIndexRangeFromIndex(index);
-        for (uint32_t i = range.start; i < range.end; ++i) {
-            descriptors_[i]->UpdateDrawState(device_data, cb_node);
+        for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(index); ++di) {
+            GetDescriptorFromIndex(index, di)->UpdateDrawState(device_data, cb_node);
         }
     }
 
@@ -1549,16 +1624,9 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
     }
 }
 
-void cvdescriptorset::DescriptorSet::FilterOneBindingReq(const BindingReqMap::value_type &binding_req_pair, BindingReqMap *out_req,
-                                                         const TrackedBindings &bindings, uint32_t limit) {
-    if (bindings.size() < limit) {
-        const auto it = bindings.find(binding_req_pair.first);
-        if (it == bindings.cend()) out_req->emplace(binding_req_pair);
-    }
-}
-
 void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                                        const BindingReqMap &in_req, BindingReqMap *out_req) const {
+    std::lock_guard<std::mutex> lock(cached_validation_lock_);
     // For const cleanliness we have to find in the maps...
     const auto validated_it = cached_validation_.find(&cb_state);
     if (validated_it == cached_validation_.cend()) {
@@ -1577,40 +1645,35 @@ void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &c
     }
     const auto &dynamic_buffers = validated.dynamic_buffers;
     const auto &non_dynamic_buffers = validated.non_dynamic_buffers;
-    const auto &stats = p_layout_->GetBindingTypeStats();
     for (const auto &binding_req_pair : in_req) {
-        auto binding = binding_req_pair.first;
-        VkDescriptorSetLayoutBinding const *layout_binding = p_layout_->GetDescriptorSetLayoutBindingPtrFromBinding(binding);
+        const auto index = p_layout_->GetIndexFromBinding(binding_req_pair.first);
+        VkDescriptorSetLayoutBinding const *layout_binding = p_layout_->GetDescriptorSetLayoutBindingPtrFromIndex(index);
         if (!layout_binding) {
             continue;
         }
-        // Caching criteria differs per type.
+        // Caching criteria differs per type, but any binding written since it was last validated is stale.
         // If image_layout have changed , the image descriptors need to be validated against them.
+        bool stale = true;
         if ((layout_binding->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC) ||
             (layout_binding->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)) {
-            FilterOneBindingReq(binding_req_pair, out_req, dynamic_buffers, stats.dynamic_buffer_count);
+            stale = !IsBindingTracked(dynamic_buffers, index);
         } else if ((layout_binding->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) ||
                    (layout_binding->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)) {
-            FilterOneBindingReq(binding_req_pair, out_req, non_dynamic_buffers, stats.non_dynamic_buffer_count);
-        } else {
+            stale = !IsBindingTracked(non_dynamic_buffers, index);
+        } else if (image_sample_version && IsBindingTracked(image_sample_version->bindings, index)) {
             // This is rather crude, as the changed layouts may not impact the bound descriptors,
             // but the simple "versioning" is a simple "dirt" test.
-            bool stale = true;
-            if (image_sample_version) {
-                const auto version_it = image_sample_version->find(binding);
-                if (version_it != image_sample_version->cend() && (version_it->second == cb_state.image_layout_change_count)) {
-                    stale = false;
-                }
-            }
-            if (stale) {
-                out_req->emplace(binding_req_pair);
-            }
+            stale = image_sample_version->image_layout_change_counts[index] != cb_state.image_layout_change_count;
+        }
+        if (stale) {
+            out_req->emplace(binding_req_pair);
         }
     }
 }
 
 void cvdescriptorset::DescriptorSet::UpdateValidationCache(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                                            const BindingReqMap &updated_bindings) {
+    std::lock_guard<std::mutex> lock(cached_validation_lock_);
     // For const cleanliness we have to find in the maps...
     auto &validated = cached_validation_[&cb_state];
 
@@ -1618,27 +1681,29 @@ void cvdescriptorset::DescriptorSet::UpdateValidationCache(const CMD_BUFFER_STAT
     auto &dynamic_buffers = validated.dynamic_buffers;
     auto &non_dynamic_buffers = validated.non_dynamic_buffers;
     for (const auto &binding_req_pair : updated_bindings) {
-        auto binding = binding_req_pair.first;
-        VkDescriptorSetLayoutBinding const *layout_binding = p_layout_->GetDescriptorSetLayoutBindingPtrFromBinding(binding);
+        const auto index = p_layout_->GetIndexFromBinding(binding_req_pair.first);
+        VkDescriptorSetLayoutBinding const *layout_binding = p_layout_->GetDescriptorSetLayoutBindingPtrFromIndex(index);
         if (!layout_binding) {
             continue;
         }
         // Caching criteria differs per type.
         if ((layout_binding->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC) ||
             (layout_binding->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)) {
-            dynamic_buffers.emplace(binding);
+            TrackBinding(&dynamic_buffers, index);
         } else if ((layout_binding->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) ||
                    (layout_binding->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)) {
-            non_dynamic_buffers.emplace(binding);
+            TrackBinding(&non_dynamic_buffers, index);
         } else {
             // Save the layout change version...
-            image_sample_version[binding] = cb_state.image_layout_change_count;
+            TrackBinding(&image_sample_version.bindings, index);
+            image_sample_version.image_layout_change_counts.resize(image_sample_version.bindings.size(), 0);
+            image_sample_version.image_layout_change_counts[index] = cb_state.image_layout_change_count;
         }
     }
 }
 
 cvdescriptorset::SamplerDescriptor::SamplerDescriptor(const ValidationStateTracker *dev_data, const VkSampler *immut)
-    : sampler_(VK_NULL_HANDLE), immutable_(false) {
+    : immutable_(false), sampler_(VK_NULL_HANDLE) {
     updated = false;
     descriptor_class = PlainSampler;
     if (immut) {
@@ -1928,7 +1993,7 @@ void cvdescriptorset::SamplerDescriptor::UpdateDrawState(ValidationStateTracker
 }
 
 cvdescriptorset::ImageSamplerDescriptor::ImageSamplerDescriptor(const ValidationStateTracker *dev_data, const VkSampler *immut)
-    : sampler_(VK_NULL_HANDLE), immutable_(false), image_view_(VK_NULL_HANDLE), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED) {
+    : immutable_(false), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED), sampler_(VK_NULL_HANDLE), image_view_(VK_NULL_HANDLE) {
     updated = false;
     descriptor_class = ImageSampler;
     if (immut) {
@@ -1980,7 +2045,7 @@ void cvdescriptorset::ImageSamplerDescriptor::UpdateDrawState(ValidationStateTra
 }
 
 cvdescriptorset::ImageDescriptor::ImageDescriptor(const VkDescriptorType type)
-    : storage_(false), image_view_(VK_NULL_HANDLE), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED) {
+    : storage_(false), image_layout_(VK_IMAGE_LAYOUT_UNDEFINED), image_view_(VK_NULL_HANDLE) {
     updated = false;
     descriptor_class = Image;
     if (VK_DESCRIPTOR_TYPE_STORAGE_IMAGE == type) storage_ = true;
@@ -2050,7 +2115,7 @@ void cvdescriptorset::BufferDescriptor::UpdateDrawState(ValidationStateTracker *
     if (buffer_node) dev_data->AddCommandBufferBindingBuffer(cb_node, buffer_node);
 }
 
-cvdescriptorset::TexelDescriptor::TexelDescriptor(const VkDescriptorType type) : buffer_view_(VK_NULL_HANDLE), storage_(false) {
+cvdescriptorset::TexelDescriptor::TexelDescriptor(const VkDescriptorType type) : storage_(false), buffer_view_(VK_NULL_HANDLE) {
     updated = false;
     descriptor_class = TexelBuffer;
     if (VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER == type) storage_ = true;
@@ -2103,6 +2168,200 @@ void cvdescriptorset::AccelerationStructureDescriptor::UpdateDrawState(Validatio
     if (acc_node) dev_data->AddCommandBufferBindingAccelerationStructure(cb_node, acc_node);
 }
 
+// Descriptor has no virtual functions, so the common entry points forward to the descriptor's own class by descriptor_class
+void cvdescriptorset::Descriptor::WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *update,
+                                              const uint32_t index) {
+    switch (descriptor_class) {
+        case PlainSampler:
+            static_cast<SamplerDescriptor *>(this)->WriteUpdate(dev_data, update, index);
+            break;
+        case ImageSampler:
+            static_cast<ImageSamplerDescriptor *>(this)->WriteUpdate(dev_data, update, index);
+            break;
+        case Image:
+            static_cast<ImageDescriptor *>(this)->WriteUpdate(dev_data, update, index);
+            break;
+        case TexelBuffer:
+            static_cast<TexelDescriptor *>(this)->WriteUpdate(dev_data, update, index);
+            break;
+        case GeneralBuffer:
+            static_cast<BufferDescriptor *>(this)->WriteUpdate(dev_data, update, index);
+            break;
+        case InlineUniform:
+            static_cast<InlineUniformDescriptor *>(this)->WriteUpdate(dev_data, update, index);
+            break;
+        case AccelerationStructure:
+            static_cast<AccelerationStructureDescriptor *>(this)->WriteUpdate(dev_data, update, index);
+            break;
+    }
+}
+
+void cvdescriptorset::Descriptor::CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *src) {
+    switch (descriptor_class) {
+        case PlainSampler:
+            static_cast<SamplerDescriptor *>(this)->CopyUpdate(dev_data, src);
+            break;
+        case ImageSampler:
+            static_cast<ImageSamplerDescriptor *>(this)->CopyUpdate(dev_data, src);
+            break;
+        case Image:
+            static_cast<ImageDescriptor *>(this)->CopyUpdate(dev_data, src);
+            break;
+        case TexelBuffer:
+            static_cast<TexelDescriptor *>(this)->CopyUpdate(dev_data, src);
+            break;
+        case GeneralBuffer:
+            static_cast<BufferDescriptor *>(this)->CopyUpdate(dev_data, src);
+            break;
+        case InlineUniform:
+            static_cast<InlineUniformDescriptor *>(this)->CopyUpdate(dev_data, src);
+            break;
+        case AccelerationStructure:
+            static_cast<AccelerationStructureDescriptor *>(this)->CopyUpdate(dev_data, src);
+            break;
+    }
+}
+
+void cvdescriptorset::Descriptor::UpdateDrawState(ValidationStateTracker *dev_data, CMD_BUFFER_STATE *cb_node) {
+    switch (descriptor_class) {
+        case PlainSampler:
+            static_cast<SamplerDescriptor *>(this)->UpdateDrawState(dev_data, cb_node);
+            break;
+        case ImageSampler:
+            static_cast<ImageSamplerDescriptor *>(this)->UpdateDrawState(dev_data, cb_node);
+            break;
+        case Image:
+            static_cast<ImageDescriptor *>(this)->UpdateDrawState(dev_data, cb_node);
+            break;
+        case TexelBuffer:
+            static_cast<TexelDescriptor *>(this)->UpdateDrawState(dev_data, cb_node);
+            break;
+        case GeneralBuffer:
+            static_cast<BufferDescriptor *>(this)->UpdateDrawState(dev_data, cb_node);
+            break;
+        case InlineUniform:
+            static_cast<InlineUniformDescriptor *>(this)->UpdateDrawState(dev_data, cb_node);
+            break;
+        case AccelerationStructure:
+            static_cast<AccelerationStructureDescriptor *>(this)->UpdateDrawState(dev_data, cb_node);
+            break;
+    }
+}
+
+void cvdescriptorset::Descriptor::Destroy() {
+    switch (descriptor_class) {
+        case PlainSampler:
+            static_cast<SamplerDescriptor *>(this)->~SamplerDescriptor();
+            break;
+        case ImageSampler:
+            static_cast<ImageSamplerDescriptor *>(this)->~ImageSamplerDescriptor();
+            break;
+        case Image:
+            static_cast<ImageDescriptor *>(this)->~ImageDescriptor();
+            break;
+        case TexelBuffer:
+            static_cast<TexelDescriptor *>(this)->~TexelDescriptor();
+            break;
+        case GeneralBuffer:
+            static_cast<BufferDescriptor *>(this)->~BufferDescriptor();
+            break;
+        case InlineUniform:
+            static_cast<InlineUniformDescriptor *>(this)->~InlineUniformDescriptor();
+            break;
+        case AccelerationStructure:
+            static_cast<AccelerationStructureDescriptor *>(this)->~AccelerationStructureDescriptor();
+            break;
+    }
+}
+
+bool cvdescriptorset::Descriptor::IsImmutableSampler() const {
+    switch (descriptor_class) {
+        case PlainSampler:
+            return static_cast<const SamplerDescriptor *>(this)->IsImmutableSampler();
+        case ImageSampler:
+            return static_cast<const ImageSamplerDescriptor *>(this)->IsImmutableSampler();
+        default:
+            return false;
+    }
+}
+
+bool cvdescriptorset::Descriptor::IsDynamic() const {
+    return (descriptor_class == GeneralBuffer) && static_cast<const BufferDescriptor *>(this)->IsDynamic();
+}
+
+bool cvdescriptorset::Descriptor::IsStorage() const {
+    switch (descriptor_class) {
+        case Image:
+            return static_cast<const ImageDescriptor *>(this)->IsStorage();
+        case TexelBuffer:
+            return static_cast<const TexelDescriptor *>(this)->IsStorage();
+        case GeneralBuffer:
+            return static_cast<const BufferDescriptor *>(this)->IsStorage();
+        default:
+            return false;
+    }
+}
+
+bool CoreChecks::ValidateDescriptorSetWrite(const VkWriteDescriptorSet *p_wd, const char *func_name) const {
+    bool skip = false;
+    auto dest_set = p_wd->dstSet;
+    auto set_node = GetSetNode(dest_set);
+    if (!set_node) {
+        skip |= LogError(dest_set, kVUID_Core_DrawState_InvalidDescriptorSet, "Cannot call %s on %s that has not been allocated.",
+                         func_name, report_data->FormatHandle(dest_set).c_str());
+    } else {
+        std::string error_code;
+        std::string error_str;
+        if (!ValidateWriteUpdate(set_node, p_wd, func_name, &error_code, &error_str)) {
+            skip |= LogError(dest_set, error_code, "%s failed write update validation for %s with error: %s.", func_name,
+                             report_data->FormatHandle(dest_set).c_str(), error_str.c_str());
+        }
+    }
+    if (p_wd->pNext) {
+        const auto *pnext_struct = lvl_find_in_chain<VkWriteDescriptorSetAccelerationStructureKHR>(p_wd->pNext);
+        if (pnext_struct) {
+            for (uint32_t j = 0; j < pnext_struct->accelerationStructureCount; ++j) {
+                const ACCELERATION_STRUCTURE_STATE *as_state =
+                    GetAccelerationStructureState(pnext_struct->pAccelerationStructures[j]);
+                if (as_state && as_state->is_khr &&
+                    (as_state->create_infoKHR.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR &&
+                     as_state->create_infoKHR.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR)) {
+                    skip |= LogError(dest_set, "VUID-VkWriteDescriptorSetAccelerationStructureKHR-pAccelerationStructures-02764",
+                                     "%s: Each acceleration structure in pAccelerationStructures must have been"
+                                     "created with VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR.",
+                                     func_name);
+                }
+            }
+        }
+    }
+    return skip;
+}
+
+bool CoreChecks::ValidateDescriptorSetCopy(const VkCopyDescriptorSet *p_cd, const char *func_name) const {
+    bool skip = false;
+    auto dst_set = p_cd->dstSet;
+    auto src_set = p_cd->srcSet;
+    auto src_node = GetSetNode(src_set);
+    auto dst_node = GetSetNode(dst_set);
+    // Object_tracker verifies that src & dest descriptor set are valid
+    assert(src_node);
+    assert(dst_node);
+    std::string error_code;
+    std::string error_str;
+    if (!ValidateCopyUpdate(p_cd, dst_node, src_node, func_name, &error_code, &error_str)) {
+        LogObjectList objlist(dst_set);
+        objlist.add(src_set);
+        skip |= LogError(objlist, error_code, "%s failed copy update from %s to %s with error: %s.", func_name,
+                         report_data->FormatHandle(src_set).c_str(), report_data->FormatHandle(dst_set).c_str(), error_str.c_str());
+    }
+    return skip;
+}
+
+// Batches smaller than this are not worth waking the worker pool for
+static const uint32_t kParallelDescriptorUpdateMinCount = 256;
+// Updates validated per worker task
+static const uint32_t kParallelDescriptorUpdateChunkSize = 64;
+
 // This is a helper function that iterates over a set of Write and Copy updates, pulls the DescriptorSet* for updated
 //  sets, and then calls their respective Validate[Write|Copy]Update functions.
 // If the update hits an issue for which the callback returns "true", meaning that the call down the chain should
@@ -2111,59 +2370,48 @@ void cvdescriptorset::AccelerationStructureDescriptor::UpdateDrawState(Validatio
 bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                               const VkCopyDescriptorSet *p_cds, const char *func_name) const {
     bool skip = false;
-    // Validate Write updates
-    for (uint32_t i = 0; i < write_count; i++) {
-        auto dest_set = p_wds[i].dstSet;
-        auto set_node = GetSetNode(dest_set);
-        if (!set_node) {
-            skip |=
-                LogError(dest_set, kVUID_Core_DrawState_InvalidDescriptorSet, "Cannot call %s on %s that has not been allocated.",
-                         func_name, report_data->FormatHandle(dest_set).c_str());
-        } else {
-            std::string error_code;
-            std::string error_str;
-            if (!ValidateWriteUpdate(set_node, &p_wds[i], func_name, &error_code, &error_str)) {
-                skip |= LogError(dest_set, error_code, "%s failed write update validation for %s with error: %s.", func_name,
-                                 report_data->FormatHandle(dest_set).c_str(), error_str.c_str());
-            }
-        }
-        if (p_wds[i].pNext) {
-            const auto *pnext_struct = lvl_find_in_chain<VkWriteDescriptorSetAccelerationStructureKHR>(p_wds[i].pNext);
-            if (pnext_struct) {
-                for (uint32_t j = 0; j < pnext_struct->accelerationStructureCount; ++j) {
-                    const ACCELERATION_STRUCTURE_STATE *as_state =
-                        GetAccelerationStructureState(pnext_struct->pAccelerationStructures[j]);
-                    if (as_state && as_state->is_khr &&
-                        (as_state->create_infoKHR.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR &&
-                         as_state->create_infoKHR.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR)) {
-                        skip |=
-                            LogError(dest_set, "VUID-VkWriteDescriptorSetAccelerationStructureKHR-pAccelerationStructures-02764",
-                                     "%s: Each acceleration structure in pAccelerationStructures must have been"
-                                     "created with VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR.",
-                                     func_name);
-                    }
+    const uint32_t update_count = write_count + copy_count;
+    if (descriptor_update_workers && (update_count >= kParallelDescriptorUpdateMinCount)) {
+        // Validation only reads state, and no update in the batch is applied until PerformUpdateDescriptorSets, so every
+        // write and copy can be checked independently. Check them all on the pool with logging deferred. An update that
+        // would log nothing gives the same result as on the serial path; the others are validated again below, in order,
+        // so that their messages are reported exactly as the serial path reports them.
+        std::vector<uint8_t> revalidate(update_count, 0);
+        const uint32_t chunk_count = (update_count + kParallelDescriptorUpdateChunkSize - 1) / kParallelDescriptorUpdateChunkSize;
+        descriptor_update_workers->Run(chunk_count, [&](uint32_t chunk) {
+            const uint32_t begin = chunk * kParallelDescriptorUpdateChunkSize;
+            const uint32_t end = std::min(begin + kParallelDescriptorUpdateChunkSize, update_count);
+            bool deferred = false;
+            SpeculativeLogMsgFlag() = &deferred;
+            for (uint32_t i = begin; i < end; ++i) {
+                deferred = false;
+                if (i < write_count) {
+                    ValidateDescriptorSetWrite(&p_wds[i], func_name);
+                } else {
+                    ValidateDescriptorSetCopy(&p_cds[i - write_count], func_name);
                 }
+                revalidate[i] = deferred ? 1 : 0;
+            }
+            SpeculativeLogMsgFlag() = nullptr;
+        });
+        for (uint32_t i = 0; i < update_count; ++i) {
+            if (!revalidate[i]) continue;
+            if (i < write_count) {
+                skip |= ValidateDescriptorSetWrite(&p_wds[i], func_name);
+            } else {
+                skip |= ValidateDescriptorSetCopy(&p_cds[i - write_count], func_name);
             }
         }
+        return skip;
+    }
+
+    // Validate Write updates
+    for (uint32_t i = 0; i < write_count; i++) {
+        skip |= ValidateDescriptorSetWrite(&p_wds[i], func_name);
     }
     // Now validate copy updates
     for (uint32_t i = 0; i < copy_count; ++i) {
-        auto dst_set = p_cds[i].dstSet;
-        auto src_set = p_cds[i].srcSet;
-        auto src_node = GetSetNode(src_set);
-        auto dst_node = GetSetNode(dst_set);
-        // Object_tracker verifies that src & dest descriptor set are valid
-        assert(src_node);
-        assert(dst_node);
-        std::string error_code;
-        std::string error_str;
-        if (!ValidateCopyUpdate(&p_cds[i], dst_node, src_node, func_name, &error_code, &error_str)) {
-            LogObjectList objlist(dst_set);
-            objlist.add(src_set);
-            skip |=
-                LogError(objlist, error_code, "%s failed copy update from %s to %s with error: %s.", func_name,
-                         report_data->FormatHandle(src_set).c_str(), report_data->FormatHandle(dst_set).c_str(), error_str.c_str());
-        }
+        skip |= ValidateDescriptorSetCopy(&p_cds[i], func_name);
     }
     return skip;
 }
@@ -346,28 +346,39 @@ class DescriptorSetLayout : public BASE_NODE {
 
 /*
  * Descriptor classes
- *  Descriptor is an abstract base class from which 5 separate descriptor types are derived.
+ *  Descriptor is the common base from which 7 separate descriptor classes are derived.
  *   This allows the WriteUpdate() and CopyUpdate() operations to be specialized per
- *   descriptor type, but all descriptors in a set can be accessed via the common Descriptor*.
+ *   descriptor class, but all descriptors in a set can be accessed via the common Descriptor*.
+ *   There is no vtable: the base dispatches on descriptor_class, which every descriptor already carries.
  */
 
 // Slightly broader than type, each c++ "class" will has a corresponding "DescriptorClass"
-enum DescriptorClass { PlainSampler, ImageSampler, Image, TexelBuffer, GeneralBuffer, InlineUniform, AccelerationStructure };
+// Byte sized so it packs with updated, and with the small leading members of each descriptor class
+enum DescriptorClass : uint8_t {
+    PlainSampler,
+    ImageSampler,
+    Image,
+    TexelBuffer,
+    GeneralBuffer,
+    InlineUniform,
+    AccelerationStructure
+};
 
 class Descriptor {
   public:
-    virtual ~Descriptor(){};
-    virtual void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) = 0;
-    virtual void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) = 0;
+    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *);
     // Create binding between resources of this descriptor and given cb_node
-    virtual void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) = 0;
-    virtual DescriptorClass GetClass() const { return descriptor_class; };
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *);
+    DescriptorClass GetClass() const { return descriptor_class; };
     // Special fast-path check for SamplerDescriptors that are immutable
-    virtual bool IsImmutableSampler() const { return false; };
+    bool IsImmutableSampler() const;
     // Check for dynamic descriptor type
-    virtual bool IsDynamic() const { return false; };
+    bool IsDynamic() const;
     // Check for storage descriptor type
-    virtual bool IsStorage() const { return false; };
+    bool IsStorage() const;
+    // Run the destructor of the descriptor's own class. Descriptors live in their set's backing store, so nothing is freed.
+    void Destroy();
     bool updated;  // Has descriptor been updated?
     DescriptorClass descriptor_class;
 };
@@ -387,27 +398,27 @@ bool ValidateDescriptorSetLayoutCreateInfo(const ValidationObject *val_obj, cons
 class SamplerDescriptor : public Descriptor {
   public:
     SamplerDescriptor(const ValidationStateTracker *dev_data, const VkSampler *);
-    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
-    virtual bool IsImmutableSampler() const override { return immutable_; };
+    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *);
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *);
+    bool IsImmutableSampler() const { return immutable_; };
     VkSampler GetSampler() const { return sampler_; }
     const SAMPLER_STATE *GetSamplerState() const { return sampler_state_.get(); }
     SAMPLER_STATE *GetSamplerState() { return sampler_state_.get(); }
 
   private:
-    VkSampler sampler_;
     bool immutable_;
+    VkSampler sampler_;
     std::shared_ptr<SAMPLER_STATE> sampler_state_;
 };
 
 class ImageSamplerDescriptor : public Descriptor {
   public:
     ImageSamplerDescriptor(const ValidationStateTracker *dev_data, const VkSampler *);
-    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
-    virtual bool IsImmutableSampler() const override { return immutable_; };
+    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *);
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *);
+    bool IsImmutableSampler() const { return immutable_; };
     VkSampler GetSampler() const { return sampler_; }
     VkImageView GetImageView() const { return image_view_; }
     const IMAGE_VIEW_STATE *GetImageViewState() const { return image_view_state_.get(); }
@@ -417,21 +428,21 @@ class ImageSamplerDescriptor : public Descriptor {
     SAMPLER_STATE *GetSamplerState() { return sampler_state_.get(); }
 
   private:
+    bool immutable_;
+    VkImageLayout image_layout_;
     std::shared_ptr<SAMPLER_STATE> sampler_state_;
     VkSampler sampler_;
-    bool immutable_;
     std::shared_ptr<IMAGE_VIEW_STATE> image_view_state_;
     VkImageView image_view_;
-    VkImageLayout image_layout_;
 };
 
 class ImageDescriptor : public Descriptor {
   public:
     ImageDescriptor(const VkDescriptorType);
-    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
-    virtual bool IsStorage() const override { return storage_; }
+    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *);
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *);
+    bool IsStorage() const { return storage_; }
     VkImageView GetImageView() const { return image_view_; }
     const IMAGE_VIEW_STATE *GetImageViewState() const { return image_view_state_.get(); }
     IMAGE_VIEW_STATE *GetImageViewState() { return image_view_state_.get(); }
@@ -439,36 +450,36 @@ class ImageDescriptor : public Descriptor {
 
   private:
     bool storage_;
+    VkImageLayout image_layout_;
     std::shared_ptr<IMAGE_VIEW_STATE> image_view_state_;
     VkImageView image_view_;
-    VkImageLayout image_layout_;
 };
 
 class TexelDescriptor : public Descriptor {
   public:
     TexelDescriptor(const VkDescriptorType);
-    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
-    virtual bool IsStorage() const override { return storage_; }
+    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *);
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *);
+    bool IsStorage() const { return storage_; }
     VkBufferView GetBufferView() const { return buffer_view_; }
     const BUFFER_VIEW_STATE *GetBufferViewState() const { return buffer_view_state_.get(); }
     BUFFER_VIEW_STATE *GetBufferViewState() { return buffer_view_state_.get(); }
 
   private:
-    VkBufferView buffer_view_;
     bool storage_;
+    VkBufferView buffer_view_;
     std::shared_ptr<BUFFER_VIEW_STATE> buffer_view_state_;
 };
 
 class BufferDescriptor : public Descriptor {
   public:
     BufferDescriptor(const VkDescriptorType);
-    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
-    virtual bool IsDynamic() const override { return dynamic_; }
-    virtual bool IsStorage() const override { return storage_; }
+    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *);
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *);
+    bool IsDynamic() const { return dynamic_; }
+    bool IsStorage() const { return storage_; }
     VkBuffer GetBuffer() const { return buffer_; }
     const BUFFER_STATE *GetBufferState() const { return buffer_state_.get(); }
     BUFFER_STATE *GetBufferState() { return buffer_state_.get(); }
@@ -490,22 +501,20 @@ class InlineUniformDescriptor : public Descriptor {
         updated = false;
         descriptor_class = InlineUniform;
     }
-    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override {
-        updated = true;
-    }
-    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override { updated = true; }
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override {}
+    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) { updated = true; }
+    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) { updated = true; }
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) {}
 };
 
 class AccelerationStructureDescriptor : public Descriptor {
   public:
     AccelerationStructureDescriptor(const VkDescriptorType);
-    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t) override;
+    void WriteUpdate(const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t);
     VkAccelerationStructureKHR GetAccelerationStructure() const { return acc_; }
     const ACCELERATION_STRUCTURE_STATE *GetAccelerationStructureState() const { return acc_state_.get(); }
     ACCELERATION_STRUCTURE_STATE *GetAccelerationStructureState() { return acc_state_.get(); }
-    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *) override;
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override;
+    void CopyUpdate(const ValidationStateTracker *dev_data, const Descriptor *);
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *);
 
   private:
     VkAccelerationStructureKHR acc_;
@@ -523,18 +532,11 @@ union AnyDescriptor {
     ~AnyDescriptor() = delete;
 };
 
+// Unit of descriptor storage. A set's descriptors are packed back to back in a vector of these, each taking only as many
+// units as its own class needs, rather than one slot sized for the largest descriptor class. All descriptors of a binding share
+// a class, so each binding is a dense array of that class within the store.
 struct alignas(alignof(AnyDescriptor)) DescriptorBackingStore {
-    uint8_t data[sizeof(AnyDescriptor)];
-
-    SamplerDescriptor *Sampler() { return &(reinterpret_cast<AnyDescriptor *>(this)->sampler); }
-    ImageSamplerDescriptor *ImageSampler() { return &(reinterpret_cast<AnyDescriptor *>(this)->image_sampler); }
-    ImageDescriptor *Image() { return &(reinterpret_cast<AnyDescriptor *>(this)->image); }
-    TexelDescriptor *Texel() { return &(reinterpret_cast<AnyDescriptor *>(this)->texel); }
-    BufferDescriptor *Buffer() { return &(reinterpret_cast<AnyDescriptor *>(this)->buffer); }
-    InlineUniformDescriptor *InlineUniform() { return &(reinterpret_cast<AnyDescriptor *>(this)->inline_uniform); }
-    AccelerationStructureDescriptor *AccelerationStructure() {
-        return &(reinterpret_cast<AnyDescriptor *>(this)->accelerator_structure);
-    }
+    uint8_t data[alignof(AnyDescriptor)];
 };
 
 // Structs to contain common elements that need to be shared between Validate* and Perform* calls below
@@ -632,18 +634,28 @@ class DescriptorSet : public BASE_NODE {
                          const std::map<uint32_t, descriptor_req> &, const char *function);
 
     // Track work that has been bound or validated to avoid duplicate work, important when large descriptor arrays
-    // are present
-    typedef std::unordered_set<uint32_t> TrackedBindings;
-    static void FilterOneBindingReq(const BindingReqMap::value_type &binding_req_pair, BindingReqMap *out_req,
-                                    const TrackedBindings &set, uint32_t limit);
+    // are present. Indexed by binding index, each entry holds the set's change count + 1 at the time the binding was
+    // last validated (zero if never), so a binding is current until a later update writes to it.
+    typedef std::vector<uint64_t> TrackedBindings;
+    bool IsBindingTracked(const TrackedBindings &tracked, uint32_t index) const {
+        return (index < tracked.size()) && (tracked[index] > binding_change_counts_[index]);
+    }
+    void TrackBinding(TrackedBindings *tracked, uint32_t index) const {
+        if (tracked->size() <= index) tracked->resize(GetBindingCount(), 0);
+        (*tracked)[index] = change_count_ + 1;
+    }
     void FilterBindingReqs(const CMD_BUFFER_STATE &, const PIPELINE_STATE &, const BindingReqMap &in_req,
                            BindingReqMap *out_req) const;
     void UpdateValidationCache(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
                                const BindingReqMap &updated_bindings);
     void ClearCachedDynamicDescriptorValidation(CMD_BUFFER_STATE *cb_state) {
+        std::lock_guard<std::mutex> lock(cached_validation_lock_);
         cached_validation_[cb_state].dynamic_buffers.clear();
     }
-    void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) { cached_validation_.erase(cb_state); }
+    void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) {
+        std::lock_guard<std::mutex> lock(cached_validation_lock_);
+        cached_validation_.erase(cb_state);
+    }
     VkSampler const *GetImmutableSamplerPtrFromBinding(const uint32_t index) const {
         return p_layout_->GetImmutableSamplerPtrFromBinding(index);
     };
@@ -666,16 +678,11 @@ class DescriptorSet : public BASE_NODE {
     }
     uint32_t GetVariableDescriptorCount() const { return variable_count_; }
     DESCRIPTOR_POOL_STATE *GetPoolState() const { return pool_state_; }
-    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const { return descriptors_[index].get(); }
+    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const;
     uint64_t GetChangeCount() const { return change_count_; }
 
     const std::vector<safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
 
-    // Given that we are providing placement new allocation for descriptors, the deleter needs to *only* call the destructor
-    struct DescriptorDeleter {
-        void operator()(Descriptor *desc) { desc->~Descriptor(); }
-    };
-
   private:
     // Private helper to set all bound cmd buffers to INVALID state
     void InvalidateBoundCmdBuffers(ValidationStateTracker *state_data);
@@ -683,10 +690,20 @@ class DescriptorSet : public BASE_NODE {
     VkDescriptorSet set_;
     DESCRIPTOR_POOL_STATE *pool_state_;
     const std::shared_ptr<DescriptorSetLayout const> p_layout_;
-    // NOTE: the the backing store for the descriptors must be declared *before* it so it will be destructed *after* it
-    // "Destructors for nonstatic member objects are called in the reverse order in which they appear in the class declaration."
+    // Per binding index, the change_count_ of the last update that wrote to the binding
+    std::vector<uint64_t> binding_change_counts_;
+    // Per binding index, where the binding's descriptors start in descriptor_store_ and how many store units each one takes
+    struct BindingStore {
+        uint32_t global_index_start;
+        uint32_t store_offset;
+        uint32_t store_units;
+    };
+    Descriptor *GetDescriptorFromIndex(uint32_t index, uint32_t array_index) {
+        const auto &store = binding_stores_[index];
+        return reinterpret_cast<Descriptor *>(&descriptor_store_[store.store_offset + array_index * store.store_units]);
+    }
+    std::vector<BindingStore> binding_stores_;
     std::vector<DescriptorBackingStore> descriptor_store_;
-    std::vector<std::unique_ptr<Descriptor, DescriptorDeleter>> descriptors_;
     const StateTracker *state_data_;
     uint32_t variable_count_;
     uint64_t change_count_;
@@ -701,7 +718,10 @@ class DescriptorSet : public BASE_NODE {
     // expensive validation operation (typically per-draw)
     typedef std::unordered_map<CMD_BUFFER_STATE *, TrackedBindings> TrackedBindingMap;
     // Track the validation caching of bindings vs. the command buffer and draw state
-    typedef std::unordered_map<uint32_t, CMD_BUFFER_STATE::ImageLayoutUpdateCount> VersionedBindings;
+    struct VersionedBindings {
+        TrackedBindings bindings;
+        std::vector<CMD_BUFFER_STATE::ImageLayoutUpdateCount> image_layout_change_counts;
+    };
     struct CachedValidation {
         TrackedBindings command_binding_and_usage;                                     // Persistent for the life of the recording
         TrackedBindings non_dynamic_buffers;                                           // Persistent for the life of the recording
@@ -711,6 +731,8 @@ class DescriptorSet : public BASE_NODE {
     typedef std::unordered_map<const CMD_BUFFER_STATE *, CachedValidation> CachedValidationMap;
     // Image and ImageView bindings are validated per pipeline and not invalidate by repeated binding
     CachedValidationMap cached_validation_;
+    // The set can be bound to command buffers recorded concurrently (see fine grained locking in ValidationStateTracker)
+    mutable std::mutex cached_validation_lock_;
 };
 // For the "bindless" style resource usage with many descriptors, need to optimize binding and validation
 class PrefilterBindRequestMap {
@@ -38,7 +38,7 @@ small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+vl_concurrent_id_map<uint64_t, uint64_t> unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -54,6 +54,7 @@ bool wrap_handles = true;
 #include "stateless_validation.h"
 #include "synchronization_validation.h"
 #include "thread_safety.h"
+#include "command_counter.h"
 
 // Global list of sType,size identifiers
 std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info{};
@@ -325,6 +326,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
 
     framework->object_dispatch = local_object_dispatch;
     framework->container_type = LayerObjectTypeInstance;
+    framework->InitObjectDispatchVectors();
     framework->disabled = local_disables;
     framework->enabled = local_enables;
 
@@ -503,6 +505,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         }
     }
 
+    device_interceptor->InitObjectDispatchVectors();
+
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
@@ -926,17 +930,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(
     VkPhysicalDevice*                           pPhysicalDevices) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEnumeratePhysicalDevices]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEnumeratePhysicalDevices]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
     }
     VkResult result = DispatchEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEnumeratePhysicalDevices]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices, result);
     }
@@ -948,17 +952,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(
     VkPhysicalDeviceFeatures*                   pFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceFeatures]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceFeatures]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceFeatures]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     }
@@ -970,17 +974,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(
     VkFormatProperties*                         pFormatProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     }
@@ -996,17 +1000,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(
     VkImageFormatProperties*                    pImageFormatProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties, result);
     }
@@ -1018,17 +1022,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(
     VkPhysicalDeviceProperties*                 pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties(physicalDevice, pProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceProperties(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties(physicalDevice, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceProperties(physicalDevice, pProperties);
     }
@@ -1040,17 +1044,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(
     VkQueueFamilyProperties*                    pQueueFamilyProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
@@ -1061,17 +1065,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(
     VkPhysicalDeviceMemoryProperties*           pMemoryProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     }
@@ -1084,17 +1088,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(
     VkQueue*                                    pQueue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
     DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
@@ -1107,17 +1111,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
     }
@@ -1128,17 +1132,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(
     VkQueue                                     queue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueWaitIdle]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueWaitIdle(queue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueWaitIdle]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueWaitIdle(queue);
     }
     VkResult result = DispatchQueueWaitIdle(queue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueWaitIdle]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueWaitIdle(queue, result);
     }
@@ -1149,17 +1153,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeviceWaitIdle]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeviceWaitIdle(device);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeviceWaitIdle]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDeviceWaitIdle(device);
     }
     VkResult result = DispatchDeviceWaitIdle(device);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeviceWaitIdle]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDeviceWaitIdle(device, result);
     }
@@ -1173,17 +1177,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(
     VkDeviceMemory*                             pMemory) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateMemory]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateMemory]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     }
     VkResult result = DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateMemory]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, result);
     }
@@ -1196,17 +1200,17 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeMemory]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeMemory(device, memory, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeMemory]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordFreeMemory(device, memory, pAllocator);
     }
     DispatchFreeMemory(device, memory, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeMemory]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordFreeMemory(device, memory, pAllocator);
     }
@@ -1221,17 +1225,17 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(
     void**                                      ppData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMapMemory(device, memory, offset, size, flags, ppData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMapMemory]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordMapMemory(device, memory, offset, size, flags, ppData);
     }
     VkResult result = DispatchMapMemory(device, memory, offset, size, flags, ppData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMapMemory]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordMapMemory(device, memory, offset, size, flags, ppData, result);
     }
@@ -1243,17 +1247,17 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(
     VkDeviceMemory                              memory) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnmapMemory(device, memory);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUnmapMemory]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUnmapMemory(device, memory);
     }
     DispatchUnmapMemory(device, memory);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUnmapMemory]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUnmapMemory(device, memory);
     }
@@ -1265,17 +1269,17 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(
     const VkMappedMemoryRange*                  pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFlushMappedMemoryRanges]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFlushMappedMemoryRanges]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFlushMappedMemoryRanges]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
@@ -1288,17 +1292,17 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(
     const VkMappedMemoryRange*                  pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInvalidateMappedMemoryRanges]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInvalidateMappedMemoryRanges]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInvalidateMappedMemoryRanges]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
@@ -1311,17 +1315,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(
     VkDeviceSize*                               pCommittedMemoryInBytes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryCommitment]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryCommitment]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
     DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryCommitment]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
@@ -1334,17 +1338,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(
     VkDeviceSize                                memoryOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory(device, buffer, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindBufferMemory(device, buffer, memory, memoryOffset);
     }
     VkResult result = DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindBufferMemory(device, buffer, memory, memoryOffset, result);
     }
@@ -1358,17 +1362,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(
     VkDeviceSize                                memoryOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory(device, image, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindImageMemory(device, image, memory, memoryOffset);
     }
     VkResult result = DispatchBindImageMemory(device, image, memory, memoryOffset);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindImageMemory(device, image, memory, memoryOffset, result);
     }
@@ -1381,17 +1385,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(
     VkMemoryRequirements*                       pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
@@ -1403,17 +1407,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(
     VkMemoryRequirements*                       pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements(device, image, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
@@ -1426,17 +1430,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(
     VkSparseImageMemoryRequirements*            pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
@@ -1453,17 +1457,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(
     VkSparseImageFormatProperties*              pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     }
@@ -1476,17 +1480,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBindSparse]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBindSparse]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     }
     VkResult result = DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBindSparse]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, result);
     }
@@ -1500,17 +1504,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFence]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFence(device, pCreateInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFence]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence);
     }
     VkResult result = DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFence]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence, result);
     }
@@ -1523,17 +1527,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFence]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFence(device, fence, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFence]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyFence(device, fence, pAllocator);
     }
     DispatchDestroyFence(device, fence, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFence]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyFence(device, fence, pAllocator);
     }
@@ -1545,17 +1549,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(
     const VkFence*                              pFences) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetFences]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetFences(device, fenceCount, pFences);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetFences]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetFences(device, fenceCount, pFences);
     }
     VkResult result = DispatchResetFences(device, fenceCount, pFences);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetFences]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetFences(device, fenceCount, pFences, result);
     }
@@ -1567,17 +1571,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(
     VkFence                                     fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceStatus]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceStatus(device, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceStatus]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetFenceStatus(device, fence);
     }
     VkResult result = DispatchGetFenceStatus(device, fence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceStatus]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetFenceStatus(device, fence, result);
     }
@@ -1592,17 +1596,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForFences]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForFences(device, fenceCount, pFences, waitAll, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitForFences]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     }
     VkResult result = DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitForFences]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
     }
@@ -1616,17 +1620,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(
     VkSemaphore*                                pSemaphore) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSemaphore]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSemaphore]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     }
     VkResult result = DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSemaphore]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore, result);
     }
@@ -1639,17 +1643,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySemaphore]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySemaphore(device, semaphore, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySemaphore]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
     DispatchDestroySemaphore(device, semaphore, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySemaphore]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
@@ -1662,17 +1666,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(
     VkEvent*                                    pEvent) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateEvent]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateEvent(device, pCreateInfo, pAllocator, pEvent);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateEvent]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     }
     VkResult result = DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateEvent]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent, result);
     }
@@ -1685,17 +1689,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyEvent]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyEvent(device, event, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyEvent]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyEvent(device, event, pAllocator);
     }
     DispatchDestroyEvent(device, event, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyEvent]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyEvent(device, event, pAllocator);
     }
@@ -1706,17 +1710,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetEventStatus]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetEventStatus(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetEventStatus]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetEventStatus(device, event);
     }
     VkResult result = DispatchGetEventStatus(device, event);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetEventStatus]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetEventStatus(device, event, result);
     }
@@ -1728,17 +1732,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetEvent]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetEvent]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetEvent(device, event);
     }
     VkResult result = DispatchSetEvent(device, event);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetEvent]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetEvent(device, event, result);
     }
@@ -1750,17 +1754,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(
     VkEvent                                     event) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetEvent]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetEvent]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetEvent(device, event);
     }
     VkResult result = DispatchResetEvent(device, event);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetEvent]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetEvent(device, event, result);
     }
@@ -1774,17 +1778,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(
     VkQueryPool*                                pQueryPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateQueryPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateQueryPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     VkResult result = DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateQueryPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool, result);
     }
@@ -1797,17 +1801,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyQueryPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyQueryPool(device, queryPool, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyQueryPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
     DispatchDestroyQueryPool(device, queryPool, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyQueryPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
@@ -1824,17 +1828,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(
     VkQueryResultFlags                          flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueryPoolResults]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueryPoolResults]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     }
     VkResult result = DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueryPoolResults]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags, result);
     }
@@ -1847,17 +1851,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBuffer]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBuffer(device, buffer, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBuffer]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
     DispatchDestroyBuffer(device, buffer, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBuffer]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
@@ -1870,17 +1874,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(
     VkBufferView*                               pView) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferView]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateBufferView]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBufferView]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView, result);
     }
@@ -1893,17 +1897,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferView]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferView(device, bufferView, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBufferView]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
     DispatchDestroyBufferView(device, bufferView, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBufferView]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
@@ -1916,17 +1920,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(
     VkImage*                                    pImage) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImage]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImage(device, pCreateInfo, pAllocator, pImage);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImage]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     VkResult result = DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImage]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     }
@@ -1939,17 +1943,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImage]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImage(device, image, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImage]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyImage(device, image, pAllocator);
     }
     DispatchDestroyImage(device, image, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImage]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyImage(device, image, pAllocator);
     }
@@ -1962,17 +1966,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
     VkSubresourceLayout*                        pLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout(device, image, pSubresource, pLayout);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSubresourceLayout]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSubresourceLayout]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
@@ -1985,17 +1989,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(
     VkImageView*                                pView) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImageView]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImageView]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImageView]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView, result);
     }
@@ -2008,17 +2012,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImageView]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImageView(device, imageView, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImageView]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyImageView(device, imageView, pAllocator);
     }
     DispatchDestroyImageView(device, imageView, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImageView]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyImageView(device, imageView, pAllocator);
     }
@@ -2030,17 +2034,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderModule]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyShaderModule(device, shaderModule, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyShaderModule]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
     DispatchDestroyShaderModule(device, shaderModule, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyShaderModule]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
@@ -2053,17 +2057,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(
     VkPipelineCache*                            pPipelineCache) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineCache]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePipelineCache]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     }
     VkResult result = DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineCache]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache, result);
     }
@@ -2076,17 +2080,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineCache]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineCache(device, pipelineCache, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineCache]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
     DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineCache]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
@@ -2099,17 +2103,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineCacheData]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineCacheData]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     }
     VkResult result = DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineCacheData]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData, result);
     }
@@ -2123,17 +2127,17 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(
     const VkPipelineCache*                      pSrcCaches) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMergePipelineCaches]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMergePipelineCaches]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     }
     VkResult result = DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMergePipelineCaches]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches, result);
     }
@@ -2146,17 +2150,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipeline]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipeline(device, pipeline, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipeline]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
     DispatchDestroyPipeline(device, pipeline, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipeline]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
@@ -2168,17 +2172,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineLayout]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineLayout(device, pipelineLayout, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineLayout]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
     DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineLayout]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
@@ -2191,17 +2195,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(
     VkSampler*                                  pSampler) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSampler]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSampler]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     }
     VkResult result = DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSampler]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler, result);
     }
@@ -2214,17 +2218,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySampler]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySampler(device, sampler, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySampler]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySampler(device, sampler, pAllocator);
     }
     DispatchDestroySampler(device, sampler, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySampler]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySampler(device, sampler, pAllocator);
     }
@@ -2237,17 +2241,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(
     VkDescriptorSetLayout*                      pSetLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorSetLayout]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorSetLayout]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     }
     VkResult result = DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorSetLayout]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, result);
     }
@@ -2260,17 +2264,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorSetLayout]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorSetLayout]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
     DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorSetLayout]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
@@ -2283,17 +2287,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(
     VkDescriptorPool*                           pDescriptorPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     }
     VkResult result = DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool, result);
     }
@@ -2306,17 +2310,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorPool(device, descriptorPool, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
     DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
@@ -2328,17 +2332,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(
     VkDescriptorPoolResetFlags                  flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetDescriptorPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetDescriptorPool(device, descriptorPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetDescriptorPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetDescriptorPool(device, descriptorPool, flags);
     }
     VkResult result = DispatchResetDescriptorPool(device, descriptorPool, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetDescriptorPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetDescriptorPool(device, descriptorPool, flags, result);
     }
@@ -2352,17 +2356,17 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
     const VkDescriptorSet*                      pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeDescriptorSets]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeDescriptorSets]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     }
     VkResult result = DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeDescriptorSets]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets, result);
     }
@@ -2377,17 +2381,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(
     const VkCopyDescriptorSet*                  pDescriptorCopies) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSets]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
     DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSets]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
@@ -2400,17 +2404,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(
     VkFramebuffer*                              pFramebuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFramebuffer]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFramebuffer]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     }
     VkResult result = DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFramebuffer]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer, result);
     }
@@ -2423,17 +2427,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFramebuffer]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFramebuffer(device, framebuffer, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFramebuffer]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
     DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFramebuffer]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
@@ -2446,17 +2450,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
@@ -2469,17 +2473,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyRenderPass]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyRenderPass(device, renderPass, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyRenderPass]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
     DispatchDestroyRenderPass(device, renderPass, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyRenderPass]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
@@ -2491,17 +2495,17 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(
     VkExtent2D*                                 pGranularity) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRenderAreaGranularity]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRenderAreaGranularity(device, renderPass, pGranularity);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRenderAreaGranularity]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
     DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRenderAreaGranularity]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
@@ -2514,17 +2518,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(
     VkCommandPool*                              pCommandPool) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCommandPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCommandPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     }
     VkResult result = DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCommandPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool, result);
     }
@@ -2537,17 +2541,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCommandPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCommandPool(device, commandPool, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCommandPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
     DispatchDestroyCommandPool(device, commandPool, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCommandPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
@@ -2559,17 +2563,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(
     VkCommandPoolResetFlags                     flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandPool(device, commandPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetCommandPool(device, commandPool, flags);
     }
     VkResult result = DispatchResetCommandPool(device, commandPool, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetCommandPool(device, commandPool, flags, result);
     }
@@ -2582,17 +2586,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(
     VkCommandBuffer*                            pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateCommandBuffers]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateCommandBuffers]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     }
     VkResult result = DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateCommandBuffers]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers, result);
     }
@@ -2606,17 +2610,17 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
     const VkCommandBuffer*                      pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeCommandBuffers]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeCommandBuffers]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
     DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeCommandBuffers]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
@@ -2627,17 +2631,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
     const VkCommandBufferBeginInfo*             pBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo);
     }
     VkResult result = DispatchBeginCommandBuffer(commandBuffer, pBeginInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, result);
     }
@@ -2648,17 +2652,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEndCommandBuffer]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEndCommandBuffer(commandBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEndCommandBuffer]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEndCommandBuffer(commandBuffer);
     }
     VkResult result = DispatchEndCommandBuffer(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEndCommandBuffer]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEndCommandBuffer(commandBuffer, result);
     }
@@ -2670,17 +2674,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
     VkCommandBufferResetFlags                   flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandBuffer]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandBuffer(commandBuffer, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandBuffer]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetCommandBuffer(commandBuffer, flags);
     }
     VkResult result = DispatchResetCommandBuffer(commandBuffer, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandBuffer]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetCommandBuffer(commandBuffer, flags, result);
     }
@@ -2693,18 +2697,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(
     VkPipeline                                  pipeline) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipeline]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipeline]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
     DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipeline]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
 }
@@ -2716,18 +2720,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
     const VkViewport*                           pViewports) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewport]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewport]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
     DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewport]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
 }
@@ -2739,18 +2743,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
     const VkRect2D*                             pScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissor]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissor]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
     DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissor]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
 }
@@ -2760,18 +2764,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(
     float                                       lineWidth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineWidth]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineWidth]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
     DispatchCmdSetLineWidth(commandBuffer, lineWidth);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineWidth]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
 }
@@ -2783,18 +2787,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(
     float                                       depthBiasSlopeFactor) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBias]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
     DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBias]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
 }
@@ -2804,18 +2808,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(
     const float                                 blendConstants[4]) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetBlendConstants]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetBlendConstants]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
     DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetBlendConstants]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
 }
@@ -2826,18 +2830,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(
     float                                       maxDepthBounds) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBounds]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBounds]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
     DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBounds]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
 }
@@ -2848,18 +2852,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(
     uint32_t                                    compareMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilCompareMask]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilCompareMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
     DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilCompareMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
 }
@@ -2870,18 +2874,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(
     uint32_t                                    writeMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilWriteMask]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilWriteMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
     DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilWriteMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
 }
@@ -2892,18 +2896,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(
     uint32_t                                    reference) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilReference]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilReference]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
     DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilReference]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
 }
@@ -2919,18 +2923,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(
     const uint32_t*                             pDynamicOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorSets]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
     DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorSets]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 }
@@ -2942,18 +2946,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(
     VkIndexType                                 indexType) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindIndexBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
     DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindIndexBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
 }
@@ -2966,18 +2970,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(
     const VkDeviceSize*                         pOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
     DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
 }
@@ -2990,18 +2994,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(
     uint32_t                                    firstInstance) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDraw]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDraw]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
     DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDraw]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
 }
@@ -3015,18 +3019,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(
     uint32_t                                    firstInstance) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexed]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexed]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
     DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexed]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 }
@@ -3039,18 +3043,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3063,18 +3067,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3086,18 +3090,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatch]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatch]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatch]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3108,18 +3112,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(
     VkDeviceSize                                offset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
     DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchIndirect]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
 }
@@ -3132,18 +3136,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
     const VkBufferCopy*                         pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3158,18 +3162,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
     const VkImageCopy*                          pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3185,18 +3189,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
     VkFilter                                    filter) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
     DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
 }
@@ -3210,18 +3214,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
     const VkBufferImageCopy*                    pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3235,18 +3239,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
     const VkBufferImageCopy*                    pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3259,18 +3263,18 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdateBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdUpdateBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
     DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdUpdateBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
 }
@@ -3283,18 +3287,18 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(
     uint32_t                                    data) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdFillBuffer]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdFillBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
     DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdFillBuffer]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
 }
@@ -3308,18 +3312,18 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
     const VkImageSubresourceRange*              pRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearColorImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearColorImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
     DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearColorImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
 }
@@ -3333,18 +3337,18 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
     const VkImageSubresourceRange*              pRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearDepthStencilImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearDepthStencilImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
     DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearDepthStencilImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
 }
@@ -3357,18 +3361,18 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
     const VkClearRect*                          pRects) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearAttachments]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearAttachments]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearAttachments]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
 }
@@ -3383,18 +3387,18 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
     const VkImageResolve*                       pRegions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3405,18 +3409,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(
     VkPipelineStageFlags                        stageMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdSetEvent(commandBuffer, event, stageMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3427,18 +3431,18 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(
     VkPipelineStageFlags                        stageMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent(commandBuffer, event, stageMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3457,18 +3461,18 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
     const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3486,18 +3490,18 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
     const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3509,18 +3513,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(
     VkQueryControlFlags                         flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQuery]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQuery]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
     DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQuery]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
 }
@@ -3531,18 +3535,18 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(
     uint32_t                                    query) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQuery]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQuery]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
     DispatchCmdEndQuery(commandBuffer, queryPool, query);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQuery]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
 }
@@ -3554,18 +3558,18 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetQueryPool]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetQueryPool]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
     DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetQueryPool]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
 }
@@ -3577,18 +3581,18 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(
     uint32_t                                    query) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
     DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
 }
@@ -3604,18 +3608,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(
     VkQueryResultFlags                          flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyQueryPoolResults]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyQueryPoolResults]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
     DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyQueryPoolResults]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
 }
@@ -3629,18 +3633,18 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(
     const void*                                 pValues) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushConstants]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
     DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushConstants]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
 }
@@ -3651,18 +3655,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
     VkSubpassContents                           contents) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
     DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
 }
@@ -3672,18 +3676,18 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
     VkSubpassContents                           contents) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass(commandBuffer, contents);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdNextSubpass(commandBuffer, contents);
     }
     DispatchCmdNextSubpass(commandBuffer, contents);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdNextSubpass(commandBuffer, contents);
     }
 }
@@ -3692,18 +3696,18 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdEndRenderPass(commandBuffer);
     }
     DispatchCmdEndRenderPass(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdEndRenderPass(commandBuffer);
     }
 }
@@ -3714,18 +3718,18 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(
     const VkCommandBuffer*                      pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteCommands]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteCommands]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
     DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteCommands]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
 }
@@ -3737,17 +3741,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(
     const VkBindBufferMemoryInfo*               pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos, result);
     }
@@ -3760,17 +3764,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(
     const VkBindImageMemoryInfo*                pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, result);
     }
@@ -3785,17 +3789,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(
     VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
@@ -3806,18 +3810,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(
     uint32_t                                    deviceMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMask]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMask]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
 }
@@ -3832,18 +3836,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBase]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBase]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBase]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3854,17 +3858,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroups(
     VkPhysicalDeviceGroupProperties*            pPhysicalDeviceGroupProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEnumeratePhysicalDeviceGroups]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEnumeratePhysicalDeviceGroups]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEnumeratePhysicalDeviceGroups]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     }
@@ -3877,17 +3881,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
@@ -3899,17 +3903,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
@@ -3922,17 +3926,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(
     VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
@@ -3943,17 +3947,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2(
     VkPhysicalDeviceFeatures2*                  pFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceFeatures2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceFeatures2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceFeatures2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     }
@@ -3964,17 +3968,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(
     VkPhysicalDeviceProperties2*                pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceProperties2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties2(physicalDevice, pProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties2(physicalDevice, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     }
@@ -3986,17 +3990,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2(
     VkFormatProperties2*                        pFormatProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     }
@@ -4008,17 +4012,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2(
     VkImageFormatProperties2*                   pImageFormatProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     }
@@ -4031,17 +4035,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2(
     VkQueueFamilyProperties2*                   pQueueFamilyProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
@@ -4052,17 +4056,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2(
     VkPhysicalDeviceMemoryProperties2*          pMemoryProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     }
@@ -4075,17 +4079,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(
     VkSparseImageFormatProperties2*             pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
@@ -4097,17 +4101,17 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(
     VkCommandPoolTrimFlags                      flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPool(device, commandPool, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordTrimCommandPool(device, commandPool, flags);
     }
     DispatchTrimCommandPool(device, commandPool, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordTrimCommandPool(device, commandPool, flags);
     }
@@ -4119,17 +4123,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(
     VkQueue*                                    pQueue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue2(device, pQueueInfo, pQueue);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
     DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
@@ -4142,17 +4146,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(
     VkSamplerYcbcrConversion*                   pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversion]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversion]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversion]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
@@ -4165,17 +4169,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversion]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversion]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversion]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
@@ -4188,17 +4192,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(
     VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplate]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplate]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplate]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
@@ -4211,17 +4215,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
@@ -4234,17 +4238,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
@@ -4256,17 +4260,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferProperties(
     VkExternalBufferProperties*                 pExternalBufferProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceExternalBufferProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceExternalBufferProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
     DispatchGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceExternalBufferProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
@@ -4278,17 +4282,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFenceProperties(
     VkExternalFenceProperties*                  pExternalFenceProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceExternalFenceProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceExternalFenceProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
     DispatchGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceExternalFenceProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
@@ -4300,17 +4304,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
     VkExternalSemaphoreProperties*              pExternalSemaphoreProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceExternalSemaphoreProperties]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceExternalSemaphoreProperties]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
     DispatchGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceExternalSemaphoreProperties]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
@@ -4322,17 +4326,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(
     VkDescriptorSetLayoutSupport*               pSupport) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupport]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupport]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupport]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
@@ -4349,18 +4353,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCount]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCount]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4375,18 +4379,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCount]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCount]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCount]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4398,17 +4402,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
@@ -4421,18 +4425,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
     const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -4443,18 +4447,18 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -4464,18 +4468,18 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -4487,17 +4491,17 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPool]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPool(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPool]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPool]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
@@ -4509,17 +4513,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(
     uint64_t*                                   pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValue]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValue(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValue]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSemaphoreCounterValue(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValue]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, result);
     }
@@ -4532,17 +4536,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphores]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphores(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphores]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordWaitSemaphores(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphores(device, pWaitInfo, timeout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphores]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
     }
@@ -4554,17 +4558,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(
     const VkSemaphoreSignalInfo*                pSignalInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphore]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphore(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphore]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSignalSemaphore(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphore(device, pSignalInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphore]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSignalSemaphore(device, pSignalInfo, result);
     }
@@ -4576,17 +4580,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddress]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddress(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddress]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferDeviceAddress(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddress(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddress]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferDeviceAddress(device, pInfo, result);
     }
@@ -4598,17 +4602,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddress]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
@@ -4620,17 +4624,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(
     const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
@@ -4644,17 +4648,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySurfaceKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySurfaceKHR(instance, surface, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySurfaceKHR(instance, surface, pAllocator);
     }
     DispatchDestroySurfaceKHR(instance, surface, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySurfaceKHR(instance, surface, pAllocator);
     }
@@ -4667,17 +4671,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(
     VkBool32*                                   pSupported) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSurfaceSupportKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSurfaceSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSurfaceSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported, result);
     }
@@ -4690,17 +4694,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilitiesKHR(
     VkSurfaceCapabilitiesKHR*                   pSurfaceCapabilities) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities, result);
     }
@@ -4714,17 +4718,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormatsKHR(
     VkSurfaceFormatKHR*                         pSurfaceFormats) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSurfaceFormatsKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSurfaceFormatsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSurfaceFormatsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats, result);
     }
@@ -4738,17 +4742,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(
     VkPresentModeKHR*                           pPresentModes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSurfacePresentModesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSurfacePresentModesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSurfacePresentModesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes, result);
     }
@@ -4763,17 +4767,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(
     VkSwapchainKHR*                             pSwapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSwapchainKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSwapchainKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     }
     VkResult result = DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSwapchainKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, result);
     }
@@ -4786,17 +4790,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySwapchainKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySwapchainKHR(device, swapchain, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySwapchainKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
     DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySwapchainKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
@@ -4809,17 +4813,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(
     VkImage*                                    pSwapchainImages) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainImagesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainImagesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     }
     VkResult result = DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainImagesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, result);
     }
@@ -4835,17 +4839,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(
     uint32_t*                                   pImageIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImageKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImageKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImageKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     }
@@ -4857,17 +4861,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
     const VkPresentInfoKHR*                     pPresentInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueuePresentKHR(queue, pPresentInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueuePresentKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueuePresentKHR(queue, pPresentInfo);
     }
     VkResult result = DispatchQueuePresentKHR(queue, pPresentInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueuePresentKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     }
@@ -4879,17 +4883,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupPresentCapabilitiesKHR(
     VkDeviceGroupPresentCapabilitiesKHR*        pDeviceGroupPresentCapabilities) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     }
     VkResult result = DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities, result);
     }
@@ -4902,17 +4906,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(
     VkDeviceGroupPresentModeFlagsKHR*           pModes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes, result);
     }
@@ -4926,17 +4930,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDevicePresentRectanglesKHR(
     VkRect2D*                                   pRects) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDevicePresentRectanglesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDevicePresentRectanglesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
     }
     VkResult result = DispatchGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDevicePresentRectanglesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects, result);
     }
@@ -4949,17 +4953,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(
     uint32_t*                                   pImageIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImage2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImage2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImage2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     }
@@ -4973,17 +4977,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(
     VkDisplayPropertiesKHR*                     pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceDisplayPropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceDisplayPropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceDisplayPropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -4996,17 +5000,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlanePropertiesKHR(
     VkDisplayPlanePropertiesKHR*                pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceDisplayPlanePropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -5020,17 +5024,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneSupportedDisplaysKHR(
     VkDisplayKHR*                               pDisplays) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDisplayPlaneSupportedDisplaysKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDisplayPlaneSupportedDisplaysKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     }
     VkResult result = DispatchGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDisplayPlaneSupportedDisplaysKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays, result);
     }
@@ -5044,17 +5048,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(
     VkDisplayModePropertiesKHR*                 pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDisplayModePropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDisplayModePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDisplayModePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties, result);
     }
@@ -5069,17 +5073,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayModeKHR(
     VkDisplayModeKHR*                           pMode) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDisplayModeKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDisplayModeKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     }
     VkResult result = DispatchCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDisplayModeKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode, result);
     }
@@ -5093,17 +5097,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilitiesKHR(
     VkDisplayPlaneCapabilitiesKHR*              pCapabilities) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDisplayPlaneCapabilitiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDisplayPlaneCapabilitiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
     }
     VkResult result = DispatchGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDisplayPlaneCapabilitiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities, result);
     }
@@ -5117,17 +5121,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDisplayPlaneSurfaceKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDisplayPlaneSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDisplayPlaneSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5143,17 +5147,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(
     VkSwapchainKHR*                             pSwapchains) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSharedSwapchainsKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSharedSwapchainsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     }
     VkResult result = DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSharedSwapchainsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains, result);
     }
@@ -5169,17 +5173,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateXlibSurfaceKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateXlibSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateXlibSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5193,17 +5197,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKHR(
     VisualID                                    visualID) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceXlibPresentationSupportKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
         if (skip) return VK_FALSE;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceXlibPresentationSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     }
     VkBool32 result = DispatchGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceXlibPresentationSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     }
@@ -5220,17 +5224,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateXcbSurfaceKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateXcbSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateXcbSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5244,17 +5248,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR(
     xcb_visualid_t                              visual_id) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceXcbPresentationSupportKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
         if (skip) return VK_FALSE;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceXcbPresentationSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     }
     VkBool32 result = DispatchGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceXcbPresentationSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     }
@@ -5271,17 +5275,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateWaylandSurfaceKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateWaylandSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateWaylandSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5294,17 +5298,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSupportKHR(
     struct wl_display*                          display) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceWaylandPresentationSupportKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
         if (skip) return VK_FALSE;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     }
     VkBool32 result = DispatchGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     }
@@ -5321,17 +5325,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAndroidSurfaceKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAndroidSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAndroidSurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5348,17 +5352,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateWin32SurfaceKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateWin32SurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateWin32SurfaceKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -5370,17 +5374,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportKHR(
     uint32_t                                    queueFamilyIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceWin32PresentationSupportKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
         if (skip) return VK_FALSE;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceWin32PresentationSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     }
     VkBool32 result = DispatchGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceWin32PresentationSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     }
@@ -5396,17 +5400,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2KHR(
     VkPhysicalDeviceFeatures2*                  pFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceFeatures2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceFeatures2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceFeatures2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     }
@@ -5417,17 +5421,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2KHR(
     VkPhysicalDeviceProperties2*                pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     }
@@ -5439,17 +5443,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2KHR(
     VkFormatProperties2*                        pFormatProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     }
@@ -5461,17 +5465,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2KHR(
     VkImageFormatProperties2*                   pImageFormatProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     }
@@ -5484,17 +5488,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2KHR(
     VkQueueFamilyProperties2*                   pQueueFamilyProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
@@ -5505,17 +5509,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2KHR(
     VkPhysicalDeviceMemoryProperties2*          pMemoryProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     }
@@ -5528,17 +5532,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2KHR(
     VkSparseImageFormatProperties2*             pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
@@ -5553,17 +5557,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(
     VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
@@ -5574,18 +5578,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(
     uint32_t                                    deviceMask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMaskKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMaskKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMaskKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
 }
@@ -5600,18 +5604,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(
     uint32_t                                    groupCountZ) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBaseKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBaseKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBaseKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -5624,17 +5628,17 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(
     VkCommandPoolTrimFlags                      flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPoolKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPoolKHR(device, commandPool, flags);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPoolKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
     DispatchTrimCommandPoolKHR(device, commandPool, flags);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPoolKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
@@ -5647,17 +5651,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroupsKHR(
     VkPhysicalDeviceGroupProperties*            pPhysicalDeviceGroupProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEnumeratePhysicalDeviceGroupsKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEnumeratePhysicalDeviceGroupsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEnumeratePhysicalDeviceGroupsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     }
@@ -5671,17 +5675,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferPropertiesKHR(
     VkExternalBufferProperties*                 pExternalBufferProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceExternalBufferPropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
     DispatchGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
@@ -5696,17 +5700,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
@@ -5720,17 +5724,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(
     VkMemoryWin32HandlePropertiesKHR*           pMemoryWin32HandleProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     }
     VkResult result = DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties, result);
     }
@@ -5745,17 +5749,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd, result);
     }
@@ -5769,17 +5773,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(
     VkMemoryFdPropertiesKHR*                    pMemoryFdProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdPropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdPropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     }
     VkResult result = DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdPropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties, result);
     }
@@ -5796,17 +5800,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphorePropertiesKHR(
     VkExternalSemaphoreProperties*              pExternalSemaphoreProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceExternalSemaphorePropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
     DispatchGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
@@ -5820,17 +5824,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreWin32HandleKHR(
     const VkImportSemaphoreWin32HandleInfoKHR*  pImportSemaphoreWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     }
     VkResult result = DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo, result);
     }
@@ -5843,17 +5847,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
@@ -5867,17 +5871,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(
     const VkImportSemaphoreFdInfoKHR*           pImportSemaphoreFdInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreFdKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     }
     VkResult result = DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo, result);
     }
@@ -5890,17 +5894,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreFdKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd, result);
     }
@@ -5917,18 +5921,18 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
     const VkWriteDescriptorSet*                 pDescriptorWrites) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
     DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
 }
@@ -5941,18 +5945,18 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
     DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
 }
@@ -5968,17 +5972,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(
     VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
@@ -5991,17 +5995,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
@@ -6014,17 +6018,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(
     const void*                                 pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
@@ -6039,17 +6043,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
     VkRenderPass*                               pRenderPass) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
@@ -6062,18 +6066,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
     const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -6084,18 +6088,18 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -6105,18 +6109,18 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
     const VkSubpassEndInfo*                     pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -6127,17 +6131,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainStatusKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainStatusKHR(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainStatusKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSwapchainStatusKHR(device, swapchain);
     }
     VkResult result = DispatchGetSwapchainStatusKHR(device, swapchain);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainStatusKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSwapchainStatusKHR(device, swapchain, result);
     }
@@ -6151,17 +6155,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFencePropertiesKHR(
     VkExternalFenceProperties*                  pExternalFenceProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceExternalFencePropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceExternalFencePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
     DispatchGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceExternalFencePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
@@ -6175,17 +6179,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(
     const VkImportFenceWin32HandleInfoKHR*      pImportFenceWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceWin32HandleKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     }
     VkResult result = DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo, result);
     }
@@ -6198,17 +6202,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceWin32HandleKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceWin32HandleKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
@@ -6222,17 +6226,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(
     const VkImportFenceFdInfoKHR*               pImportFenceFdInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceFdKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceFdKHR(device, pImportFenceFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordImportFenceFdKHR(device, pImportFenceFdInfo);
     }
     VkResult result = DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordImportFenceFdKHR(device, pImportFenceFdInfo, result);
     }
@@ -6245,17 +6249,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(
     int*                                        pFd) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceFdKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceFdKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd, result);
     }
@@ -6271,17 +6275,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceQueueFamilyPerformanceQuer
     VkPerformanceCounterDescriptionKHR*         pCounterDescriptions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions, result);
     }
@@ -6294,17 +6298,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
     uint32_t*                                   pNumPasses) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     }
     DispatchGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     }
@@ -6315,17 +6319,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
     const VkAcquireProfilingLockInfoKHR*        pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireProfilingLockKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireProfilingLockKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireProfilingLockKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireProfilingLockKHR(device, pInfo);
     }
     VkResult result = DispatchAcquireProfilingLockKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireProfilingLockKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireProfilingLockKHR(device, pInfo, result);
     }
@@ -6336,17 +6340,17 @@ VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseProfilingLockKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseProfilingLockKHR(device);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseProfilingLockKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordReleaseProfilingLockKHR(device);
     }
     DispatchReleaseProfilingLockKHR(device);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseProfilingLockKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordReleaseProfilingLockKHR(device);
     }
@@ -6360,17 +6364,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2KHR(
     VkSurfaceCapabilities2KHR*                  pSurfaceCapabilities) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilities2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities, result);
     }
@@ -6384,17 +6388,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormats2KHR(
     VkSurfaceFormat2KHR*                        pSurfaceFormats) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSurfaceFormats2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSurfaceFormats2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSurfaceFormats2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats, result);
     }
@@ -6409,17 +6413,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayProperties2KHR(
     VkDisplayProperties2KHR*                    pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceDisplayProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceDisplayProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceDisplayProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -6432,17 +6436,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlaneProperties2KHR(
     VkDisplayPlaneProperties2KHR*               pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceDisplayPlaneProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -6456,17 +6460,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModeProperties2KHR(
     VkDisplayModeProperties2KHR*                pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDisplayModeProperties2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDisplayModeProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDisplayModeProperties2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties, result);
     }
@@ -6479,17 +6483,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilities2KHR(
     VkDisplayPlaneCapabilities2KHR*             pCapabilities) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDisplayPlaneCapabilities2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDisplayPlaneCapabilities2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
     }
     VkResult result = DispatchGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDisplayPlaneCapabilities2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities, result);
     }
@@ -6506,17 +6510,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
@@ -6528,17 +6532,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
@@ -6551,17 +6555,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(
     VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
@@ -6576,17 +6580,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(
     VkSamplerYcbcrConversion*                   pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
@@ -6599,17 +6603,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
@@ -6622,17 +6626,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(
     const VkBindBufferMemoryInfo*               pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
@@ -6645,17 +6649,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(
     const VkBindImageMemoryInfo*                pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2KHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2KHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
@@ -6672,17 +6676,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(
     VkDescriptorSetLayoutSupport*               pSupport) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
@@ -6699,18 +6703,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -6725,18 +6729,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -6756,17 +6760,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(
     uint64_t*                                   pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValueKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValueKHR(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValueKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValueKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue, result);
     }
@@ -6779,17 +6783,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(
     uint64_t                                    timeout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphoresKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphoresKHR(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphoresKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphoresKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
     }
@@ -6801,17 +6805,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(
     const VkSemaphoreSignalInfo*                pSignalInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphoreKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphoreKHR(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphoreKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSignalSemaphoreKHR(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphoreKHR(device, pSignalInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphoreKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSignalSemaphoreKHR(device, pSignalInfo, result);
     }
@@ -6829,17 +6833,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferDeviceAddressKHR(device, pInfo, result);
     }
@@ -6851,17 +6855,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddressKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
@@ -6873,17 +6877,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(
     const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
@@ -6898,17 +6902,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(
     VkDeferredOperationKHR*                     pDeferredOperation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDeferredOperationKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDeferredOperationKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
     }
     VkResult result = DispatchCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDeferredOperationKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation, result);
     }
@@ -6921,17 +6925,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDeferredOperationKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDeferredOperationKHR(device, operation, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDeferredOperationKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
     DispatchDestroyDeferredOperationKHR(device, operation, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDeferredOperationKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
@@ -6942,17 +6946,17 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(
     VkDeferredOperationKHR                      operation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationMaxConcurrencyKHR(device, operation);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
     uint32_t result = DispatchGetDeferredOperationMaxConcurrencyKHR(device, operation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
@@ -6964,17 +6968,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(
     VkDeferredOperationKHR                      operation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationResultKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationResultKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationResultKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeferredOperationResultKHR(device, operation);
     }
     VkResult result = DispatchGetDeferredOperationResultKHR(device, operation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationResultKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeferredOperationResultKHR(device, operation, result);
     }
@@ -6986,17 +6990,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DeferredOperationJoinKHR(
     VkDeferredOperationKHR                      operation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeferredOperationJoinKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeferredOperationJoinKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeferredOperationJoinKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDeferredOperationJoinKHR(device, operation);
     }
     VkResult result = DispatchDeferredOperationJoinKHR(device, operation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeferredOperationJoinKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDeferredOperationJoinKHR(device, operation, result);
     }
@@ -7012,17 +7016,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(
     VkPipelineExecutablePropertiesKHR*          pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutablePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     }
     VkResult result = DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties, result);
     }
@@ -7036,17 +7040,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(
     VkPipelineExecutableStatisticKHR*           pStatistics) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableStatisticsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     }
     VkResult result = DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics, result);
     }
@@ -7060,17 +7064,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     }
     VkResult result = DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations, result);
     }
@@ -7087,18 +7091,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(
     const VkCopyBufferInfo2KHR*                 pCopyBufferInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
         if (skip) return;
-    }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    }
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     }
     DispatchCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     }
 }
@@ -7108,18 +7112,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(
     const VkCopyImageInfo2KHR*                  pCopyImageInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     }
     DispatchCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     }
 }
@@ -7129,18 +7133,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(
     const VkCopyBufferToImageInfo2KHR*          pCopyBufferToImageInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     }
     DispatchCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     }
 }
@@ -7150,18 +7154,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(
     const VkCopyImageToBufferInfo2KHR*          pCopyImageToBufferInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     }
     DispatchCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     }
 }
@@ -7171,18 +7175,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(
     const VkBlitImageInfo2KHR*                  pBlitImageInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     }
     DispatchCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     }
 }
@@ -7192,18 +7196,18 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(
     const VkResolveImageInfo2KHR*               pResolveImageInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2KHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     }
     DispatchCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage2KHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     }
 }
@@ -7216,18 +7220,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(
     VkDebugReportCallbackEXT*                   pCallback) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDebugReportCallbackEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDebugReportCallbackEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     }
     VkResult result = DispatchCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     layer_create_report_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pCallback);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDebugReportCallbackEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback, result);
     }
@@ -7240,18 +7244,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDebugReportCallbackEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDebugReportCallbackEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     }
     DispatchDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     layer_destroy_callback(layer_data->report_data, callback, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDebugReportCallbackEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     }
@@ -7268,17 +7272,17 @@ VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(
     const char*                                 pMessage) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugReportMessageEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugReportMessageEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     }
     DispatchDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugReportMessageEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     }
@@ -7296,17 +7300,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(
     const VkDebugMarkerObjectTagInfoEXT*        pTagInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo, result);
     }
@@ -7318,18 +7322,18 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(
     const VkDebugMarkerObjectNameInfoEXT*       pNameInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetMarkerObjectName(pNameInfo);
     VkResult result = DispatchDebugMarkerSetObjectNameEXT(device, pNameInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo, result);
     }
@@ -7341,18 +7345,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
     const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerBeginEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerBeginEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerBeginEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -7361,18 +7365,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerEndEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerEndEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
     DispatchCmdDebugMarkerEndEXT(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerEndEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
 }
@@ -7382,18 +7386,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
     const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerInsertEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerInsertEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerInsertEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -7410,18 +7414,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(
     const VkDeviceSize*                         pSizes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
     DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
 }
@@ -7434,18 +7438,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(
     const VkDeviceSize*                         pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -7458,18 +7462,18 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(
     const VkDeviceSize*                         pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndTransformFeedbackEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -7482,18 +7486,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(
     uint32_t                                    index) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
     DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
 }
@@ -7505,18 +7509,18 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(
     uint32_t                                    index) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
     DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQueryIndexedEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
 }
@@ -7531,18 +7535,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(
     uint32_t                                    vertexStride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
     DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
 }
@@ -7553,17 +7557,17 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(
     const VkImageViewHandleInfoNVX*             pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewHandleNVX]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewHandleNVX(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewHandleNVX]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     uint32_t result = DispatchGetImageViewHandleNVX(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewHandleNVX]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageViewHandleNVX(device, pInfo);
     }
@@ -7576,17 +7580,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageViewAddressNVX(
     VkImageViewAddressPropertiesNVX*            pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewAddressNVX]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewAddressNVX(device, imageView, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewAddressNVX]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageViewAddressNVX(device, imageView, pProperties);
     }
     VkResult result = DispatchGetImageViewAddressNVX(device, imageView, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewAddressNVX]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageViewAddressNVX(device, imageView, pProperties, result);
     }
@@ -7604,18 +7608,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7630,18 +7634,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7660,17 +7664,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(
     void*                                       pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderInfoAMD]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetShaderInfoAMD]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     }
     VkResult result = DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetShaderInfoAMD]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo, result);
     }
@@ -7687,17 +7691,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateStreamDescriptorSurfaceGGP(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateStreamDescriptorSurfaceGGP]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateStreamDescriptorSurfaceGGP]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateStreamDescriptorSurfaceGGP]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -7719,17 +7723,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceExternalImageFormatPropertiesNV(
     VkExternalImageFormatPropertiesNV*          pExternalImageFormatProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceExternalImageFormatPropertiesNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties, result);
     }
@@ -7746,17 +7750,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(
     HANDLE*                                     pHandle) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle, result);
     }
@@ -7777,17 +7781,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateViSurfaceNN]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateViSurfaceNN]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateViSurfaceNN]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -7805,18 +7809,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
     const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
     DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
 }
@@ -7825,18 +7829,18 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
     DispatchCmdEndConditionalRenderingEXT(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndConditionalRenderingEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
 }
@@ -7849,18 +7853,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
     const VkViewportWScalingNV*                 pViewportWScalings) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWScalingNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
     DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWScalingNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
 }
@@ -7871,17 +7875,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseDisplayEXT(
     VkDisplayKHR                                display) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseDisplayEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseDisplayEXT(physicalDevice, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseDisplayEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordReleaseDisplayEXT(physicalDevice, display);
     }
     VkResult result = DispatchReleaseDisplayEXT(physicalDevice, display);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseDisplayEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordReleaseDisplayEXT(physicalDevice, display, result);
     }
@@ -7896,17 +7900,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireXlibDisplayEXT(
     VkDisplayKHR                                display) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireXlibDisplayEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireXlibDisplayEXT(physicalDevice, dpy, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireXlibDisplayEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display);
     }
     VkResult result = DispatchAcquireXlibDisplayEXT(physicalDevice, dpy, display);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireXlibDisplayEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display, result);
     }
@@ -7920,17 +7924,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRandROutputDisplayEXT(
     VkDisplayKHR*                               pDisplay) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRandROutputDisplayEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRandROutputDisplayEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     }
     VkResult result = DispatchGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRandROutputDisplayEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay, result);
     }
@@ -7945,17 +7949,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2EXT(
     VkSurfaceCapabilities2EXT*                  pSurfaceCapabilities) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilities2EXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities, result);
     }
@@ -7969,17 +7973,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(
     const VkDisplayPowerInfoEXT*                pDisplayPowerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDisplayPowerControlEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDisplayPowerControlEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     }
     VkResult result = DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDisplayPowerControlEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo, result);
     }
@@ -7993,17 +7997,17 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDeviceEventEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDeviceEventEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDeviceEventEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence, result);
     }
@@ -8018,17 +8022,17 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(
     VkFence*                                    pFence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDisplayEventEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDisplayEventEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDisplayEventEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence, result);
     }
@@ -8042,17 +8046,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(
     uint64_t*                                   pCounterValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainCounterEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainCounterEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     }
     VkResult result = DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainCounterEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue, result);
     }
@@ -8066,17 +8070,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(
     VkRefreshCycleDurationGOOGLE*               pDisplayTimingProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     }
     VkResult result = DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties, result);
     }
@@ -8090,17 +8094,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(
     VkPastPresentationTimingGOOGLE*             pPresentationTimings) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     }
     VkResult result = DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings, result);
     }
@@ -8120,18 +8124,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
     const VkRect2D*                             pDiscardRectangles) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDiscardRectangleEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
     DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDiscardRectangleEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
 }
@@ -8147,17 +8151,17 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(
     const VkHdrMetadataEXT*                     pMetadata) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetHdrMetadataEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetHdrMetadataEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
     DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetHdrMetadataEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
@@ -8172,17 +8176,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateIOSSurfaceMVK]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateIOSSurfaceMVK]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateIOSSurfaceMVK]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -8199,17 +8203,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMacOSSurfaceMVK(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateMacOSSurfaceMVK]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateMacOSSurfaceMVK]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateMacOSSurfaceMVK]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -8225,18 +8229,18 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(
     const VkDebugUtilsObjectNameInfoEXT*        pNameInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);
     VkResult result = DispatchSetDebugUtilsObjectNameEXT(device, pNameInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo, result);
     }
@@ -8248,17 +8252,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(
     const VkDebugUtilsObjectTagInfoEXT*         pTagInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo, result);
     }
@@ -8270,18 +8274,18 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     BeginQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
@@ -8291,18 +8295,18 @@ VKAPI_ATTR void VKAPI_CALL QueueEndDebugUtilsLabelEXT(
     VkQueue                                     queue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueEndDebugUtilsLabelEXT(queue);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
     DispatchQueueEndDebugUtilsLabelEXT(queue);
     EndQueueDebugUtilsLabel(layer_data->report_data, queue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
@@ -8313,18 +8317,18 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
@@ -8335,18 +8339,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -8355,18 +8359,18 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(
     VkCommandBuffer                             commandBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
     DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
 }
@@ -8376,18 +8380,18 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
     const VkDebugUtilsLabelEXT*                 pLabelInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -8399,18 +8403,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(
     VkDebugUtilsMessengerEXT*                   pMessenger) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDebugUtilsMessengerEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDebugUtilsMessengerEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     }
     VkResult result = DispatchCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     layer_create_messenger_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pMessenger);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDebugUtilsMessengerEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger, result);
     }
@@ -8423,18 +8427,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugUtilsMessengerEXT(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDebugUtilsMessengerEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDebugUtilsMessengerEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     }
     DispatchDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     layer_destroy_callback(layer_data->report_data, messenger, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDebugUtilsMessengerEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     }
@@ -8447,17 +8451,17 @@ VKAPI_ATTR void VKAPI_CALL SubmitDebugUtilsMessageEXT(
     const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSubmitDebugUtilsMessageEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSubmitDebugUtilsMessageEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     }
     DispatchSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSubmitDebugUtilsMessageEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     }
@@ -8471,17 +8475,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(
     VkAndroidHardwareBufferPropertiesANDROID*   pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     }
     VkResult result = DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties, result);
     }
@@ -8494,17 +8498,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(
     struct AHardwareBuffer**                    pBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     }
     VkResult result = DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer, result);
     }
@@ -8524,18 +8528,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
     const VkSampleLocationsInfoEXT*             pSampleLocationsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleLocationsEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
     DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleLocationsEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
 }
@@ -8546,17 +8550,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMultisamplePropertiesEXT(
     VkMultisamplePropertiesEXT*                 pMultisampleProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceMultisamplePropertiesEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceMultisamplePropertiesEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     }
     DispatchGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceMultisamplePropertiesEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     }
@@ -8575,17 +8579,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(
     VkImageDrmFormatModifierPropertiesEXT*      pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     }
     VkResult result = DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties, result);
     }
@@ -8602,18 +8606,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(
     VkImageLayout                               imageLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadingRateImageNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindShadingRateImageNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindShadingRateImageNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
 }
@@ -8625,18 +8629,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
     const VkShadingRatePaletteNV*               pShadingRatePalettes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
     DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
 }
@@ -8648,18 +8652,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
     const VkCoarseSampleOrderCustomNV*          pCustomSampleOrders) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
     DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
 }
@@ -8672,17 +8676,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(
     VkAccelerationStructureNV*                  pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
@@ -8695,17 +8699,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
@@ -8717,17 +8721,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
@@ -8739,17 +8743,17 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     VkMemoryRequirements2KHR*                   pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
@@ -8761,17 +8765,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryKHR(
     const VkBindAccelerationStructureMemoryInfoKHR* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindAccelerationStructureMemoryKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindAccelerationStructureMemoryKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindAccelerationStructureMemoryKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos, result);
     }
@@ -8784,17 +8788,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(
     const VkBindAccelerationStructureMemoryInfoKHR* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindAccelerationStructureMemoryNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindAccelerationStructureMemoryNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindAccelerationStructureMemoryNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos, result);
     }
@@ -8813,17 +8817,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
     VkDeviceSize                                scratchOffset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
     DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
@@ -8836,17 +8840,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(
     VkCopyAccelerationStructureModeKHR          mode) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
     DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
@@ -8870,18 +8874,18 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(
     uint32_t                                    depth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
     DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
 }
@@ -8895,17 +8899,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
@@ -8921,17 +8925,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
@@ -8945,17 +8949,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureHandleNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureHandleNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     }
     VkResult result = DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureHandleNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData, result);
     }
@@ -8971,18 +8975,18 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(
     uint32_t                                    firstQuery) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -8996,18 +9000,18 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(
     uint32_t                                    firstQuery) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -9018,17 +9022,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(
     uint32_t                                    shader) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCompileDeferredNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCompileDeferredNV(device, pipeline, shader);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCompileDeferredNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCompileDeferredNV(device, pipeline, shader);
     }
     VkResult result = DispatchCompileDeferredNV(device, pipeline, shader);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCompileDeferredNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCompileDeferredNV(device, pipeline, shader, result);
     }
@@ -9047,17 +9051,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(
     VkMemoryHostPointerPropertiesEXT*           pMemoryHostPointerProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     }
     VkResult result = DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties, result);
     }
@@ -9073,18 +9077,18 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(
     uint32_t                                    marker) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarkerAMD]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarkerAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarkerAMD]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
 }
@@ -9097,17 +9101,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCalibrateableTimeDomainsEXT(
     VkTimeDomainEXT*                            pTimeDomains) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceCalibrateableTimeDomainsEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
     }
     VkResult result = DispatchGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains, result);
     }
@@ -9122,17 +9126,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
     uint64_t*                                   pMaxDeviation) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetCalibratedTimestampsEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     }
     VkResult result = DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetCalibratedTimestampsEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation, result);
     }
@@ -9155,18 +9159,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(
     uint32_t                                    firstTask) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
     DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
 }
@@ -9179,18 +9183,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -9205,18 +9209,18 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -9231,18 +9235,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
     const VkRect2D*                             pExclusiveScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExclusiveScissorNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
     DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExclusiveScissorNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
 }
@@ -9253,18 +9257,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(
     const void*                                 pCheckpointMarker) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCheckpointNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCheckpointNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
     DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCheckpointNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
 }
@@ -9275,17 +9279,17 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(
     VkCheckpointDataNV*                         pCheckpointData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointDataNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueueCheckpointDataNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueueCheckpointDataNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
@@ -9298,17 +9302,17 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
     const VkInitializePerformanceApiInfoINTEL*  pInitializeInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInitializePerformanceApiINTEL]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInitializePerformanceApiINTEL(device, pInitializeInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInitializePerformanceApiINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo);
     }
     VkResult result = DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInitializePerformanceApiINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo, result);
     }
@@ -9319,17 +9323,17 @@ VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(
     VkDevice                                    device) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUninitializePerformanceApiINTEL]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUninitializePerformanceApiINTEL(device);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUninitializePerformanceApiINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordUninitializePerformanceApiINTEL(device);
     }
     DispatchUninitializePerformanceApiINTEL(device);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUninitializePerformanceApiINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordUninitializePerformanceApiINTEL(device);
     }
@@ -9340,18 +9344,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
     const VkPerformanceMarkerInfoINTEL*         pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -9362,18 +9366,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
     const VkPerformanceStreamMarkerInfoINTEL*   pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -9384,18 +9388,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
     const VkPerformanceOverrideInfoINTEL*       pOverrideInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     }
     VkResult result = DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, result);
     }
     return result;
@@ -9407,17 +9411,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(
     VkPerformanceConfigurationINTEL*            pConfiguration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     }
     VkResult result = DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration, result);
     }
@@ -9429,17 +9433,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(
     VkPerformanceConfigurationINTEL             configuration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleasePerformanceConfigurationINTEL(device, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordReleasePerformanceConfigurationINTEL(device, configuration);
     }
     VkResult result = DispatchReleasePerformanceConfigurationINTEL(device, configuration);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordReleasePerformanceConfigurationINTEL(device, configuration, result);
     }
@@ -9451,17 +9455,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(
     VkPerformanceConfigurationINTEL             configuration) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSetPerformanceConfigurationINTEL(queue, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration);
     }
     VkResult result = DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration, result);
     }
@@ -9474,17 +9478,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(
     VkPerformanceValueINTEL*                    pValue) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPerformanceParameterINTEL]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPerformanceParameterINTEL(device, parameter, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPerformanceParameterINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPerformanceParameterINTEL(device, parameter, pValue);
     }
     VkResult result = DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPerformanceParameterINTEL]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPerformanceParameterINTEL(device, parameter, pValue, result);
     }
@@ -9499,17 +9503,17 @@ VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(
     VkBool32                                    localDimmingEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLocalDimmingAMD]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetLocalDimmingAMD]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
     DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetLocalDimmingAMD]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
@@ -9524,17 +9528,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImagePipeSurfaceFUCHSIA]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImagePipeSurfaceFUCHSIA]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImagePipeSurfaceFUCHSIA]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -9551,17 +9555,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateMetalSurfaceEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateMetalSurfaceEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateMetalSurfaceEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -9585,17 +9589,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(
     const VkBufferDeviceAddressInfo*            pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressEXT(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetBufferDeviceAddressEXT(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressEXT(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetBufferDeviceAddressEXT(device, pInfo, result);
     }
@@ -9612,17 +9616,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCooperativeMatrixPropertiesNV(
     VkCooperativeMatrixPropertiesNV*            pProperties) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceCooperativeMatrixPropertiesNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties, result);
     }
@@ -9636,17 +9640,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSupportedFramebufferMixedSamples
     VkFramebufferMixedSamplesCombinationNV*     pCombinations) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
     }
     VkResult result = DispatchGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations, result);
     }
@@ -9664,17 +9668,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModes2EXT(
     VkPresentModeKHR*                           pPresentModes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceSurfacePresentModes2EXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceSurfacePresentModes2EXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes, result);
     }
@@ -9686,17 +9690,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain, result);
     }
@@ -9708,17 +9712,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(
     VkSwapchainKHR                              swapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain, result);
     }
@@ -9731,17 +9735,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(
     VkDeviceGroupPresentModeFlagsKHR*           pModes) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes, result);
     }
@@ -9757,17 +9761,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateHeadlessSurfaceEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateHeadlessSurfaceEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateHeadlessSurfaceEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -9781,18 +9785,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(
     uint16_t                                    lineStipplePattern) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
     DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
 }
@@ -9806,17 +9810,17 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
     uint32_t                                    queryCount) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPoolEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPoolEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPoolEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
@@ -9829,18 +9833,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(
     VkCullModeFlags                             cullMode) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullModeEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCullModeEXT(commandBuffer, cullMode);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullModeEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
     DispatchCmdSetCullModeEXT(commandBuffer, cullMode);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullModeEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
 }
@@ -9850,18 +9854,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(
     VkFrontFace                                 frontFace) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFaceEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFrontFaceEXT(commandBuffer, frontFace);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFaceEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
     DispatchCmdSetFrontFaceEXT(commandBuffer, frontFace);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFaceEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
 }
@@ -9871,18 +9875,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(
     VkPrimitiveTopology                         primitiveTopology) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
     DispatchCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
 }
@@ -9893,18 +9897,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(
     const VkViewport*                           pViewports) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
     DispatchCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
 }
@@ -9915,18 +9919,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(
     const VkRect2D*                             pScissors) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
     DispatchCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCountEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
 }
@@ -9941,18 +9945,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(
     const VkDeviceSize*                         pStrides) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2EXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2EXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
     DispatchCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2EXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
 }
@@ -9962,18 +9966,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(
     VkBool32                                    depthTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
     DispatchCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
 }
@@ -9983,18 +9987,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(
     VkBool32                                    depthWriteEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
     DispatchCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
 }
@@ -10004,18 +10008,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(
     VkCompareOp                                 depthCompareOp) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOpEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOpEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
     DispatchCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOpEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
 }
@@ -10025,18 +10029,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(
     VkBool32                                    depthBoundsTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
     DispatchCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
 }
@@ -10046,18 +10050,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(
     VkBool32                                    stencilTestEnable) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
     DispatchCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnableEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
 }
@@ -10071,18 +10075,18 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(
     VkCompareOp                                 compareOp) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOpEXT]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOpEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
     DispatchCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOpEXT]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
 }
@@ -10095,17 +10099,17 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
@@ -10116,18 +10120,18 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(
     const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
     DispatchCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
 }
@@ -10138,18 +10142,18 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(
     const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
     DispatchCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
 }
@@ -10161,18 +10165,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(
     uint32_t                                    groupIndex) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
     DispatchCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
 }
@@ -10184,17 +10188,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(
     VkIndirectCommandsLayoutNV*                 pIndirectCommandsLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateIndirectCommandsLayoutNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     }
     VkResult result = DispatchCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout, result);
     }
@@ -10207,17 +10211,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNV]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
     DispatchDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
@@ -10236,17 +10240,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(
     VkPrivateDataSlotEXT*                       pPrivateDataSlot) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlotEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePrivateDataSlotEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     }
     VkResult result = DispatchCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePrivateDataSlotEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot, result);
     }
@@ -10259,17 +10263,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(
     const VkAllocationCallbacks*                pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlotEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPrivateDataSlotEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
     DispatchDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPrivateDataSlotEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
@@ -10283,17 +10287,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(
     uint64_t                                    data) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateDataEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetPrivateDataEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
     }
     VkResult result = DispatchSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetPrivateDataEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data, result);
     }
@@ -10308,17 +10312,17 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(
     uint64_t*                                   pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateDataEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPrivateDataEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
     DispatchGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPrivateDataEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
@@ -10339,17 +10343,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDirectFBSurfaceEXT(
     VkSurfaceKHR*                               pSurface) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDirectFBSurfaceEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDirectFBSurfaceEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDirectFBSurfaceEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
@@ -10362,17 +10366,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceDirectFBPresentationSupportEXT(
     IDirectFB*                                  dfb) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPhysicalDeviceDirectFBPresentationSupportEXT]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
         if (skip) return VK_FALSE;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
     }
     VkBool32 result = DispatchGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
     }
@@ -10389,17 +10393,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(
     VkAccelerationStructureKHR*                 pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
@@ -10412,17 +10416,17 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsKHR(
     VkMemoryRequirements2*                      pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
@@ -10435,17 +10439,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureKHR(
     const VkAccelerationStructureBuildOffsetInfoKHR* const* ppOffsetInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
     }
     DispatchCmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
     }
@@ -10459,18 +10463,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureIndirectKHR(
     uint32_t                                    indirectStride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureIndirectKHR(commandBuffer, pInfo, indirectBuffer, indirectOffset, indirectStride);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdBuildAccelerationStructureIndirectKHR(commandBuffer, pInfo, indirectBuffer, indirectOffset, indirectStride);
     }
     DispatchCmdBuildAccelerationStructureIndirectKHR(commandBuffer, pInfo, indirectBuffer, indirectOffset, indirectStride);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdBuildAccelerationStructureIndirectKHR(commandBuffer, pInfo, indirectBuffer, indirectOffset, indirectStride);
     }
 }
@@ -10482,17 +10486,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BuildAccelerationStructureKHR(
     const VkAccelerationStructureBuildOffsetInfoKHR* const* ppOffsetInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBuildAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBuildAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordBuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos);
     }
     VkResult result = DispatchBuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBuildAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordBuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos, result);
     }
@@ -10504,17 +10508,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(
     const VkCopyAccelerationStructureInfoKHR*   pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCopyAccelerationStructureKHR(device, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCopyAccelerationStructureKHR(device, pInfo, result);
     }
@@ -10526,17 +10530,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(
     const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureToMemoryKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureToMemoryKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCopyAccelerationStructureToMemoryKHR(device, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureToMemoryKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCopyAccelerationStructureToMemoryKHR(device, pInfo, result);
     }
@@ -10548,17 +10552,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToAccelerationStructureKHR(
     const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyMemoryToAccelerationStructureKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyMemoryToAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCopyMemoryToAccelerationStructureKHR(device, pInfo);
     }
     VkResult result = DispatchCopyMemoryToAccelerationStructureKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCopyMemoryToAccelerationStructureKHR(device, pInfo, result);
     }
@@ -10575,17 +10579,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(
     size_t                                      stride) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWriteAccelerationStructuresPropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
     }
     VkResult result = DispatchWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride, result);
     }
@@ -10597,17 +10601,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(
     const VkCopyAccelerationStructureInfoKHR*   pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
@@ -10618,18 +10622,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(
     const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
 }
@@ -10639,18 +10643,18 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(
     const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
 }
@@ -10666,18 +10670,18 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(
     uint32_t                                    depth) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
     DispatchCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
 }
@@ -10687,17 +10691,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetAccelerationStructureDeviceAddressKHR(
     const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureDeviceAddressKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetAccelerationStructureDeviceAddressKHR(device, pInfo);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo, result);
     }
@@ -10713,17 +10717,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingCaptureReplayShaderGroupHandlesKHR(
     void*                                       pData) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
@@ -10740,18 +10744,18 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(
     VkDeviceSize                                offset) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->read_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_read_lock(commandBuffer);
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, buffer, offset);
         if (skip) return;
     }
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PreCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, buffer, offset);
     }
     DispatchCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, buffer, offset);
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirectKHR]) {
+        auto lock = intercept->cmd_buffer_write_lock(commandBuffer);
         intercept->PostCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, buffer, offset);
     }
 }
@@ -10761,17 +10765,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(
     const VkAccelerationStructureVersionKHR*    version) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR]) {
         auto lock = intercept->read_lock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR(device, version);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, version);
     }
     VkResult result = DispatchGetDeviceAccelerationStructureCompatibilityKHR(device, version);
-    for (auto intercept : layer_data->object_dispatch) {
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, version, result);
     }
@@ -11338,6 +11342,1436 @@ const std::unordered_map<std::string, function_data> name_to_funcptr_map = {
 
 } // namespace vulkan_layer_chassis
 
+// Build the per-intercept dispatch vectors. An object is only added to the vector for a given hook if its class (or
+// one of its bases other than ValidationObject) overrides that hook -- a pointer-to-member that still resolves to the
+// ValidationObject declaration has the same type as the base one, any override has a different class type.
+void ValidationObject::InitObjectDispatchVectors() {
+
+#define BUILD_DISPATCH_VECTOR(name) \
+    init_object_dispatch_vector(InterceptId ## name, \
+                                typeid(&ValidationObject::name), \
+                                typeid(&ThreadSafety::name), \
+                                typeid(&StatelessValidation::name), \
+                                typeid(&ObjectLifetimes::name), \
+                                typeid(&CoreChecks::name), \
+                                typeid(&BestPractices::name), \
+                                typeid(&GpuAssisted::name), \
+                                typeid(&DebugPrintf::name), \
+                                typeid(&SyncValidator::name), \
+                                typeid(&CommandCounter::name));
+
+    auto init_object_dispatch_vector = [this](InterceptId id,
+                                              const std::type_info& vo_typeid,
+                                              const std::type_info& tt_typeid,
+                                              const std::type_info& tpv_typeid,
+                                              const std::type_info& tot_typeid,
+                                              const std::type_info& tcv_typeid,
+                                              const std::type_info& tbp_typeid,
+                                              const std::type_info& tga_typeid,
+                                              const std::type_info& tdp_typeid,
+                                              const std::type_info& tsv_typeid,
+                                              const std::type_info& tcc_typeid) {
+        auto &intercept_vector = this->intercept_vectors[id];
+        for (auto item : this->object_dispatch) {
+            switch (item->container_type) {
+            case LayerObjectTypeThreading:
+                if (tt_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeParameterValidation:
+                if (tpv_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeObjectTracker:
+                if (tot_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeCoreValidation:
+                if (tcv_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeBestPractices:
+                if (tbp_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeGpuAssisted:
+                if (tga_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeDebugPrintf:
+                if (tdp_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeSyncValidation:
+                if (tsv_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeCommandCounter:
+                if (tcc_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            default:
+                // Chassis codegen needs to be updated for unknown validation object type
+                assert(0);
+                intercept_vector.push_back(item);
+                break;
+            }
+        }
+    };
+
+    intercept_vectors.clear();
+    intercept_vectors.resize(InterceptIdCount);
+
+    BUILD_DISPATCH_VECTOR(PreCallValidateEnumeratePhysicalDevices);
+    BUILD_DISPATCH_VECTOR(PreCallRecordEnumeratePhysicalDevices);
+    BUILD_DISPATCH_VECTOR(PostCallRecordEnumeratePhysicalDevices);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceFeatures);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceFeatures);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceFeatures);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceFormatProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceFormatProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceFormatProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceImageFormatProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceImageFormatProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceImageFormatProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceQueueFamilyProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceQueueFamilyProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceQueueFamilyProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceMemoryProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceMemoryProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceMemoryProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueWaitIdle);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueWaitIdle);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueWaitIdle);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDeviceWaitIdle);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDeviceWaitIdle);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDeviceWaitIdle);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAllocateMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAllocateMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAllocateMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateFreeMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordFreeMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordFreeMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateMapMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordMapMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordMapMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUnmapMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUnmapMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUnmapMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateFlushMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PreCallRecordFlushMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PostCallRecordFlushMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PreCallValidateInvalidateMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PreCallRecordInvalidateMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PostCallRecordInvalidateMappedMemoryRanges);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryCommitment);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryCommitment);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryCommitment);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSparseImageFormatProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSparseImageFormatProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSparseImageFormatProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueBindSparse);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueBindSparse);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueBindSparse);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateFence);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateFence);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateFence);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyFence);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyFence);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyFence);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetFences);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetFences);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetFences);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceStatus);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceStatus);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceStatus);
+    BUILD_DISPATCH_VECTOR(PreCallValidateWaitForFences);
+    BUILD_DISPATCH_VECTOR(PreCallRecordWaitForFences);
+    BUILD_DISPATCH_VECTOR(PostCallRecordWaitForFences);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSemaphore);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySemaphore);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetEventStatus);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetEventStatus);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetEventStatus);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateQueryPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyQueryPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateBufferView);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateBufferView);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateBufferView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBufferView);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBufferView);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBufferView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSubresourceLayout);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSubresourceLayout);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSubresourceLayout);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateImageView);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateImageView);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateImageView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImageView);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImageView);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImageView);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyShaderModule);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyShaderModule);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyShaderModule);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreatePipelineCache);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreatePipelineCache);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreatePipelineCache);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineCache);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineCache);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipelineCache);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineCacheData);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineCacheData);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineCacheData);
+    BUILD_DISPATCH_VECTOR(PreCallValidateMergePipelineCaches);
+    BUILD_DISPATCH_VECTOR(PreCallRecordMergePipelineCaches);
+    BUILD_DISPATCH_VECTOR(PostCallRecordMergePipelineCaches);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipeline);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipeline);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipeline);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineLayout);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineLayout);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipelineLayout);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSampler);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSampler);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSampler);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySampler);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySampler);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySampler);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorSetLayout);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetDescriptorPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateFreeDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallRecordFreeDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PostCallRecordFreeDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateFramebuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateFramebuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateFramebuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyFramebuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyFramebuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyFramebuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyRenderPass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRenderAreaGranularity);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRenderAreaGranularity);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRenderAreaGranularity);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateCommandPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCommandPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetCommandPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAllocateCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAllocateCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAllocateCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallValidateFreeCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallRecordFreeCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PostCallRecordFreeCommandBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBeginCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBeginCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBeginCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateEndCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordEndCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordEndCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetCommandBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindPipeline);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindPipeline);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindPipeline);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewport);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewport);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewport);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissor);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissor);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissor);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineWidth);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineWidth);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineWidth);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBias);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBias);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBias);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetBlendConstants);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetBlendConstants);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetBlendConstants);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBounds);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBounds);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBounds);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilCompareMask);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilCompareMask);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilCompareMask);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilWriteMask);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilWriteMask);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilWriteMask);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilReference);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilReference);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilReference);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorSets);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindIndexBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindIndexBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindIndexBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDraw);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDraw);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDraw);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexed);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexed);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexed);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirect);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirect);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatch);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatch);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatch);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchIndirect);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchIndirect);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdUpdateBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdUpdateBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdUpdateBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdFillBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdFillBuffer);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdFillBuffer);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearColorImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearColorImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearColorImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearDepthStencilImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearDepthStencilImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearDepthStencilImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearAttachments);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearAttachments);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearAttachments);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetEvent);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetEvent);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWaitEvents);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWaitEvents);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWaitEvents);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPipelineBarrier);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPipelineBarrier);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPipelineBarrier);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginQuery);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginQuery);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginQuery);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndQuery);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndQuery);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndQuery);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyQueryPoolResults);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushConstants);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushConstants);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushConstants);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdExecuteCommands);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdExecuteCommands);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdExecuteCommands);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPeerMemoryFeatures);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPeerMemoryFeatures);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPeerMemoryFeatures);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDeviceMask);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDeviceMask);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDeviceMask);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchBase);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchBase);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchBase);
+    BUILD_DISPATCH_VECTOR(PreCallValidateEnumeratePhysicalDeviceGroups);
+    BUILD_DISPATCH_VECTOR(PreCallRecordEnumeratePhysicalDeviceGroups);
+    BUILD_DISPATCH_VECTOR(PostCallRecordEnumeratePhysicalDeviceGroups);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceFeatures2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceFeatures2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceFeatures2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceProperties2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceImageFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceImageFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceImageFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceQueueFamilyProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceQueueFamilyProperties2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceQueueFamilyProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceMemoryProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceMemoryProperties2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceMemoryProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateTrimCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordTrimCommandPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordTrimCommandPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySamplerYcbcrConversion);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorUpdateTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSetWithTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSetWithTemplate);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSetWithTemplate);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceExternalBufferProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceExternalBufferProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceExternalBufferProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceExternalFenceProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceExternalFenceProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceExternalFenceProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceExternalSemaphoreProperties);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceExternalSemaphoreProperties);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceExternalSemaphoreProperties);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSupport);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSupport);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSupport);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCount);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCount);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCount);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCount);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCount);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCount);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass2);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass2);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetQueryPool);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreCounterValue);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreCounterValue);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreCounterValue);
+    BUILD_DISPATCH_VECTOR(PreCallValidateWaitSemaphores);
+    BUILD_DISPATCH_VECTOR(PreCallRecordWaitSemaphores);
+    BUILD_DISPATCH_VECTOR(PostCallRecordWaitSemaphores);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSignalSemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSignalSemaphore);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSignalSemaphore);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddress);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddress);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddress);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryOpaqueCaptureAddress);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSurfaceSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSurfaceSupportKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSurfaceSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSurfaceFormatsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSurfaceFormatsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySwapchainKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainImagesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainImagesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainImagesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireNextImageKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireNextImageKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireNextImageKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueuePresentKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueuePresentKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueuePresentKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPresentCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPresentCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPresentCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupSurfacePresentModesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDevicePresentRectanglesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDevicePresentRectanglesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDevicePresentRectanglesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireNextImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireNextImage2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireNextImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceDisplayPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceDisplayPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceDisplayPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceDisplayPlanePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDisplayPlaneSupportedDisplaysKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDisplayPlaneSupportedDisplaysKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDisplayPlaneSupportedDisplaysKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDisplayModePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDisplayModePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDisplayModePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDisplayModeKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDisplayModeKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDisplayModeKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDisplayPlaneCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDisplayPlaneCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDisplayPlaneCapabilitiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDisplayPlaneSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDisplayPlaneSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDisplayPlaneSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSharedSwapchainsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSharedSwapchainsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSharedSwapchainsKHR);
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateXlibSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateXlibSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateXlibSurfaceKHR);
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceXlibPresentationSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceXlibPresentationSupportKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceXlibPresentationSupportKHR);
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateXcbSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateXcbSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateXcbSurfaceKHR);
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceXcbPresentationSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceXcbPresentationSupportKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceXcbPresentationSupportKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateWaylandSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateWaylandSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateWaylandSurfaceKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceWaylandPresentationSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateAndroidSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateAndroidSurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateAndroidSurfaceKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateWin32SurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateWin32SurfaceKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateWin32SurfaceKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceWin32PresentationSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceWin32PresentationSupportKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceWin32PresentationSupportKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceFeatures2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceFeatures2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceFeatures2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceImageFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceImageFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceImageFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceMemoryProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceMemoryProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceMemoryProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDeviceMaskKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDeviceMaskKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDeviceMaskKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchBaseKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchBaseKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchBaseKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateTrimCommandPoolKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordTrimCommandPoolKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordTrimCommandPoolKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateEnumeratePhysicalDeviceGroupsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordEnumeratePhysicalDeviceGroupsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordEnumeratePhysicalDeviceGroupsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceExternalBufferPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandleKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandlePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandlePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandlePropertiesKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryFdPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryFdPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryFdPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceExternalSemaphorePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreWin32HandleKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreWin32HandleKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorUpdateTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSetWithTemplateKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainStatusKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainStatusKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainStatusKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceExternalFencePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceExternalFencePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceExternalFencePropertiesKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateImportFenceWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordImportFenceWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordImportFenceWin32HandleKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceWin32HandleKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceWin32HandleKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateImportFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordImportFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordImportFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceFdKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateReleaseProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordReleaseProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordReleaseProfilingLockKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSurfaceCapabilities2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSurfaceFormats2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSurfaceFormats2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSurfaceFormats2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceDisplayProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceDisplayProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceDisplayProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceDisplayPlaneProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDisplayModeProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDisplayModeProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDisplayModeProperties2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDisplayPlaneCapabilities2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDisplayPlaneCapabilities2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDisplayPlaneCapabilities2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateSamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateSamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroySamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroySamplerYcbcrConversionKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSupportKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSupportKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCountKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreCounterValueKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreCounterValueKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreCounterValueKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateWaitSemaphoresKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordWaitSemaphoresKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordWaitSemaphoresKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSignalSemaphoreKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSignalSemaphoreKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSignalSemaphoreKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDeferredOperationKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDeferredOperationKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDeferredOperationKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDeferredOperationKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDeferredOperationKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDeferredOperationKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeferredOperationMaxConcurrencyKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeferredOperationMaxConcurrencyKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeferredOperationMaxConcurrencyKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeferredOperationResultKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeferredOperationResultKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeferredOperationResultKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateDeferredOperationJoinKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDeferredOperationJoinKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDeferredOperationJoinKHR);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutablePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutablePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutablePropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutableStatisticsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutableStatisticsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutableStatisticsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutableInternalRepresentationsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutableInternalRepresentationsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutableInternalRepresentationsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage2KHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage2KHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDebugReportCallbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDebugReportCallbackEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDebugReportCallbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDebugReportCallbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDebugReportCallbackEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDebugReportCallbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDebugReportMessageEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDebugReportMessageEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDebugReportMessageEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDebugMarkerSetObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDebugMarkerSetObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDebugMarkerSetObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDebugMarkerSetObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDebugMarkerSetObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDebugMarkerSetObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerBeginEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerBeginEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerBeginEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerEndEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerEndEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerEndEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerInsertEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerInsertEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerInsertEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindTransformFeedbackBuffersEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindTransformFeedbackBuffersEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindTransformFeedbackBuffersEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndTransformFeedbackEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndQueryIndexedEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectByteCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectByteCountEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectByteCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewHandleNVX);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewHandleNVX);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewHandleNVX);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewAddressNVX);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewAddressNVX);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewAddressNVX);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCountAMD);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderInfoAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderInfoAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderInfoAMD);
+#ifdef VK_USE_PLATFORM_GGP
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateStreamDescriptorSurfaceGGP);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateStreamDescriptorSurfaceGGP);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateStreamDescriptorSurfaceGGP);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceExternalImageFormatPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandleNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandleNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandleNV);
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateViSurfaceNN);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateViSurfaceNN);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateViSurfaceNN);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndConditionalRenderingEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWScalingNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWScalingNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWScalingNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateReleaseDisplayEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordReleaseDisplayEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordReleaseDisplayEXT);
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireXlibDisplayEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireXlibDisplayEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireXlibDisplayEXT);
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRandROutputDisplayEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRandROutputDisplayEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRandROutputDisplayEXT);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSurfaceCapabilities2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDisplayPowerControlEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDisplayPowerControlEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDisplayPowerControlEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateRegisterDeviceEventEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordRegisterDeviceEventEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordRegisterDeviceEventEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateRegisterDisplayEventEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordRegisterDisplayEventEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordRegisterDisplayEventEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainCounterEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainCounterEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainCounterEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRefreshCycleDurationGOOGLE);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRefreshCycleDurationGOOGLE);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRefreshCycleDurationGOOGLE);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPastPresentationTimingGOOGLE);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPastPresentationTimingGOOGLE);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPastPresentationTimingGOOGLE);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDiscardRectangleEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDiscardRectangleEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDiscardRectangleEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetHdrMetadataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetHdrMetadataEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetHdrMetadataEXT);
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateIOSSurfaceMVK);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateIOSSurfaceMVK);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateIOSSurfaceMVK);
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateMacOSSurfaceMVK);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateMacOSSurfaceMVK);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateMacOSSurfaceMVK);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetDebugUtilsObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetDebugUtilsObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetDebugUtilsObjectNameEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetDebugUtilsObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetDebugUtilsObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetDebugUtilsObjectTagEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdInsertDebugUtilsLabelEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDebugUtilsMessengerEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDebugUtilsMessengerEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDebugUtilsMessengerEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDebugUtilsMessengerEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDebugUtilsMessengerEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDebugUtilsMessengerEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSubmitDebugUtilsMessageEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSubmitDebugUtilsMessageEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSubmitDebugUtilsMessageEXT);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAndroidHardwareBufferPropertiesANDROID);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAndroidHardwareBufferPropertiesANDROID);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAndroidHardwareBufferPropertiesANDROID);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryAndroidHardwareBufferANDROID);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryAndroidHardwareBufferANDROID);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryAndroidHardwareBufferANDROID);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetSampleLocationsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetSampleLocationsEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetSampleLocationsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceMultisamplePropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceMultisamplePropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceMultisamplePropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageDrmFormatModifierPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetImageDrmFormatModifierPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetImageDrmFormatModifierPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindShadingRateImageNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindShadingRateImageNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindShadingRateImageNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportShadingRatePaletteNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportShadingRatePaletteNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportShadingRatePaletteNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoarseSampleOrderNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoarseSampleOrderNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoarseSampleOrderNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindAccelerationStructureMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindAccelerationStructureMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindAccelerationStructureMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateBindAccelerationStructureMemoryNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBindAccelerationStructureMemoryNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBindAccelerationStructureMemoryNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureHandleNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureHandleNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureHandleNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteAccelerationStructuresPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteAccelerationStructuresPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteAccelerationStructuresPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCompileDeferredNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCompileDeferredNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCompileDeferredNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryHostPointerPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryHostPointerPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryHostPointerPropertiesEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteBufferMarkerAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteBufferMarkerAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteBufferMarkerAMD);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceCalibrateableTimeDomainsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetCalibratedTimestampsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetCalibratedTimestampsEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetCalibratedTimestampsEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectCountNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectCountNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectCountNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetExclusiveScissorNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetExclusiveScissorNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetExclusiveScissorNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCheckpointNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCheckpointNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCheckpointNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetQueueCheckpointDataNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetQueueCheckpointDataNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetQueueCheckpointDataNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateInitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordInitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordInitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateUninitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordUninitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordUninitializePerformanceApiINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceStreamMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceStreamMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceStreamMarkerINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceOverrideINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceOverrideINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceOverrideINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquirePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquirePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquirePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateReleasePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordReleasePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordReleasePerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSetPerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSetPerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSetPerformanceConfigurationINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPerformanceParameterINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPerformanceParameterINTEL);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPerformanceParameterINTEL);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetLocalDimmingAMD);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetLocalDimmingAMD);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetLocalDimmingAMD);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateImagePipeSurfaceFUCHSIA);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateImagePipeSurfaceFUCHSIA);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateImagePipeSurfaceFUCHSIA);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateMetalSurfaceEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateMetalSurfaceEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateMetalSurfaceEXT);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddressEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddressEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddressEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceCooperativeMatrixPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceSurfacePresentModes2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceSurfacePresentModes2EXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireFullScreenExclusiveModeEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordAcquireFullScreenExclusiveModeEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordAcquireFullScreenExclusiveModeEXT);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateReleaseFullScreenExclusiveModeEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordReleaseFullScreenExclusiveModeEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordReleaseFullScreenExclusiveModeEXT);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupSurfacePresentModes2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupSurfacePresentModes2EXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupSurfacePresentModes2EXT);
+#endif
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateHeadlessSurfaceEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateHeadlessSurfaceEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateHeadlessSurfaceEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineStippleEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineStippleEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineStippleEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateResetQueryPoolEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordResetQueryPoolEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordResetQueryPoolEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCullModeEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCullModeEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCullModeEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFrontFaceEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFrontFaceEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFrontFaceEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveTopologyEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveTopologyEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveTopologyEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissorWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissorWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissorWithCountEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers2EXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers2EXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthWriteEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthWriteEnableEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthWriteEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthCompareOpEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthCompareOpEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthCompareOpEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBoundsTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBoundsTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBoundsTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilTestEnableEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilOpEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilOpEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilOpEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetGeneratedCommandsMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetGeneratedCommandsMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetGeneratedCommandsMemoryRequirementsNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPreprocessGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdPreprocessGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdPreprocessGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdExecuteGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdExecuteGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdExecuteGeneratedCommandsNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindPipelineShaderGroupNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindPipelineShaderGroupNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindPipelineShaderGroupNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyIndirectCommandsLayoutNV);
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreatePrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreatePrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreatePrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPrivateDataSlotEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateSetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordSetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordSetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPrivateDataEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPrivateDataEXT);
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDirectFBSurfaceEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateDirectFBSurfaceEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateDirectFBSurfaceEXT);
+#endif
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetPhysicalDeviceDirectFBPresentationSupportEXT);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCreateAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCreateAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCreateAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureMemoryRequirementsKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureMemoryRequirementsKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureMemoryRequirementsKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructureIndirectKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructureIndirectKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructureIndirectKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateBuildAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordBuildAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordBuildAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCopyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCopyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCopyAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCopyAccelerationStructureToMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCopyAccelerationStructureToMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCopyAccelerationStructureToMemoryKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCopyMemoryToAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCopyMemoryToAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCopyMemoryToAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordWriteAccelerationStructuresPropertiesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordWriteAccelerationStructuresPropertiesKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureToMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureToMemoryKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureToMemoryKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryToAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryToAccelerationStructureKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryToAccelerationStructureKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureDeviceAddressKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureDeviceAddressKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysIndirectKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysIndirectKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysIndirectKHR);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR);
+    BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR);
+    BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR);
+#endif
+}
+
+
 // loader-layer interface v0, just wrappers since there is only a layer
 
 VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pCount,
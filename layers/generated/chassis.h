@@ -34,6 +34,7 @@
 #include <unordered_set>
 #include <algorithm>
 #include <memory>
+#include <typeinfo>
 
 #include "vk_loader_platform.h"
 #include "vulkan/vulkan.h"
@@ -68,7 +69,7 @@ struct HashedUint64 {
     }
 };
 
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vl_concurrent_id_map<uint64_t, uint64_t> unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -2792,6 +2793,1367 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(
 
 
 
+// Intercept identifiers, used to index ValidationObject::intercept_vectors
+typedef enum InterceptId {
+    InterceptIdPreCallValidateEnumeratePhysicalDevices,
+    InterceptIdPreCallRecordEnumeratePhysicalDevices,
+    InterceptIdPostCallRecordEnumeratePhysicalDevices,
+    InterceptIdPreCallValidateGetPhysicalDeviceFeatures,
+    InterceptIdPreCallRecordGetPhysicalDeviceFeatures,
+    InterceptIdPostCallRecordGetPhysicalDeviceFeatures,
+    InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties,
+    InterceptIdPreCallValidateGetDeviceQueue,
+    InterceptIdPreCallRecordGetDeviceQueue,
+    InterceptIdPostCallRecordGetDeviceQueue,
+    InterceptIdPreCallValidateQueueSubmit,
+    InterceptIdPreCallRecordQueueSubmit,
+    InterceptIdPostCallRecordQueueSubmit,
+    InterceptIdPreCallValidateQueueWaitIdle,
+    InterceptIdPreCallRecordQueueWaitIdle,
+    InterceptIdPostCallRecordQueueWaitIdle,
+    InterceptIdPreCallValidateDeviceWaitIdle,
+    InterceptIdPreCallRecordDeviceWaitIdle,
+    InterceptIdPostCallRecordDeviceWaitIdle,
+    InterceptIdPreCallValidateAllocateMemory,
+    InterceptIdPreCallRecordAllocateMemory,
+    InterceptIdPostCallRecordAllocateMemory,
+    InterceptIdPreCallValidateFreeMemory,
+    InterceptIdPreCallRecordFreeMemory,
+    InterceptIdPostCallRecordFreeMemory,
+    InterceptIdPreCallValidateMapMemory,
+    InterceptIdPreCallRecordMapMemory,
+    InterceptIdPostCallRecordMapMemory,
+    InterceptIdPreCallValidateUnmapMemory,
+    InterceptIdPreCallRecordUnmapMemory,
+    InterceptIdPostCallRecordUnmapMemory,
+    InterceptIdPreCallValidateFlushMappedMemoryRanges,
+    InterceptIdPreCallRecordFlushMappedMemoryRanges,
+    InterceptIdPostCallRecordFlushMappedMemoryRanges,
+    InterceptIdPreCallValidateInvalidateMappedMemoryRanges,
+    InterceptIdPreCallRecordInvalidateMappedMemoryRanges,
+    InterceptIdPostCallRecordInvalidateMappedMemoryRanges,
+    InterceptIdPreCallValidateGetDeviceMemoryCommitment,
+    InterceptIdPreCallRecordGetDeviceMemoryCommitment,
+    InterceptIdPostCallRecordGetDeviceMemoryCommitment,
+    InterceptIdPreCallValidateBindBufferMemory,
+    InterceptIdPreCallRecordBindBufferMemory,
+    InterceptIdPostCallRecordBindBufferMemory,
+    InterceptIdPreCallValidateBindImageMemory,
+    InterceptIdPreCallRecordBindImageMemory,
+    InterceptIdPostCallRecordBindImageMemory,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements,
+    InterceptIdPreCallValidateGetImageMemoryRequirements,
+    InterceptIdPreCallRecordGetImageMemoryRequirements,
+    InterceptIdPostCallRecordGetImageMemoryRequirements,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements,
+    InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties,
+    InterceptIdPreCallValidateQueueBindSparse,
+    InterceptIdPreCallRecordQueueBindSparse,
+    InterceptIdPostCallRecordQueueBindSparse,
+    InterceptIdPreCallValidateCreateFence,
+    InterceptIdPreCallRecordCreateFence,
+    InterceptIdPostCallRecordCreateFence,
+    InterceptIdPreCallValidateDestroyFence,
+    InterceptIdPreCallRecordDestroyFence,
+    InterceptIdPostCallRecordDestroyFence,
+    InterceptIdPreCallValidateResetFences,
+    InterceptIdPreCallRecordResetFences,
+    InterceptIdPostCallRecordResetFences,
+    InterceptIdPreCallValidateGetFenceStatus,
+    InterceptIdPreCallRecordGetFenceStatus,
+    InterceptIdPostCallRecordGetFenceStatus,
+    InterceptIdPreCallValidateWaitForFences,
+    InterceptIdPreCallRecordWaitForFences,
+    InterceptIdPostCallRecordWaitForFences,
+    InterceptIdPreCallValidateCreateSemaphore,
+    InterceptIdPreCallRecordCreateSemaphore,
+    InterceptIdPostCallRecordCreateSemaphore,
+    InterceptIdPreCallValidateDestroySemaphore,
+    InterceptIdPreCallRecordDestroySemaphore,
+    InterceptIdPostCallRecordDestroySemaphore,
+    InterceptIdPreCallValidateCreateEvent,
+    InterceptIdPreCallRecordCreateEvent,
+    InterceptIdPostCallRecordCreateEvent,
+    InterceptIdPreCallValidateDestroyEvent,
+    InterceptIdPreCallRecordDestroyEvent,
+    InterceptIdPostCallRecordDestroyEvent,
+    InterceptIdPreCallValidateGetEventStatus,
+    InterceptIdPreCallRecordGetEventStatus,
+    InterceptIdPostCallRecordGetEventStatus,
+    InterceptIdPreCallValidateSetEvent,
+    InterceptIdPreCallRecordSetEvent,
+    InterceptIdPostCallRecordSetEvent,
+    InterceptIdPreCallValidateResetEvent,
+    InterceptIdPreCallRecordResetEvent,
+    InterceptIdPostCallRecordResetEvent,
+    InterceptIdPreCallValidateCreateQueryPool,
+    InterceptIdPreCallRecordCreateQueryPool,
+    InterceptIdPostCallRecordCreateQueryPool,
+    InterceptIdPreCallValidateDestroyQueryPool,
+    InterceptIdPreCallRecordDestroyQueryPool,
+    InterceptIdPostCallRecordDestroyQueryPool,
+    InterceptIdPreCallValidateGetQueryPoolResults,
+    InterceptIdPreCallRecordGetQueryPoolResults,
+    InterceptIdPostCallRecordGetQueryPoolResults,
+    InterceptIdPreCallValidateDestroyBuffer,
+    InterceptIdPreCallRecordDestroyBuffer,
+    InterceptIdPostCallRecordDestroyBuffer,
+    InterceptIdPreCallValidateCreateBufferView,
+    InterceptIdPreCallRecordCreateBufferView,
+    InterceptIdPostCallRecordCreateBufferView,
+    InterceptIdPreCallValidateDestroyBufferView,
+    InterceptIdPreCallRecordDestroyBufferView,
+    InterceptIdPostCallRecordDestroyBufferView,
+    InterceptIdPreCallValidateCreateImage,
+    InterceptIdPreCallRecordCreateImage,
+    InterceptIdPostCallRecordCreateImage,
+    InterceptIdPreCallValidateDestroyImage,
+    InterceptIdPreCallRecordDestroyImage,
+    InterceptIdPostCallRecordDestroyImage,
+    InterceptIdPreCallValidateGetImageSubresourceLayout,
+    InterceptIdPreCallRecordGetImageSubresourceLayout,
+    InterceptIdPostCallRecordGetImageSubresourceLayout,
+    InterceptIdPreCallValidateCreateImageView,
+    InterceptIdPreCallRecordCreateImageView,
+    InterceptIdPostCallRecordCreateImageView,
+    InterceptIdPreCallValidateDestroyImageView,
+    InterceptIdPreCallRecordDestroyImageView,
+    InterceptIdPostCallRecordDestroyImageView,
+    InterceptIdPreCallValidateDestroyShaderModule,
+    InterceptIdPreCallRecordDestroyShaderModule,
+    InterceptIdPostCallRecordDestroyShaderModule,
+    InterceptIdPreCallValidateCreatePipelineCache,
+    InterceptIdPreCallRecordCreatePipelineCache,
+    InterceptIdPostCallRecordCreatePipelineCache,
+    InterceptIdPreCallValidateDestroyPipelineCache,
+    InterceptIdPreCallRecordDestroyPipelineCache,
+    InterceptIdPostCallRecordDestroyPipelineCache,
+    InterceptIdPreCallValidateGetPipelineCacheData,
+    InterceptIdPreCallRecordGetPipelineCacheData,
+    InterceptIdPostCallRecordGetPipelineCacheData,
+    InterceptIdPreCallValidateMergePipelineCaches,
+    InterceptIdPreCallRecordMergePipelineCaches,
+    InterceptIdPostCallRecordMergePipelineCaches,
+    InterceptIdPreCallValidateDestroyPipeline,
+    InterceptIdPreCallRecordDestroyPipeline,
+    InterceptIdPostCallRecordDestroyPipeline,
+    InterceptIdPreCallValidateDestroyPipelineLayout,
+    InterceptIdPreCallRecordDestroyPipelineLayout,
+    InterceptIdPostCallRecordDestroyPipelineLayout,
+    InterceptIdPreCallValidateCreateSampler,
+    InterceptIdPreCallRecordCreateSampler,
+    InterceptIdPostCallRecordCreateSampler,
+    InterceptIdPreCallValidateDestroySampler,
+    InterceptIdPreCallRecordDestroySampler,
+    InterceptIdPostCallRecordDestroySampler,
+    InterceptIdPreCallValidateCreateDescriptorSetLayout,
+    InterceptIdPreCallRecordCreateDescriptorSetLayout,
+    InterceptIdPostCallRecordCreateDescriptorSetLayout,
+    InterceptIdPreCallValidateDestroyDescriptorSetLayout,
+    InterceptIdPreCallRecordDestroyDescriptorSetLayout,
+    InterceptIdPostCallRecordDestroyDescriptorSetLayout,
+    InterceptIdPreCallValidateCreateDescriptorPool,
+    InterceptIdPreCallRecordCreateDescriptorPool,
+    InterceptIdPostCallRecordCreateDescriptorPool,
+    InterceptIdPreCallValidateDestroyDescriptorPool,
+    InterceptIdPreCallRecordDestroyDescriptorPool,
+    InterceptIdPostCallRecordDestroyDescriptorPool,
+    InterceptIdPreCallValidateResetDescriptorPool,
+    InterceptIdPreCallRecordResetDescriptorPool,
+    InterceptIdPostCallRecordResetDescriptorPool,
+    InterceptIdPreCallValidateFreeDescriptorSets,
+    InterceptIdPreCallRecordFreeDescriptorSets,
+    InterceptIdPostCallRecordFreeDescriptorSets,
+    InterceptIdPreCallValidateUpdateDescriptorSets,
+    InterceptIdPreCallRecordUpdateDescriptorSets,
+    InterceptIdPostCallRecordUpdateDescriptorSets,
+    InterceptIdPreCallValidateCreateFramebuffer,
+    InterceptIdPreCallRecordCreateFramebuffer,
+    InterceptIdPostCallRecordCreateFramebuffer,
+    InterceptIdPreCallValidateDestroyFramebuffer,
+    InterceptIdPreCallRecordDestroyFramebuffer,
+    InterceptIdPostCallRecordDestroyFramebuffer,
+    InterceptIdPreCallValidateCreateRenderPass,
+    InterceptIdPreCallRecordCreateRenderPass,
+    InterceptIdPostCallRecordCreateRenderPass,
+    InterceptIdPreCallValidateDestroyRenderPass,
+    InterceptIdPreCallRecordDestroyRenderPass,
+    InterceptIdPostCallRecordDestroyRenderPass,
+    InterceptIdPreCallValidateGetRenderAreaGranularity,
+    InterceptIdPreCallRecordGetRenderAreaGranularity,
+    InterceptIdPostCallRecordGetRenderAreaGranularity,
+    InterceptIdPreCallValidateCreateCommandPool,
+    InterceptIdPreCallRecordCreateCommandPool,
+    InterceptIdPostCallRecordCreateCommandPool,
+    InterceptIdPreCallValidateDestroyCommandPool,
+    InterceptIdPreCallRecordDestroyCommandPool,
+    InterceptIdPostCallRecordDestroyCommandPool,
+    InterceptIdPreCallValidateResetCommandPool,
+    InterceptIdPreCallRecordResetCommandPool,
+    InterceptIdPostCallRecordResetCommandPool,
+    InterceptIdPreCallValidateAllocateCommandBuffers,
+    InterceptIdPreCallRecordAllocateCommandBuffers,
+    InterceptIdPostCallRecordAllocateCommandBuffers,
+    InterceptIdPreCallValidateFreeCommandBuffers,
+    InterceptIdPreCallRecordFreeCommandBuffers,
+    InterceptIdPostCallRecordFreeCommandBuffers,
+    InterceptIdPreCallValidateBeginCommandBuffer,
+    InterceptIdPreCallRecordBeginCommandBuffer,
+    InterceptIdPostCallRecordBeginCommandBuffer,
+    InterceptIdPreCallValidateEndCommandBuffer,
+    InterceptIdPreCallRecordEndCommandBuffer,
+    InterceptIdPostCallRecordEndCommandBuffer,
+    InterceptIdPreCallValidateResetCommandBuffer,
+    InterceptIdPreCallRecordResetCommandBuffer,
+    InterceptIdPostCallRecordResetCommandBuffer,
+    InterceptIdPreCallValidateCmdBindPipeline,
+    InterceptIdPreCallRecordCmdBindPipeline,
+    InterceptIdPostCallRecordCmdBindPipeline,
+    InterceptIdPreCallValidateCmdSetViewport,
+    InterceptIdPreCallRecordCmdSetViewport,
+    InterceptIdPostCallRecordCmdSetViewport,
+    InterceptIdPreCallValidateCmdSetScissor,
+    InterceptIdPreCallRecordCmdSetScissor,
+    InterceptIdPostCallRecordCmdSetScissor,
+    InterceptIdPreCallValidateCmdSetLineWidth,
+    InterceptIdPreCallRecordCmdSetLineWidth,
+    InterceptIdPostCallRecordCmdSetLineWidth,
+    InterceptIdPreCallValidateCmdSetDepthBias,
+    InterceptIdPreCallRecordCmdSetDepthBias,
+    InterceptIdPostCallRecordCmdSetDepthBias,
+    InterceptIdPreCallValidateCmdSetBlendConstants,
+    InterceptIdPreCallRecordCmdSetBlendConstants,
+    InterceptIdPostCallRecordCmdSetBlendConstants,
+    InterceptIdPreCallValidateCmdSetDepthBounds,
+    InterceptIdPreCallRecordCmdSetDepthBounds,
+    InterceptIdPostCallRecordCmdSetDepthBounds,
+    InterceptIdPreCallValidateCmdSetStencilCompareMask,
+    InterceptIdPreCallRecordCmdSetStencilCompareMask,
+    InterceptIdPostCallRecordCmdSetStencilCompareMask,
+    InterceptIdPreCallValidateCmdSetStencilWriteMask,
+    InterceptIdPreCallRecordCmdSetStencilWriteMask,
+    InterceptIdPostCallRecordCmdSetStencilWriteMask,
+    InterceptIdPreCallValidateCmdSetStencilReference,
+    InterceptIdPreCallRecordCmdSetStencilReference,
+    InterceptIdPostCallRecordCmdSetStencilReference,
+    InterceptIdPreCallValidateCmdBindDescriptorSets,
+    InterceptIdPreCallRecordCmdBindDescriptorSets,
+    InterceptIdPostCallRecordCmdBindDescriptorSets,
+    InterceptIdPreCallValidateCmdBindIndexBuffer,
+    InterceptIdPreCallRecordCmdBindIndexBuffer,
+    InterceptIdPostCallRecordCmdBindIndexBuffer,
+    InterceptIdPreCallValidateCmdBindVertexBuffers,
+    InterceptIdPreCallRecordCmdBindVertexBuffers,
+    InterceptIdPostCallRecordCmdBindVertexBuffers,
+    InterceptIdPreCallValidateCmdDraw,
+    InterceptIdPreCallRecordCmdDraw,
+    InterceptIdPostCallRecordCmdDraw,
+    InterceptIdPreCallValidateCmdDrawIndexed,
+    InterceptIdPreCallRecordCmdDrawIndexed,
+    InterceptIdPostCallRecordCmdDrawIndexed,
+    InterceptIdPreCallValidateCmdDrawIndirect,
+    InterceptIdPreCallRecordCmdDrawIndirect,
+    InterceptIdPostCallRecordCmdDrawIndirect,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirect,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirect,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirect,
+    InterceptIdPreCallValidateCmdDispatch,
+    InterceptIdPreCallRecordCmdDispatch,
+    InterceptIdPostCallRecordCmdDispatch,
+    InterceptIdPreCallValidateCmdDispatchIndirect,
+    InterceptIdPreCallRecordCmdDispatchIndirect,
+    InterceptIdPostCallRecordCmdDispatchIndirect,
+    InterceptIdPreCallValidateCmdCopyBuffer,
+    InterceptIdPreCallRecordCmdCopyBuffer,
+    InterceptIdPostCallRecordCmdCopyBuffer,
+    InterceptIdPreCallValidateCmdCopyImage,
+    InterceptIdPreCallRecordCmdCopyImage,
+    InterceptIdPostCallRecordCmdCopyImage,
+    InterceptIdPreCallValidateCmdBlitImage,
+    InterceptIdPreCallRecordCmdBlitImage,
+    InterceptIdPostCallRecordCmdBlitImage,
+    InterceptIdPreCallValidateCmdCopyBufferToImage,
+    InterceptIdPreCallRecordCmdCopyBufferToImage,
+    InterceptIdPostCallRecordCmdCopyBufferToImage,
+    InterceptIdPreCallValidateCmdCopyImageToBuffer,
+    InterceptIdPreCallRecordCmdCopyImageToBuffer,
+    InterceptIdPostCallRecordCmdCopyImageToBuffer,
+    InterceptIdPreCallValidateCmdUpdateBuffer,
+    InterceptIdPreCallRecordCmdUpdateBuffer,
+    InterceptIdPostCallRecordCmdUpdateBuffer,
+    InterceptIdPreCallValidateCmdFillBuffer,
+    InterceptIdPreCallRecordCmdFillBuffer,
+    InterceptIdPostCallRecordCmdFillBuffer,
+    InterceptIdPreCallValidateCmdClearColorImage,
+    InterceptIdPreCallRecordCmdClearColorImage,
+    InterceptIdPostCallRecordCmdClearColorImage,
+    InterceptIdPreCallValidateCmdClearDepthStencilImage,
+    InterceptIdPreCallRecordCmdClearDepthStencilImage,
+    InterceptIdPostCallRecordCmdClearDepthStencilImage,
+    InterceptIdPreCallValidateCmdClearAttachments,
+    InterceptIdPreCallRecordCmdClearAttachments,
+    InterceptIdPostCallRecordCmdClearAttachments,
+    InterceptIdPreCallValidateCmdResolveImage,
+    InterceptIdPreCallRecordCmdResolveImage,
+    InterceptIdPostCallRecordCmdResolveImage,
+    InterceptIdPreCallValidateCmdSetEvent,
+    InterceptIdPreCallRecordCmdSetEvent,
+    InterceptIdPostCallRecordCmdSetEvent,
+    InterceptIdPreCallValidateCmdResetEvent,
+    InterceptIdPreCallRecordCmdResetEvent,
+    InterceptIdPostCallRecordCmdResetEvent,
+    InterceptIdPreCallValidateCmdWaitEvents,
+    InterceptIdPreCallRecordCmdWaitEvents,
+    InterceptIdPostCallRecordCmdWaitEvents,
+    InterceptIdPreCallValidateCmdPipelineBarrier,
+    InterceptIdPreCallRecordCmdPipelineBarrier,
+    InterceptIdPostCallRecordCmdPipelineBarrier,
+    InterceptIdPreCallValidateCmdBeginQuery,
+    InterceptIdPreCallRecordCmdBeginQuery,
+    InterceptIdPostCallRecordCmdBeginQuery,
+    InterceptIdPreCallValidateCmdEndQuery,
+    InterceptIdPreCallRecordCmdEndQuery,
+    InterceptIdPostCallRecordCmdEndQuery,
+    InterceptIdPreCallValidateCmdResetQueryPool,
+    InterceptIdPreCallRecordCmdResetQueryPool,
+    InterceptIdPostCallRecordCmdResetQueryPool,
+    InterceptIdPreCallValidateCmdWriteTimestamp,
+    InterceptIdPreCallRecordCmdWriteTimestamp,
+    InterceptIdPostCallRecordCmdWriteTimestamp,
+    InterceptIdPreCallValidateCmdCopyQueryPoolResults,
+    InterceptIdPreCallRecordCmdCopyQueryPoolResults,
+    InterceptIdPostCallRecordCmdCopyQueryPoolResults,
+    InterceptIdPreCallValidateCmdPushConstants,
+    InterceptIdPreCallRecordCmdPushConstants,
+    InterceptIdPostCallRecordCmdPushConstants,
+    InterceptIdPreCallValidateCmdBeginRenderPass,
+    InterceptIdPreCallRecordCmdBeginRenderPass,
+    InterceptIdPostCallRecordCmdBeginRenderPass,
+    InterceptIdPreCallValidateCmdNextSubpass,
+    InterceptIdPreCallRecordCmdNextSubpass,
+    InterceptIdPostCallRecordCmdNextSubpass,
+    InterceptIdPreCallValidateCmdEndRenderPass,
+    InterceptIdPreCallRecordCmdEndRenderPass,
+    InterceptIdPostCallRecordCmdEndRenderPass,
+    InterceptIdPreCallValidateCmdExecuteCommands,
+    InterceptIdPreCallRecordCmdExecuteCommands,
+    InterceptIdPostCallRecordCmdExecuteCommands,
+    InterceptIdPreCallValidateBindBufferMemory2,
+    InterceptIdPreCallRecordBindBufferMemory2,
+    InterceptIdPostCallRecordBindBufferMemory2,
+    InterceptIdPreCallValidateBindImageMemory2,
+    InterceptIdPreCallRecordBindImageMemory2,
+    InterceptIdPostCallRecordBindImageMemory2,
+    InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPreCallValidateCmdSetDeviceMask,
+    InterceptIdPreCallRecordCmdSetDeviceMask,
+    InterceptIdPostCallRecordCmdSetDeviceMask,
+    InterceptIdPreCallValidateCmdDispatchBase,
+    InterceptIdPreCallRecordCmdDispatchBase,
+    InterceptIdPostCallRecordCmdDispatchBase,
+    InterceptIdPreCallValidateEnumeratePhysicalDeviceGroups,
+    InterceptIdPreCallRecordEnumeratePhysicalDeviceGroups,
+    InterceptIdPostCallRecordEnumeratePhysicalDeviceGroups,
+    InterceptIdPreCallValidateGetImageMemoryRequirements2,
+    InterceptIdPreCallRecordGetImageMemoryRequirements2,
+    InterceptIdPostCallRecordGetImageMemoryRequirements2,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements2,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements2,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements2,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements2,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements2,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements2,
+    InterceptIdPreCallValidateGetPhysicalDeviceFeatures2,
+    InterceptIdPreCallRecordGetPhysicalDeviceFeatures2,
+    InterceptIdPostCallRecordGetPhysicalDeviceFeatures2,
+    InterceptIdPreCallValidateGetPhysicalDeviceProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties2,
+    InterceptIdPreCallValidateTrimCommandPool,
+    InterceptIdPreCallRecordTrimCommandPool,
+    InterceptIdPostCallRecordTrimCommandPool,
+    InterceptIdPreCallValidateGetDeviceQueue2,
+    InterceptIdPreCallRecordGetDeviceQueue2,
+    InterceptIdPostCallRecordGetDeviceQueue2,
+    InterceptIdPreCallValidateCreateSamplerYcbcrConversion,
+    InterceptIdPreCallRecordCreateSamplerYcbcrConversion,
+    InterceptIdPostCallRecordCreateSamplerYcbcrConversion,
+    InterceptIdPreCallValidateDestroySamplerYcbcrConversion,
+    InterceptIdPreCallRecordDestroySamplerYcbcrConversion,
+    InterceptIdPostCallRecordDestroySamplerYcbcrConversion,
+    InterceptIdPreCallValidateCreateDescriptorUpdateTemplate,
+    InterceptIdPreCallRecordCreateDescriptorUpdateTemplate,
+    InterceptIdPostCallRecordCreateDescriptorUpdateTemplate,
+    InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate,
+    InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate,
+    InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate,
+    InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate,
+    InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate,
+    InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalBufferProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalBufferProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalBufferProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalFenceProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalFenceProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalFenceProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalSemaphoreProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalSemaphoreProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalSemaphoreProperties,
+    InterceptIdPreCallValidateGetDescriptorSetLayoutSupport,
+    InterceptIdPreCallRecordGetDescriptorSetLayoutSupport,
+    InterceptIdPostCallRecordGetDescriptorSetLayoutSupport,
+    InterceptIdPreCallValidateCmdDrawIndirectCount,
+    InterceptIdPreCallRecordCmdDrawIndirectCount,
+    InterceptIdPostCallRecordCmdDrawIndirectCount,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirectCount,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirectCount,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirectCount,
+    InterceptIdPreCallValidateCreateRenderPass2,
+    InterceptIdPreCallRecordCreateRenderPass2,
+    InterceptIdPostCallRecordCreateRenderPass2,
+    InterceptIdPreCallValidateCmdBeginRenderPass2,
+    InterceptIdPreCallRecordCmdBeginRenderPass2,
+    InterceptIdPostCallRecordCmdBeginRenderPass2,
+    InterceptIdPreCallValidateCmdNextSubpass2,
+    InterceptIdPreCallRecordCmdNextSubpass2,
+    InterceptIdPostCallRecordCmdNextSubpass2,
+    InterceptIdPreCallValidateCmdEndRenderPass2,
+    InterceptIdPreCallRecordCmdEndRenderPass2,
+    InterceptIdPostCallRecordCmdEndRenderPass2,
+    InterceptIdPreCallValidateResetQueryPool,
+    InterceptIdPreCallRecordResetQueryPool,
+    InterceptIdPostCallRecordResetQueryPool,
+    InterceptIdPreCallValidateGetSemaphoreCounterValue,
+    InterceptIdPreCallRecordGetSemaphoreCounterValue,
+    InterceptIdPostCallRecordGetSemaphoreCounterValue,
+    InterceptIdPreCallValidateWaitSemaphores,
+    InterceptIdPreCallRecordWaitSemaphores,
+    InterceptIdPostCallRecordWaitSemaphores,
+    InterceptIdPreCallValidateSignalSemaphore,
+    InterceptIdPreCallRecordSignalSemaphore,
+    InterceptIdPostCallRecordSignalSemaphore,
+    InterceptIdPreCallValidateGetBufferDeviceAddress,
+    InterceptIdPreCallRecordGetBufferDeviceAddress,
+    InterceptIdPostCallRecordGetBufferDeviceAddress,
+    InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress,
+    InterceptIdPreCallRecordGetBufferOpaqueCaptureAddress,
+    InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress,
+    InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress,
+    InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddress,
+    InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress,
+    InterceptIdPreCallValidateDestroySurfaceKHR,
+    InterceptIdPreCallRecordDestroySurfaceKHR,
+    InterceptIdPostCallRecordDestroySurfaceKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceSupportKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceFormatsKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceFormatsKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceFormatsKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfacePresentModesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfacePresentModesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfacePresentModesKHR,
+    InterceptIdPreCallValidateCreateSwapchainKHR,
+    InterceptIdPreCallRecordCreateSwapchainKHR,
+    InterceptIdPostCallRecordCreateSwapchainKHR,
+    InterceptIdPreCallValidateDestroySwapchainKHR,
+    InterceptIdPreCallRecordDestroySwapchainKHR,
+    InterceptIdPostCallRecordDestroySwapchainKHR,
+    InterceptIdPreCallValidateGetSwapchainImagesKHR,
+    InterceptIdPreCallRecordGetSwapchainImagesKHR,
+    InterceptIdPostCallRecordGetSwapchainImagesKHR,
+    InterceptIdPreCallValidateAcquireNextImageKHR,
+    InterceptIdPreCallRecordAcquireNextImageKHR,
+    InterceptIdPostCallRecordAcquireNextImageKHR,
+    InterceptIdPreCallValidateQueuePresentKHR,
+    InterceptIdPreCallRecordQueuePresentKHR,
+    InterceptIdPostCallRecordQueuePresentKHR,
+    InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPreCallValidateGetPhysicalDevicePresentRectanglesKHR,
+    InterceptIdPreCallRecordGetPhysicalDevicePresentRectanglesKHR,
+    InterceptIdPostCallRecordGetPhysicalDevicePresentRectanglesKHR,
+    InterceptIdPreCallValidateAcquireNextImage2KHR,
+    InterceptIdPreCallRecordAcquireNextImage2KHR,
+    InterceptIdPostCallRecordAcquireNextImage2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceDisplayPropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceDisplayPropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceDisplayPropertiesKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceDisplayPlanePropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR,
+    InterceptIdPreCallValidateGetDisplayPlaneSupportedDisplaysKHR,
+    InterceptIdPreCallRecordGetDisplayPlaneSupportedDisplaysKHR,
+    InterceptIdPostCallRecordGetDisplayPlaneSupportedDisplaysKHR,
+    InterceptIdPreCallValidateGetDisplayModePropertiesKHR,
+    InterceptIdPreCallRecordGetDisplayModePropertiesKHR,
+    InterceptIdPostCallRecordGetDisplayModePropertiesKHR,
+    InterceptIdPreCallValidateCreateDisplayModeKHR,
+    InterceptIdPreCallRecordCreateDisplayModeKHR,
+    InterceptIdPostCallRecordCreateDisplayModeKHR,
+    InterceptIdPreCallValidateGetDisplayPlaneCapabilitiesKHR,
+    InterceptIdPreCallRecordGetDisplayPlaneCapabilitiesKHR,
+    InterceptIdPostCallRecordGetDisplayPlaneCapabilitiesKHR,
+    InterceptIdPreCallValidateCreateDisplayPlaneSurfaceKHR,
+    InterceptIdPreCallRecordCreateDisplayPlaneSurfaceKHR,
+    InterceptIdPostCallRecordCreateDisplayPlaneSurfaceKHR,
+    InterceptIdPreCallValidateCreateSharedSwapchainsKHR,
+    InterceptIdPreCallRecordCreateSharedSwapchainsKHR,
+    InterceptIdPostCallRecordCreateSharedSwapchainsKHR,
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    InterceptIdPreCallValidateCreateXlibSurfaceKHR,
+    InterceptIdPreCallRecordCreateXlibSurfaceKHR,
+    InterceptIdPostCallRecordCreateXlibSurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    InterceptIdPreCallValidateGetPhysicalDeviceXlibPresentationSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceXlibPresentationSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceXlibPresentationSupportKHR,
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    InterceptIdPreCallValidateCreateXcbSurfaceKHR,
+    InterceptIdPreCallRecordCreateXcbSurfaceKHR,
+    InterceptIdPostCallRecordCreateXcbSurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    InterceptIdPreCallValidateGetPhysicalDeviceXcbPresentationSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceXcbPresentationSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceXcbPresentationSupportKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    InterceptIdPreCallValidateCreateWaylandSurfaceKHR,
+    InterceptIdPreCallRecordCreateWaylandSurfaceKHR,
+    InterceptIdPostCallRecordCreateWaylandSurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    InterceptIdPreCallValidateGetPhysicalDeviceWaylandPresentationSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR,
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    InterceptIdPreCallValidateCreateAndroidSurfaceKHR,
+    InterceptIdPreCallRecordCreateAndroidSurfaceKHR,
+    InterceptIdPostCallRecordCreateAndroidSurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateCreateWin32SurfaceKHR,
+    InterceptIdPreCallRecordCreateWin32SurfaceKHR,
+    InterceptIdPostCallRecordCreateWin32SurfaceKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetPhysicalDeviceWin32PresentationSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceWin32PresentationSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceWin32PresentationSupportKHR,
+#endif
+    InterceptIdPreCallValidateGetPhysicalDeviceFeatures2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceFeatures2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceFeatures2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR,
+    InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPreCallValidateCmdSetDeviceMaskKHR,
+    InterceptIdPreCallRecordCmdSetDeviceMaskKHR,
+    InterceptIdPostCallRecordCmdSetDeviceMaskKHR,
+    InterceptIdPreCallValidateCmdDispatchBaseKHR,
+    InterceptIdPreCallRecordCmdDispatchBaseKHR,
+    InterceptIdPostCallRecordCmdDispatchBaseKHR,
+    InterceptIdPreCallValidateTrimCommandPoolKHR,
+    InterceptIdPreCallRecordTrimCommandPoolKHR,
+    InterceptIdPostCallRecordTrimCommandPoolKHR,
+    InterceptIdPreCallValidateEnumeratePhysicalDeviceGroupsKHR,
+    InterceptIdPreCallRecordEnumeratePhysicalDeviceGroupsKHR,
+    InterceptIdPostCallRecordEnumeratePhysicalDeviceGroupsKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalBufferPropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetMemoryWin32HandleKHR,
+    InterceptIdPreCallRecordGetMemoryWin32HandleKHR,
+    InterceptIdPostCallRecordGetMemoryWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR,
+    InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR,
+    InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR,
+#endif
+    InterceptIdPreCallValidateGetMemoryFdKHR,
+    InterceptIdPreCallRecordGetMemoryFdKHR,
+    InterceptIdPostCallRecordGetMemoryFdKHR,
+    InterceptIdPreCallValidateGetMemoryFdPropertiesKHR,
+    InterceptIdPreCallRecordGetMemoryFdPropertiesKHR,
+    InterceptIdPostCallRecordGetMemoryFdPropertiesKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalSemaphorePropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR,
+    InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR,
+    InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR,
+    InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR,
+    InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR,
+#endif
+    InterceptIdPreCallValidateImportSemaphoreFdKHR,
+    InterceptIdPreCallRecordImportSemaphoreFdKHR,
+    InterceptIdPostCallRecordImportSemaphoreFdKHR,
+    InterceptIdPreCallValidateGetSemaphoreFdKHR,
+    InterceptIdPreCallRecordGetSemaphoreFdKHR,
+    InterceptIdPostCallRecordGetSemaphoreFdKHR,
+    InterceptIdPreCallValidateCmdPushDescriptorSetKHR,
+    InterceptIdPreCallRecordCmdPushDescriptorSetKHR,
+    InterceptIdPostCallRecordCmdPushDescriptorSetKHR,
+    InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallValidateCreateRenderPass2KHR,
+    InterceptIdPreCallRecordCreateRenderPass2KHR,
+    InterceptIdPostCallRecordCreateRenderPass2KHR,
+    InterceptIdPreCallValidateCmdBeginRenderPass2KHR,
+    InterceptIdPreCallRecordCmdBeginRenderPass2KHR,
+    InterceptIdPostCallRecordCmdBeginRenderPass2KHR,
+    InterceptIdPreCallValidateCmdNextSubpass2KHR,
+    InterceptIdPreCallRecordCmdNextSubpass2KHR,
+    InterceptIdPostCallRecordCmdNextSubpass2KHR,
+    InterceptIdPreCallValidateCmdEndRenderPass2KHR,
+    InterceptIdPreCallRecordCmdEndRenderPass2KHR,
+    InterceptIdPostCallRecordCmdEndRenderPass2KHR,
+    InterceptIdPreCallValidateGetSwapchainStatusKHR,
+    InterceptIdPreCallRecordGetSwapchainStatusKHR,
+    InterceptIdPostCallRecordGetSwapchainStatusKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalFencePropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalFencePropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalFencePropertiesKHR,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateImportFenceWin32HandleKHR,
+    InterceptIdPreCallRecordImportFenceWin32HandleKHR,
+    InterceptIdPostCallRecordImportFenceWin32HandleKHR,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetFenceWin32HandleKHR,
+    InterceptIdPreCallRecordGetFenceWin32HandleKHR,
+    InterceptIdPostCallRecordGetFenceWin32HandleKHR,
+#endif
+    InterceptIdPreCallValidateImportFenceFdKHR,
+    InterceptIdPreCallRecordImportFenceFdKHR,
+    InterceptIdPostCallRecordImportFenceFdKHR,
+    InterceptIdPreCallValidateGetFenceFdKHR,
+    InterceptIdPreCallRecordGetFenceFdKHR,
+    InterceptIdPostCallRecordGetFenceFdKHR,
+    InterceptIdPreCallValidateEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR,
+    InterceptIdPreCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR,
+    InterceptIdPostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR,
+    InterceptIdPreCallValidateAcquireProfilingLockKHR,
+    InterceptIdPreCallRecordAcquireProfilingLockKHR,
+    InterceptIdPostCallRecordAcquireProfilingLockKHR,
+    InterceptIdPreCallValidateReleaseProfilingLockKHR,
+    InterceptIdPreCallRecordReleaseProfilingLockKHR,
+    InterceptIdPostCallRecordReleaseProfilingLockKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilities2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceFormats2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceFormats2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceFormats2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceDisplayProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceDisplayProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceDisplayProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceDisplayPlaneProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR,
+    InterceptIdPreCallValidateGetDisplayModeProperties2KHR,
+    InterceptIdPreCallRecordGetDisplayModeProperties2KHR,
+    InterceptIdPostCallRecordGetDisplayModeProperties2KHR,
+    InterceptIdPreCallValidateGetDisplayPlaneCapabilities2KHR,
+    InterceptIdPreCallRecordGetDisplayPlaneCapabilities2KHR,
+    InterceptIdPostCallRecordGetDisplayPlaneCapabilities2KHR,
+    InterceptIdPreCallValidateGetImageMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetImageMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetImageMemoryRequirements2KHR,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR,
+    InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR,
+    InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR,
+    InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR,
+    InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR,
+    InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR,
+    InterceptIdPreCallValidateBindBufferMemory2KHR,
+    InterceptIdPreCallRecordBindBufferMemory2KHR,
+    InterceptIdPostCallRecordBindBufferMemory2KHR,
+    InterceptIdPreCallValidateBindImageMemory2KHR,
+    InterceptIdPreCallRecordBindImageMemory2KHR,
+    InterceptIdPostCallRecordBindImageMemory2KHR,
+    InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPreCallValidateCmdDrawIndirectCountKHR,
+    InterceptIdPreCallRecordCmdDrawIndirectCountKHR,
+    InterceptIdPostCallRecordCmdDrawIndirectCountKHR,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPreCallValidateGetSemaphoreCounterValueKHR,
+    InterceptIdPreCallRecordGetSemaphoreCounterValueKHR,
+    InterceptIdPostCallRecordGetSemaphoreCounterValueKHR,
+    InterceptIdPreCallValidateWaitSemaphoresKHR,
+    InterceptIdPreCallRecordWaitSemaphoresKHR,
+    InterceptIdPostCallRecordWaitSemaphoresKHR,
+    InterceptIdPreCallValidateSignalSemaphoreKHR,
+    InterceptIdPreCallRecordSignalSemaphoreKHR,
+    InterceptIdPostCallRecordSignalSemaphoreKHR,
+    InterceptIdPreCallValidateGetBufferDeviceAddressKHR,
+    InterceptIdPreCallRecordGetBufferDeviceAddressKHR,
+    InterceptIdPostCallRecordGetBufferDeviceAddressKHR,
+    InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR,
+    InterceptIdPreCallRecordGetBufferOpaqueCaptureAddressKHR,
+    InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR,
+    InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR,
+    InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR,
+    InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR,
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCreateDeferredOperationKHR,
+    InterceptIdPreCallRecordCreateDeferredOperationKHR,
+    InterceptIdPostCallRecordCreateDeferredOperationKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateDestroyDeferredOperationKHR,
+    InterceptIdPreCallRecordDestroyDeferredOperationKHR,
+    InterceptIdPostCallRecordDestroyDeferredOperationKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR,
+    InterceptIdPreCallRecordGetDeferredOperationMaxConcurrencyKHR,
+    InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetDeferredOperationResultKHR,
+    InterceptIdPreCallRecordGetDeferredOperationResultKHR,
+    InterceptIdPostCallRecordGetDeferredOperationResultKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateDeferredOperationJoinKHR,
+    InterceptIdPreCallRecordDeferredOperationJoinKHR,
+    InterceptIdPostCallRecordDeferredOperationJoinKHR,
+#endif
+    InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR,
+    InterceptIdPreCallRecordGetPipelineExecutablePropertiesKHR,
+    InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR,
+    InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR,
+    InterceptIdPreCallRecordGetPipelineExecutableStatisticsKHR,
+    InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR,
+    InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR,
+    InterceptIdPreCallRecordGetPipelineExecutableInternalRepresentationsKHR,
+    InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR,
+    InterceptIdPreCallValidateCmdCopyBuffer2KHR,
+    InterceptIdPreCallRecordCmdCopyBuffer2KHR,
+    InterceptIdPostCallRecordCmdCopyBuffer2KHR,
+    InterceptIdPreCallValidateCmdCopyImage2KHR,
+    InterceptIdPreCallRecordCmdCopyImage2KHR,
+    InterceptIdPostCallRecordCmdCopyImage2KHR,
+    InterceptIdPreCallValidateCmdCopyBufferToImage2KHR,
+    InterceptIdPreCallRecordCmdCopyBufferToImage2KHR,
+    InterceptIdPostCallRecordCmdCopyBufferToImage2KHR,
+    InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR,
+    InterceptIdPreCallRecordCmdCopyImageToBuffer2KHR,
+    InterceptIdPostCallRecordCmdCopyImageToBuffer2KHR,
+    InterceptIdPreCallValidateCmdBlitImage2KHR,
+    InterceptIdPreCallRecordCmdBlitImage2KHR,
+    InterceptIdPostCallRecordCmdBlitImage2KHR,
+    InterceptIdPreCallValidateCmdResolveImage2KHR,
+    InterceptIdPreCallRecordCmdResolveImage2KHR,
+    InterceptIdPostCallRecordCmdResolveImage2KHR,
+    InterceptIdPreCallValidateCreateDebugReportCallbackEXT,
+    InterceptIdPreCallRecordCreateDebugReportCallbackEXT,
+    InterceptIdPostCallRecordCreateDebugReportCallbackEXT,
+    InterceptIdPreCallValidateDestroyDebugReportCallbackEXT,
+    InterceptIdPreCallRecordDestroyDebugReportCallbackEXT,
+    InterceptIdPostCallRecordDestroyDebugReportCallbackEXT,
+    InterceptIdPreCallValidateDebugReportMessageEXT,
+    InterceptIdPreCallRecordDebugReportMessageEXT,
+    InterceptIdPostCallRecordDebugReportMessageEXT,
+    InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT,
+    InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT,
+    InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT,
+    InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT,
+    InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT,
+    InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerBeginEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerBeginEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerBeginEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerEndEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerEndEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerEndEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerInsertEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerInsertEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerInsertEXT,
+    InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT,
+    InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT,
+    InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT,
+    InterceptIdPreCallValidateCmdEndTransformFeedbackEXT,
+    InterceptIdPreCallRecordCmdEndTransformFeedbackEXT,
+    InterceptIdPostCallRecordCmdEndTransformFeedbackEXT,
+    InterceptIdPreCallValidateCmdBeginQueryIndexedEXT,
+    InterceptIdPreCallRecordCmdBeginQueryIndexedEXT,
+    InterceptIdPostCallRecordCmdBeginQueryIndexedEXT,
+    InterceptIdPreCallValidateCmdEndQueryIndexedEXT,
+    InterceptIdPreCallRecordCmdEndQueryIndexedEXT,
+    InterceptIdPostCallRecordCmdEndQueryIndexedEXT,
+    InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT,
+    InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT,
+    InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT,
+    InterceptIdPreCallValidateGetImageViewHandleNVX,
+    InterceptIdPreCallRecordGetImageViewHandleNVX,
+    InterceptIdPostCallRecordGetImageViewHandleNVX,
+    InterceptIdPreCallValidateGetImageViewAddressNVX,
+    InterceptIdPreCallRecordGetImageViewAddressNVX,
+    InterceptIdPostCallRecordGetImageViewAddressNVX,
+    InterceptIdPreCallValidateCmdDrawIndirectCountAMD,
+    InterceptIdPreCallRecordCmdDrawIndirectCountAMD,
+    InterceptIdPostCallRecordCmdDrawIndirectCountAMD,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPreCallValidateGetShaderInfoAMD,
+    InterceptIdPreCallRecordGetShaderInfoAMD,
+    InterceptIdPostCallRecordGetShaderInfoAMD,
+#ifdef VK_USE_PLATFORM_GGP
+    InterceptIdPreCallValidateCreateStreamDescriptorSurfaceGGP,
+    InterceptIdPreCallRecordCreateStreamDescriptorSurfaceGGP,
+    InterceptIdPostCallRecordCreateStreamDescriptorSurfaceGGP,
+#endif
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalImageFormatPropertiesNV,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetMemoryWin32HandleNV,
+    InterceptIdPreCallRecordGetMemoryWin32HandleNV,
+    InterceptIdPostCallRecordGetMemoryWin32HandleNV,
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+    InterceptIdPreCallValidateCreateViSurfaceNN,
+    InterceptIdPreCallRecordCreateViSurfaceNN,
+    InterceptIdPostCallRecordCreateViSurfaceNN,
+#endif
+    InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT,
+    InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT,
+    InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT,
+    InterceptIdPreCallValidateCmdEndConditionalRenderingEXT,
+    InterceptIdPreCallRecordCmdEndConditionalRenderingEXT,
+    InterceptIdPostCallRecordCmdEndConditionalRenderingEXT,
+    InterceptIdPreCallValidateCmdSetViewportWScalingNV,
+    InterceptIdPreCallRecordCmdSetViewportWScalingNV,
+    InterceptIdPostCallRecordCmdSetViewportWScalingNV,
+    InterceptIdPreCallValidateReleaseDisplayEXT,
+    InterceptIdPreCallRecordReleaseDisplayEXT,
+    InterceptIdPostCallRecordReleaseDisplayEXT,
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    InterceptIdPreCallValidateAcquireXlibDisplayEXT,
+    InterceptIdPreCallRecordAcquireXlibDisplayEXT,
+    InterceptIdPostCallRecordAcquireXlibDisplayEXT,
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    InterceptIdPreCallValidateGetRandROutputDisplayEXT,
+    InterceptIdPreCallRecordGetRandROutputDisplayEXT,
+    InterceptIdPostCallRecordGetRandROutputDisplayEXT,
+#endif
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilities2EXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT,
+    InterceptIdPreCallValidateDisplayPowerControlEXT,
+    InterceptIdPreCallRecordDisplayPowerControlEXT,
+    InterceptIdPostCallRecordDisplayPowerControlEXT,
+    InterceptIdPreCallValidateRegisterDeviceEventEXT,
+    InterceptIdPreCallRecordRegisterDeviceEventEXT,
+    InterceptIdPostCallRecordRegisterDeviceEventEXT,
+    InterceptIdPreCallValidateRegisterDisplayEventEXT,
+    InterceptIdPreCallRecordRegisterDisplayEventEXT,
+    InterceptIdPostCallRecordRegisterDisplayEventEXT,
+    InterceptIdPreCallValidateGetSwapchainCounterEXT,
+    InterceptIdPreCallRecordGetSwapchainCounterEXT,
+    InterceptIdPostCallRecordGetSwapchainCounterEXT,
+    InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE,
+    InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE,
+    InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE,
+    InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE,
+    InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE,
+    InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE,
+    InterceptIdPreCallValidateCmdSetDiscardRectangleEXT,
+    InterceptIdPreCallRecordCmdSetDiscardRectangleEXT,
+    InterceptIdPostCallRecordCmdSetDiscardRectangleEXT,
+    InterceptIdPreCallValidateSetHdrMetadataEXT,
+    InterceptIdPreCallRecordSetHdrMetadataEXT,
+    InterceptIdPostCallRecordSetHdrMetadataEXT,
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    InterceptIdPreCallValidateCreateIOSSurfaceMVK,
+    InterceptIdPreCallRecordCreateIOSSurfaceMVK,
+    InterceptIdPostCallRecordCreateIOSSurfaceMVK,
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    InterceptIdPreCallValidateCreateMacOSSurfaceMVK,
+    InterceptIdPreCallRecordCreateMacOSSurfaceMVK,
+    InterceptIdPostCallRecordCreateMacOSSurfaceMVK,
+#endif
+    InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT,
+    InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT,
+    InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT,
+    InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT,
+    InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT,
+    InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT,
+    InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCreateDebugUtilsMessengerEXT,
+    InterceptIdPreCallRecordCreateDebugUtilsMessengerEXT,
+    InterceptIdPostCallRecordCreateDebugUtilsMessengerEXT,
+    InterceptIdPreCallValidateDestroyDebugUtilsMessengerEXT,
+    InterceptIdPreCallRecordDestroyDebugUtilsMessengerEXT,
+    InterceptIdPostCallRecordDestroyDebugUtilsMessengerEXT,
+    InterceptIdPreCallValidateSubmitDebugUtilsMessageEXT,
+    InterceptIdPreCallRecordSubmitDebugUtilsMessageEXT,
+    InterceptIdPostCallRecordSubmitDebugUtilsMessageEXT,
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID,
+    InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID,
+    InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID,
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID,
+    InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID,
+    InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID,
+#endif
+    InterceptIdPreCallValidateCmdSetSampleLocationsEXT,
+    InterceptIdPreCallRecordCmdSetSampleLocationsEXT,
+    InterceptIdPostCallRecordCmdSetSampleLocationsEXT,
+    InterceptIdPreCallValidateGetPhysicalDeviceMultisamplePropertiesEXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceMultisamplePropertiesEXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceMultisamplePropertiesEXT,
+    InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPreCallValidateCmdBindShadingRateImageNV,
+    InterceptIdPreCallRecordCmdBindShadingRateImageNV,
+    InterceptIdPostCallRecordCmdBindShadingRateImageNV,
+    InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV,
+    InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV,
+    InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV,
+    InterceptIdPreCallValidateCreateAccelerationStructureNV,
+    InterceptIdPreCallRecordCreateAccelerationStructureNV,
+    InterceptIdPostCallRecordCreateAccelerationStructureNV,
+    InterceptIdPreCallValidateDestroyAccelerationStructureKHR,
+    InterceptIdPreCallRecordDestroyAccelerationStructureKHR,
+    InterceptIdPostCallRecordDestroyAccelerationStructureKHR,
+    InterceptIdPreCallValidateDestroyAccelerationStructureNV,
+    InterceptIdPreCallRecordDestroyAccelerationStructureNV,
+    InterceptIdPostCallRecordDestroyAccelerationStructureNV,
+    InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPreCallValidateBindAccelerationStructureMemoryKHR,
+    InterceptIdPreCallRecordBindAccelerationStructureMemoryKHR,
+    InterceptIdPostCallRecordBindAccelerationStructureMemoryKHR,
+    InterceptIdPreCallValidateBindAccelerationStructureMemoryNV,
+    InterceptIdPreCallRecordBindAccelerationStructureMemoryNV,
+    InterceptIdPostCallRecordBindAccelerationStructureMemoryNV,
+    InterceptIdPreCallValidateCmdBuildAccelerationStructureNV,
+    InterceptIdPreCallRecordCmdBuildAccelerationStructureNV,
+    InterceptIdPostCallRecordCmdBuildAccelerationStructureNV,
+    InterceptIdPreCallValidateCmdCopyAccelerationStructureNV,
+    InterceptIdPreCallRecordCmdCopyAccelerationStructureNV,
+    InterceptIdPostCallRecordCmdCopyAccelerationStructureNV,
+    InterceptIdPreCallValidateCmdTraceRaysNV,
+    InterceptIdPreCallRecordCmdTraceRaysNV,
+    InterceptIdPostCallRecordCmdTraceRaysNV,
+    InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR,
+    InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR,
+    InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR,
+    InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPreCallValidateGetAccelerationStructureHandleNV,
+    InterceptIdPreCallRecordGetAccelerationStructureHandleNV,
+    InterceptIdPostCallRecordGetAccelerationStructureHandleNV,
+    InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPreCallValidateCompileDeferredNV,
+    InterceptIdPreCallRecordCompileDeferredNV,
+    InterceptIdPostCallRecordCompileDeferredNV,
+    InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPreCallValidateCmdWriteBufferMarkerAMD,
+    InterceptIdPreCallRecordCmdWriteBufferMarkerAMD,
+    InterceptIdPostCallRecordCmdWriteBufferMarkerAMD,
+    InterceptIdPreCallValidateGetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    InterceptIdPreCallValidateGetCalibratedTimestampsEXT,
+    InterceptIdPreCallRecordGetCalibratedTimestampsEXT,
+    InterceptIdPostCallRecordGetCalibratedTimestampsEXT,
+    InterceptIdPreCallValidateCmdDrawMeshTasksNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksNV,
+    InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV,
+    InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPreCallValidateCmdSetExclusiveScissorNV,
+    InterceptIdPreCallRecordCmdSetExclusiveScissorNV,
+    InterceptIdPostCallRecordCmdSetExclusiveScissorNV,
+    InterceptIdPreCallValidateCmdSetCheckpointNV,
+    InterceptIdPreCallRecordCmdSetCheckpointNV,
+    InterceptIdPostCallRecordCmdSetCheckpointNV,
+    InterceptIdPreCallValidateGetQueueCheckpointDataNV,
+    InterceptIdPreCallRecordGetQueueCheckpointDataNV,
+    InterceptIdPostCallRecordGetQueueCheckpointDataNV,
+    InterceptIdPreCallValidateInitializePerformanceApiINTEL,
+    InterceptIdPreCallRecordInitializePerformanceApiINTEL,
+    InterceptIdPostCallRecordInitializePerformanceApiINTEL,
+    InterceptIdPreCallValidateUninitializePerformanceApiINTEL,
+    InterceptIdPreCallRecordUninitializePerformanceApiINTEL,
+    InterceptIdPostCallRecordUninitializePerformanceApiINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL,
+    InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateGetPerformanceParameterINTEL,
+    InterceptIdPreCallRecordGetPerformanceParameterINTEL,
+    InterceptIdPostCallRecordGetPerformanceParameterINTEL,
+    InterceptIdPreCallValidateSetLocalDimmingAMD,
+    InterceptIdPreCallRecordSetLocalDimmingAMD,
+    InterceptIdPostCallRecordSetLocalDimmingAMD,
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    InterceptIdPreCallValidateCreateImagePipeSurfaceFUCHSIA,
+    InterceptIdPreCallRecordCreateImagePipeSurfaceFUCHSIA,
+    InterceptIdPostCallRecordCreateImagePipeSurfaceFUCHSIA,
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    InterceptIdPreCallValidateCreateMetalSurfaceEXT,
+    InterceptIdPreCallRecordCreateMetalSurfaceEXT,
+    InterceptIdPostCallRecordCreateMetalSurfaceEXT,
+#endif
+    InterceptIdPreCallValidateGetBufferDeviceAddressEXT,
+    InterceptIdPreCallRecordGetBufferDeviceAddressEXT,
+    InterceptIdPostCallRecordGetBufferDeviceAddressEXT,
+    InterceptIdPreCallValidateGetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    InterceptIdPreCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    InterceptIdPostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    InterceptIdPreCallValidateGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+    InterceptIdPreCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+    InterceptIdPostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfacePresentModes2EXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfacePresentModes2EXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT,
+    InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT,
+    InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT,
+    InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT,
+    InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT,
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT,
+    InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT,
+    InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT,
+#endif
+    InterceptIdPreCallValidateCreateHeadlessSurfaceEXT,
+    InterceptIdPreCallRecordCreateHeadlessSurfaceEXT,
+    InterceptIdPostCallRecordCreateHeadlessSurfaceEXT,
+    InterceptIdPreCallValidateCmdSetLineStippleEXT,
+    InterceptIdPreCallRecordCmdSetLineStippleEXT,
+    InterceptIdPostCallRecordCmdSetLineStippleEXT,
+    InterceptIdPreCallValidateResetQueryPoolEXT,
+    InterceptIdPreCallRecordResetQueryPoolEXT,
+    InterceptIdPostCallRecordResetQueryPoolEXT,
+    InterceptIdPreCallValidateCmdSetCullModeEXT,
+    InterceptIdPreCallRecordCmdSetCullModeEXT,
+    InterceptIdPostCallRecordCmdSetCullModeEXT,
+    InterceptIdPreCallValidateCmdSetFrontFaceEXT,
+    InterceptIdPreCallRecordCmdSetFrontFaceEXT,
+    InterceptIdPostCallRecordCmdSetFrontFaceEXT,
+    InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT,
+    InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT,
+    InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT,
+    InterceptIdPreCallValidateCmdSetViewportWithCountEXT,
+    InterceptIdPreCallRecordCmdSetViewportWithCountEXT,
+    InterceptIdPostCallRecordCmdSetViewportWithCountEXT,
+    InterceptIdPreCallValidateCmdSetScissorWithCountEXT,
+    InterceptIdPreCallRecordCmdSetScissorWithCountEXT,
+    InterceptIdPostCallRecordCmdSetScissorWithCountEXT,
+    InterceptIdPreCallValidateCmdBindVertexBuffers2EXT,
+    InterceptIdPreCallRecordCmdBindVertexBuffers2EXT,
+    InterceptIdPostCallRecordCmdBindVertexBuffers2EXT,
+    InterceptIdPreCallValidateCmdSetDepthTestEnableEXT,
+    InterceptIdPreCallRecordCmdSetDepthTestEnableEXT,
+    InterceptIdPostCallRecordCmdSetDepthTestEnableEXT,
+    InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT,
+    InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT,
+    InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT,
+    InterceptIdPreCallValidateCmdSetDepthCompareOpEXT,
+    InterceptIdPreCallRecordCmdSetDepthCompareOpEXT,
+    InterceptIdPostCallRecordCmdSetDepthCompareOpEXT,
+    InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT,
+    InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT,
+    InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT,
+    InterceptIdPreCallValidateCmdSetStencilTestEnableEXT,
+    InterceptIdPreCallRecordCmdSetStencilTestEnableEXT,
+    InterceptIdPostCallRecordCmdSetStencilTestEnableEXT,
+    InterceptIdPreCallValidateCmdSetStencilOpEXT,
+    InterceptIdPreCallRecordCmdSetStencilOpEXT,
+    InterceptIdPostCallRecordCmdSetStencilOpEXT,
+    InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV,
+    InterceptIdPreCallRecordGetGeneratedCommandsMemoryRequirementsNV,
+    InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV,
+    InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV,
+    InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV,
+    InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV,
+    InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV,
+    InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV,
+    InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV,
+    InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV,
+    InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV,
+    InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV,
+    InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV,
+    InterceptIdPreCallRecordCreateIndirectCommandsLayoutNV,
+    InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV,
+    InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV,
+    InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNV,
+    InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV,
+    InterceptIdPreCallValidateCreatePrivateDataSlotEXT,
+    InterceptIdPreCallRecordCreatePrivateDataSlotEXT,
+    InterceptIdPostCallRecordCreatePrivateDataSlotEXT,
+    InterceptIdPreCallValidateDestroyPrivateDataSlotEXT,
+    InterceptIdPreCallRecordDestroyPrivateDataSlotEXT,
+    InterceptIdPostCallRecordDestroyPrivateDataSlotEXT,
+    InterceptIdPreCallValidateSetPrivateDataEXT,
+    InterceptIdPreCallRecordSetPrivateDataEXT,
+    InterceptIdPostCallRecordSetPrivateDataEXT,
+    InterceptIdPreCallValidateGetPrivateDataEXT,
+    InterceptIdPreCallRecordGetPrivateDataEXT,
+    InterceptIdPostCallRecordGetPrivateDataEXT,
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    InterceptIdPreCallValidateCreateDirectFBSurfaceEXT,
+    InterceptIdPreCallRecordCreateDirectFBSurfaceEXT,
+    InterceptIdPostCallRecordCreateDirectFBSurfaceEXT,
+#endif
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    InterceptIdPreCallValidateGetPhysicalDeviceDirectFBPresentationSupportEXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCreateAccelerationStructureKHR,
+    InterceptIdPreCallRecordCreateAccelerationStructureKHR,
+    InterceptIdPostCallRecordCreateAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsKHR,
+    InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsKHR,
+    InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdBuildAccelerationStructureKHR,
+    InterceptIdPreCallRecordCmdBuildAccelerationStructureKHR,
+    InterceptIdPostCallRecordCmdBuildAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdBuildAccelerationStructureIndirectKHR,
+    InterceptIdPreCallRecordCmdBuildAccelerationStructureIndirectKHR,
+    InterceptIdPostCallRecordCmdBuildAccelerationStructureIndirectKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateBuildAccelerationStructureKHR,
+    InterceptIdPreCallRecordBuildAccelerationStructureKHR,
+    InterceptIdPostCallRecordBuildAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCopyAccelerationStructureKHR,
+    InterceptIdPreCallRecordCopyAccelerationStructureKHR,
+    InterceptIdPostCallRecordCopyAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR,
+    InterceptIdPreCallRecordCopyAccelerationStructureToMemoryKHR,
+    InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR,
+    InterceptIdPreCallRecordCopyMemoryToAccelerationStructureKHR,
+    InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPreCallRecordWriteAccelerationStructuresPropertiesKHR,
+    InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR,
+    InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR,
+    InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR,
+    InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR,
+    InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR,
+    InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR,
+    InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdTraceRaysKHR,
+    InterceptIdPreCallRecordCmdTraceRaysKHR,
+    InterceptIdPostCallRecordCmdTraceRaysKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR,
+    InterceptIdPreCallRecordGetAccelerationStructureDeviceAddressKHR,
+    InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+    InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+    InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateCmdTraceRaysIndirectKHR,
+    InterceptIdPreCallRecordCmdTraceRaysIndirectKHR,
+    InterceptIdPostCallRecordCmdTraceRaysIndirectKHR,
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR,
+    InterceptIdPreCallRecordGetDeviceAccelerationStructureCompatibilityKHR,
+    InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR,
+#endif
+    InterceptIdCount,
+} InterceptId;
+
 
 // Layer object type identifiers
 enum LayerObjectTypeId {
@@ -2836,6 +4198,10 @@ typedef enum ValidationCheckDisables {
 typedef enum ValidationCheckEnables {
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM,
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL,
+    VALIDATION_CHECK_ENABLE_FINE_GRAINED_LOCKING,
+    VALIDATION_CHECK_ENABLE_GPU_DEFERRED_READBACK,
+    VALIDATION_CHECK_ENABLE_PARALLEL_DESCRIPTOR_UPDATES,
+    VALIDATION_CHECK_ENABLE_SHARED_STATE_TRACKING,
 } ValidationCheckEnables;
 
 typedef enum VkValidationFeatureEnable {
@@ -2870,6 +4236,10 @@ typedef enum EnableFlags {
     vendor_specific_arm,
     debug_printf,
     sync_validation,
+    fine_grained_locking,
+    gpu_deferred_readback,
+    parallel_descriptor_updates,
+    shared_state_tracking,
     // Insert new enables above this line
     kMaxEnableFlags,
 } EnableFlags;
@@ -2897,6 +4267,8 @@ class ValidationObject {
         LAYER_PHYS_DEV_PROPERTIES phys_dev_properties = {};
 
         std::vector<ValidationObject*> object_dispatch;
+        // Per-intercept subsets of object_dispatch, holding only the objects that override that particular hook
+        std::vector<std::vector<ValidationObject*>> intercept_vectors;
         LayerObjectTypeId container_type;
 
         std::string layer_name = "CHASSIS";
@@ -2913,6 +4285,14 @@ class ValidationObject {
         virtual write_lock_guard_t write_lock() {
             return write_lock_guard_t(validation_object_mutex);
         }
+        // Locks taken around the hooks of vkCmd* commands. By default these are the object-wide locks, validation objects
+        // that synchronize their per command buffer state themselves can narrow them to the target command buffer.
+        virtual CmdBufferLockGuard cmd_buffer_read_lock(VkCommandBuffer command_buffer) {
+            return CmdBufferLockGuard{read_lock()};
+        }
+        virtual CmdBufferLockGuard cmd_buffer_write_lock(VkCommandBuffer command_buffer) {
+            return CmdBufferLockGuard{read_lock_guard_t(), write_lock()};
+        }
 
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
@@ -2946,6 +4326,8 @@ class ValidationObject {
             }
         }
 
+        void InitObjectDispatchVectors();
+
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
             for (auto validation_object : object_dispatch) {
                 if (validation_object->container_type == object_type) {
@@ -2957,6 +4339,7 @@ class ValidationObject {
 
         // Debug Logging Helpers
         bool LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
@@ -2975,6 +4358,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool LogError(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
@@ -2994,6 +4378,7 @@ class ValidationObject {
         };
 
         bool LogWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
@@ -3012,6 +4397,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
@@ -3030,6 +4416,7 @@ class ValidationObject {
         };
 
         bool LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
@@ -3048,6 +4435,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
@@ -3066,6 +4454,7 @@ class ValidationObject {
         };
 
         bool LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
@@ -3084,6 +4473,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
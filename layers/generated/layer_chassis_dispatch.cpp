@@ -179,6 +179,107 @@ void WrapPnextChainHandles(ValidationObject *layer_data, const void *pNext) {
 
 #define DISPATCH_MAX_STACK_ALLOCATIONS 32
 
+// Per-thread bump allocator for the temporary unwrapped copies of API parameters. A Dispatch function opens a
+// DispatchScratchScope and allocates its copies from it; when the scope closes the copies are destroyed and their memory
+// is handed back to the arena. Scopes nest, so dispatch calls made by validation objects while an outer call is still in
+// flight work too. Blocks are kept for reuse, so once warmed up the arena does not touch the heap.
+class DispatchScratchArena {
+  public:
+    struct Destructor {
+        void (*destroy)(void *objects, size_t count);
+        void *objects;
+        size_t count;
+        Destructor *next;
+    };
+    struct Mark {
+        size_t block;
+        size_t offset;
+        Destructor *destructors;
+    };
+
+    Mark GetMark() const { return {block_, offset_, destructors_}; }
+
+    void Release(const Mark &mark) {
+        while (destructors_ != mark.destructors) {
+            destructors_->destroy(destructors_->objects, destructors_->count);
+            destructors_ = destructors_->next;
+        }
+        block_ = mark.block;
+        offset_ = mark.offset;
+    }
+
+    void *Allocate(size_t size, size_t alignment) {
+        while (block_ < blocks_.size()) {
+            const size_t offset = (offset_ + alignment - 1) & ~(alignment - 1);
+            if (offset + size <= blocks_[block_].size) {
+                offset_ = offset + size;
+                return blocks_[block_].data.get() + offset;
+            }
+            // Blocks are only ever appended or inserted, so everything past block_ is free
+            if (block_ + 1 < blocks_.size() && blocks_[block_ + 1].size < size + alignment) {
+                blocks_.insert(blocks_.begin() + block_ + 1, Block(size + alignment));
+            }
+            ++block_;
+            offset_ = 0;
+        }
+        blocks_.emplace_back(size + alignment > kBlockSize ? size + alignment : kBlockSize);
+        offset_ = 0;
+        return Allocate(size, alignment);
+    }
+
+    template <typename T>
+    T *NewArray(size_t count) {
+        T *objects = static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+        for (size_t i = 0; i < count; ++i) new (&objects[i]) T();
+        if (!std::is_trivially_destructible<T>::value) {
+            auto destructor = static_cast<Destructor *>(Allocate(sizeof(Destructor), alignof(Destructor)));
+            destructor->destroy = [](void *objects, size_t count) {
+                for (size_t i = 0; i < count; ++i) static_cast<T *>(objects)[i].~T();
+            };
+            destructor->objects = objects;
+            destructor->count = count;
+            destructor->next = destructors_;
+            destructors_ = destructor;
+        }
+        return objects;
+    }
+
+  private:
+    static const size_t kBlockSize = 64 * 1024;
+    struct Block {
+        explicit Block(size_t block_size) : size(block_size), data(new uint8_t[block_size]) {}
+        size_t size;
+        std::unique_ptr<uint8_t[]> data;
+    };
+
+    std::vector<Block> blocks_;
+    size_t block_ = 0;
+    size_t offset_ = 0;
+    Destructor *destructors_ = nullptr;
+};
+
+class DispatchScratchScope {
+  public:
+    DispatchScratchScope() : arena_(GetArena()), mark_(arena_.GetMark()) {}
+    ~DispatchScratchScope() { arena_.Release(mark_); }
+    DispatchScratchScope(const DispatchScratchScope &) = delete;
+    DispatchScratchScope &operator=(const DispatchScratchScope &) = delete;
+
+    template <typename T>
+    T *NewArray(size_t count) {
+        return arena_.NewArray<T>(count);
+    }
+
+  private:
+    static DispatchScratchArena &GetArena() {
+        static thread_local DispatchScratchArena arena;
+        return arena;
+    }
+
+    DispatchScratchArena &arena_;
+    const DispatchScratchArena::Mark mark_;
+};
+
 // The VK_EXT_pipeline_creation_feedback extension returns data from the driver -- we've created a copy of the pnext chain, so
 // copy the returned data to the caller before freeing the copy's data.
 void CopyCreatePipelineFeedbackData(const void *src_chain, const void *dst_chain) {
@@ -198,9 +299,10 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateGraphicsPipelines(device, pipelineCache, createInfoCount,
                                                                                            pCreateInfos, pAllocator, pPipelines);
+    DispatchScratchScope scratch;
     safe_VkGraphicsPipelineCreateInfo *local_pCreateInfos = nullptr;
     if (pCreateInfos) {
-        local_pCreateInfos = new safe_VkGraphicsPipelineCreateInfo[createInfoCount];
+        local_pCreateInfos = scratch.NewArray<safe_VkGraphicsPipelineCreateInfo>(createInfoCount);
         read_lock_guard_t lock(dispatch_lock);
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             bool uses_color_attachment = false;
@@ -248,7 +350,6 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
         }
     }
 
-    delete[] local_pCreateInfos;
     {
         for (uint32_t i = 0; i < createInfoCount; ++i) {
             if (pPipelines[i] != VK_NULL_HANDLE) {
@@ -259,6 +360,140 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
     return result;
 }
 
+// Streaming descriptor updates are hot, so rather than deep copying the writes through safe structs this makes shallow
+// copies in the scratch arena and only replaces the handle arrays. Writes with a pNext chain (which may carry handles)
+// fall back to a deep copy of that write.
+void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
+                                  uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
+                                                                      descriptorCopyCount, pDescriptorCopies);
+    DispatchScratchScope scratch;
+    VkWriteDescriptorSet *local_pDescriptorWrites = nullptr;
+    VkCopyDescriptorSet *local_pDescriptorCopies = nullptr;
+    if (pDescriptorWrites) {
+        local_pDescriptorWrites = scratch.NewArray<VkWriteDescriptorSet>(descriptorWriteCount);
+        for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
+            const VkWriteDescriptorSet &write = pDescriptorWrites[index0];
+            VkWriteDescriptorSet &local_write = local_pDescriptorWrites[index0];
+            if (write.pNext) {
+                auto safe_write = scratch.NewArray<safe_VkWriteDescriptorSet>(1);
+                safe_write->initialize(&write);
+                WrapPnextChainHandles(layer_data, safe_write->pNext);
+                local_write = *safe_write->ptr();
+            } else {
+                local_write = write;
+            }
+            if (write.dstSet) {
+                local_write.dstSet = layer_data->Unwrap(write.dstSet);
+            }
+            switch (write.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    if (write.descriptorCount && write.pImageInfo) {
+                        auto local_image_info = scratch.NewArray<VkDescriptorImageInfo>(write.descriptorCount);
+                        for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                            local_image_info[index1] = write.pImageInfo[index1];
+                            if (write.pImageInfo[index1].sampler) {
+                                local_image_info[index1].sampler = layer_data->Unwrap(write.pImageInfo[index1].sampler);
+                            }
+                            if (write.pImageInfo[index1].imageView) {
+                                local_image_info[index1].imageView = layer_data->Unwrap(write.pImageInfo[index1].imageView);
+                            }
+                        }
+                        local_write.pImageInfo = local_image_info;
+                    }
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    if (write.descriptorCount && write.pBufferInfo) {
+                        auto local_buffer_info = scratch.NewArray<VkDescriptorBufferInfo>(write.descriptorCount);
+                        for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                            local_buffer_info[index1] = write.pBufferInfo[index1];
+                            if (write.pBufferInfo[index1].buffer) {
+                                local_buffer_info[index1].buffer = layer_data->Unwrap(write.pBufferInfo[index1].buffer);
+                            }
+                        }
+                        local_write.pBufferInfo = local_buffer_info;
+                    }
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    if (write.descriptorCount && write.pTexelBufferView) {
+                        auto local_texel_buffer_view = scratch.NewArray<VkBufferView>(write.descriptorCount);
+                        for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                            local_texel_buffer_view[index1] = layer_data->Unwrap(write.pTexelBufferView[index1]);
+                        }
+                        local_write.pTexelBufferView = local_texel_buffer_view;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    if (pDescriptorCopies) {
+        local_pDescriptorCopies = scratch.NewArray<VkCopyDescriptorSet>(descriptorCopyCount);
+        for (uint32_t index0 = 0; index0 < descriptorCopyCount; ++index0) {
+            local_pDescriptorCopies[index0] = pDescriptorCopies[index0];
+            if (pDescriptorCopies[index0].srcSet) {
+                local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(pDescriptorCopies[index0].srcSet);
+            }
+            if (pDescriptorCopies[index0].dstSet) {
+                local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(pDescriptorCopies[index0].dstSet);
+            }
+        }
+    }
+    layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, local_pDescriptorWrites,
+                                                           descriptorCopyCount, local_pDescriptorCopies);
+}
+
+// Submits are hot too, so they get the same treatment as descriptor writes: shallow copies in the scratch arena with only
+// the semaphore arrays replaced. A submit with a pNext chain (which may carry handles) falls back to a deep copy.
+VkResult DispatchQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    DispatchScratchScope scratch;
+    VkSubmitInfo *local_pSubmits = nullptr;
+    if (pSubmits) {
+        local_pSubmits = scratch.NewArray<VkSubmitInfo>(submitCount);
+        for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
+            const VkSubmitInfo &submit = pSubmits[index0];
+            VkSubmitInfo &local_submit = local_pSubmits[index0];
+            if (submit.pNext) {
+                auto safe_submit = scratch.NewArray<safe_VkSubmitInfo>(1);
+                safe_submit->initialize(&submit);
+                WrapPnextChainHandles(layer_data, safe_submit->pNext);
+                local_submit = *safe_submit->ptr();
+            } else {
+                local_submit = submit;
+            }
+            if (submit.waitSemaphoreCount && submit.pWaitSemaphores) {
+                auto local_wait_semaphores = scratch.NewArray<VkSemaphore>(submit.waitSemaphoreCount);
+                for (uint32_t index1 = 0; index1 < submit.waitSemaphoreCount; ++index1) {
+                    local_wait_semaphores[index1] = layer_data->Unwrap(submit.pWaitSemaphores[index1]);
+                }
+                local_submit.pWaitSemaphores = local_wait_semaphores;
+            }
+            if (submit.signalSemaphoreCount && submit.pSignalSemaphores) {
+                auto local_signal_semaphores = scratch.NewArray<VkSemaphore>(submit.signalSemaphoreCount);
+                for (uint32_t index1 = 0; index1 < submit.signalSemaphoreCount; ++index1) {
+                    local_signal_semaphores[index1] = layer_data->Unwrap(submit.pSignalSemaphores[index1]);
+                }
+                local_submit.pSignalSemaphores = local_signal_semaphores;
+            }
+        }
+    }
+    fence = layer_data->Unwrap(fence);
+    return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, local_pSubmits, fence);
+}
+
 template <typename T>
 static void UpdateCreateRenderPassState(ValidationObject *layer_data, const T *pCreateInfo, VkRenderPass renderPass) {
     auto &renderpass_state = layer_data->renderpasses_states[renderPass];
@@ -339,16 +574,18 @@ VkResult DispatchCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfo
                                     const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
-    safe_VkSwapchainCreateInfoKHR *local_pCreateInfo = NULL;
+    // None of the members behind pointers hold handles, so a shallow copy is enough
+    VkSwapchainCreateInfoKHR local_create_info;
+    const VkSwapchainCreateInfoKHR *local_pCreateInfo = nullptr;
     if (pCreateInfo) {
-        local_pCreateInfo = new safe_VkSwapchainCreateInfoKHR(pCreateInfo);
-        local_pCreateInfo->oldSwapchain = layer_data->Unwrap(pCreateInfo->oldSwapchain);
+        local_create_info = *pCreateInfo;
+        local_create_info.oldSwapchain = layer_data->Unwrap(pCreateInfo->oldSwapchain);
         // Surface is instance-level object
-        local_pCreateInfo->surface = layer_data->Unwrap(pCreateInfo->surface);
+        local_create_info.surface = layer_data->Unwrap(pCreateInfo->surface);
+        local_pCreateInfo = &local_create_info;
     }
 
-    VkResult result = layer_data->device_dispatch_table.CreateSwapchainKHR(device, local_pCreateInfo->ptr(), pAllocator, pSwapchain);
-    delete local_pCreateInfo;
+    VkResult result = layer_data->device_dispatch_table.CreateSwapchainKHR(device, local_pCreateInfo, pAllocator, pSwapchain);
 
     if (VK_SUCCESS == result) {
         *pSwapchain = layer_data->WrapNew(*pSwapchain);
@@ -362,25 +599,23 @@ VkResult DispatchCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCo
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator,
                                                                            pSwapchains);
-    safe_VkSwapchainCreateInfoKHR *local_pCreateInfos = NULL;
-    {
-        if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkSwapchainCreateInfoKHR[swapchainCount];
-            for (uint32_t i = 0; i < swapchainCount; ++i) {
-                local_pCreateInfos[i].initialize(&pCreateInfos[i]);
-                if (pCreateInfos[i].surface) {
-                    // Surface is instance-level object
-                    local_pCreateInfos[i].surface = layer_data->Unwrap(pCreateInfos[i].surface);
-                }
-                if (pCreateInfos[i].oldSwapchain) {
-                    local_pCreateInfos[i].oldSwapchain = layer_data->Unwrap(pCreateInfos[i].oldSwapchain);
-                }
+    DispatchScratchScope scratch;
+    VkSwapchainCreateInfoKHR *local_pCreateInfos = nullptr;
+    if (pCreateInfos) {
+        local_pCreateInfos = scratch.NewArray<VkSwapchainCreateInfoKHR>(swapchainCount);
+        for (uint32_t i = 0; i < swapchainCount; ++i) {
+            local_pCreateInfos[i] = pCreateInfos[i];
+            if (pCreateInfos[i].surface) {
+                // Surface is instance-level object
+                local_pCreateInfos[i].surface = layer_data->Unwrap(pCreateInfos[i].surface);
+            }
+            if (pCreateInfos[i].oldSwapchain) {
+                local_pCreateInfos[i].oldSwapchain = layer_data->Unwrap(pCreateInfos[i].oldSwapchain);
             }
         }
     }
-    VkResult result = layer_data->device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, local_pCreateInfos->ptr(),
+    VkResult result = layer_data->device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, local_pCreateInfos,
                                                                                   pAllocator, pSwapchains);
-    delete[] local_pCreateInfos;
     if (VK_SUCCESS == result) {
         for (uint32_t i = 0; i < swapchainCount; i++) {
             pSwapchains[i] = layer_data->WrapNew(pSwapchains[i]);
@@ -442,33 +677,29 @@ void DispatchDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, cons
 VkResult DispatchQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueuePresentKHR(queue, pPresentInfo);
-    safe_VkPresentInfoKHR *local_pPresentInfo = NULL;
-    {
-        if (pPresentInfo) {
-            local_pPresentInfo = new safe_VkPresentInfoKHR(pPresentInfo);
-            if (local_pPresentInfo->pWaitSemaphores) {
-                for (uint32_t index1 = 0; index1 < local_pPresentInfo->waitSemaphoreCount; ++index1) {
-                    local_pPresentInfo->pWaitSemaphores[index1] = layer_data->Unwrap(pPresentInfo->pWaitSemaphores[index1]);
-                }
-            }
-            if (local_pPresentInfo->pSwapchains) {
-                for (uint32_t index1 = 0; index1 < local_pPresentInfo->swapchainCount; ++index1) {
-                    local_pPresentInfo->pSwapchains[index1] = layer_data->Unwrap(pPresentInfo->pSwapchains[index1]);
-                }
+    // A shallow copy with only the handle arrays replaced, which also leaves pResults pointing at the caller's array
+    DispatchScratchScope scratch;
+    VkPresentInfoKHR local_present_info;
+    const VkPresentInfoKHR *local_pPresentInfo = nullptr;
+    if (pPresentInfo) {
+        local_present_info = *pPresentInfo;
+        if (pPresentInfo->waitSemaphoreCount && pPresentInfo->pWaitSemaphores) {
+            auto local_wait_semaphores = scratch.NewArray<VkSemaphore>(pPresentInfo->waitSemaphoreCount);
+            for (uint32_t index1 = 0; index1 < pPresentInfo->waitSemaphoreCount; ++index1) {
+                local_wait_semaphores[index1] = layer_data->Unwrap(pPresentInfo->pWaitSemaphores[index1]);
             }
+            local_present_info.pWaitSemaphores = local_wait_semaphores;
         }
-    }
-    VkResult result = layer_data->device_dispatch_table.QueuePresentKHR(queue, local_pPresentInfo->ptr());
-
-    // pResults is an output array embedded in a structure. The code generator neglects to copy back from the safe_* version,
-    // so handle it as a special case here:
-    if (pPresentInfo && pPresentInfo->pResults) {
-        for (uint32_t i = 0; i < pPresentInfo->swapchainCount; i++) {
-            pPresentInfo->pResults[i] = local_pPresentInfo->pResults[i];
+        if (pPresentInfo->swapchainCount && pPresentInfo->pSwapchains) {
+            auto local_swapchains = scratch.NewArray<VkSwapchainKHR>(pPresentInfo->swapchainCount);
+            for (uint32_t index1 = 0; index1 < pPresentInfo->swapchainCount; ++index1) {
+                local_swapchains[index1] = layer_data->Unwrap(pPresentInfo->pSwapchains[index1]);
+            }
+            local_present_info.pSwapchains = local_swapchains;
         }
+        local_pPresentInfo = &local_present_info;
     }
-    delete local_pPresentInfo;
-    return result;
+    return layer_data->device_dispatch_table.QueuePresentKHR(queue, local_pPresentInfo);
 }
 
 void DispatchDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks *pAllocator) {
@@ -519,25 +750,24 @@ VkResult DispatchAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAl
                                         VkDescriptorSet *pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
-    safe_VkDescriptorSetAllocateInfo *local_pAllocateInfo = NULL;
-    {
-        if (pAllocateInfo) {
-            local_pAllocateInfo = new safe_VkDescriptorSetAllocateInfo(pAllocateInfo);
-            if (pAllocateInfo->descriptorPool) {
-                local_pAllocateInfo->descriptorPool = layer_data->Unwrap(pAllocateInfo->descriptorPool);
-            }
-            if (local_pAllocateInfo->pSetLayouts) {
-                for (uint32_t index1 = 0; index1 < local_pAllocateInfo->descriptorSetCount; ++index1) {
-                    local_pAllocateInfo->pSetLayouts[index1] = layer_data->Unwrap(local_pAllocateInfo->pSetLayouts[index1]);
-                }
+    DispatchScratchScope scratch;
+    VkDescriptorSetAllocateInfo local_allocate_info;
+    const VkDescriptorSetAllocateInfo *local_pAllocateInfo = nullptr;
+    if (pAllocateInfo) {
+        local_allocate_info = *pAllocateInfo;
+        if (pAllocateInfo->descriptorPool) {
+            local_allocate_info.descriptorPool = layer_data->Unwrap(pAllocateInfo->descriptorPool);
+        }
+        if (pAllocateInfo->descriptorSetCount && pAllocateInfo->pSetLayouts) {
+            auto local_set_layouts = scratch.NewArray<VkDescriptorSetLayout>(pAllocateInfo->descriptorSetCount);
+            for (uint32_t index1 = 0; index1 < pAllocateInfo->descriptorSetCount; ++index1) {
+                local_set_layouts[index1] = layer_data->Unwrap(pAllocateInfo->pSetLayouts[index1]);
             }
+            local_allocate_info.pSetLayouts = local_set_layouts;
         }
+        local_pAllocateInfo = &local_allocate_info;
     }
-    VkResult result = layer_data->device_dispatch_table.AllocateDescriptorSets(
-        device, (const VkDescriptorSetAllocateInfo *)local_pAllocateInfo, pDescriptorSets);
-    if (local_pAllocateInfo) {
-        delete local_pAllocateInfo;
-    }
+    VkResult result = layer_data->device_dispatch_table.AllocateDescriptorSets(device, local_pAllocateInfo, pDescriptorSets);
     if (VK_SUCCESS == result) {
         write_lock_guard_t lock(dispatch_lock);
         auto &pool_descriptor_sets = layer_data->pool_descriptor_sets_map[pAllocateInfo->descriptorPool];
@@ -554,12 +784,13 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles)
         return layer_data->device_dispatch_table.FreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+    DispatchScratchScope scratch;
     VkDescriptorSet *local_pDescriptorSets = NULL;
     VkDescriptorPool local_descriptor_pool = VK_NULL_HANDLE;
     {
         local_descriptor_pool = layer_data->Unwrap(descriptorPool);
         if (pDescriptorSets) {
-            local_pDescriptorSets = new VkDescriptorSet[descriptorSetCount];
+            local_pDescriptorSets = scratch.NewArray<VkDescriptorSet>(descriptorSetCount);
             for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
                 local_pDescriptorSets[index0] = layer_data->Unwrap(pDescriptorSets[index0]);
             }
@@ -567,7 +798,6 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
     }
     VkResult result = layer_data->device_dispatch_table.FreeDescriptorSets(device, local_descriptor_pool, descriptorSetCount,
                                                                            (const VkDescriptorSet *)local_pDescriptorSets);
-    if (local_pDescriptorSets) delete[] local_pDescriptorSets;
     if ((VK_SUCCESS == result) && (pDescriptorSets)) {
         write_lock_guard_t lock(dispatch_lock);
         auto &pool_descriptor_sets = layer_data->pool_descriptor_sets_map[descriptorPool];
@@ -1203,41 +1433,7 @@ void DispatchGetDeviceQueue(
 
 }
 
-VkResult DispatchQueueSubmit(
-    VkQueue                                     queue,
-    uint32_t                                    submitCount,
-    const VkSubmitInfo*                         pSubmits,
-    VkFence                                     fence)
-{
-    auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
-    if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
-    safe_VkSubmitInfo *local_pSubmits = NULL;
-    {
-        if (pSubmits) {
-            local_pSubmits = new safe_VkSubmitInfo[submitCount];
-            for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
-                local_pSubmits[index0].initialize(&pSubmits[index0]);
-                WrapPnextChainHandles(layer_data, local_pSubmits[index0].pNext);
-                if (local_pSubmits[index0].pWaitSemaphores) {
-                    for (uint32_t index1 = 0; index1 < local_pSubmits[index0].waitSemaphoreCount; ++index1) {
-                        local_pSubmits[index0].pWaitSemaphores[index1] = layer_data->Unwrap(local_pSubmits[index0].pWaitSemaphores[index1]);
-                    }
-                }
-                if (local_pSubmits[index0].pSignalSemaphores) {
-                    for (uint32_t index1 = 0; index1 < local_pSubmits[index0].signalSemaphoreCount; ++index1) {
-                        local_pSubmits[index0].pSignalSemaphores[index1] = layer_data->Unwrap(local_pSubmits[index0].pSignalSemaphores[index1]);
-                    }
-                }
-            }
-        }
-        fence = layer_data->Unwrap(fence);
-    }
-    VkResult result = layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, (const VkSubmitInfo*)local_pSubmits, fence);
-    if (local_pSubmits) {
-        delete[] local_pSubmits;
-    }
-    return result;
-}
+// Skip vkQueueSubmit dispatch, manually generated
 
 VkResult DispatchQueueWaitIdle(
     VkQueue                                     queue)
@@ -1337,10 +1533,11 @@ VkResult DispatchFlushMappedMemoryRanges(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    DispatchScratchScope scratch;
     safe_VkMappedMemoryRange *local_pMemoryRanges = NULL;
     {
         if (pMemoryRanges) {
-            local_pMemoryRanges = new safe_VkMappedMemoryRange[memoryRangeCount];
+            local_pMemoryRanges = scratch.NewArray<safe_VkMappedMemoryRange>(memoryRangeCount);
             for (uint32_t index0 = 0; index0 < memoryRangeCount; ++index0) {
                 local_pMemoryRanges[index0].initialize(&pMemoryRanges[index0]);
                 if (pMemoryRanges[index0].memory) {
@@ -1350,9 +1547,7 @@ VkResult DispatchFlushMappedMemoryRanges(
         }
     }
     VkResult result = layer_data->device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount, (const VkMappedMemoryRange*)local_pMemoryRanges);
-    if (local_pMemoryRanges) {
-        delete[] local_pMemoryRanges;
-    }
+
     return result;
 }
 
@@ -1363,10 +1558,11 @@ VkResult DispatchInvalidateMappedMemoryRanges(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    DispatchScratchScope scratch;
     safe_VkMappedMemoryRange *local_pMemoryRanges = NULL;
     {
         if (pMemoryRanges) {
-            local_pMemoryRanges = new safe_VkMappedMemoryRange[memoryRangeCount];
+            local_pMemoryRanges = scratch.NewArray<safe_VkMappedMemoryRange>(memoryRangeCount);
             for (uint32_t index0 = 0; index0 < memoryRangeCount; ++index0) {
                 local_pMemoryRanges[index0].initialize(&pMemoryRanges[index0]);
                 if (pMemoryRanges[index0].memory) {
@@ -1376,9 +1572,7 @@ VkResult DispatchInvalidateMappedMemoryRanges(
         }
     }
     VkResult result = layer_data->device_dispatch_table.InvalidateMappedMemoryRanges(device, memoryRangeCount, (const VkMappedMemoryRange*)local_pMemoryRanges);
-    if (local_pMemoryRanges) {
-        delete[] local_pMemoryRanges;
-    }
+
     return result;
 }
 
@@ -1496,10 +1690,11 @@ VkResult DispatchQueueBindSparse(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+    DispatchScratchScope scratch;
     safe_VkBindSparseInfo *local_pBindInfo = NULL;
     {
         if (pBindInfo) {
-            local_pBindInfo = new safe_VkBindSparseInfo[bindInfoCount];
+            local_pBindInfo = scratch.NewArray<safe_VkBindSparseInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfo[index0].initialize(&pBindInfo[index0]);
                 WrapPnextChainHandles(layer_data, local_pBindInfo[index0].pNext);
@@ -1560,9 +1755,7 @@ VkResult DispatchQueueBindSparse(
         fence = layer_data->Unwrap(fence);
     }
     VkResult result = layer_data->device_dispatch_table.QueueBindSparse(queue, bindInfoCount, (const VkBindSparseInfo*)local_pBindInfo, fence);
-    if (local_pBindInfo) {
-        delete[] local_pBindInfo;
-    }
+
     return result;
 }
 
@@ -1606,19 +1799,19 @@ VkResult DispatchResetFences(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ResetFences(device, fenceCount, pFences);
+    DispatchScratchScope scratch;
     VkFence var_local_pFences[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkFence *local_pFences = NULL;
     {
         if (pFences) {
-            local_pFences = fenceCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkFence[fenceCount] : var_local_pFences;
+            local_pFences = fenceCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkFence>(fenceCount) : var_local_pFences;
             for (uint32_t index0 = 0; index0 < fenceCount; ++index0) {
                 local_pFences[index0] = layer_data->Unwrap(pFences[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.ResetFences(device, fenceCount, (const VkFence*)local_pFences);
-    if (local_pFences != var_local_pFences)
-        delete[] local_pFences;
+
     return result;
 }
 
@@ -1645,19 +1838,19 @@ VkResult DispatchWaitForFences(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.WaitForFences(device, fenceCount, pFences, waitAll, timeout);
+    DispatchScratchScope scratch;
     VkFence var_local_pFences[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkFence *local_pFences = NULL;
     {
         if (pFences) {
-            local_pFences = fenceCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkFence[fenceCount] : var_local_pFences;
+            local_pFences = fenceCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkFence>(fenceCount) : var_local_pFences;
             for (uint32_t index0 = 0; index0 < fenceCount; ++index0) {
                 local_pFences[index0] = layer_data->Unwrap(pFences[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.WaitForFences(device, fenceCount, (const VkFence*)local_pFences, waitAll, timeout);
-    if (local_pFences != var_local_pFences)
-        delete[] local_pFences;
+
     return result;
 }
 
@@ -2100,20 +2293,20 @@ VkResult DispatchMergePipelineCaches(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+    DispatchScratchScope scratch;
     VkPipelineCache var_local_pSrcCaches[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkPipelineCache *local_pSrcCaches = NULL;
     {
         dstCache = layer_data->Unwrap(dstCache);
         if (pSrcCaches) {
-            local_pSrcCaches = srcCacheCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkPipelineCache[srcCacheCount] : var_local_pSrcCaches;
+            local_pSrcCaches = srcCacheCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkPipelineCache>(srcCacheCount) : var_local_pSrcCaches;
             for (uint32_t index0 = 0; index0 < srcCacheCount; ++index0) {
                 local_pSrcCaches[index0] = layer_data->Unwrap(pSrcCaches[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.MergePipelineCaches(device, dstCache, srcCacheCount, (const VkPipelineCache*)local_pSrcCaches);
-    if (local_pSrcCaches != var_local_pSrcCaches)
-        delete[] local_pSrcCaches;
+
     return result;
 }
 
@@ -2129,11 +2322,12 @@ VkResult DispatchCreateComputePipelines(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    DispatchScratchScope scratch;
     safe_VkComputePipelineCreateInfo *local_pCreateInfos = NULL;
     {
         pipelineCache = layer_data->Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkComputePipelineCreateInfo[createInfoCount];
+            local_pCreateInfos = scratch.NewArray<safe_VkComputePipelineCreateInfo>(createInfoCount);
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pCreateInfos[index0].pNext);
@@ -2156,9 +2350,6 @@ VkResult DispatchCreateComputePipelines(
         }
     }
 
-    if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
-    }
     {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
             if (pPipelines[index0] != VK_NULL_HANDLE) {
@@ -2348,71 +2539,7 @@ VkResult DispatchCreateDescriptorPool(
 
 // Skip vkFreeDescriptorSets dispatch, manually generated
 
-void DispatchUpdateDescriptorSets(
-    VkDevice                                    device,
-    uint32_t                                    descriptorWriteCount,
-    const VkWriteDescriptorSet*                 pDescriptorWrites,
-    uint32_t                                    descriptorCopyCount,
-    const VkCopyDescriptorSet*                  pDescriptorCopies)
-{
-    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    if (!wrap_handles) return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
-    safe_VkWriteDescriptorSet *local_pDescriptorWrites = NULL;
-    safe_VkCopyDescriptorSet *local_pDescriptorCopies = NULL;
-    {
-        if (pDescriptorWrites) {
-            local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
-            for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
-                local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
-                WrapPnextChainHandles(layer_data, local_pDescriptorWrites[index0].pNext);
-                if (pDescriptorWrites[index0].dstSet) {
-                    local_pDescriptorWrites[index0].dstSet = layer_data->Unwrap(pDescriptorWrites[index0].dstSet);
-                }
-                if (local_pDescriptorWrites[index0].pImageInfo) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        if (pDescriptorWrites[index0].pImageInfo[index1].sampler) {
-                            local_pDescriptorWrites[index0].pImageInfo[index1].sampler = layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].sampler);
-                        }
-                        if (pDescriptorWrites[index0].pImageInfo[index1].imageView) {
-                            local_pDescriptorWrites[index0].pImageInfo[index1].imageView = layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].imageView);
-                        }
-                    }
-                }
-                if (local_pDescriptorWrites[index0].pBufferInfo) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        if (pDescriptorWrites[index0].pBufferInfo[index1].buffer) {
-                            local_pDescriptorWrites[index0].pBufferInfo[index1].buffer = layer_data->Unwrap(pDescriptorWrites[index0].pBufferInfo[index1].buffer);
-                        }
-                    }
-                }
-                if (local_pDescriptorWrites[index0].pTexelBufferView) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        local_pDescriptorWrites[index0].pTexelBufferView[index1] = layer_data->Unwrap(local_pDescriptorWrites[index0].pTexelBufferView[index1]);
-                    }
-                }
-            }
-        }
-        if (pDescriptorCopies) {
-            local_pDescriptorCopies = new safe_VkCopyDescriptorSet[descriptorCopyCount];
-            for (uint32_t index0 = 0; index0 < descriptorCopyCount; ++index0) {
-                local_pDescriptorCopies[index0].initialize(&pDescriptorCopies[index0]);
-                if (pDescriptorCopies[index0].srcSet) {
-                    local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(pDescriptorCopies[index0].srcSet);
-                }
-                if (pDescriptorCopies[index0].dstSet) {
-                    local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(pDescriptorCopies[index0].dstSet);
-                }
-            }
-        }
-    }
-    layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, (const VkWriteDescriptorSet*)local_pDescriptorWrites, descriptorCopyCount, (const VkCopyDescriptorSet*)local_pDescriptorCopies);
-    if (local_pDescriptorWrites) {
-        delete[] local_pDescriptorWrites;
-    }
-    if (local_pDescriptorCopies) {
-        delete[] local_pDescriptorCopies;
-    }
-}
+// Skip vkUpdateDescriptorSets dispatch, manually generated
 
 VkResult DispatchCreateFramebuffer(
     VkDevice                                    device,
@@ -2730,20 +2857,20 @@ void DispatchCmdBindDescriptorSets(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    DispatchScratchScope scratch;
     VkDescriptorSet var_local_pDescriptorSets[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkDescriptorSet *local_pDescriptorSets = NULL;
     {
         layout = layer_data->Unwrap(layout);
         if (pDescriptorSets) {
-            local_pDescriptorSets = descriptorSetCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkDescriptorSet[descriptorSetCount] : var_local_pDescriptorSets;
+            local_pDescriptorSets = descriptorSetCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkDescriptorSet>(descriptorSetCount) : var_local_pDescriptorSets;
             for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
                 local_pDescriptorSets[index0] = layer_data->Unwrap(pDescriptorSets[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, (const VkDescriptorSet*)local_pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-    if (local_pDescriptorSets != var_local_pDescriptorSets)
-        delete[] local_pDescriptorSets;
+
 }
 
 void DispatchCmdBindIndexBuffer(
@@ -2770,19 +2897,19 @@ void DispatchCmdBindVertexBuffers(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    DispatchScratchScope scratch;
     VkBuffer var_local_pBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkBuffer *local_pBuffers = NULL;
     {
         if (pBuffers) {
-            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[bindingCount] : var_local_pBuffers;
+            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkBuffer>(bindingCount) : var_local_pBuffers;
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets);
-    if (local_pBuffers != var_local_pBuffers)
-        delete[] local_pBuffers;
+
 }
 
 void DispatchCmdDraw(
@@ -3099,19 +3226,20 @@ void DispatchCmdWaitEvents(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    DispatchScratchScope scratch;
     VkEvent var_local_pEvents[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkEvent *local_pEvents = NULL;
     safe_VkBufferMemoryBarrier *local_pBufferMemoryBarriers = NULL;
     safe_VkImageMemoryBarrier *local_pImageMemoryBarriers = NULL;
     {
         if (pEvents) {
-            local_pEvents = eventCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkEvent[eventCount] : var_local_pEvents;
+            local_pEvents = eventCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkEvent>(eventCount) : var_local_pEvents;
             for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
                 local_pEvents[index0] = layer_data->Unwrap(pEvents[index0]);
             }
         }
         if (pBufferMemoryBarriers) {
-            local_pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier[bufferMemoryBarrierCount];
+            local_pBufferMemoryBarriers = scratch.NewArray<safe_VkBufferMemoryBarrier>(bufferMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
                 local_pBufferMemoryBarriers[index0].initialize(&pBufferMemoryBarriers[index0]);
                 if (pBufferMemoryBarriers[index0].buffer) {
@@ -3120,7 +3248,7 @@ void DispatchCmdWaitEvents(
             }
         }
         if (pImageMemoryBarriers) {
-            local_pImageMemoryBarriers = new safe_VkImageMemoryBarrier[imageMemoryBarrierCount];
+            local_pImageMemoryBarriers = scratch.NewArray<safe_VkImageMemoryBarrier>(imageMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < imageMemoryBarrierCount; ++index0) {
                 local_pImageMemoryBarriers[index0].initialize(&pImageMemoryBarriers[index0]);
                 if (pImageMemoryBarriers[index0].image) {
@@ -3130,14 +3258,7 @@ void DispatchCmdWaitEvents(
         }
     }
     layer_data->device_dispatch_table.CmdWaitEvents(commandBuffer, eventCount, (const VkEvent*)local_pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, (const VkBufferMemoryBarrier*)local_pBufferMemoryBarriers, imageMemoryBarrierCount, (const VkImageMemoryBarrier*)local_pImageMemoryBarriers);
-    if (local_pEvents != var_local_pEvents)
-        delete[] local_pEvents;
-    if (local_pBufferMemoryBarriers) {
-        delete[] local_pBufferMemoryBarriers;
-    }
-    if (local_pImageMemoryBarriers) {
-        delete[] local_pImageMemoryBarriers;
-    }
+
 }
 
 void DispatchCmdPipelineBarrier(
@@ -3154,11 +3275,12 @@ void DispatchCmdPipelineBarrier(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    DispatchScratchScope scratch;
     safe_VkBufferMemoryBarrier *local_pBufferMemoryBarriers = NULL;
     safe_VkImageMemoryBarrier *local_pImageMemoryBarriers = NULL;
     {
         if (pBufferMemoryBarriers) {
-            local_pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier[bufferMemoryBarrierCount];
+            local_pBufferMemoryBarriers = scratch.NewArray<safe_VkBufferMemoryBarrier>(bufferMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
                 local_pBufferMemoryBarriers[index0].initialize(&pBufferMemoryBarriers[index0]);
                 if (pBufferMemoryBarriers[index0].buffer) {
@@ -3167,7 +3289,7 @@ void DispatchCmdPipelineBarrier(
             }
         }
         if (pImageMemoryBarriers) {
-            local_pImageMemoryBarriers = new safe_VkImageMemoryBarrier[imageMemoryBarrierCount];
+            local_pImageMemoryBarriers = scratch.NewArray<safe_VkImageMemoryBarrier>(imageMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < imageMemoryBarrierCount; ++index0) {
                 local_pImageMemoryBarriers[index0].initialize(&pImageMemoryBarriers[index0]);
                 if (pImageMemoryBarriers[index0].image) {
@@ -3177,12 +3299,7 @@ void DispatchCmdPipelineBarrier(
         }
     }
     layer_data->device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, (const VkBufferMemoryBarrier*)local_pBufferMemoryBarriers, imageMemoryBarrierCount, (const VkImageMemoryBarrier*)local_pImageMemoryBarriers);
-    if (local_pBufferMemoryBarriers) {
-        delete[] local_pBufferMemoryBarriers;
-    }
-    if (local_pImageMemoryBarriers) {
-        delete[] local_pImageMemoryBarriers;
-    }
+
 }
 
 void DispatchCmdBeginQuery(
@@ -3343,10 +3460,11 @@ VkResult DispatchBindBufferMemory2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory2(device, bindInfoCount, pBindInfos);
+    DispatchScratchScope scratch;
     safe_VkBindBufferMemoryInfo *local_pBindInfos = NULL;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindBufferMemoryInfo[bindInfoCount];
+            local_pBindInfos = scratch.NewArray<safe_VkBindBufferMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 if (pBindInfos[index0].buffer) {
@@ -3359,9 +3477,7 @@ VkResult DispatchBindBufferMemory2(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindBufferMemory2(device, bindInfoCount, (const VkBindBufferMemoryInfo*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
+
     return result;
 }
 
@@ -3372,10 +3488,11 @@ VkResult DispatchBindImageMemory2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindImageMemory2(device, bindInfoCount, pBindInfos);
+    DispatchScratchScope scratch;
     safe_VkBindImageMemoryInfo *local_pBindInfos = NULL;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindImageMemoryInfo[bindInfoCount];
+            local_pBindInfos = scratch.NewArray<safe_VkBindImageMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pBindInfos[index0].pNext);
@@ -3389,9 +3506,7 @@ VkResult DispatchBindImageMemory2(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindImageMemory2(device, bindInfoCount, (const VkBindImageMemoryInfo*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
+
     return result;
 }
 
@@ -4683,11 +4798,12 @@ void DispatchCmdPushDescriptorSetKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+    DispatchScratchScope scratch;
     safe_VkWriteDescriptorSet *local_pDescriptorWrites = NULL;
     {
         layout = layer_data->Unwrap(layout);
         if (pDescriptorWrites) {
-            local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
+            local_pDescriptorWrites = scratch.NewArray<safe_VkWriteDescriptorSet>(descriptorWriteCount);
             for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
                 local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
                 WrapPnextChainHandles(layer_data, local_pDescriptorWrites[index0].pNext);
@@ -4720,9 +4836,7 @@ void DispatchCmdPushDescriptorSetKHR(
         }
     }
     layer_data->device_dispatch_table.CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, (const VkWriteDescriptorSet*)local_pDescriptorWrites);
-    if (local_pDescriptorWrites) {
-        delete[] local_pDescriptorWrites;
-    }
+
 }
 
 // Skip vkCmdPushDescriptorSetWithTemplateKHR dispatch, manually generated
@@ -5133,10 +5247,11 @@ VkResult DispatchBindBufferMemory2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+    DispatchScratchScope scratch;
     safe_VkBindBufferMemoryInfo *local_pBindInfos = NULL;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindBufferMemoryInfo[bindInfoCount];
+            local_pBindInfos = scratch.NewArray<safe_VkBindBufferMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 if (pBindInfos[index0].buffer) {
@@ -5149,9 +5264,7 @@ VkResult DispatchBindBufferMemory2KHR(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount, (const VkBindBufferMemoryInfo*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
+
     return result;
 }
 
@@ -5162,10 +5275,11 @@ VkResult DispatchBindImageMemory2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+    DispatchScratchScope scratch;
     safe_VkBindImageMemoryInfo *local_pBindInfos = NULL;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindImageMemoryInfo[bindInfoCount];
+            local_pBindInfos = scratch.NewArray<safe_VkBindImageMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pBindInfos[index0].pNext);
@@ -5179,9 +5293,7 @@ VkResult DispatchBindImageMemory2KHR(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindImageMemory2KHR(device, bindInfoCount, (const VkBindImageMemoryInfo*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
+
     return result;
 }
 
@@ -5772,19 +5884,19 @@ void DispatchCmdBindTransformFeedbackBuffersEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+    DispatchScratchScope scratch;
     VkBuffer var_local_pBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkBuffer *local_pBuffers = NULL;
     {
         if (pBuffers) {
-            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[bindingCount] : var_local_pBuffers;
+            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkBuffer>(bindingCount) : var_local_pBuffers;
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets, pSizes);
-    if (local_pBuffers != var_local_pBuffers)
-        delete[] local_pBuffers;
+
 }
 
 void DispatchCmdBeginTransformFeedbackEXT(
@@ -5796,19 +5908,19 @@ void DispatchCmdBeginTransformFeedbackEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+    DispatchScratchScope scratch;
     VkBuffer var_local_pCounterBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkBuffer *local_pCounterBuffers = NULL;
     {
         if (pCounterBuffers) {
-            local_pCounterBuffers = counterBufferCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[counterBufferCount] : var_local_pCounterBuffers;
+            local_pCounterBuffers = counterBufferCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkBuffer>(counterBufferCount) : var_local_pCounterBuffers;
             for (uint32_t index0 = 0; index0 < counterBufferCount; ++index0) {
                 local_pCounterBuffers[index0] = layer_data->Unwrap(pCounterBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, (const VkBuffer*)local_pCounterBuffers, pCounterBufferOffsets);
-    if (local_pCounterBuffers != var_local_pCounterBuffers)
-        delete[] local_pCounterBuffers;
+
 }
 
 void DispatchCmdEndTransformFeedbackEXT(
@@ -5820,19 +5932,19 @@ void DispatchCmdEndTransformFeedbackEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+    DispatchScratchScope scratch;
     VkBuffer var_local_pCounterBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkBuffer *local_pCounterBuffers = NULL;
     {
         if (pCounterBuffers) {
-            local_pCounterBuffers = counterBufferCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[counterBufferCount] : var_local_pCounterBuffers;
+            local_pCounterBuffers = counterBufferCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkBuffer>(counterBufferCount) : var_local_pCounterBuffers;
             for (uint32_t index0 = 0; index0 < counterBufferCount; ++index0) {
                 local_pCounterBuffers[index0] = layer_data->Unwrap(pCounterBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, (const VkBuffer*)local_pCounterBuffers, pCounterBufferOffsets);
-    if (local_pCounterBuffers != var_local_pCounterBuffers)
-        delete[] local_pCounterBuffers;
+
 }
 
 void DispatchCmdBeginQueryIndexedEXT(
@@ -6271,19 +6383,19 @@ void DispatchSetHdrMetadataEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.SetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+    DispatchScratchScope scratch;
     VkSwapchainKHR var_local_pSwapchains[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkSwapchainKHR *local_pSwapchains = NULL;
     {
         if (pSwapchains) {
-            local_pSwapchains = swapchainCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkSwapchainKHR[swapchainCount] : var_local_pSwapchains;
+            local_pSwapchains = swapchainCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkSwapchainKHR>(swapchainCount) : var_local_pSwapchains;
             for (uint32_t index0 = 0; index0 < swapchainCount; ++index0) {
                 local_pSwapchains[index0] = layer_data->Unwrap(pSwapchains[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.SetHdrMetadataEXT(device, swapchainCount, (const VkSwapchainKHR*)local_pSwapchains, pMetadata);
-    if (local_pSwapchains != var_local_pSwapchains)
-        delete[] local_pSwapchains;
+
 }
 
 #ifdef VK_USE_PLATFORM_IOS_MVK
@@ -6537,20 +6649,20 @@ VkResult DispatchMergeValidationCachesEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.MergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
+    DispatchScratchScope scratch;
     VkValidationCacheEXT var_local_pSrcCaches[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkValidationCacheEXT *local_pSrcCaches = NULL;
     {
         dstCache = layer_data->Unwrap(dstCache);
         if (pSrcCaches) {
-            local_pSrcCaches = srcCacheCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkValidationCacheEXT[srcCacheCount] : var_local_pSrcCaches;
+            local_pSrcCaches = srcCacheCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkValidationCacheEXT>(srcCacheCount) : var_local_pSrcCaches;
             for (uint32_t index0 = 0; index0 < srcCacheCount; ++index0) {
                 local_pSrcCaches[index0] = layer_data->Unwrap(pSrcCaches[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.MergeValidationCachesEXT(device, dstCache, srcCacheCount, (const VkValidationCacheEXT*)local_pSrcCaches);
-    if (local_pSrcCaches != var_local_pSrcCaches)
-        delete[] local_pSrcCaches;
+
     return result;
 }
 
@@ -6710,10 +6822,11 @@ VkResult DispatchBindAccelerationStructureMemoryKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindAccelerationStructureMemoryKHR(device, bindInfoCount, pBindInfos);
+    DispatchScratchScope scratch;
     safe_VkBindAccelerationStructureMemoryInfoKHR *local_pBindInfos = NULL;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindAccelerationStructureMemoryInfoKHR[bindInfoCount];
+            local_pBindInfos = scratch.NewArray<safe_VkBindAccelerationStructureMemoryInfoKHR>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 if (pBindInfos[index0].accelerationStructure) {
@@ -6726,9 +6839,7 @@ VkResult DispatchBindAccelerationStructureMemoryKHR(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindAccelerationStructureMemoryKHR(device, bindInfoCount, (const VkBindAccelerationStructureMemoryInfoKHR*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
+
     return result;
 }
 
@@ -6739,10 +6850,11 @@ VkResult DispatchBindAccelerationStructureMemoryNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+    DispatchScratchScope scratch;
     safe_VkBindAccelerationStructureMemoryInfoKHR *local_pBindInfos = NULL;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindAccelerationStructureMemoryInfoKHR[bindInfoCount];
+            local_pBindInfos = scratch.NewArray<safe_VkBindAccelerationStructureMemoryInfoKHR>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 if (pBindInfos[index0].accelerationStructure) {
@@ -6755,9 +6867,7 @@ VkResult DispatchBindAccelerationStructureMemoryNV(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindAccelerationStructureMemoryNV(device, bindInfoCount, (const VkBindAccelerationStructureMemoryInfoKHR*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
+
     return result;
 }
 
@@ -6861,11 +6971,12 @@ VkResult DispatchCreateRayTracingPipelinesNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    DispatchScratchScope scratch;
     safe_VkRayTracingPipelineCreateInfoNV *local_pCreateInfos = NULL;
     {
         pipelineCache = layer_data->Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkRayTracingPipelineCreateInfoNV[createInfoCount];
+            local_pCreateInfos = scratch.NewArray<safe_VkRayTracingPipelineCreateInfoNV>(createInfoCount);
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pCreateInfos[index0].pNext);
@@ -6892,9 +7003,6 @@ VkResult DispatchCreateRayTracingPipelinesNV(
         }
     }
 
-    if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
-    }
     {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
             if (pPipelines[index0] != VK_NULL_HANDLE) {
@@ -6967,11 +7075,12 @@ void DispatchCmdWriteAccelerationStructuresPropertiesKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+    DispatchScratchScope scratch;
     VkAccelerationStructureKHR var_local_pAccelerationStructures[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkAccelerationStructureKHR *local_pAccelerationStructures = NULL;
     {
         if (pAccelerationStructures) {
-            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkAccelerationStructureKHR[accelerationStructureCount] : var_local_pAccelerationStructures;
+            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkAccelerationStructureKHR>(accelerationStructureCount) : var_local_pAccelerationStructures;
             for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
                 local_pAccelerationStructures[index0] = layer_data->Unwrap(pAccelerationStructures[index0]);
             }
@@ -6979,8 +7088,7 @@ void DispatchCmdWriteAccelerationStructuresPropertiesKHR(
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, (const VkAccelerationStructureKHR*)local_pAccelerationStructures, queryType, queryPool, firstQuery);
-    if (local_pAccelerationStructures != var_local_pAccelerationStructures)
-        delete[] local_pAccelerationStructures;
+
 }
 
 void DispatchCmdWriteAccelerationStructuresPropertiesNV(
@@ -6993,11 +7101,12 @@ void DispatchCmdWriteAccelerationStructuresPropertiesNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+    DispatchScratchScope scratch;
     VkAccelerationStructureKHR var_local_pAccelerationStructures[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkAccelerationStructureKHR *local_pAccelerationStructures = NULL;
     {
         if (pAccelerationStructures) {
-            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkAccelerationStructureKHR[accelerationStructureCount] : var_local_pAccelerationStructures;
+            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkAccelerationStructureKHR>(accelerationStructureCount) : var_local_pAccelerationStructures;
             for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
                 local_pAccelerationStructures[index0] = layer_data->Unwrap(pAccelerationStructures[index0]);
             }
@@ -7005,8 +7114,7 @@ void DispatchCmdWriteAccelerationStructuresPropertiesNV(
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, (const VkAccelerationStructureKHR*)local_pAccelerationStructures, queryType, queryPool, firstQuery);
-    if (local_pAccelerationStructures != var_local_pAccelerationStructures)
-        delete[] local_pAccelerationStructures;
+
 }
 
 VkResult DispatchCompileDeferredNV(
@@ -7533,19 +7641,19 @@ void DispatchCmdBindVertexBuffers2EXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    DispatchScratchScope scratch;
     VkBuffer var_local_pBuffers[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkBuffer *local_pBuffers = NULL;
     {
         if (pBuffers) {
-            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkBuffer[bindingCount] : var_local_pBuffers;
+            local_pBuffers = bindingCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkBuffer>(bindingCount) : var_local_pBuffers;
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets, pSizes, pStrides);
-    if (local_pBuffers != var_local_pBuffers)
-        delete[] local_pBuffers;
+
 }
 
 void DispatchCmdSetDepthTestEnableEXT(
@@ -7897,10 +8005,11 @@ void DispatchCmdBuildAccelerationStructureKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBuildAccelerationStructureKHR(commandBuffer, infoCount, pInfos, ppOffsetInfos);
+    DispatchScratchScope scratch;
     safe_VkAccelerationStructureBuildGeometryInfoKHR *local_pInfos = NULL;
     {
         if (pInfos) {
-            local_pInfos = new safe_VkAccelerationStructureBuildGeometryInfoKHR[infoCount];
+            local_pInfos = scratch.NewArray<safe_VkAccelerationStructureBuildGeometryInfoKHR>(infoCount);
             for (uint32_t index0 = 0; index0 < infoCount; ++index0) {
                 local_pInfos[index0].initialize(&pInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pInfos[index0].pNext);
@@ -7914,9 +8023,7 @@ void DispatchCmdBuildAccelerationStructureKHR(
         }
     }
     layer_data->device_dispatch_table.CmdBuildAccelerationStructureKHR(commandBuffer, infoCount, (const VkAccelerationStructureBuildGeometryInfoKHR*)local_pInfos, ppOffsetInfos);
-    if (local_pInfos) {
-        delete[] local_pInfos;
-    }
+
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
 
@@ -7962,10 +8069,11 @@ VkResult DispatchBuildAccelerationStructureKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BuildAccelerationStructureKHR(device, infoCount, pInfos, ppOffsetInfos);
+    DispatchScratchScope scratch;
     safe_VkAccelerationStructureBuildGeometryInfoKHR *local_pInfos = NULL;
     {
         if (pInfos) {
-            local_pInfos = new safe_VkAccelerationStructureBuildGeometryInfoKHR[infoCount];
+            local_pInfos = scratch.NewArray<safe_VkAccelerationStructureBuildGeometryInfoKHR>(infoCount);
             for (uint32_t index0 = 0; index0 < infoCount; ++index0) {
                 local_pInfos[index0].initialize(&pInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pInfos[index0].pNext);
@@ -7979,9 +8087,7 @@ VkResult DispatchBuildAccelerationStructureKHR(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BuildAccelerationStructureKHR(device, infoCount, (const VkAccelerationStructureBuildGeometryInfoKHR*)local_pInfos, ppOffsetInfos);
-    if (local_pInfos) {
-        delete[] local_pInfos;
-    }
+
     return result;
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -8080,19 +8186,19 @@ VkResult DispatchWriteAccelerationStructuresPropertiesKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.WriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
+    DispatchScratchScope scratch;
     VkAccelerationStructureKHR var_local_pAccelerationStructures[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkAccelerationStructureKHR *local_pAccelerationStructures = NULL;
     {
         if (pAccelerationStructures) {
-            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? new VkAccelerationStructureKHR[accelerationStructureCount] : var_local_pAccelerationStructures;
+            local_pAccelerationStructures = accelerationStructureCount > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<VkAccelerationStructureKHR>(accelerationStructureCount) : var_local_pAccelerationStructures;
             for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
                 local_pAccelerationStructures[index0] = layer_data->Unwrap(pAccelerationStructures[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.WriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, (const VkAccelerationStructureKHR*)local_pAccelerationStructures, queryType, dataSize, pData, stride);
-    if (local_pAccelerationStructures != var_local_pAccelerationStructures)
-        delete[] local_pAccelerationStructures;
+
     return result;
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -8244,11 +8350,12 @@ VkResult DispatchCreateRayTracingPipelinesKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateRayTracingPipelinesKHR(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    DispatchScratchScope scratch;
     safe_VkRayTracingPipelineCreateInfoKHR *local_pCreateInfos = NULL;
     {
         pipelineCache = layer_data->Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkRayTracingPipelineCreateInfoKHR[createInfoCount];
+            local_pCreateInfos = scratch.NewArray<safe_VkRayTracingPipelineCreateInfoKHR>(createInfoCount);
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pCreateInfos[index0].pNext);
@@ -8280,9 +8387,6 @@ VkResult DispatchCreateRayTracingPipelinesKHR(
         }
     }
 
-    if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
-    }
     {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
             if (pPipelines[index0] != VK_NULL_HANDLE) {
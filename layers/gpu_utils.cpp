@@ -25,34 +25,17 @@
 #include "spirv-tools/optimizer.hpp"
 #include "spirv-tools/instrument.hpp"
 #include <spirv/unified1/spirv.hpp>
+#include "xxhash.h"
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <regex>
 
 #define VMA_IMPLEMENTATION
 // This define indicates that we will supply Vulkan function pointers at initialization
 #define VMA_STATIC_VULKAN_FUNCTIONS 0
 #include "vk_mem_alloc.h"
-
-class UtilDescriptorSetManager {
-  public:
-    UtilDescriptorSetManager(VkDevice device, uint32_t numBindingsInSet);
-    ~UtilDescriptorSetManager();
-
-    VkResult GetDescriptorSet(VkDescriptorPool *desc_pool, VkDescriptorSetLayout ds_layout, VkDescriptorSet *desc_sets);
-    VkResult GetDescriptorSets(uint32_t count, VkDescriptorPool *pool, VkDescriptorSetLayout ds_layout,
-                               std::vector<VkDescriptorSet> *desc_sets);
-    void PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set);
-
-  private:
-    static const uint32_t kItemsPerChunk = 512;
-    struct PoolTracker {
-        uint32_t size;
-        uint32_t used;
-    };
-    VkDevice device;
-    uint32_t numBindingsInSet;
-    std::unordered_map<VkDescriptorPool, struct PoolTracker> desc_pool_map_;
-};
+#include "gpu_utils.h"
 
 // Implementation for Descriptor Set Manager class
 UtilDescriptorSetManager::UtilDescriptorSetManager(VkDevice device, uint32_t numBindingsInSet)
@@ -273,6 +256,139 @@ void UtilPreCallRecordCreateDevice(VkPhysicalDevice gpu, safe_VkDeviceCreateInfo
     }
 }
 
+void UtilInstrumentationCache::Initialize(const char *directory) {
+    enabled_ = true;
+    directory_ = directory ? directory : "";
+    if (!directory_.empty() && directory_.back() != '/' && directory_.back() != '\\') directory_ += '/';
+    // Instrumented code from a different version of the instrumentation passes must not be reused.
+    const char *tools_version = spvSoftwareVersionDetailsString();
+    tools_version_hash_ = XXH64(tools_version, strlen(tools_version), kFileVersion);
+}
+
+void UtilInstrumentationCache::AppendValidatorOptions(const DeviceExtensions &device_extensions,
+                                                      const DeviceFeatures &enabled_features, std::vector<uint32_t> &options) {
+    options.push_back(device_extensions.vk_khr_relaxed_block_layout ? 1 : 0);
+    options.push_back(device_extensions.vk_khr_uniform_buffer_standard_layout &&
+                      enabled_features.core12.uniformBufferStandardLayout == VK_TRUE);
+    options.push_back(device_extensions.vk_ext_scalar_block_layout && enabled_features.core12.scalarBlockLayout == VK_TRUE);
+}
+
+uint64_t UtilInstrumentationCache::MakeKey(const std::vector<unsigned int> &pgm, const std::vector<uint32_t> &options) const {
+    const uint64_t options_hash = XXH64(options.data(), options.size() * sizeof(uint32_t), tools_version_hash_);
+    return XXH64(pgm.data(), pgm.size() * sizeof(unsigned int), options_hash);
+}
+
+uint32_t UtilInstrumentationCache::PickShaderIdPlaceholder(const std::vector<unsigned int> &pgm) {
+    // The instrumentation emits the shader id as an OpConstant, reusing an existing constant of the same value if there is
+    // one. A value that appears nowhere in the original code can only end up in constants the instrumentation created.
+    uint32_t placeholder = 0xC0DE1D00;
+    while (std::find(pgm.begin(), pgm.end(), placeholder) != pgm.end()) {
+        placeholder++;
+    }
+    return placeholder;
+}
+
+bool UtilInstrumentationCache::Lookup(uint64_t key, uint32_t shader_id, std::vector<unsigned int> &pgm) {
+    auto entry_it = entries_.find(key);
+    if (entry_it == entries_.end()) {
+        Entry entry;
+        if (directory_.empty() || !ReadEntry(key, entry)) return false;
+        entry_it = entries_.emplace(key, std::move(entry)).first;
+    }
+    Patch(entry_it->second, shader_id, pgm);
+    return true;
+}
+
+void UtilInstrumentationCache::Store(uint64_t key, uint32_t placeholder, uint32_t shader_id, std::vector<unsigned int> &pgm) {
+    Entry entry;
+    entry.words.assign(pgm.begin(), pgm.end());
+    // Walk the instructions past the 5 word header, looking for 32-bit OpConstants holding the placeholder.
+    for (size_t offset = 5; offset < pgm.size();) {
+        const uint32_t word_count = pgm[offset] >> 16;
+        if (word_count == 0 || offset + word_count > pgm.size()) return;  // Malformed, don't cache it
+        if ((pgm[offset] & 0xFFFF) == spv::OpConstant && word_count == 4 && pgm[offset + 3] == placeholder) {
+            entry.shader_id_offsets.push_back(static_cast<uint32_t>(offset + 3));
+        }
+        offset += word_count;
+    }
+    Patch(entry, shader_id, pgm);
+    if (!directory_.empty()) WriteEntry(key, entry);
+    entries_[key] = std::move(entry);
+}
+
+void UtilInstrumentationCache::Patch(const Entry &entry, uint32_t shader_id, std::vector<unsigned int> &pgm) {
+    pgm.assign(entry.words.begin(), entry.words.end());
+    for (auto offset : entry.shader_id_offsets) {
+        pgm[offset] = shader_id;
+    }
+}
+
+std::string UtilInstrumentationCache::EntryPath(uint64_t key) const {
+    char name[32];
+    snprintf(name, sizeof(name), "%016" PRIx64 ".spv", key);
+    return directory_ + name;
+}
+
+// An entry file holds a header of kFileMagic, kFileVersion, the key, the number of shader id offsets, the number of code
+// words and a checksum of what follows, then the offsets and the code. Anything that doesn't check out is a miss.
+bool UtilInstrumentationCache::ReadEntry(uint64_t key, Entry &entry) const {
+    FILE *file = fopen(EntryPath(key).c_str(), "rb");
+    if (!file) return false;
+    uint32_t header[8] = {};
+    bool valid = (fread(header, sizeof(header), 1, file) == 1) && (header[0] == kFileMagic) && (header[1] == kFileVersion) &&
+                 (header[2] == static_cast<uint32_t>(key)) && (header[3] == static_cast<uint32_t>(key >> 32)) &&
+                 (header[5] > 5) && (header[4] <= header[5]);
+    if (valid) {
+        entry.shader_id_offsets.resize(header[4]);
+        entry.words.resize(header[5]);
+        valid = (entry.shader_id_offsets.empty() ||
+                 fread(entry.shader_id_offsets.data(), sizeof(uint32_t), entry.shader_id_offsets.size(), file) ==
+                     entry.shader_id_offsets.size()) &&
+                (fread(entry.words.data(), sizeof(uint32_t), entry.words.size(), file) == entry.words.size()) &&
+                (fgetc(file) == EOF);
+    }
+    fclose(file);
+    if (!valid) return false;
+
+    uint64_t checksum = XXH64(entry.shader_id_offsets.data(), entry.shader_id_offsets.size() * sizeof(uint32_t), 0);
+    checksum = XXH64(entry.words.data(), entry.words.size() * sizeof(uint32_t), checksum);
+    if ((header[6] != static_cast<uint32_t>(checksum)) || (header[7] != static_cast<uint32_t>(checksum >> 32))) return false;
+    for (auto offset : entry.shader_id_offsets) {
+        if (offset >= entry.words.size()) return false;
+    }
+    return entry.words[0] == spv::MagicNumber;
+}
+
+void UtilInstrumentationCache::WriteEntry(uint64_t key, const Entry &entry) const {
+    uint64_t checksum = XXH64(entry.shader_id_offsets.data(), entry.shader_id_offsets.size() * sizeof(uint32_t), 0);
+    checksum = XXH64(entry.words.data(), entry.words.size() * sizeof(uint32_t), checksum);
+    const uint32_t header[8] = {kFileMagic,
+                                kFileVersion,
+                                static_cast<uint32_t>(key),
+                                static_cast<uint32_t>(key >> 32),
+                                static_cast<uint32_t>(entry.shader_id_offsets.size()),
+                                static_cast<uint32_t>(entry.words.size()),
+                                static_cast<uint32_t>(checksum),
+                                static_cast<uint32_t>(checksum >> 32)};
+
+    // Write to a uniquely named file and rename it into place, so that processes sharing the directory never read a
+    // partially written entry.
+    const std::string path = EntryPath(key);
+    const std::string temp_path =
+        path + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "." +
+        std::to_string(reinterpret_cast<uintptr_t>(this)) + ".tmp";
+    FILE *file = fopen(temp_path.c_str(), "wb");
+    if (!file) return;
+    bool written = (fwrite(header, sizeof(header), 1, file) == 1) &&
+                   (fwrite(entry.shader_id_offsets.data(), sizeof(uint32_t), entry.shader_id_offsets.size(), file) ==
+                    entry.shader_id_offsets.size()) &&
+                   (fwrite(entry.words.data(), sizeof(uint32_t), entry.words.size(), file) == entry.words.size());
+    written = (fclose(file) == 0) && written;
+    if (!written || (rename(temp_path.c_str(), path.c_str()) != 0)) {
+        remove(temp_path.c_str());
+    }
+}
+
 // Generate the stage-specific part of the message.
 void UtilGenerateStageMessage(const uint32_t *debug_record, std::string &msg) {
     using namespace spvtools;
@@ -19,6 +19,8 @@
 #pragma once
 #include "chassis.h"
 #include "shader_validation.h"
+#include <algorithm>
+#include <deque>
 class UtilDescriptorSetManager {
   public:
     UtilDescriptorSetManager(VkDevice device, uint32_t numBindingsInSet);
@@ -43,6 +45,51 @@ struct UtilQueueBarrierCommandInfo {
     VkCommandPool barrier_command_pool = VK_NULL_HANDLE;
     VkCommandBuffer barrier_command_buffer = VK_NULL_HANDLE;
 };
+// A submission whose instrumentation output is read back once its fence signals. The command buffers are listed in the order
+// their output is processed: each primary followed by the secondaries it executes.
+struct UtilDeferredReadback {
+    VkFence fence;
+    std::vector<VkCommandBuffer> command_buffers;
+};
+// Submissions allowed in flight per queue before a new one waits for the oldest to be read back.
+static const size_t kUtilMaxDeferredReadbacksPerQueue = 16;
+// Cache of instrumented SPIR-V, keyed by a hash of the original code and of everything that changes how it is instrumented.
+// Entries live in memory and, if a directory is given, in one file per key in that directory so later runs can skip
+// instrumentation. The shader id that the instrumentation bakes into the code is stored as a placeholder and patched on a hit.
+class UtilInstrumentationCache {
+  public:
+    void Initialize(const char *directory);
+    bool Enabled() const { return enabled_; }
+
+    // Appends the device state that AdjustValidatorOptions() turns into validator options to a key's option words.
+    static void AppendValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
+                                       std::vector<uint32_t> &options);
+    uint64_t MakeKey(const std::vector<unsigned int> &pgm, const std::vector<uint32_t> &options) const;
+    // Returns a shader id to instrument with in place of the real one, chosen so it appears nowhere in the original code.
+    static uint32_t PickShaderIdPlaceholder(const std::vector<unsigned int> &pgm);
+    // On a hit, replaces pgm with the cached instrumented code for shader_id.
+    bool Lookup(uint64_t key, uint32_t shader_id, std::vector<unsigned int> &pgm);
+    // Records pgm, instrumented with placeholder as its shader id, then patches pgm to use shader_id.
+    void Store(uint64_t key, uint32_t placeholder, uint32_t shader_id, std::vector<unsigned int> &pgm);
+
+  private:
+    struct Entry {
+        std::vector<uint32_t> words;
+        std::vector<uint32_t> shader_id_offsets;
+    };
+    static const uint32_t kFileMagic = 0x43495047;  // "GPIC"
+    static const uint32_t kFileVersion = 1;
+
+    std::string EntryPath(uint64_t key) const;
+    bool ReadEntry(uint64_t key, Entry &entry) const;
+    void WriteEntry(uint64_t key, const Entry &entry) const;
+    static void Patch(const Entry &entry, uint32_t shader_id, std::vector<unsigned int> &pgm);
+
+    bool enabled_ = false;
+    std::string directory_;
+    uint64_t tools_version_hash_ = 0;
+    std::unordered_map<uint64_t, Entry> entries_;
+};
 VkResult UtilInitializeVma(VkPhysicalDevice physical_device, VkDevice device, VmaAllocator *pAllocator);
 void UtilPreCallRecordCreateDevice(VkPhysicalDevice gpu, safe_VkDeviceCreateInfo *modified_create_info,
                                    VkPhysicalDeviceFeatures supported_features, VkPhysicalDeviceFeatures desired_features);
@@ -68,6 +115,13 @@ void UtilPostCallRecordCreateDevice(const VkDeviceCreateInfo *pCreateInfo, std::
     }
     object_ptr->desc_set_bind_index = object_ptr->adjusted_max_desc_sets - 1;
 
+    // The environment variable takes precedence over the settings file
+    std::string cache_directory = GetLayerEnvVar("VK_LAYER_SHADER_INSTRUMENTATION_CACHE");
+    if (cache_directory.empty()) cache_directory = getLayerOption("khronos_validation.shader_instrumentation_cache");
+    if (!cache_directory.empty()) {
+        object_ptr->instrumentation_cache.Initialize(cache_directory.c_str());
+    }
+
     VkResult result1 = UtilInitializeVma(object_ptr->physicalDevice, object_ptr->device, &object_ptr->vmaAllocator);
     assert(result1 == VK_SUCCESS);
     std::unique_ptr<UtilDescriptorSetManager> desc_set_manager(
@@ -100,13 +154,21 @@ void UtilPostCallRecordCreateDevice(const VkDeviceCreateInfo *pCreateInfo, std::
         return;
     }
     object_ptr->desc_set_manager = std::move(desc_set_manager);
+    object_ptr->deferred_readback = object_ptr->enabled[gpu_deferred_readback];
 
     // Register callback to be called at any ResetCommandBuffer time
     object_ptr->SetCommandBufferResetCallback(
         [object_ptr](VkCommandBuffer command_buffer) -> void { object_ptr->ResetCommandBuffer(command_buffer); });
 }
 template <typename ObjectType>
+void UtilProcessDeferredReadbacks(ObjectType *object_ptr, bool wait_for_all, VkCommandBuffer wait_for_command_buffer);
+template <typename ObjectType>
 void UtilPreCallRecordDestroyDevice(ObjectType *object_ptr) {
+    UtilProcessDeferredReadbacks(object_ptr, true, VK_NULL_HANDLE);
+    for (auto fence : object_ptr->deferred_readback_fences) {
+        DispatchDestroyFence(object_ptr->device, fence, nullptr);
+    }
+    object_ptr->deferred_readback_fences.clear();
     for (auto &queue_barrier_command_info_kv : object_ptr->queue_barrier_command_infos) {
         UtilQueueBarrierCommandInfo &queue_barrier_command_info = queue_barrier_command_info_kv.second;
 
@@ -343,59 +405,57 @@ void UtilCopyCreatePipelineFeedbackData(const uint32_t count, CreateInfos *pCrea
 
 template <typename ObjectType>
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
-void UtilProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node, ObjectType *object_ptr) {
-    if (cb_node && (cb_node->hasDrawCmd || cb_node->hasTraceRaysCmd || cb_node->hasDispatchCmd)) {
-        auto gpu_buffer_list = object_ptr->GetBufferInfo(cb_node->commandBuffer);
-        uint32_t draw_index = 0;
-        uint32_t compute_index = 0;
-        uint32_t ray_trace_index = 0;
-
-        for (auto &buffer_info : gpu_buffer_list) {
-            char *pData;
-
-            uint32_t operation_index = 0;
-            if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-                operation_index = draw_index;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
-                operation_index = compute_index;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
-                operation_index = ray_trace_index;
-            } else {
-                assert(false);
-            }
+void UtilProcessInstrumentationBuffer(VkQueue queue, VkCommandBuffer command_buffer, ObjectType *object_ptr) {
+    auto gpu_buffer_list = object_ptr->GetBufferInfo(command_buffer);
+    uint32_t draw_index = 0;
+    uint32_t compute_index = 0;
+    uint32_t ray_trace_index = 0;
+
+    for (auto &buffer_info : gpu_buffer_list) {
+        char *pData;
+
+        uint32_t operation_index = 0;
+        if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            operation_index = draw_index;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+            operation_index = compute_index;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
+            operation_index = ray_trace_index;
+        } else {
+            assert(false);
+        }
 
-            VkResult result = vmaMapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&pData);
-            if (result == VK_SUCCESS) {
-                object_ptr->AnalyzeAndGenerateMessages(cb_node->commandBuffer, queue, buffer_info.pipeline_bind_point,
-                                                       operation_index, (uint32_t *)pData);
-                vmaUnmapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation);
-            }
+        VkResult result = vmaMapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&pData);
+        if (result == VK_SUCCESS) {
+            object_ptr->AnalyzeAndGenerateMessages(command_buffer, queue, buffer_info.pipeline_bind_point, operation_index,
+                                                   (uint32_t *)pData);
+            vmaUnmapMemory(object_ptr->vmaAllocator, buffer_info.output_mem_block.allocation);
+        }
 
-            if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-                draw_index++;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
-                compute_index++;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
-                ray_trace_index++;
-            } else {
-                assert(false);
-            }
+        if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            draw_index++;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+            compute_index++;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
+            ray_trace_index++;
+        } else {
+            assert(false);
         }
     }
 }
 template <typename ObjectType>
-// Submit a memory barrier on graphics queues.
+// Submit a memory barrier on graphics queues, signaling fence (if any) once it completes.
 // Lazy-create and record the needed command buffer.
-void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
+VkResult UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr, VkFence fence = VK_NULL_HANDLE) {
     auto queue_barrier_command_info_it = object_ptr->queue_barrier_command_infos.emplace(queue, UtilQueueBarrierCommandInfo{});
     if (queue_barrier_command_info_it.second) {
         UtilQueueBarrierCommandInfo &queue_barrier_command_info = queue_barrier_command_info_it.first->second;
 
         uint32_t queue_family_index = 0;
 
-        auto queue_state_it = object_ptr->queueMap.find(queue);
-        if (queue_state_it != object_ptr->queueMap.end()) {
-            queue_family_index = queue_state_it->second.queueFamilyIndex;
+        auto queue_state = object_ptr->GetQueueState(queue);
+        if (queue_state) {
+            queue_family_index = queue_state->queueFamilyIndex;
         }
 
         VkResult result = VK_SUCCESS;
@@ -408,7 +468,7 @@ void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
         if (result != VK_SUCCESS) {
             object_ptr->ReportSetupProblem(object_ptr->device, "Unable to create command pool for barrier CB.");
             queue_barrier_command_info.barrier_command_pool = VK_NULL_HANDLE;
-            return;
+            return result;
         }
 
         VkCommandBufferAllocateInfo buffer_alloc_info = {};
@@ -423,15 +483,17 @@ void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
             DispatchDestroyCommandPool(object_ptr->device, queue_barrier_command_info.barrier_command_pool, nullptr);
             queue_barrier_command_info.barrier_command_pool = VK_NULL_HANDLE;
             queue_barrier_command_info.barrier_command_buffer = VK_NULL_HANDLE;
-            return;
+            return result;
         }
 
         // Hook up command buffer dispatch
         object_ptr->vkSetDeviceLoaderData(object_ptr->device, queue_barrier_command_info.barrier_command_buffer);
 
         // Record a global memory barrier to force availability of device memory operations to the host domain.
+        // With deferred readback the barrier can be pending several times over on the same queue.
         VkCommandBufferBeginInfo command_buffer_begin_info = {};
         command_buffer_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        command_buffer_begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
         result = DispatchBeginCommandBuffer(queue_barrier_command_info.barrier_command_buffer, &command_buffer_begin_info);
         if (result == VK_SUCCESS) {
             VkMemoryBarrier memory_barrier = {};
@@ -451,7 +513,102 @@ void UtilSubmitBarrier(VkQueue queue, ObjectType *object_ptr) {
         submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submit_info.commandBufferCount = 1;
         submit_info.pCommandBuffers = &queue_barrier_command_info.barrier_command_buffer;
-        DispatchQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+        return DispatchQueueSubmit(queue, 1, &submit_info, fence);
+    }
+    return (fence != VK_NULL_HANDLE) ? VK_ERROR_INITIALIZATION_FAILED : VK_SUCCESS;
+}
+template <typename ObjectType>
+// Read back the output of one deferred submission and recycle its fence.
+void UtilRetireDeferredReadback(VkQueue queue, UtilDeferredReadback &readback, ObjectType *object_ptr) {
+    for (auto command_buffer : readback.command_buffers) {
+        object_ptr->ProcessInstrumentationBuffers(queue, command_buffer);
+    }
+    DispatchResetFences(object_ptr->device, 1, &readback.fence);
+    object_ptr->deferred_readback_fences.push_back(readback.fence);
+}
+template <typename ObjectType>
+// Read back deferred submissions in submission order on each queue, stopping at the first one still executing. Submissions are
+// waited on instead of polled if wait_for_all is set, or up to and including the last one that uses wait_for_command_buffer.
+void UtilProcessDeferredReadbacks(ObjectType *object_ptr, bool wait_for_all, VkCommandBuffer wait_for_command_buffer) {
+    for (auto &queue_readbacks : object_ptr->deferred_readbacks) {
+        auto &readbacks = queue_readbacks.second;
+        size_t wait_count = wait_for_all ? readbacks.size() : 0;
+        if (wait_for_command_buffer != VK_NULL_HANDLE) {
+            for (size_t i = wait_count; i < readbacks.size(); i++) {
+                const auto &command_buffers = readbacks[i].command_buffers;
+                if (std::find(command_buffers.begin(), command_buffers.end(), wait_for_command_buffer) != command_buffers.end()) {
+                    wait_count = i + 1;
+                }
+            }
+        }
+        for (size_t retired = 0; !readbacks.empty(); retired++) {
+            VkFence fence = readbacks.front().fence;
+            VkResult result = (retired < wait_count)
+                                  ? DispatchWaitForFences(object_ptr->device, 1, &fence, VK_TRUE, UINT64_MAX)
+                                  : DispatchGetFenceStatus(object_ptr->device, fence);
+            // Like the synchronous path, read back whatever is there on errors such as device loss.
+            if ((result == VK_NOT_READY) || (result == VK_TIMEOUT)) break;
+            UtilRetireDeferredReadback(queue_readbacks.first, readbacks.front(), object_ptr);
+            readbacks.pop_front();
+        }
+    }
+}
+template <typename ObjectType>
+// Make the instrumentation output of a submission available to the host and read it back. By default this waits for the queue
+// to go idle; with deferred readback a fence is attached to the barrier submission instead and the output is read back by
+// UtilProcessDeferredReadbacks.
+void UtilReadbackSubmission(VkQueue queue, uint32_t submit_count, const VkSubmitInfo *submits, ObjectType *object_ptr) {
+    std::vector<VkCommandBuffer> command_buffers;
+    for (uint32_t submit_idx = 0; submit_idx < submit_count; submit_idx++) {
+        const VkSubmitInfo *submit = &submits[submit_idx];
+        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+            auto cb_node = object_ptr->GetCBState(submit->pCommandBuffers[i]);
+            command_buffers.push_back(cb_node->commandBuffer);
+            for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
+                command_buffers.push_back(secondaryCmdBuffer->commandBuffer);
+            }
+        }
+    }
+
+    if (object_ptr->deferred_readback) {
+        VkFence fence = VK_NULL_HANDLE;
+        VkResult result = VK_SUCCESS;
+        if (!object_ptr->deferred_readback_fences.empty()) {
+            fence = object_ptr->deferred_readback_fences.back();
+            object_ptr->deferred_readback_fences.pop_back();
+        } else {
+            VkFenceCreateInfo fence_create_info = {};
+            fence_create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            result = DispatchCreateFence(object_ptr->device, &fence_create_info, nullptr, &fence);
+        }
+        if (result == VK_SUCCESS) {
+            result = UtilSubmitBarrier(queue, object_ptr, fence);
+            if (result == VK_SUCCESS) {
+                auto &readbacks = object_ptr->deferred_readbacks[queue];
+                readbacks.emplace_back(UtilDeferredReadback{fence, std::move(command_buffers)});
+                if (readbacks.size() > kUtilMaxDeferredReadbacksPerQueue) {
+                    DispatchWaitForFences(object_ptr->device, 1, &readbacks.front().fence, VK_TRUE, UINT64_MAX);
+                    UtilRetireDeferredReadback(queue, readbacks.front(), object_ptr);
+                    readbacks.pop_front();
+                }
+                return;
+            }
+            object_ptr->deferred_readback_fences.push_back(fence);
+        }
+        // Fall back to reading back synchronously, after anything still deferred on this queue.
+        DispatchQueueWaitIdle(queue);
+        auto &readbacks = object_ptr->deferred_readbacks[queue];
+        for (auto &readback : readbacks) {
+            UtilRetireDeferredReadback(queue, readback, object_ptr);
+        }
+        readbacks.clear();
+    } else {
+        UtilSubmitBarrier(queue, object_ptr);
+        DispatchQueueWaitIdle(queue);
+    }
+
+    for (auto command_buffer : command_buffers) {
+        object_ptr->ProcessInstrumentationBuffers(queue, command_buffer);
     }
 }
 void UtilGenerateStageMessage(const uint32_t *debug_record, std::string &msg);
@@ -284,6 +284,7 @@ void GpuAssisted::PostCallRecordGetBufferDeviceAddress(VkDevice device, const Vk
     // Validate against the size requested when the buffer was created
     if (buffer_state) {
         buffer_map[address] = buffer_state->createInfo.size;
+        buffer_address_map[pInfo->buffer] = address;
         buffer_state->deviceAddress = address;
     }
 }
@@ -299,8 +300,12 @@ void GpuAssisted::PostCallRecordGetBufferDeviceAddressKHR(VkDevice device, const
 }
 
 void GpuAssisted::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) {
-    BUFFER_STATE *buffer_state = GetBufferState(buffer);
-    if (buffer_state) buffer_map.erase(buffer_state->deviceAddress);
+    // With shared state tracking the buffer state is already gone here, so the address is kept on the side
+    auto address_it = buffer_address_map.find(buffer);
+    if (address_it != buffer_address_map.end()) {
+        buffer_map.erase(address_it->second);
+        buffer_address_map.erase(address_it);
+    }
     ValidationStateTracker::PreCallRecordDestroyBuffer(device, buffer, pAllocator);
 }
 
@@ -915,14 +920,14 @@ void GpuAssisted::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer c
     as_validation_state.validation_buffers[commandBuffer].push_back(std::move(as_validation_buffer_info));
 }
 
-void GpuAssisted::ProcessAccelerationStructureBuildValidationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node) {
-    if (cb_node == nullptr || !cb_node->hasBuildAccelerationStructureCmd) {
+void GpuAssisted::ProcessAccelerationStructureBuildValidationBuffer(VkQueue queue, VkCommandBuffer command_buffer) {
+    auto &as_validation_info = acceleration_structure_validation_state;
+    auto as_validation_buffer_infos = as_validation_info.validation_buffers.find(command_buffer);
+    if (as_validation_buffer_infos == as_validation_info.validation_buffers.end()) {
         return;
     }
 
-    auto &as_validation_info = acceleration_structure_validation_state;
-    auto &as_validation_buffer_infos = as_validation_info.validation_buffers[cb_node->commandBuffer];
-    for (const auto &as_validation_buffer_info : as_validation_buffer_infos) {
+    for (const auto &as_validation_buffer_info : as_validation_buffer_infos->second) {
         GpuAccelerationStructureBuildValidationBuffer *mapped_validation_buffer = nullptr;
 
         VkResult result =
@@ -995,6 +1000,8 @@ void GpuAssisted::ResetCommandBuffer(VkCommandBuffer commandBuffer) {
     if (aborted) {
         return;
     }
+    // Output of a deferred readback must be read before the buffers holding it are freed.
+    UtilProcessDeferredReadbacks(this, false, commandBuffer);
     auto gpuav_buffer_list = GetBufferInfo(commandBuffer);
     for (auto buffer_info : gpuav_buffer_list) {
         vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
@@ -1200,19 +1207,38 @@ bool GpuAssisted::InstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo,
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
     using namespace spvtools;
     spv_target_env target_env = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
+    const bool buffer_device_address =
+        (device_extensions.vk_ext_buffer_device_address || device_extensions.vk_khr_buffer_device_address) && shaderInt64 &&
+        enabled_features.core12.bufferDeviceAddress;
+
+    // Reuse the result of an earlier instrumentation of the same code if the cache has one. Otherwise instrument with a
+    // placeholder shader id that the cache can find and replace on later hits.
+    uint32_t shader_id = unique_shader_module_id;
+    uint64_t cache_key = 0;
+    if (instrumentation_cache.Enabled()) {
+        std::vector<uint32_t> cache_options = {static_cast<uint32_t>(container_type), static_cast<uint32_t>(target_env),
+                                               desc_set_bind_index, descriptor_indexing, buffer_device_address};
+        UtilInstrumentationCache::AppendValidatorOptions(device_extensions, enabled_features, cache_options);
+        cache_key = instrumentation_cache.MakeKey(new_pgm, cache_options);
+        if (instrumentation_cache.Lookup(cache_key, unique_shader_module_id, new_pgm)) {
+            *unique_shader_id = unique_shader_module_id++;
+            return true;
+        }
+        shader_id = UtilInstrumentationCache::PickShaderIdPlaceholder(new_pgm);
+    }
+
     spvtools::ValidatorOptions options;
     AdjustValidatorOptions(device_extensions, enabled_features, options);
     Optimizer optimizer(target_env);
     optimizer.SetMessageConsumer(GpuConsoleMessageConsumer);
-    optimizer.RegisterPass(
-        CreateInstBindlessCheckPass(desc_set_bind_index, unique_shader_module_id, descriptor_indexing, descriptor_indexing));
+    optimizer.RegisterPass(CreateInstBindlessCheckPass(desc_set_bind_index, shader_id, descriptor_indexing, descriptor_indexing));
     optimizer.RegisterPass(CreateAggressiveDCEPass());
-    if ((device_extensions.vk_ext_buffer_device_address || device_extensions.vk_khr_buffer_device_address) && shaderInt64 &&
-        enabled_features.core12.bufferDeviceAddress)
-        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, unique_shader_module_id));
+    if (buffer_device_address) optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, shader_id));
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, options, false);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (instrumentation_cache.Enabled()) {
+        instrumentation_cache.Store(cache_key, shader_id, unique_shader_module_id, new_pgm);
     }
     *unique_shader_id = unique_shader_module_id++;
     return pass;
@@ -1336,6 +1362,8 @@ void GpuAssisted::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
             auto cb_node = GetCBState(submit->pCommandBuffers[i]);
+            // A simultaneous use command buffer may still have output waiting to be read back from a previous submission.
+            UtilProcessDeferredReadbacks(this, false, cb_node->commandBuffer);
             UpdateInstrumentationBuffer(cb_node);
             for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
                 UpdateInstrumentationBuffer(secondaryCmdBuffer);
@@ -1345,13 +1373,14 @@ void GpuAssisted::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
 }
 
 // Issue a memory barrier to make GPU-written data available to host.
-// Wait for the queue to complete execution.
+// Wait for the queue to complete execution, or with deferred readback, for a fence signaled after it.
 // Check the debug buffers for all the command buffers that were submitted.
 void GpuAssisted::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                             VkResult result) {
     ValidationStateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
 
     if (aborted || (result != VK_SUCCESS)) return;
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
     bool buffers_present = false;
     // Don't QueueWaitIdle if there's nothing to process
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
@@ -1367,22 +1396,35 @@ void GpuAssisted::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount,
     }
     if (!buffers_present) return;
 
-    UtilSubmitBarrier(queue, this);
+    UtilReadbackSubmission(queue, submitCount, pSubmits, this);
+}
 
-    DispatchQueueWaitIdle(queue);
+// Read back the instrumentation and acceleration structure build validation output of a submitted command buffer.
+void GpuAssisted::ProcessInstrumentationBuffers(VkQueue queue, VkCommandBuffer command_buffer) {
+    UtilProcessInstrumentationBuffer(queue, command_buffer, this);
+    ProcessAccelerationStructureBuildValidationBuffer(queue, command_buffer);
+}
 
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        const VkSubmitInfo *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            auto cb_node = GetCBState(submit->pCommandBuffers[i]);
-            UtilProcessInstrumentationBuffer(queue, cb_node, this);
-            ProcessAccelerationStructureBuildValidationBuffer(queue, cb_node);
-            for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
-                UtilProcessInstrumentationBuffer(queue, secondaryCmdBuffer, this);
-                ProcessAccelerationStructureBuildValidationBuffer(queue, cb_node);
-            }
-        }
-    }
+// Pick up deferred readbacks that have completed by the time the application waits on the device.
+void GpuAssisted::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                              uint64_t timeout, VkResult result) {
+    ValidationStateTracker::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
+}
+
+void GpuAssisted::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    ValidationStateTracker::PostCallRecordGetFenceStatus(device, fence, result);
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
+}
+
+void GpuAssisted::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    ValidationStateTracker::PostCallRecordQueueWaitIdle(queue, result);
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
+}
+
+void GpuAssisted::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    ValidationStateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    UtilProcessDeferredReadbacks(this, false, VK_NULL_HANDLE);
 }
 
 void GpuAssisted::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
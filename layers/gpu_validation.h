@@ -90,6 +90,7 @@ class GpuAssisted : public ValidationStateTracker {
     std::unordered_map<VkCommandBuffer, std::vector<GpuAssistedBufferInfo>> command_buffer_map;  // gpu_buffer_list;
     uint32_t output_buffer_size;
     std::map<VkDeviceAddress, VkDeviceSize> buffer_map;
+    std::unordered_map<VkBuffer, VkDeviceAddress> buffer_address_map;
     GpuAssistedAccelerationStructureBuildValidationState acceleration_structure_validation_state;
 
   public:
@@ -108,6 +109,10 @@ class GpuAssisted : public ValidationStateTracker {
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     VmaAllocator vmaAllocator = {};
     std::map<VkQueue, UtilQueueBarrierCommandInfo> queue_barrier_command_infos;
+    bool deferred_readback = false;
+    std::map<VkQueue, std::deque<UtilDeferredReadback>> deferred_readbacks;
+    std::vector<VkFence> deferred_readback_fences;
+    UtilInstrumentationCache instrumentation_cache;
     std::vector<GpuAssistedBufferInfo>& GetBufferInfo(const VkCommandBuffer command_buffer) {
         auto buffer_list = command_buffer_map.find(command_buffer);
         if (buffer_list == command_buffer_map.end()) {
@@ -157,7 +162,8 @@ class GpuAssisted : public ValidationStateTracker {
                                                       VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update,
                                                       VkAccelerationStructureNV dst, VkAccelerationStructureNV src,
                                                       VkBuffer scratch, VkDeviceSize scratchOffset);
-    void ProcessAccelerationStructureBuildValidationBuffer(VkQueue queue, CMD_BUFFER_STATE* cb_node);
+    void ProcessAccelerationStructureBuildValidationBuffer(VkQueue queue, VkCommandBuffer command_buffer);
+    void ProcessInstrumentationBuffers(VkQueue queue, VkCommandBuffer command_buffer);
     void PreCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                               const VkGraphicsPipelineCreateInfo* pCreateInfos,
                                               const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
@@ -202,6 +208,11 @@ class GpuAssisted : public ValidationStateTracker {
     void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence);
     void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                    VkResult result);
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
+                                     uint64_t timeout, VkResult result);
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result);
+    void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result);
+    void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result);
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
                               uint32_t firstInstance);
     void PreCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
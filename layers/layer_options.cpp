@@ -85,6 +85,18 @@ void SetValidationEnable(CHECK_ENABLED &enable_data, const ValidationCheckEnable
         case VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL:
             enable_data[vendor_specific_arm] = true;
             break;
+        case VALIDATION_CHECK_ENABLE_FINE_GRAINED_LOCKING:
+            enable_data[fine_grained_locking] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_GPU_DEFERRED_READBACK:
+            enable_data[gpu_deferred_readback] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_PARALLEL_DESCRIPTOR_UPDATES:
+            enable_data[parallel_descriptor_updates] = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_SHARED_STATE_TRACKING:
+            enable_data[shared_state_tracking] = true;
+            break;
         default:
             assert(true);
     }
@@ -231,8 +243,12 @@ void CreateFilterMessageIdList(std::string raw_id_list, std::string delimiter, s
                 int_id = static_cast<uint32_t>(id_hash);
             }
         }
-        if ((int_id != 0) && (std::find(filter_list.begin(), filter_list.end(), int_id)) == filter_list.end()) {
-            filter_list.push_back(int_id);
+        // Keep the list sorted so that LogMsgEnabled can binary search it without locking
+        if (int_id != 0) {
+            auto insert_pos = std::lower_bound(filter_list.begin(), filter_list.end(), int_id);
+            if ((insert_pos == filter_list.end()) || (*insert_pos != int_id)) {
+                filter_list.insert(insert_pos, int_id);
+            }
         }
     }
 }
@@ -68,6 +68,10 @@ static const std::unordered_map<std::string, ValidationCheckDisables> Validation
 static const std::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM},
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL},
+    {"VALIDATION_CHECK_ENABLE_FINE_GRAINED_LOCKING", VALIDATION_CHECK_ENABLE_FINE_GRAINED_LOCKING},
+    {"VALIDATION_CHECK_ENABLE_GPU_DEFERRED_READBACK", VALIDATION_CHECK_ENABLE_GPU_DEFERRED_READBACK},
+    {"VALIDATION_CHECK_ENABLE_PARALLEL_DESCRIPTOR_UPDATES", VALIDATION_CHECK_ENABLE_PARALLEL_DESCRIPTOR_UPDATES},
+    {"VALIDATION_CHECK_ENABLE_SHARED_STATE_TRACKING", VALIDATION_CHECK_ENABLE_SHARED_STATE_TRACKING},
 };
 
 // This should mirror the 'DisableFlags' enumerated type
@@ -93,7 +97,11 @@ static const std::vector<std::string> EnableFlagNameHelper = {
     "VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT",                     // best_practices,
     "VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM",                         // vendor_specific_arm,
     "VK_VALIDATION_FEATURE_ENABLE_DEBUG_PRINTF_EXT",                       // debug_printf,
-    "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION"              // sync_validation,
+    "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION",             // sync_validation,
+    "VALIDATION_CHECK_ENABLE_FINE_GRAINED_LOCKING",                        // fine_grained_locking,
+    "VALIDATION_CHECK_ENABLE_GPU_DEFERRED_READBACK",                       // gpu_deferred_readback,
+    "VALIDATION_CHECK_ENABLE_PARALLEL_DESCRIPTOR_UPDATES",                 // parallel_descriptor_updates,
+    "VALIDATION_CHECK_ENABLE_SHARED_STATE_TRACKING",                       // shared_state_tracking,
 };
 
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data);
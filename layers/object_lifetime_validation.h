@@ -46,16 +46,72 @@ enum ObjectStatusFlagBits {
     OBJSTATUS_CUSTOM_ALLOCATOR = 0x00000002,          // Allocated with custom allocator
 };
 
-// Object and state information structure
+// Object and state information structure. Nodes are owned by the ObjTrackStateRegistry of the ObjectLifetimes tracking them.
 struct ObjTrackState {
-    uint64_t handle;                                               // Object handle (new)
-    VulkanObjectType object_type;                                  // Object type identifier
-    ObjectStatusFlags status;                                      // Object state
-    uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<std::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    uint64_t handle;                   // Object handle (new)
+    VulkanObjectType object_type;      // Object type identifier
+    ObjectStatusFlags status;          // Object state
+    uint64_t parent_object;            // Parent object
+    std::atomic<uint32_t> generation;  // Bumped each time the node is released back to the registry
+    // Child objects (descriptor sets of a VkDescriptorPool, command buffers of a VkCommandPool), linked through the
+    // children's sibling pointers. next_sibling also links released nodes on the registry free list.
+    ObjTrackState *parent_node;
+    ObjTrackState *first_child;
+    ObjTrackState *prev_sibling;
+    ObjTrackState *next_sibling;
+
+    ObjTrackState()
+        : handle(0),
+          object_type(kVulkanObjectTypeUnknown),
+          status(OBJSTATUS_NONE),
+          parent_object(0),
+          generation(0),
+          parent_node(nullptr),
+          first_child(nullptr),
+          prev_sibling(nullptr),
+          next_sibling(nullptr) {}
 };
 
-typedef vl_concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
+// Reference to a registry node, tagged with the node generation at the time the reference was taken. Once the object is
+// destroyed the node generation moves on, so stale references (e.g. from a map snapshot) can be told apart from a node that
+// has been reused for another object.
+struct ObjTrackRef {
+    ObjTrackState *node;
+    uint32_t generation;
+
+    ObjTrackRef() : node(nullptr), generation(0) {}
+    explicit ObjTrackRef(ObjTrackState *node_) : node(node_), generation(node_->generation.load(std::memory_order_relaxed)) {}
+    bool IsLive() const { return node && node->generation.load(std::memory_order_acquire) == generation; }
+    ObjTrackState *operator->() const { return node; }
+};
+
+// Slab storage for ObjTrackState nodes. Nodes are carved out of blocks that are never moved or freed before the registry
+// itself, so node pointers stay valid for lookups racing with a destroy, and released nodes are reused through a free list
+// instead of going back to the heap.
+class ObjTrackStateRegistry {
+  public:
+    ObjTrackStateRegistry() : block_size_(0), block_used_(0), free_list_(nullptr) {}
+
+    ObjTrackState *Allocate();
+    // Release a list of nodes linked through next_sibling
+    void ReleaseList(ObjTrackState *first);
+    void Release(ObjTrackState *node) {
+        node->next_sibling = nullptr;
+        ReleaseList(node);
+    }
+
+  private:
+    static const size_t kFirstBlockSize = 256;
+    static const size_t kMaxBlockSize = 64 * 1024;
+
+    std::mutex lock_;
+    std::vector<std::unique_ptr<ObjTrackState[]>> blocks_;
+    size_t block_size_;
+    size_t block_used_;
+    ObjTrackState *free_list_;
+};
+
+typedef vl_concurrent_unordered_map<uint64_t, ObjTrackRef, 6> object_map_type;
 
 class ObjectLifetimes : public ValidationObject {
   public:
@@ -71,6 +127,8 @@ class ObjectLifetimes : public ValidationObject {
 
     std::atomic<uint64_t> num_objects[kVulkanObjectTypeMax + 1];
     std::atomic<uint64_t> num_total_objects;
+    // Storage for the ObjTrackState nodes referenced by the maps below
+    ObjTrackStateRegistry obj_track_registry;
     // Vector of unordered_maps per object type to hold ObjTrackState info
     object_map_type object_map[kVulkanObjectTypeMax + 1];
     // Special-case map for swapchain images
@@ -90,10 +148,11 @@ class ObjectLifetimes : public ValidationObject {
     }
 
     template <typename T1>
-    void InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, std::shared_ptr<ObjTrackState> pNode) {
+    bool InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, ObjTrackState *pNode) {
         uint64_t object_handle = HandleToUint64(object);
-        bool inserted = map.insert(object_handle, pNode);
+        bool inserted = map.insert(object_handle, ObjTrackRef(pNode));
         if (!inserted) {
+            obj_track_registry.Release(pNode);
             // The object should not already exist. If we couldn't add it to the map, there was probably
             // a race condition in the app. Report an error and move on.
             (void)LogError(object, kVUID_ObjectTracker_Info,
@@ -102,8 +161,14 @@ class ObjectLifetimes : public ValidationObject {
                            "race condition in the application.",
                            object_string[object_type], object_handle);
         }
+        return inserted;
     }
 
+    void LinkChildObject(ObjTrackState *parent_node, ObjTrackState *child_node);
+    void UnlinkChildObject(ObjTrackState *child_node);
+    void ReleaseObjectNode(ObjTrackState *node);
+    void DestroyChildObjects(ObjTrackState *parent_node, VulkanObjectType child_type);
+
     bool ReportUndestroyedInstanceObjects(VkInstance instance, const std::string &error_code) const;
     bool ReportUndestroyedDeviceObjects(VkDevice device, const std::string &error_code) const;
 
@@ -113,8 +178,9 @@ class ObjectLifetimes : public ValidationObject {
     void DestroyUndestroyedObjects(VulkanObjectType object_type);
 
     void CreateQueue(VkQueue vkObj);
-    void AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer, VkCommandBufferLevel level);
-    void AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set);
+    void AllocateCommandBuffer(const VkCommandPool command_pool, ObjTrackState *pool_node, const VkCommandBuffer command_buffer,
+                               VkCommandBufferLevel level);
+    void AllocateDescriptorSet(VkDescriptorPool descriptor_pool, ObjTrackState *pool_node, VkDescriptorSet descriptor_set);
     void CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain);
     void DestroyLeakedInstanceObjects();
     void DestroyLeakedDeviceObjects();
@@ -197,17 +263,14 @@ class ObjectLifetimes : public ValidationObject {
         uint64_t object_handle = HandleToUint64(object);
         bool custom_allocator = (pAllocator != nullptr);
         if (!object_map[object_type].contains(object_handle)) {
-            auto pNewObjNode = std::make_shared<ObjTrackState>();
+            auto pNewObjNode = obj_track_registry.Allocate();
             pNewObjNode->object_type = object_type;
             pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
             pNewObjNode->handle = object_handle;
 
-            InsertObject(object_map[object_type], object, object_type, pNewObjNode);
-            num_objects[object_type]++;
-            num_total_objects++;
-
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
-                pNewObjNode->child_objects.reset(new std::unordered_set<uint64_t>);
+            if (InsertObject(object_map[object_type], object, object_type, pNewObjNode)) {
+                num_objects[object_type]++;
+                num_total_objects++;
             }
         }
     }
@@ -233,6 +296,7 @@ class ObjectLifetimes : public ValidationObject {
         assert(num_objects[item->second->object_type] > 0);
 
         num_objects[item->second->object_type]--;
+        ReleaseObjectNode(item->second.node);
     }
 
     template <typename T1>
@@ -245,6 +309,31 @@ class ObjectLifetimes : public ValidationObject {
         }
     }
 
+    // Destroy a batch of childless objects (e.g. from vkFreeCommandBuffers), returning their nodes to the registry together
+    template <typename T1>
+    void RecordDestroyObjects(uint32_t object_count, const T1 *objects, VulkanObjectType object_type) {
+        ObjTrackState *released = nullptr;
+        for (uint32_t i = 0; i < object_count; i++) {
+            auto object_handle = HandleToUint64(objects[i]);
+            if (object_handle == VK_NULL_HANDLE) continue;
+            auto item = object_map[object_type].pop(object_handle);
+            if (item == object_map[object_type].end()) continue;
+
+            assert(num_total_objects > 0);
+            num_total_objects--;
+            assert(num_objects[object_type] > 0);
+            num_objects[object_type]--;
+
+            auto node = item->second.node;
+            UnlinkChildObject(node);
+            node->next_sibling = released;
+            released = node;
+        }
+        if (released) {
+            obj_track_registry.ReleaseList(released);
+        }
+    }
+
     template <typename T1>
     bool ValidateDestroyObject(T1 object, VulkanObjectType object_type, const VkAllocationCallbacks *pAllocator,
                                const char *expected_custom_allocator_code, const char *expected_default_allocator_code) const {
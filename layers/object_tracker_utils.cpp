@@ -34,6 +34,99 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
     return typed_handle;
 }
 
+ObjTrackState *ObjTrackStateRegistry::Allocate() {
+    std::lock_guard<std::mutex> lock(lock_);
+    ObjTrackState *node = free_list_;
+    if (node) {
+        free_list_ = node->next_sibling;
+    } else {
+        if (block_used_ == block_size_) {
+            block_size_ = block_size_ ? std::min(block_size_ * 2, static_cast<size_t>(kMaxBlockSize)) : kFirstBlockSize;
+            blocks_.emplace_back(new ObjTrackState[block_size_]);
+            block_used_ = 0;
+        }
+        node = &blocks_.back()[block_used_++];
+    }
+    node->status = OBJSTATUS_NONE;
+    node->parent_object = 0;
+    node->parent_node = nullptr;
+    node->first_child = nullptr;
+    node->prev_sibling = nullptr;
+    node->next_sibling = nullptr;
+    return node;
+}
+
+void ObjTrackStateRegistry::ReleaseList(ObjTrackState *first) {
+    std::lock_guard<std::mutex> lock(lock_);
+    ObjTrackState *last = first;
+    for (ObjTrackState *node = first; node; node = node->next_sibling) {
+        node->generation.fetch_add(1, std::memory_order_release);
+        last = node;
+    }
+    last->next_sibling = free_list_;
+    free_list_ = first;
+}
+
+void ObjectLifetimes::LinkChildObject(ObjTrackState *parent_node, ObjTrackState *child_node) {
+    child_node->parent_node = parent_node;
+    child_node->prev_sibling = nullptr;
+    child_node->next_sibling = parent_node->first_child;
+    if (parent_node->first_child) {
+        parent_node->first_child->prev_sibling = child_node;
+    }
+    parent_node->first_child = child_node;
+}
+
+void ObjectLifetimes::UnlinkChildObject(ObjTrackState *child_node) {
+    auto parent_node = child_node->parent_node;
+    if (!parent_node) return;
+    if (child_node->prev_sibling) {
+        child_node->prev_sibling->next_sibling = child_node->next_sibling;
+    } else {
+        parent_node->first_child = child_node->next_sibling;
+    }
+    if (child_node->next_sibling) {
+        child_node->next_sibling->prev_sibling = child_node->prev_sibling;
+    }
+    child_node->parent_node = nullptr;
+    child_node->prev_sibling = nullptr;
+    child_node->next_sibling = nullptr;
+}
+
+// Return the node of a destroyed object to the registry. Any children still linked to it are left untracked by the parent.
+void ObjectLifetimes::ReleaseObjectNode(ObjTrackState *node) {
+    UnlinkChildObject(node);
+    auto child_node = node->first_child;
+    while (child_node) {
+        auto next_node = child_node->next_sibling;
+        child_node->parent_node = nullptr;
+        child_node->prev_sibling = nullptr;
+        child_node->next_sibling = nullptr;
+        child_node = next_node;
+    }
+    node->first_child = nullptr;
+    obj_track_registry.Release(node);
+}
+
+// Destroy all children of a pool object at once, e.g. when a descriptor pool is reset or a command pool is destroyed.
+void ObjectLifetimes::DestroyChildObjects(ObjTrackState *parent_node, VulkanObjectType child_type) {
+    auto first_child = parent_node->first_child;
+    if (!first_child) return;
+
+    uint64_t destroyed_count = 0;
+    for (auto child_node = first_child; child_node; child_node = child_node->next_sibling) {
+        child_node->parent_node = nullptr;
+        destroyed_count += object_map[child_type].erase(child_node->handle);
+    }
+    parent_node->first_child = nullptr;
+
+    assert(num_total_objects >= destroyed_count);
+    num_total_objects -= destroyed_count;
+    assert(num_objects[child_type] >= destroyed_count);
+    num_objects[child_type] -= destroyed_count;
+    obj_track_registry.ReleaseList(first_child);
+}
+
 // Destroy memRef lists and free all memory
 void ObjectLifetimes::DestroyQueueDataStructures() {
     // Destroy the items in the queue map
@@ -44,15 +137,17 @@ void ObjectLifetimes::DestroyQueueDataStructures() {
         num_total_objects--;
         assert(num_objects[obj_index] > 0);
         num_objects[obj_index]--;
-        object_map[kVulkanObjectTypeQueue].erase(queue.first);
+        if (object_map[kVulkanObjectTypeQueue].erase(queue.first)) {
+            ReleaseObjectNode(queue.second.node);
+        }
     }
 }
 
 void ObjectLifetimes::DestroyUndestroyedObjects(VulkanObjectType object_type) {
     auto snapshot = object_map[object_type].snapshot();
     for (const auto &item : snapshot) {
-        auto object_info = item.second;
-        DestroyObjectSilently(object_info->handle, object_type);
+        if (!item.second.IsLive()) continue;
+        DestroyObjectSilently(item.first, object_type);
     }
 }
 
@@ -82,9 +177,9 @@ bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object_handle, VkObjectTy
     return CheckObjectValidity(object_handle, object_type, null_allowed, invalid_handle_code, wrong_device_code);
 }
 
-void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer,
-                                            VkCommandBufferLevel level) {
-    auto pNewObjNode = std::make_shared<ObjTrackState>();
+void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, ObjTrackState *pool_node,
+                                            const VkCommandBuffer command_buffer, VkCommandBufferLevel level) {
+    auto pNewObjNode = obj_track_registry.Allocate();
     pNewObjNode->object_type = kVulkanObjectTypeCommandBuffer;
     pNewObjNode->handle = HandleToUint64(command_buffer);
     pNewObjNode->parent_object = HandleToUint64(command_pool);
@@ -93,9 +188,15 @@ void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, co
     } else {
         pNewObjNode->status = OBJSTATUS_NONE;
     }
-    InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, pNewObjNode);
+    if (!InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, pNewObjNode)) {
+        return;
+    }
     num_objects[kVulkanObjectTypeCommandBuffer]++;
     num_total_objects++;
+
+    if (pool_node) {
+        LinkChildObject(pool_node, pNewObjNode);
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer) const {
@@ -123,19 +224,21 @@ bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkComman
     return skip;
 }
 
-void ObjectLifetimes::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set) {
-    auto pNewObjNode = std::make_shared<ObjTrackState>();
+void ObjectLifetimes::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, ObjTrackState *pool_node,
+                                            VkDescriptorSet descriptor_set) {
+    auto pNewObjNode = obj_track_registry.Allocate();
     pNewObjNode->object_type = kVulkanObjectTypeDescriptorSet;
     pNewObjNode->status = OBJSTATUS_NONE;
     pNewObjNode->handle = HandleToUint64(descriptor_set);
     pNewObjNode->parent_object = HandleToUint64(descriptor_pool);
-    InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, pNewObjNode);
+    if (!InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, pNewObjNode)) {
+        return;
+    }
     num_objects[kVulkanObjectTypeDescriptorSet]++;
     num_total_objects++;
 
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
+    if (pool_node) {
+        LinkChildObject(pool_node, pNewObjNode);
     }
 }
 
@@ -239,15 +342,15 @@ bool ObjectLifetimes::PreCallValidateCmdPushDescriptorSetKHR(VkCommandBuffer com
 }
 
 void ObjectLifetimes::CreateQueue(VkQueue vkObj) {
-    std::shared_ptr<ObjTrackState> p_obj_node = NULL;
+    ObjTrackState *p_obj_node = nullptr;
     auto queue_item = object_map[kVulkanObjectTypeQueue].find(HandleToUint64(vkObj));
     if (queue_item == object_map[kVulkanObjectTypeQueue].end()) {
-        p_obj_node = std::make_shared<ObjTrackState>();
-        InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, p_obj_node);
+        p_obj_node = obj_track_registry.Allocate();
+        if (!InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, p_obj_node)) return;
         num_objects[kVulkanObjectTypeQueue]++;
         num_total_objects++;
     } else {
-        p_obj_node = queue_item->second;
+        p_obj_node = queue_item->second.node;
     }
     p_obj_node->object_type = kVulkanObjectTypeQueue;
     p_obj_node->status = OBJSTATUS_NONE;
@@ -256,7 +359,7 @@ void ObjectLifetimes::CreateQueue(VkQueue vkObj) {
 
 void ObjectLifetimes::CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain) {
     if (!swapchainImageMap.contains(HandleToUint64(swapchain_image))) {
-        auto pNewObjNode = std::make_shared<ObjTrackState>();
+        auto pNewObjNode = obj_track_registry.Allocate();
         pNewObjNode->object_type = kVulkanObjectTypeImage;
         pNewObjNode->status = OBJSTATUS_NONE;
         pNewObjNode->handle = HandleToUint64(swapchain_image);
@@ -271,7 +374,7 @@ bool ObjectLifetimes::ReportLeakedInstanceObjects(VkInstance instance, VulkanObj
 
     auto snapshot = object_map[object_type].snapshot();
     for (const auto &item : snapshot) {
-        const auto object_info = item.second;
+        const auto object_info = item.second.node;
         LogObjectList objlist(instance);
         objlist.add(ObjTrackStateTypedHandle(*object_info));
         skip |= LogError(objlist, error_code, "OBJ ERROR : For %s, %s has not been destroyed.",
@@ -287,7 +390,7 @@ bool ObjectLifetimes::ReportLeakedDeviceObjects(VkDevice device, VulkanObjectTyp
 
     auto snapshot = object_map[object_type].snapshot();
     for (const auto &item : snapshot) {
-        const auto object_info = item.second;
+        const auto object_info = item.second.node;
         LogObjectList objlist(device);
         objlist.add(ObjTrackStateTypedHandle(*object_info));
         skip |= LogError(objlist, error_code, "OBJ ERROR : For %s, %s has not been destroyed.",
@@ -305,7 +408,7 @@ bool ObjectLifetimes::PreCallValidateDestroyInstance(VkInstance instance, const
 
     auto snapshot = object_map[kVulkanObjectTypeDevice].snapshot();
     for (const auto &iit : snapshot) {
-        auto pNode = iit.second;
+        auto pNode = iit.second.node;
 
         VkDevice device = reinterpret_cast<VkDevice>(pNode->handle);
         VkDebugReportObjectTypeEXT debug_object_type = get_debug_report_enum[pNode->object_type];
@@ -456,10 +559,9 @@ bool ObjectLifetimes::PreCallValidateResetDescriptorPool(VkDevice device, VkDesc
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
+        for (auto child_node = itr->second->first_child; child_node; child_node = child_node->next_sibling) {
+            skip |= ValidateDestroyObject(CastFromUint64<VkDescriptorSet>(child_node->handle), kVulkanObjectTypeDescriptorSet,
+                                          nullptr, kVUIDUndefined, kVUIDUndefined);
         }
     }
     return skip;
@@ -472,11 +574,7 @@ void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescri
     // our descriptorSet map.
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pPoolNode->child_objects->clear();
+        DestroyChildObjects(itr->second.node, kVulkanObjectTypeDescriptorSet);
     }
 }
 
@@ -646,8 +744,13 @@ bool ObjectLifetimes::PreCallValidateAllocateCommandBuffers(VkDevice device, con
 void ObjectLifetimes::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
                                                            VkCommandBuffer *pCommandBuffers, VkResult result) {
     if (result != VK_SUCCESS) return;
+    ObjTrackState *pool_node = nullptr;
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(pAllocateInfo->commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        pool_node = itr->second.node;
+    }
     for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
-        AllocateCommandBuffer(pAllocateInfo->commandPool, pCommandBuffers[i], pAllocateInfo->level);
+        AllocateCommandBuffer(pAllocateInfo->commandPool, pool_node, pCommandBuffers[i], pAllocateInfo->level);
     }
 }
 
@@ -672,8 +775,13 @@ void ObjectLifetimes::PostCallRecordAllocateDescriptorSets(VkDevice device, cons
                                                            VkDescriptorSet *pDescriptorSets, VkResult result) {
     if (result != VK_SUCCESS) return;
     auto lock = write_shared_lock();
+    ObjTrackState *pool_node = nullptr;
+    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(pAllocateInfo->descriptorPool));
+    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
+        pool_node = itr->second.node;
+    }
     for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
-        AllocateDescriptorSet(pAllocateInfo->descriptorPool, pDescriptorSets[i]);
+        AllocateDescriptorSet(pAllocateInfo->descriptorPool, pool_node, pDescriptorSets[i]);
     }
 }
 
@@ -695,9 +803,7 @@ bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers) {
-    for (uint32_t i = 0; i < commandBufferCount; i++) {
-        RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
-    }
+    RecordDestroyObjects(commandBufferCount, pCommandBuffers, kVulkanObjectTypeCommandBuffer);
 }
 
 bool ObjectLifetimes::PreCallValidateDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
@@ -711,9 +817,12 @@ void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapch
     RecordDestroyObject(swapchain, kVulkanObjectTypeSwapchainKHR);
 
     auto snapshot = swapchainImageMap.snapshot(
-        [swapchain](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
+        [swapchain](ObjTrackRef pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
     for (const auto &itr : snapshot) {
-        swapchainImageMap.erase(itr.first);
+        auto item = swapchainImageMap.pop(itr.first);
+        if (item != swapchainImageMap.end()) {
+            obj_track_registry.Release(item->second.node);
+        }
     }
 }
 
@@ -736,17 +845,7 @@ bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescr
 void ObjectLifetimes::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                       const VkDescriptorSet *pDescriptorSets) {
     auto lock = write_shared_lock();
-    std::shared_ptr<ObjTrackState> pPoolNode = nullptr;
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        pPoolNode = itr->second;
-    }
-    for (uint32_t i = 0; i < descriptorSetCount; i++) {
-        RecordDestroyObject(pDescriptorSets[i], kVulkanObjectTypeDescriptorSet);
-        if (pPoolNode) {
-            pPoolNode->child_objects->erase(HandleToUint64(pDescriptorSets[i]));
-        }
-    }
+    RecordDestroyObjects(descriptorSetCount, pDescriptorSets, kVulkanObjectTypeDescriptorSet);
 }
 
 bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
@@ -760,10 +859,9 @@ bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDe
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
+        for (auto child_node = itr->second->first_child; child_node; child_node = child_node->next_sibling) {
+            skip |= ValidateDestroyObject(CastFromUint64<VkDescriptorSet>(child_node->handle), kVulkanObjectTypeDescriptorSet,
+                                          nullptr, kVUIDUndefined, kVUIDUndefined);
         }
     }
     skip |= ValidateDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool, pAllocator,
@@ -776,11 +874,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
     auto lock = write_shared_lock();
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pPoolNode->child_objects->clear();
+        DestroyChildObjects(itr->second.node, kVulkanObjectTypeDescriptorSet);
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
@@ -792,13 +886,13 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent");
 
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto pNode = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first));
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        for (auto child_node = itr->second->first_child; child_node; child_node = child_node->next_sibling) {
+            const auto command_buffer = reinterpret_cast<VkCommandBuffer>(child_node->handle);
+            skip |= ValidateCommandBuffer(commandPool, command_buffer);
+            skip |= ValidateDestroyObject(command_buffer, kVulkanObjectTypeCommandBuffer, nullptr, kVUIDUndefined, kVUIDUndefined);
+        }
     }
     skip |= ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator,
                                   "VUID-vkDestroyCommandPool-commandPool-00042", "VUID-vkDestroyCommandPool-commandPool-00043");
@@ -807,11 +901,10 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        DestroyChildObjects(itr->second.node, kVulkanObjectTypeCommandBuffer);
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
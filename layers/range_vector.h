@@ -27,7 +27,9 @@
 #include <cassert>
 #include <limits>
 #include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 #include <cstdint>
 
 #define RANGE_ASSERT(b) assert(b)
@@ -1352,6 +1354,372 @@ class small_range_map {
     std::array<bool, N> in_use_;
 };
 
+// A B-tree like ordered map for range keys for use as the range map "ImplMap" as an alternate to std::map
+//
+// The entries are kept in order in a list of fixed capacity blocks, each holding the keys in one contiguous array and the
+// values in a second. A lookup is a binary search over the blocks (by their last key) followed by one within the block,
+// and walking the map is a linear scan of each block in turn. Inserts and erases only move the values after the change
+// point within the one block, with a full block split in two, so that the cost of a change doesn't grow with the map.
+// For the maps of range tracked resource state this is cheaper than allocating, freeing, and chasing pointers between
+// red-black tree nodes.
+//
+// Unlike a plain array, an iterator refers to its entry by the range begin (as small_range_map does), and not by position,
+// so that as with std::map an iterator remains valid across inserts and erases of *other* entries. The iterator caches the
+// position of its entry together with the map's modification count, and only searches for the entry again if the map was
+// changed since.
+//
+// Assumes RangeKey implements begin, end, == and < from template range above
+template <typename Key, typename T, typename RangeKey = range<Key>, size_t N = 32>
+class btree_range_map {
+  public:
+    using mapped_type = T;
+    using key_type = RangeKey;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using index_type = typename key_type::index_type;
+    using size_type = size_t;
+
+  private:
+    static const size_t kEndBlock = std::numeric_limits<size_t>::max();
+    static const size_t kBlockCapacity = N;
+    static_assert(kBlockCapacity >= 4, "btree_range_map blocks must hold at least four entries");
+
+    // Location of an entry, block kEndBlock is end()
+    struct Position {
+        size_t block;
+        size_t slot;
+        Position() : block(kEndBlock), slot(0) {}
+        Position(size_t block_, size_t slot_) : block(block_), slot(slot_) {}
+        bool at_end() const { return block == kEndBlock; }
+    };
+
+    struct alignas(alignof(value_type)) BackingStore {
+        uint8_t data[sizeof(value_type)];
+    };
+
+    struct Block {
+        size_t count;
+        key_type keys[kBlockCapacity];
+        BackingStore values[kBlockCapacity];
+
+        Block() : count(0) {}
+        ~Block() {
+            for (size_t i = 0; i < count; ++i) {
+                value(i)->~value_type();
+            }
+        }
+        value_type *value(size_t slot) { return reinterpret_cast<value_type *>(&values[slot]); }
+        const value_type *value(size_t slot) const { return reinterpret_cast<const value_type *>(&values[slot]); }
+        const key_type &last_key() const { return keys[count - 1]; }
+
+        // Move count values from the front of src to dest, as values can't generally be relocated by copying their bytes.
+        // The destination slots must be unused, and the source slots are left unused.
+        static void move_values(Block &dest, size_t dest_slot, Block &src, size_t src_slot, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                dest.keys[dest_slot + i] = src.keys[src_slot + i];
+                new (&dest.values[dest_slot + i]) value_type(std::move(*src.value(src_slot + i)));
+                src.value(src_slot + i)->~value_type();
+            }
+        }
+    };
+
+  public:
+    template <typename Map_, typename Value_>
+    struct IteratorImpl {
+      public:
+        using Map = Map_;
+        using Value = Value_;
+        friend Map;
+        Value *operator->() const { return map_->get_value(resolve()); }
+        Value &operator*() const { return *(map_->get_value(resolve())); }
+        IteratorImpl &operator++() {
+            set_pos(map_->next(resolve()));
+            return *this;
+        }
+        IteratorImpl &operator--() {
+            // Decrementing end() gives the last entry, as with std::map
+            set_pos(map_->prev(at_end() ? Position() : resolve()));
+            return *this;
+        }
+        bool operator==(const IteratorImpl &other) const {
+            if (at_end() || other.at_end()) {
+                return at_end() && other.at_end();  // all ends are equal
+            }
+            return (map_ == other.map_) && (begin_ == other.begin_);
+        }
+        bool operator!=(const IteratorImpl &other) const { return !(*this == other); }
+
+        // At end()
+        IteratorImpl() : map_(nullptr), pos_(), begin_(), version_(0) {}
+
+        // Raw getters to allow for const_iterator conversion below
+        Map *get_map() const { return map_; }
+        Position get_pos() const { return pos_; }
+        index_type get_begin() const { return begin_; }
+        uint64_t get_version() const { return version_; }
+
+        bool at_end() const { return (map_ == nullptr) || pos_.at_end(); }
+
+      protected:
+        IteratorImpl(Map *map, const Position &pos) : map_(map), pos_(), begin_(), version_(0) { set_pos(pos); }
+        IteratorImpl(Map *map, const Position &pos, index_type begin, uint64_t version)
+            : map_(map), pos_(pos), begin_(begin), version_(version) {}
+
+      private:
+        void set_pos(const Position &pos) {
+            pos_ = pos;
+            if (!pos.at_end()) {
+                begin_ = map_->get_key(pos).begin;
+                version_ = map_->version_;
+            }
+        }
+        // The cached position is good until the map changes, after which the entry is looked up again by its begin
+        const Position &resolve() const {
+            RANGE_ASSERT(!at_end());
+            if (version_ != map_->version_) {
+                pos_ = map_->find_begin(begin_);
+                version_ = map_->version_;
+            }
+            return pos_;
+        }
+
+        Map *map_;
+        mutable Position pos_;
+        index_type begin_;  // the begin of the entry's range, which identifies it across changes to the map
+        mutable uint64_t version_;
+    };
+    using iterator = IteratorImpl<btree_range_map, value_type>;
+
+    // The const iterator must be derived to allow the conversion from iterator, which iterator doesn't support
+    class const_iterator : public IteratorImpl<const btree_range_map, const value_type> {
+        using Base = IteratorImpl<const btree_range_map, const value_type>;
+        friend btree_range_map;
+
+      public:
+        const_iterator(const iterator &it) : Base(it.get_map(), it.get_pos(), it.get_begin(), it.get_version()) {}
+        const_iterator() : Base() {}
+
+      private:
+        const_iterator(const btree_range_map *map, const Position &pos) : Base(map, pos) {}
+    };
+
+    iterator begin() { return iterator(this, first()); }
+    const_iterator cbegin() const { return const_iterator(this, first()); }
+    const_iterator begin() const { return cbegin(); }
+    iterator end() { return iterator(this, Position()); }
+    const_iterator cend() const { return const_iterator(this, Position()); }
+    const_iterator end() const { return cend(); }
+
+    size_type size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void clear() {
+        blocks_.clear();
+        size_ = 0;
+        ++version_;
+    }
+
+    // Find entry with an exact key match
+    iterator find(const key_type &key) { return iterator(this, find_impl(key)); }
+    const_iterator find(const key_type &key) const { return const_iterator(this, find_impl(key)); }
+
+    iterator lower_bound(const key_type &key) { return iterator(this, lower_bound_impl(key)); }
+    const_iterator lower_bound(const key_type &key) const { return const_iterator(this, lower_bound_impl(key)); }
+
+    iterator upper_bound(const key_type &key) { return iterator(this, upper_bound_impl(key)); }
+    const_iterator upper_bound(const key_type &key) const { return const_iterator(this, upper_bound_impl(key)); }
+
+    iterator erase(const const_iterator &pos) {
+        RANGE_ASSERT(pos.get_map() == this);
+        return erase_impl(pos.resolve());
+    }
+    iterator erase(const iterator &pos) {
+        RANGE_ASSERT(pos.get_map() == this);
+        return erase_impl(pos.resolve());
+    }
+
+    // Must be called with rvalue or lvalue of value_type. As with std::map, an existing entry with the same key is kept.
+    template <typename Value>
+    std::pair<iterator, bool> emplace(Value &&value) {
+        const Position pos = lower_bound_impl(value.first);
+        if (!pos.at_end() && (get_key(pos) == value.first)) return std::make_pair(iterator(this, pos), false);
+        return std::make_pair(insert_impl(pos, std::forward<Value>(value)), true);
+    }
+
+    // A correct hint is the entry the new one goes before, which saves the binary searches
+    template <typename Value>
+    iterator emplace_hint(const const_iterator &hint, Value &&value) {
+        const auto &key = value.first;
+        const Position pos = hint.at_end() ? Position() : hint.resolve();
+        const Position before = prev(pos);
+        const bool hint_open = (pos.at_end() || (key < get_key(pos))) && (before.at_end() || (get_key(before) < key));
+        if (!hint_open) return emplace(std::forward<Value>(value)).first;
+        return insert_impl(pos, std::forward<Value>(value));
+    }
+    template <typename Value>
+    iterator emplace_hint(const iterator &hint, Value &&value) {
+        return emplace_hint(const_iterator(hint), std::forward<Value>(value));
+    }
+
+    iterator insert(const const_iterator &hint, const value_type &value) { return emplace_hint(hint, value); }
+    iterator insert(const iterator &hint, const value_type &value) { return emplace_hint(const_iterator(hint), value); }
+    std::pair<iterator, bool> insert(const value_type &value) { return emplace(value); }
+
+    btree_range_map() : size_(0), version_(0) {}
+    btree_range_map(const btree_range_map &other) : size_(0), version_(0) { copy_from(other); }
+    btree_range_map(btree_range_map &&other) : blocks_(std::move(other.blocks_)), size_(other.size_), version_(0) {
+        other.clear();
+    }
+    btree_range_map &operator=(const btree_range_map &other) {
+        if (this != &other) {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+    btree_range_map &operator=(btree_range_map &&other) {
+        if (this != &other) {
+            blocks_ = std::move(other.blocks_);
+            size_ = other.size_;
+            ++version_;
+            other.clear();
+        }
+        return *this;
+    }
+
+  private:
+    const key_type &get_key(const Position &pos) const { return blocks_[pos.block]->keys[pos.slot]; }
+    value_type *get_value(const Position &pos) { return blocks_[pos.block]->value(pos.slot); }
+    const value_type *get_value(const Position &pos) const { return blocks_[pos.block]->value(pos.slot); }
+
+    Position first() const { return blocks_.empty() ? Position() : Position(0, 0); }
+    Position next(const Position &pos) const {
+        if (pos.slot + 1 < blocks_[pos.block]->count) return Position(pos.block, pos.slot + 1);
+        if (pos.block + 1 < blocks_.size()) return Position(pos.block + 1, 0);
+        return Position();
+    }
+    // The entry before pos, where the entry before end() is the last, and the entry before the first is end()
+    Position prev(const Position &pos) const {
+        if (pos.at_end()) return blocks_.empty() ? Position() : Position(blocks_.size() - 1, blocks_.back()->count - 1);
+        if (pos.slot > 0) return Position(pos.block, pos.slot - 1);
+        if (pos.block > 0) return Position(pos.block - 1, blocks_[pos.block - 1]->count - 1);
+        return Position();
+    }
+
+    // The first block with a last key not less than key (for lower_bound) or greater than key (for upper_bound), as the
+    // entry sought is either in that block or is the block's first entry.
+    template <typename Compare>
+    size_t find_block(const key_type &key, Compare less_than_key) const {
+        const auto it = std::partition_point(blocks_.cbegin(), blocks_.cend(), [&key, &less_than_key](const BlockPtr &block) {
+            return less_than_key(block->last_key(), key);
+        });
+        return static_cast<size_t>(it - blocks_.cbegin());
+    }
+
+    Position lower_bound_impl(const key_type &key) const {
+        const size_t block = find_block(key, [](const key_type &lhs, const key_type &rhs) { return lhs < rhs; });
+        if (block == blocks_.size()) return Position();
+        const Block &b = *blocks_[block];
+        return Position(block, static_cast<size_t>(std::lower_bound(b.keys, b.keys + b.count, key) - b.keys));
+    }
+    Position upper_bound_impl(const key_type &key) const {
+        const size_t block = find_block(key, [](const key_type &lhs, const key_type &rhs) { return !(rhs < lhs); });
+        if (block == blocks_.size()) return Position();
+        const Block &b = *blocks_[block];
+        return Position(block, static_cast<size_t>(std::upper_bound(b.keys, b.keys + b.count, key) - b.keys));
+    }
+    Position find_impl(const key_type &key) const {
+        const Position pos = lower_bound_impl(key);
+        return (!pos.at_end() && (get_key(pos) == key)) ? pos : Position();
+    }
+    // The position of the entry starting at begin, or of the entry after where it was if it is gone
+    Position find_begin(const index_type &begin) const { return lower_bound_impl(key_type(begin, begin)); }
+
+    template <typename Value>
+    iterator insert_impl(Position pos, Value &&value) {
+        if (pos.at_end()) {
+            // Append to the last block, if it has room
+            if (blocks_.empty() || (blocks_.back()->count == kBlockCapacity)) {
+                blocks_.emplace_back(new Block());
+            }
+            pos = Position(blocks_.size() - 1, blocks_.back()->count);
+        } else if (blocks_[pos.block]->count == kBlockCapacity) {
+            // Split the full block, moving its upper half to a new block following it
+            const size_t half = kBlockCapacity / 2;
+            BlockPtr upper(new Block());
+            Block &lower = *blocks_[pos.block];
+            Block::move_values(*upper, 0, lower, half, kBlockCapacity - half);
+            upper->count = kBlockCapacity - half;
+            lower.count = half;
+            blocks_.insert(blocks_.begin() + pos.block + 1, std::move(upper));
+            if (pos.slot > half) {
+                pos = Position(pos.block + 1, pos.slot - half);
+            }
+        }
+
+        // Open a hole at pos by moving the subsequent values up one slot, from the top down
+        Block &block = *blocks_[pos.block];
+        for (size_t i = block.count; i > pos.slot; --i) {
+            Block::move_values(block, i, block, i - 1, 1);
+        }
+        block.keys[pos.slot] = value.first;
+        new (&block.values[pos.slot]) value_type(std::forward<Value>(value));
+        ++block.count;
+        ++size_;
+        ++version_;
+        return iterator(this, pos);
+    }
+
+    iterator erase_impl(const Position &pos) {
+        Block &block = *blocks_[pos.block];
+        block.value(pos.slot)->~value_type();
+        // Close the hole at pos by moving the subsequent values down one slot
+        for (size_t i = pos.slot + 1; i < block.count; ++i) {
+            Block::move_values(block, i - 1, block, i, 1);
+        }
+        --block.count;
+        --size_;
+        ++version_;
+
+        Position following = (pos.slot < block.count) ? pos : Position(pos.block + 1, 0);
+        if (block.count == 0) {
+            blocks_.erase(blocks_.begin() + pos.block);
+            following = Position(pos.block, 0);
+        } else if ((pos.block + 1 < blocks_.size()) && (block.count + blocks_[pos.block + 1]->count <= kBlockCapacity / 2)) {
+            // Merge sparse neighbors, so that erase heavy use doesn't leave a long list of nearly empty blocks
+            Block &next_block = *blocks_[pos.block + 1];
+            if (following.block == pos.block + 1) following = Position(pos.block, block.count);
+            Block::move_values(block, block.count, next_block, 0, next_block.count);
+            block.count += next_block.count;
+            next_block.count = 0;
+            blocks_.erase(blocks_.begin() + pos.block + 1);
+        }
+        if (following.block >= blocks_.size()) following = Position();
+        return iterator(this, following);  // the entry following the erased one, or end
+    }
+
+    void copy_from(const btree_range_map &other) {
+        blocks_.reserve(other.blocks_.size());
+        for (const auto &other_block : other.blocks_) {
+            BlockPtr block(new Block());
+            for (size_t i = 0; i < other_block->count; ++i) {
+                block->keys[i] = other_block->keys[i];
+                new (&block->values[i]) value_type(*other_block->value(i));
+                ++block->count;
+            }
+            blocks_.emplace_back(std::move(block));
+        }
+        size_ = other.size_;
+        ++version_;
+    }
+
+    template <typename Map_, typename Value_>
+    friend struct IteratorImpl;
+    using BlockPtr = std::unique_ptr<Block>;
+    std::vector<BlockPtr> blocks_;
+    size_t size_;
+    uint64_t version_;
+};
+
 // Forward index iterator, tracking an index value and the appropos lower bound
 // returns an index_type, lower_bound pair.  Supports ++,  offset, and seek affecting the index,
 // lower bound updates as needed. As the index may specify a range for which no entry exist, dereferenced
@@ -106,65 +106,67 @@ static shader_stage_attributes shader_stage_attribs[] = {
 unsigned ExecutionModelToShaderStageFlagBits(unsigned mode);
 
 // SPIRV utility functions
-void SHADER_MODULE_STATE::BuildDefIndex() {
-    for (auto insn : *this) {
-        switch (insn.opcode()) {
-            // Types
-            case spv::OpTypeVoid:
-            case spv::OpTypeBool:
-            case spv::OpTypeInt:
-            case spv::OpTypeFloat:
-            case spv::OpTypeVector:
-            case spv::OpTypeMatrix:
-            case spv::OpTypeImage:
-            case spv::OpTypeSampler:
-            case spv::OpTypeSampledImage:
-            case spv::OpTypeArray:
-            case spv::OpTypeRuntimeArray:
-            case spv::OpTypeStruct:
-            case spv::OpTypeOpaque:
-            case spv::OpTypePointer:
-            case spv::OpTypeFunction:
-            case spv::OpTypeEvent:
-            case spv::OpTypeDeviceEvent:
-            case spv::OpTypeReserveId:
-            case spv::OpTypeQueue:
-            case spv::OpTypePipe:
-            case spv::OpTypeAccelerationStructureNV:
-            case spv::OpTypeCooperativeMatrixNV:
-                def_index[insn.word(1)] = insn.offset();
-                break;
 
-                // Fixed constants
-            case spv::OpConstantTrue:
-            case spv::OpConstantFalse:
-            case spv::OpConstant:
-            case spv::OpConstantComposite:
-            case spv::OpConstantSampler:
-            case spv::OpConstantNull:
-                def_index[insn.word(2)] = insn.offset();
-                break;
-
-                // Specialization constants
-            case spv::OpSpecConstantTrue:
-            case spv::OpSpecConstantFalse:
-            case spv::OpSpecConstant:
-            case spv::OpSpecConstantComposite:
-            case spv::OpSpecConstantOp:
-                def_index[insn.word(2)] = insn.offset();
-                break;
+// The word holding the result <id> of the instructions recorded in the def index, or 0 for any other instruction
+static uint32_t DefIndexResultIdWord(uint32_t opcode) {
+    switch (opcode) {
+        // Types
+        case spv::OpTypeVoid:
+        case spv::OpTypeBool:
+        case spv::OpTypeInt:
+        case spv::OpTypeFloat:
+        case spv::OpTypeVector:
+        case spv::OpTypeMatrix:
+        case spv::OpTypeImage:
+        case spv::OpTypeSampler:
+        case spv::OpTypeSampledImage:
+        case spv::OpTypeArray:
+        case spv::OpTypeRuntimeArray:
+        case spv::OpTypeStruct:
+        case spv::OpTypeOpaque:
+        case spv::OpTypePointer:
+        case spv::OpTypeFunction:
+        case spv::OpTypeEvent:
+        case spv::OpTypeDeviceEvent:
+        case spv::OpTypeReserveId:
+        case spv::OpTypeQueue:
+        case spv::OpTypePipe:
+        case spv::OpTypeAccelerationStructureNV:
+        case spv::OpTypeCooperativeMatrixNV:
+            return 1;
 
-                // Variables
-            case spv::OpVariable:
-                def_index[insn.word(2)] = insn.offset();
-                break;
+            // Fixed constants
+        case spv::OpConstantTrue:
+        case spv::OpConstantFalse:
+        case spv::OpConstant:
+        case spv::OpConstantComposite:
+        case spv::OpConstantSampler:
+        case spv::OpConstantNull:
+            // Specialization constants
+        case spv::OpSpecConstantTrue:
+        case spv::OpSpecConstantFalse:
+        case spv::OpSpecConstant:
+        case spv::OpSpecConstantComposite:
+        case spv::OpSpecConstantOp:
+            // Variables
+        case spv::OpVariable:
+            // Functions
+        case spv::OpFunction:
+            return 2;
 
-                // Functions
-            case spv::OpFunction:
-                def_index[insn.word(2)] = insn.offset();
-                break;
+        default:
+            // We don't care about any other defs for now.
+            return 0;
+    }
+}
 
-                // Decorations
+void SHADER_MODULE_STATE::BuildDefIndex() {
+    auto &def_index = static_data->def_index;
+    auto &decorations = static_data->decorations;
+    auto &entry_points = static_data->entry_points;
+    for (auto insn : *this) {
+        switch (insn.opcode()) {
+            // Decorations
             case spv::OpDecorate: {
                 auto targetId = insn.word(1);
                 decorations[targetId].add(insn.word(2), insn.len() > 3u ? insn.word(3) : 0u);
@@ -184,10 +186,109 @@ void SHADER_MODULE_STATE::BuildDefIndex() {
                 break;
             }
 
-            default:
-                // We don't care about any other defs for now.
+            default: {
+                const uint32_t result_word = DefIndexResultIdWord(insn.opcode());
+                if (result_word) def_index[insn.word(result_word)] = insn.offset();
+            } break;
+        }
+    }
+}
+
+bool SHADER_MODULE_STATE::IsInstructionOffset(uint32_t offset) const {
+    if ((offset < 5) || (offset >= words.size())) return false;
+    const uint32_t len = words[offset] >> 16;
+    return (len != 0) && (len <= words.size() - offset);
+}
+
+bool SHADER_MODULE_STATE::AdoptParseResults(const StaticData &serialized_data) {
+    // The offsets are the only data used to index into the words. Each has to be the start of an instruction that defines the
+    // id, or for entry points the start of an OpEntryPoint of the stage and name.
+    for (const auto &def : serialized_data.def_index) {
+        if (!IsInstructionOffset(def.second)) return false;
+        const auto insn = at(def.second);
+        const uint32_t result_word = DefIndexResultIdWord(insn.opcode());
+        if (!result_word || (result_word >= insn.len()) || (insn.word(result_word) != def.first)) return false;
+    }
+    for (const auto &entry_point : serialized_data.entry_points) {
+        const auto &name = entry_point.first;
+        if (!IsInstructionOffset(entry_point.second.offset)) return false;
+        const auto insn = at(entry_point.second.offset);
+        if ((insn.opcode() != spv::OpEntryPoint) || (insn.len() <= 3) ||
+            (ExecutionModelToShaderStageFlagBits(insn.word(1)) != entry_point.second.stage)) {
+            return false;
+        }
+        const size_t max_name_size = (insn.len() - 3) * sizeof(uint32_t);
+        const char *insn_name = reinterpret_cast<const char *>(&insn.word(3));
+        if ((name.size() >= max_name_size) || (memcmp(insn_name, name.data(), name.size()) != 0) || insn_name[name.size()]) {
+            return false;
+        }
+    }
+
+    static_data->def_index = serialized_data.def_index;
+    static_data->decorations = serialized_data.decorations;
+    static_data->entry_points = serialized_data.entry_points;
+    static_data->has_specialization_constants = serialized_data.has_specialization_constants;
+    has_specialization_constants = serialized_data.has_specialization_constants;
+    return true;
+}
+
+std::shared_ptr<const SHADER_MODULE_STATE::EntryPointResources> SHADER_MODULE_STATE::GetEntryPointResources(
+    spirv_inst_iter entrypoint) const {
+    const uint32_t offset = entrypoint.offset();
+    {
+        std::lock_guard<std::mutex> lock(static_data->entry_point_lock);
+        auto it = static_data->entry_point_resources.find(offset);
+        if (it != static_data->entry_point_resources.end()) return it->second;
+    }
+
+    // Computed outside of the lock, if two threads race here the first result stored is the one kept
+    auto resources = std::make_shared<EntryPointResources>();
+    resources->accessible_ids = MarkAccessibleIds(this, entrypoint);
+    resources->descriptor_uses = CollectInterfaceByDescriptorSlot(this, resources->accessible_ids,
+                                                                  &resources->has_writable_descriptor,
+                                                                  &resources->has_atomic_descriptor);
+
+    std::lock_guard<std::mutex> lock(static_data->entry_point_lock);
+    return static_data->entry_point_resources.emplace(offset, std::move(resources)).first->second;
+}
+
+void SHADER_MODULE_STATE::AdoptEntryPointResources(const StaticData &serialized_data) {
+    for (const auto &entry : serialized_data.entry_point_resources) {
+        const uint32_t offset = entry.first;
+        const auto &resources = *entry.second;
+
+        // The key has to be the offset of one of this module's OpEntryPoint instructions, and the entrypoint's function one of
+        // the ids accessible from it
+        bool consistent = false;
+        for (const auto &entry_point : static_data->entry_points) {
+            if (entry_point.second.offset == offset) {
+                consistent = resources.accessible_ids.count(at(offset).word(2)) != 0;
+                break;
+            }
+        }
+
+        // Every id has to be defined by the module, and each descriptor use has to match the variable's declaration
+        for (auto id : resources.accessible_ids) {
+            if (!consistent) break;
+            consistent = (get_def(id) != end());
+        }
+        for (const auto &use : resources.descriptor_uses) {
+            if (!consistent) break;
+            const auto &var = use.second;
+            auto insn = get_def(var.id);
+            if (!resources.accessible_ids.count(var.id) || (insn == end()) || (insn.opcode() != spv::OpVariable) ||
+                (insn.word(1) != var.type_id)) {
+                consistent = false;
                 break;
+            }
+            const auto d = get_decorations(var.id);
+            const int32_t input_index =
+                (d.flags & decoration_set::input_attachment_index_bit) ? static_cast<int32_t>(d.input_attachment_index) : -1;
+            consistent =
+                (use.first.first == d.descriptor_set) && (use.first.second == d.binding) && (var.input_index == input_index);
         }
+
+        if (consistent) static_data->entry_point_resources.emplace(offset, entry.second);
     }
 }
 
@@ -227,7 +328,7 @@ unsigned ExecutionModelToShaderStageFlagBits(unsigned mode) {
 }
 
 spirv_inst_iter FindEntrypoint(SHADER_MODULE_STATE const *src, char const *name, VkShaderStageFlagBits stageBits) {
-    auto range = src->entry_points.equal_range(name);
+    auto range = src->static_data->entry_points.equal_range(name);
     for (auto it = range.first; it != range.second; ++it) {
         if (it->second.stage == stageBits) {
             return src->at(it->second.offset);
@@ -3598,9 +3699,345 @@ bool CoreChecks::ValidateRayTracingPipeline(PIPELINE_STATE *pipeline, bool isKHR
     return skip;
 }
 
-uint32_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH32(smci->pCode, smci->codeSize, 0); }
+uint64_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci, spv_target_env env) {
+    return XXH64(smci->pCode, smci->codeSize, static_cast<uint64_t>(env));
+}
+
+// The data following the VkValidationCacheEXT header is a sequence of 32-bit words: kDataMagic, kDataVersion, an entry count,
+// then for each entry the shader hash, its flags, the size and checksum of its payload and the payload itself. The payload holds
+// the entrypoint resources, keyed by OpEntryPoint offset, then the parse flags and, unless preprocessing changed the code, the
+// def index, decorations and entry points. Every offset into the module's words is checked against the module's own code
+// before use, see SHADER_MODULE_STATE::AdoptParseResults.
+enum ValidationCacheEntryFlagBits : uint32_t {
+    kValidationCacheEntryValidated = 1 << 0,
+    kValidationCacheEntryStaticData = 1 << 1,
+};
+
+enum ValidationCacheParseFlagBits : uint32_t {
+    kValidationCacheParsePreprocessed = 1 << 0,
+    kValidationCacheParseSpecializationConstants = 1 << 1,
+};
+
+class ValidationCacheWriter {
+  public:
+    explicit ValidationCacheWriter(std::vector<uint32_t> &out) : out_(out) {}
+
+    void Word(uint32_t value) { out_.push_back(value); }
+    void Word64(uint64_t value) {
+        Word(static_cast<uint32_t>(value));
+        Word(static_cast<uint32_t>(value >> 32));
+    }
+    void Count(size_t count) { Word(static_cast<uint32_t>(count)); }
+    void Words(const std::vector<uint32_t> &words) {
+        Count(words.size());
+        out_.insert(out_.end(), words.begin(), words.end());
+    }
+    void String(const std::string &str) {
+        Count(str.size());
+        const size_t first = out_.size();
+        out_.resize(first + (str.size() + sizeof(uint32_t) - 1) / sizeof(uint32_t), 0);
+        if (!str.empty()) memcpy(&out_[first], str.data(), str.size());
+    }
+
+  private:
+    std::vector<uint32_t> &out_;
+};
+
+// Reads back what ValidationCacheWriter wrote. Every read is bounds checked, as the data comes from the application.
+class ValidationCacheReader {
+  public:
+    ValidationCacheReader(const uint8_t *data, size_t size) : data_(data), size_(size), pos_(0) {}
+
+    bool Word(uint32_t *value) {
+        if (size_ - pos_ < sizeof(uint32_t)) return false;
+        memcpy(value, data_ + pos_, sizeof(uint32_t));
+        pos_ += sizeof(uint32_t);
+        return true;
+    }
+    bool Word64(uint64_t *value) {
+        uint32_t low, high;
+        if (!Word(&low) || !Word(&high)) return false;
+        *value = (static_cast<uint64_t>(high) << 32) | low;
+        return true;
+    }
+    // Reads an element count, rejecting counts that could not possibly fit in the remaining data
+    bool Count(uint32_t *count, size_t words_per_element) {
+        return Word(count) && (static_cast<uint64_t>(*count) * words_per_element * sizeof(uint32_t) <= size_ - pos_);
+    }
+    bool Words(std::vector<uint32_t> *words) {
+        uint32_t count;
+        if (!Count(&count, 1)) return false;
+        words->resize(count);
+        if (count) memcpy(words->data(), data_ + pos_, count * sizeof(uint32_t));
+        pos_ += count * sizeof(uint32_t);
+        return true;
+    }
+    bool String(std::string *str) {
+        uint32_t length;
+        if (!Word(&length)) return false;
+        const size_t padded_length = (static_cast<size_t>(length) + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+        if (padded_length > size_ - pos_) return false;
+        str->assign(reinterpret_cast<const char *>(data_ + pos_), length);
+        pos_ += padded_length;
+        return true;
+    }
+    bool Skip(size_t bytes) {
+        if (bytes > size_ - pos_) return false;
+        pos_ += bytes;
+        return true;
+    }
+    const uint8_t *Position() const { return data_ + pos_; }
+
+  private:
+    const uint8_t *data_;
+    size_t size_;
+    size_t pos_;
+};
+
+static void WriteShaderStaticData(ValidationCacheWriter &writer, const SHADER_MODULE_STATE::StaticData &static_data) {
+    std::lock_guard<std::mutex> lock(static_data.entry_point_lock);
+    writer.Count(static_data.entry_point_resources.size());
+    for (const auto &entry : static_data.entry_point_resources) {
+        const auto &resources = *entry.second;
+        writer.Word(entry.first);
+        writer.Word((resources.has_writable_descriptor ? 1 : 0) | (resources.has_atomic_descriptor ? 2 : 0));
+        writer.Count(resources.accessible_ids.size());
+        for (auto id : resources.accessible_ids) writer.Word(id);
+        writer.Count(resources.descriptor_uses.size());
+        for (const auto &use : resources.descriptor_uses) {
+            const auto &var = use.second;
+            writer.Word(use.first.first);
+            writer.Word(use.first.second);
+            writer.Word(var.id);
+            writer.Word(var.type_id);
+            writer.Word(var.offset);
+            writer.Word(static_cast<uint32_t>(var.input_index));
+            writer.Word((var.is_patch ? 1 : 0) | (var.is_block_member ? 2 : 0) | (var.is_relaxed_precision ? 4 : 0) |
+                        (var.is_writable ? 8 : 0) | (var.is_atomic_operation ? 16 : 0));
+        }
+    }
+
+    writer.Word((static_data.preprocessed ? kValidationCacheParsePreprocessed : 0) |
+                (static_data.has_specialization_constants ? kValidationCacheParseSpecializationConstants : 0));
+    // The offsets of preprocessed code would not index the application's code, which is all a later run has
+    if (static_data.preprocessed) return;
+    writer.Count(static_data.def_index.size());
+    for (const auto &def : static_data.def_index) {
+        writer.Word(def.first);
+        writer.Word(def.second);
+    }
+    writer.Count(static_data.decorations.size());
+    for (const auto &decoration : static_data.decorations) {
+        const auto &d = decoration.second;
+        writer.Word(decoration.first);
+        writer.Word(d.flags);
+        writer.Word(d.location);
+        writer.Word(d.component);
+        writer.Word(d.input_attachment_index);
+        writer.Word(d.descriptor_set);
+        writer.Word(d.binding);
+        writer.Word(d.builtin);
+    }
+    writer.Count(static_data.entry_points.size());
+    for (const auto &entry_point : static_data.entry_points) {
+        writer.String(entry_point.first);
+        writer.Word(entry_point.second.offset);
+        writer.Word(entry_point.second.stage);
+    }
+}
+
+static bool ReadShaderStaticData(ValidationCacheReader &reader, SHADER_MODULE_STATE::StaticData *static_data) {
+    uint32_t count;
+    static_data->serialized = true;
+    if (!reader.Count(&count, 4)) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t offset, flags, id_count, use_count;
+        auto resources = std::make_shared<SHADER_MODULE_STATE::EntryPointResources>();
+        if (!reader.Word(&offset) || !reader.Word(&flags) || !reader.Count(&id_count, 1)) return false;
+        resources->has_writable_descriptor = (flags & 1) != 0;
+        resources->has_atomic_descriptor = (flags & 2) != 0;
+        resources->accessible_ids.reserve(id_count);
+        for (uint32_t j = 0; j < id_count; j++) {
+            uint32_t id;
+            if (!reader.Word(&id)) return false;
+            resources->accessible_ids.insert(id);
+        }
+        if (!reader.Count(&use_count, 7)) return false;
+        resources->descriptor_uses.reserve(use_count);
+        for (uint32_t j = 0; j < use_count; j++) {
+            uint32_t set, binding, input_index, var_flags;
+            interface_var var;
+            if (!reader.Word(&set) || !reader.Word(&binding) || !reader.Word(&var.id) || !reader.Word(&var.type_id) ||
+                !reader.Word(&var.offset) || !reader.Word(&input_index) || !reader.Word(&var_flags)) {
+                return false;
+            }
+            var.input_index = static_cast<int32_t>(input_index);
+            var.is_patch = (var_flags & 1) != 0;
+            var.is_block_member = (var_flags & 2) != 0;
+            var.is_relaxed_precision = (var_flags & 4) != 0;
+            var.is_writable = (var_flags & 8) != 0;
+            var.is_atomic_operation = (var_flags & 16) != 0;
+            resources->descriptor_uses.emplace_back(descriptor_slot_t(set, binding), var);
+        }
+        static_data->entry_point_resources.emplace(offset, std::move(resources));
+    }
+
+    uint32_t parse_flags;
+    if (!reader.Word(&parse_flags)) return false;
+    static_data->preprocessed = (parse_flags & kValidationCacheParsePreprocessed) != 0;
+    static_data->has_specialization_constants = (parse_flags & kValidationCacheParseSpecializationConstants) != 0;
+    if (static_data->preprocessed) return true;
+
+    if (!reader.Count(&count, 2)) return false;
+    static_data->def_index.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t id, offset;
+        if (!reader.Word(&id) || !reader.Word(&offset)) return false;
+        static_data->def_index[id] = offset;
+    }
+    if (!reader.Count(&count, 8)) return false;
+    static_data->decorations.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t id;
+        decoration_set d;
+        if (!reader.Word(&id) || !reader.Word(&d.flags) || !reader.Word(&d.location) || !reader.Word(&d.component) ||
+            !reader.Word(&d.input_attachment_index) || !reader.Word(&d.descriptor_set) || !reader.Word(&d.binding) ||
+            !reader.Word(&d.builtin)) {
+            return false;
+        }
+        static_data->decorations[id] = d;
+    }
+    if (!reader.Count(&count, 3)) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        std::string name;
+        SHADER_MODULE_STATE::EntryPoint entry_point;
+        uint32_t stage;
+        if (!reader.String(&name) || !reader.Word(&entry_point.offset) || !reader.Word(&stage)) return false;
+        entry_point.stage = stage;
+        static_data->entry_points.emplace(std::move(name), entry_point);
+    }
+    return true;
+}
+
+void ValidationCache::Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
+    const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
+    auto size = headerSize;
+    if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
+
+    uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
+    if (data[0] != size) return;
+    if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
+    uint8_t expected_uuid[VK_UUID_SIZE];
+    Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
+    if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
+
+    ValidationCacheReader reader(reinterpret_cast<uint8_t const *>(data) + headerSize, pCreateInfo->initialDataSize - headerSize);
+    uint32_t magic, version, entry_count;
+    if (!reader.Word(&magic) || (magic != kDataMagic) || !reader.Word(&version) || (version != kDataVersion) ||
+        !reader.Word(&entry_count)) {
+        return;  // Written by a different version of the layer
+    }
 
-static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
+    for (uint32_t i = 0; i < entry_count; i++) {
+        uint64_t hash, checksum;
+        uint32_t flags, payload_size;
+        if (!reader.Word64(&hash) || !reader.Word(&flags) || !reader.Word(&payload_size) || !reader.Word64(&checksum)) return;
+        const uint8_t *payload = reader.Position();
+        if (!reader.Skip(payload_size * sizeof(uint32_t))) return;
+        // Drop corrupted entries, the remaining ones are still usable
+        if (XXH64(payload, payload_size * sizeof(uint32_t), 0) != checksum) continue;
+
+        if (flags & kValidationCacheEntryValidated) good_shader_hashes.insert(hash);
+        if (flags & kValidationCacheEntryStaticData) {
+            auto static_data = std::make_shared<SHADER_MODULE_STATE::StaticData>();
+            ValidationCacheReader payload_reader(payload, payload_size * sizeof(uint32_t));
+            if (ReadShaderStaticData(payload_reader, static_data.get())) {
+                shader_static_data.emplace(hash, std::move(static_data));
+            }
+        }
+    }
+}
+
+void ValidationCache::Write(size_t *pDataSize, void *pData) {
+    const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
+
+    // Serialize every entry up front, remembering where each one ends so that a short buffer still receives whole entries
+    std::vector<uint32_t> entries;
+    std::vector<size_t> entry_ends;
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        std::unordered_set<uint64_t> hashes(good_shader_hashes);
+        for (const auto &entry : shader_static_data) hashes.insert(entry.first);
+
+        ValidationCacheWriter writer(entries);
+        std::vector<uint32_t> payload;
+        ValidationCacheWriter payload_writer(payload);
+        for (auto hash : hashes) {
+            uint32_t flags = 0;
+            payload.clear();
+            if (good_shader_hashes.count(hash)) flags |= kValidationCacheEntryValidated;
+            auto static_data = shader_static_data.find(hash);
+            if (static_data != shader_static_data.end()) {
+                flags |= kValidationCacheEntryStaticData;
+                WriteShaderStaticData(payload_writer, *static_data->second);
+            }
+            writer.Word64(hash);
+            writer.Word(flags);
+            writer.Count(payload.size());
+            writer.Word64(XXH64(payload.data(), payload.size() * sizeof(uint32_t), 0));
+            entries.insert(entries.end(), payload.begin(), payload.end());
+            entry_ends.push_back(entries.size());
+        }
+    }
+
+    const size_t prefix_size = 3 * sizeof(uint32_t);  // kDataMagic, kDataVersion and the entry count
+    if (!pData) {
+        *pDataSize = headerSize + prefix_size + entries.size() * sizeof(uint32_t);
+        return;
+    }
+
+    if (*pDataSize < headerSize) {
+        *pDataSize = 0;
+        return;  // Too small for even the header!
+    }
+
+    uint32_t *out = (uint32_t *)pData;
+    size_t actualSize = headerSize;
+
+    // Write the header
+    *out++ = headerSize;
+    *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
+    Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
+    out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
+
+    if (*pDataSize >= headerSize + prefix_size) {
+        size_t entry_count = 0;
+        while ((entry_count < entry_ends.size()) &&
+               (headerSize + prefix_size + entry_ends[entry_count] * sizeof(uint32_t) <= *pDataSize)) {
+            entry_count++;
+        }
+        const size_t entry_words = entry_count ? entry_ends[entry_count - 1] : 0;
+        *out++ = kDataMagic;
+        *out++ = kDataVersion;
+        *out++ = static_cast<uint32_t>(entry_count);
+        if (entry_words) memcpy(out, entries.data(), entry_words * sizeof(uint32_t));
+        actualSize += prefix_size + entry_words * sizeof(uint32_t);
+    }
+
+    *pDataSize = actualSize;
+}
+
+void ValidationCache::Merge(ValidationCache const *other) {
+    if (other == this) return;
+    std::unique_lock<std::mutex> dst_lock(lock_, std::defer_lock);
+    std::unique_lock<std::mutex> src_lock(other->lock_, std::defer_lock);
+    std::lock(dst_lock, src_lock);
+    good_shader_hashes.reserve(good_shader_hashes.size() + other->good_shader_hashes.size());
+    for (auto h : other->good_shader_hashes) good_shader_hashes.insert(h);
+    for (const auto &entry : other->shader_static_data) shader_static_data.emplace(entry.first, entry.second);
+}
+
+ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
     const auto validation_cache_ci = lvl_find_in_chain<VkShaderModuleValidationCacheCreateInfoEXT>(pCreateInfo->pNext);
     if (validation_cache_ci) {
         return CastFromHandle<ValidationCache *>(validation_cache_ci->validationCache);
@@ -3624,16 +4061,16 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
                          "SPIR-V module not valid: Codesize must be a multiple of 4 but is " PRINTF_SIZE_T_SPECIFIER ".",
                          pCreateInfo->codeSize);
     } else {
+        spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
         auto cache = GetValidationCacheInfo(pCreateInfo);
-        uint32_t hash = 0;
+        uint64_t hash = 0;
         if (cache) {
-            hash = ValidationCache::MakeShaderHash(pCreateInfo);
+            hash = ValidationCache::MakeShaderHash(pCreateInfo, spirv_environment);
             if (cache->Contains(hash)) return false;
         }
 
         // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
         // the default values will be used during validation.
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
         spv_context ctx = spvContextCreate(spirv_environment);
         spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
         spv_diagnostic diag = nullptr;
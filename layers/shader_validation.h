@@ -23,6 +23,8 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -121,17 +123,44 @@ struct decoration_set {
 };
 
 struct SHADER_MODULE_STATE : public BASE_NODE {
-    // The spirv image itself
-    std::vector<uint32_t> words;
-    // A mapping of <id> to the first word of its def. this is useful because walking type
-    // trees, constant expressions, etc requires jumping all over the instruction stream.
-    std::unordered_map<unsigned, unsigned> def_index;
-    std::unordered_map<unsigned, decoration_set> decorations;
     struct EntryPoint {
         uint32_t offset;
         VkShaderStageFlags stage;
     };
-    std::unordered_multimap<std::string, EntryPoint> entry_points;
+    // Resources reachable from the static call tree of an entrypoint. These depend only on the module and the entrypoint, not
+    // on the pipeline, so they are computed once and shared by every pipeline stage using the entrypoint.
+    struct EntryPointResources {
+        std::unordered_set<uint32_t> accessible_ids;
+        std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
+        bool has_writable_descriptor = false;
+        bool has_atomic_descriptor = false;
+    };
+    // Everything derived from parsing the spirv. Modules created from identical code through a VkValidationCacheEXT share a
+    // single copy, which the cache can also serialize so that it survives across runs.
+    struct StaticData {
+        // The preprocessed spirv image, only stored when preprocessing changed the module's code.
+        std::vector<uint32_t> preprocessed_words;
+        // Whether preprocessing changed the module's code, in which case the offsets below index preprocessed_words
+        bool preprocessed{false};
+        // A mapping of <id> to the first word of its def. this is useful because walking type
+        // trees, constant expressions, etc requires jumping all over the instruction stream.
+        std::unordered_map<unsigned, unsigned> def_index;
+        std::unordered_map<unsigned, decoration_set> decorations;
+        std::unordered_multimap<std::string, EntryPoint> entry_points;
+        bool has_specialization_constants{false};
+        // Set on data read back from the application supplied VkValidationCacheEXT initial data. The first module with matching
+        // code adopts the def index, decorations and entry points once their offsets check out against its words, and then the
+        // entrypoint resources that are consistent with them. See SHADER_MODULE_STATE::AdoptParseResults and
+        // AdoptEntryPointResources.
+        bool serialized{false};
+        // Keyed by the offset of the OpEntryPoint instruction and filled in on first use, so guarded by entry_point_lock.
+        mutable std::mutex entry_point_lock;
+        mutable std::unordered_map<uint32_t, std::shared_ptr<const EntryPointResources>> entry_point_resources;
+    };
+
+    // The spirv image itself
+    std::vector<uint32_t> words;
+    std::shared_ptr<StaticData> static_data;
     bool has_valid_spirv;
     bool has_specialization_constants{false};
     VkShaderModule vk_shader_module;
@@ -181,6 +210,8 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
             auto result =
                 optimizer.Run(src_binary, binary_size / sizeof(uint32_t), &optimized_binary, spvtools::ValidatorOptions(), true);
             if (result) {
+                static_data->preprocessed = true;
+                static_data->preprocessed_words = optimized_binary;
                 return optimized_binary;
             }
         }
@@ -188,19 +219,50 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         return src;
     }
 
+    // If cached_data is set it holds the results of parsing identical code earlier, and the module is not parsed again.
     SHADER_MODULE_STATE(VkShaderModuleCreateInfo const *pCreateInfo, VkShaderModule shaderModule, spv_target_env env,
-                        uint32_t unique_shader_id)
-        : words(), def_index(), has_valid_spirv(true), vk_shader_module(shaderModule), gpu_validation_shader_id(unique_shader_id) {
-        words = PreprocessShaderBinary((uint32_t *)pCreateInfo->pCode, pCreateInfo->codeSize, env);
-        BuildDefIndex();
+                        uint32_t unique_shader_id, std::shared_ptr<StaticData> cached_data = nullptr)
+        : words(),
+          static_data(std::move(cached_data)),
+          has_valid_spirv(true),
+          vk_shader_module(shaderModule),
+          gpu_validation_shader_id(unique_shader_id) {
+        if (static_data && static_data->serialized) {
+            const auto serialized_data = std::move(static_data);
+            static_data = std::make_shared<StaticData>();
+            // Unless preprocessing changed the code, the serialized parse results index pCode as is and replace parsing it
+            words.assign(pCreateInfo->pCode, pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t));
+            if (serialized_data->preprocessed || !AdoptParseResults(*serialized_data)) {
+                words = PreprocessShaderBinary((uint32_t *)pCreateInfo->pCode, pCreateInfo->codeSize, env);
+                static_data->has_specialization_constants = has_specialization_constants;
+                BuildDefIndex();
+            }
+            AdoptEntryPointResources(*serialized_data);
+        } else if (static_data) {
+            if (static_data->preprocessed_words.empty()) {
+                words.assign(pCreateInfo->pCode, pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t));
+            } else {
+                words = static_data->preprocessed_words;
+            }
+            has_specialization_constants = static_data->has_specialization_constants;
+        } else {
+            static_data = std::make_shared<StaticData>();
+            words = PreprocessShaderBinary((uint32_t *)pCreateInfo->pCode, pCreateInfo->codeSize, env);
+            static_data->has_specialization_constants = has_specialization_constants;
+            BuildDefIndex();
+        }
     }
 
-    SHADER_MODULE_STATE() : has_valid_spirv(false), vk_shader_module(VK_NULL_HANDLE), gpu_validation_shader_id(UINT32_MAX) {}
+    SHADER_MODULE_STATE()
+        : static_data(std::make_shared<StaticData>()),
+          has_valid_spirv(false),
+          vk_shader_module(VK_NULL_HANDLE),
+          gpu_validation_shader_id(UINT32_MAX) {}
 
     decoration_set get_decorations(unsigned id) const {
         // return the actual decorations for this id, or a default set.
-        auto it = decorations.find(id);
-        if (it != decorations.end()) return it->second;
+        auto it = static_data->decorations.find(id);
+        if (it != static_data->decorations.end()) return it->second;
         return decoration_set();
     }
 
@@ -212,22 +274,36 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(unsigned id) const {
-        auto it = def_index.find(id);
-        if (it == def_index.end()) {
+        auto it = static_data->def_index.find(id);
+        if (it == static_data->def_index.end()) {
             return end();
         }
         return at(it->second);
     }
 
+    // Returns the resources used by the entrypoint, computing them if this is the first request for them
+    std::shared_ptr<const EntryPointResources> GetEntryPointResources(spirv_inst_iter entrypoint) const;
+
     void BuildDefIndex();
+    // Whether offset is the start of an instruction that lies entirely within the module
+    bool IsInstructionOffset(uint32_t offset) const;
+    // Takes the def index, decorations and entry points of serialized cache data in place of BuildDefIndex, if every offset in
+    // them points at the matching instruction of this module's words. Returns false, adopting nothing, otherwise.
+    bool AdoptParseResults(const StaticData &serialized_data);
+    // Takes the entrypoint resources of serialized cache data that are consistent with this module's parsed code
+    void AdoptEntryPointResources(const StaticData &serialized_data);
 };
 
 class ValidationCache {
-    // hashes of shaders that have passed validation before, and can be skipped.
+    // Shaders that have passed validation before, and can be skipped.
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
-    std::unordered_set<uint32_t> good_shader_hashes;
+    std::unordered_set<uint64_t> good_shader_hashes;
+    // Parsed shader modules, which do not depend on the module passing validation
+    std::unordered_map<uint64_t, std::shared_ptr<SHADER_MODULE_STATE::StaticData>> shader_static_data;
+    // Shader module creation may happen on any thread
+    mutable std::mutex lock_;
     ValidationCache() {}
 
   public:
@@ -237,66 +313,43 @@ class ValidationCache {
         return VkValidationCacheEXT(cache);
     }
 
-    void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-        auto size = headerSize;
-        if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
-
-        uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-        if (data[0] != size) return;
-        if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
-        uint8_t expected_uuid[VK_UUID_SIZE];
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
-        if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
-
-        data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
-
-        for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-            good_shader_hashes.insert(*data);
-        }
-    }
-
-    void Write(size_t *pDataSize, void *pData) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
-        if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes.size() * sizeof(uint32_t);
-            return;
-        }
+    void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo);
 
-        if (*pDataSize < headerSize) {
-            *pDataSize = 0;
-            return;  // Too small for even the header!
-        }
+    void Write(size_t *pDataSize, void *pData);
 
-        uint32_t *out = (uint32_t *)pData;
-        size_t actualSize = headerSize;
+    void Merge(ValidationCache const *other);
 
-        // Write the header
-        *out++ = headerSize;
-        *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
-        out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
+    // The module is validated and preprocessed for a given SPIR-V environment, so that is part of the key
+    static uint64_t MakeShaderHash(VkShaderModuleCreateInfo const *smci, spv_target_env env);
 
-        for (auto it = good_shader_hashes.begin(); it != good_shader_hashes.end() && actualSize < *pDataSize;
-             it++, out++, actualSize += sizeof(uint32_t)) {
-            *out = *it;
-        }
-
-        *pDataSize = actualSize;
+    bool Contains(uint64_t hash) {
+        std::lock_guard<std::mutex> lock(lock_);
+        return good_shader_hashes.count(hash) != 0;
     }
 
-    void Merge(ValidationCache const *other) {
-        good_shader_hashes.reserve(good_shader_hashes.size() + other->good_shader_hashes.size());
-        for (auto h : other->good_shader_hashes) good_shader_hashes.insert(h);
+    void Insert(uint64_t hash) {
+        std::lock_guard<std::mutex> lock(lock_);
+        good_shader_hashes.insert(hash);
     }
 
-    static uint32_t MakeShaderHash(VkShaderModuleCreateInfo const *smci);
-
-    bool Contains(uint32_t hash) { return good_shader_hashes.count(hash) != 0; }
+    std::shared_ptr<SHADER_MODULE_STATE::StaticData> GetStaticData(uint64_t hash) {
+        std::lock_guard<std::mutex> lock(lock_);
+        auto it = shader_static_data.find(hash);
+        return (it != shader_static_data.end()) ? it->second : nullptr;
+    }
 
-    void Insert(uint32_t hash) { good_shader_hashes.insert(hash); }
+    void InsertStaticData(uint64_t hash, const std::shared_ptr<SHADER_MODULE_STATE::StaticData> &static_data) {
+        std::lock_guard<std::mutex> lock(lock_);
+        auto result = shader_static_data.emplace(hash, static_data);
+        // Replace serialized data once a module has parsed the code and adopted what it could of it
+        if (!result.second && result.first->second->serialized) result.first->second = static_data;
+    }
 
   private:
+    // Bumped whenever the layout of the data following the VkValidationCacheEXT header changes
+    static const uint32_t kDataMagic = 0x43564c56;  // "VLVC"
+    static const uint32_t kDataVersion = 4;
+
     void Sha1ToVkUuid(const char *sha1_str, uint8_t *uuid) {
         // Convert sha1_str from a hex string to binary. We only need VK_UUID_SIZE bytes of
         // output, so pad with zeroes if the input string is shorter than that, and truncate
@@ -317,6 +370,8 @@ class ValidationCache {
     }
 };
 
+ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo);
+
 spirv_inst_iter FindEntrypoint(SHADER_MODULE_STATE const *src, char const *name, VkShaderStageFlagBits stageBits);
 
 // For some analyses, we need to know about all ids referenced by the static call tree of a particular entrypoint. This is
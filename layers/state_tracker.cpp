@@ -50,14 +50,65 @@ const char *CommandTypeString(CMD_TYPE type) {
     return command_name_list[type];
 }
 
+static bool IsStateTrackerObject(const ValidationObject *validation_object) {
+    switch (validation_object->container_type) {
+        case LayerObjectTypeCoreValidation:
+        case LayerObjectTypeBestPractices:
+        case LayerObjectTypeGpuAssisted:
+        case LayerObjectTypeDebugPrintf:
+        case LayerObjectTypeSyncValidation:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void ValidationStateTracker::InitDeviceValidationObject(bool add_obj, ValidationObject *inst_obj, ValidationObject *dev_obj) {
     if (add_obj) {
         instance_state = reinterpret_cast<ValidationStateTracker *>(GetValidationObject(inst_obj->object_dispatch, container_type));
+        if (inst_obj->enabled[shared_state_tracking]) {
+            // The trackers are added in dispatch order, so any tracker already present is the one recording the device state
+            for (auto *validation_object : dev_obj->object_dispatch) {
+                if (IsStateTrackerObject(validation_object)) {
+                    shared_state_source = static_cast<ValidationStateTracker *>(validation_object);
+                    shared_state_source->shared_state_readers.push_back(this);
+                    break;
+                }
+            }
+        }
         // Call base class
         ValidationObject::InitDeviceValidationObject(add_obj, inst_obj, dev_obj);
     }
 }
 
+read_lock_guard_t ValidationStateTracker::read_lock() {
+    if (shared_state_source) return shared_state_source->read_lock();
+    return ValidationObject::read_lock();
+}
+
+write_lock_guard_t ValidationStateTracker::write_lock() {
+    if (shared_state_source) return shared_state_source->write_lock();
+    return ValidationObject::write_lock();
+}
+
+CmdBufferLockGuard ValidationStateTracker::cmd_buffer_read_lock(VkCommandBuffer command_buffer) {
+    // Command buffer validation also reads the per command buffer state, so it is locked just as for recording
+    if (!fine_grained_locking_enabled) return ValidationObject::cmd_buffer_read_lock(command_buffer);
+    return cmd_buffer_write_lock(command_buffer);
+}
+
+CmdBufferLockGuard ValidationStateTracker::cmd_buffer_write_lock(VkCommandBuffer command_buffer) {
+    if (!fine_grained_locking_enabled) return ValidationObject::cmd_buffer_write_lock(command_buffer);
+    CmdBufferLockGuard guard;
+    // The state maps are only modified under the exclusive lock, so the command buffer lookup is safe once this is held
+    guard.object_shared_lock = SharedLockGuard(validation_object_mutex);
+    auto cb_state = GetCBState(command_buffer);
+    if (cb_state) {
+        guard.cmd_buffer_lock = std::unique_lock<std::mutex>(cb_state->recording_lock);
+    }
+    return guard;
+}
+
 uint32_t ResolveRemainingLevels(const VkImageSubresourceRange *range, uint32_t mip_levels) {
     // Return correct number of mip levels taking into account VK_REMAINING_MIP_LEVELS
     uint32_t mip_level_count = range->levelCount;
@@ -219,6 +270,7 @@ void ValidationStateTracker::RecordDestroySamplerYcbcrConversionANDROID(VkSample
 
 void ValidationStateTracker::PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(
     VkDevice device, const struct AHardwareBuffer *buffer, VkAndroidHardwareBufferPropertiesANDROID *pProperties, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto ahb_format_props = lvl_find_in_chain<VkAndroidHardwareBufferFormatPropertiesANDROID>(pProperties->pNext);
     if (ahb_format_props) {
@@ -289,6 +341,7 @@ void AddImageStateProps(IMAGE_STATE &image_state, const VkDevice device, const V
 
 void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator, VkImage *pImage, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto is_node = std::make_shared<IMAGE_STATE>(device, *pImage, pCreateInfo);
     is_node->disjoint = ((pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT) != 0);
@@ -335,10 +388,33 @@ void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const Vk
 
     is_node->unprotected = ((pCreateInfo->flags & VK_IMAGE_CREATE_PROTECTED_BIT) == 0);
 
+    AllocateImageLayoutSlot(is_node.get());
     imageMap.insert(std::make_pair(*pImage, std::move(is_node)));
 }
 
+void ValidationStateTracker::AllocateImageLayoutSlot(IMAGE_STATE *image_state) {
+    if (free_image_layout_slots.empty()) {
+        image_state->layout_slot = static_cast<uint32_t>(image_layout_slots.size());
+        image_layout_slots.push_back(image_state);
+    } else {
+        // Reuse the most recently released slot, keeping the slot range (and so the command buffer tables) dense
+        image_state->layout_slot = free_image_layout_slots.back();
+        free_image_layout_slots.pop_back();
+        image_layout_slots[image_state->layout_slot] = image_state;
+    }
+}
+
+void ValidationStateTracker::ReleaseImageLayoutSlot(IMAGE_STATE *image_state) {
+    const uint32_t slot = image_state->layout_slot;
+    if (slot >= image_layout_slots.size()) return;
+    assert(image_layout_slots[slot] == image_state);
+    image_layout_slots[slot] = nullptr;
+    free_image_layout_slots.push_back(slot);
+    image_state->layout_slot = kNoImageLayoutSlot;
+}
+
 void ValidationStateTracker::PreCallRecordDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!image) return;
     IMAGE_STATE *image_state = GetImageState(image);
     const VulkanTypedHandle obj_struct(image, kVulkanObjectTypeImage);
@@ -355,6 +431,7 @@ void ValidationStateTracker::PreCallRecordDestroyImage(VkDevice device, VkImage
     }
     RemoveAliasingImage(image_state);
     ClearMemoryObjectBindings(obj_struct);
+    ReleaseImageLayoutSlot(image_state);
     image_state->destroyed = true;
     // Remove image from imageMap
     imageMap.erase(image);
@@ -363,6 +440,7 @@ void ValidationStateTracker::PreCallRecordDestroyImage(VkDevice device, VkImage
 void ValidationStateTracker::PreCallRecordCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image,
                                                              VkImageLayout imageLayout, const VkClearColorValue *pColor,
                                                              uint32_t rangeCount, const VkImageSubresourceRange *pRanges) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto image_state = GetImageState(image);
     if (cb_node && image_state) {
@@ -374,6 +452,7 @@ void ValidationStateTracker::PreCallRecordCmdClearDepthStencilImage(VkCommandBuf
                                                                     VkImageLayout imageLayout,
                                                                     const VkClearDepthStencilValue *pDepthStencil,
                                                                     uint32_t rangeCount, const VkImageSubresourceRange *pRanges) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto image_state = GetImageState(image);
     if (cb_node && image_state) {
@@ -384,6 +463,7 @@ void ValidationStateTracker::PreCallRecordCmdClearDepthStencilImage(VkCommandBuf
 void ValidationStateTracker::PreCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage,
                                                        VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout,
                                                        uint32_t regionCount, const VkImageCopy *pRegions) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto src_image_state = GetImageState(srcImage);
     auto dst_image_state = GetImageState(dstImage);
@@ -397,6 +477,7 @@ void ValidationStateTracker::PreCallRecordCmdResolveImage(VkCommandBuffer comman
                                                           VkImageLayout srcImageLayout, VkImage dstImage,
                                                           VkImageLayout dstImageLayout, uint32_t regionCount,
                                                           const VkImageResolve *pRegions) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto src_image_state = GetImageState(srcImage);
     auto dst_image_state = GetImageState(dstImage);
@@ -409,6 +490,7 @@ void ValidationStateTracker::PreCallRecordCmdResolveImage(VkCommandBuffer comman
 void ValidationStateTracker::PreCallRecordCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage,
                                                        VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout,
                                                        uint32_t regionCount, const VkImageBlit *pRegions, VkFilter filter) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto src_image_state = GetImageState(srcImage);
     auto dst_image_state = GetImageState(dstImage);
@@ -421,6 +503,7 @@ void ValidationStateTracker::PreCallRecordCmdBlitImage(VkCommandBuffer commandBu
 void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
                                                         const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer,
                                                         VkResult result) {
+    if (shared_state_source) return;
     if (result != VK_SUCCESS) return;
     // TODO : This doesn't create deep copy of pQueueFamilyIndices so need to fix that if/when we want that data to be valid
     auto buffer_state = std::make_shared<BUFFER_STATE>(*pBuffer, pCreateInfo);
@@ -439,6 +522,7 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
 void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
                                                             const VkAllocationCallbacks *pAllocator, VkBufferView *pView,
                                                             VkResult result) {
+    if (shared_state_source) return;
     if (result != VK_SUCCESS) return;
     auto buffer_state = GetBufferShared(pCreateInfo->buffer);
     auto buffer_view_state = std::make_shared<BUFFER_VIEW_STATE>(buffer_state, *pView, pCreateInfo);
@@ -453,6 +537,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
                                                            const VkAllocationCallbacks *pAllocator, VkImageView *pView,
                                                            VkResult result) {
+    if (shared_state_source) return;
     if (result != VK_SUCCESS) return;
     auto image_state = GetImageShared(pCreateInfo->image);
     auto image_view_state = std::make_shared<IMAGE_VIEW_STATE>(image_state, *pView, pCreateInfo);
@@ -495,6 +580,7 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
 
 void ValidationStateTracker::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                                         uint32_t regionCount, const VkBufferCopy *pRegions) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto src_buffer_state = GetBufferState(srcBuffer);
     auto dst_buffer_state = GetBufferState(dstBuffer);
@@ -506,6 +592,7 @@ void ValidationStateTracker::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandB
 
 void ValidationStateTracker::PreCallRecordDestroyImageView(VkDevice device, VkImageView imageView,
                                                            const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     IMAGE_VIEW_STATE *image_view_state = GetImageViewState(imageView);
     if (!image_view_state) return;
     const VulkanTypedHandle obj_struct(imageView, kVulkanObjectTypeImageView);
@@ -517,6 +604,7 @@ void ValidationStateTracker::PreCallRecordDestroyImageView(VkDevice device, VkIm
 }
 
 void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!buffer) return;
     auto buffer_state = GetBufferState(buffer);
     const VulkanTypedHandle obj_struct(buffer, kVulkanObjectTypeBuffer);
@@ -532,6 +620,7 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
 
 void ValidationStateTracker::PreCallRecordDestroyBufferView(VkDevice device, VkBufferView bufferView,
                                                             const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!bufferView) return;
     auto buffer_view_state = GetBufferViewState(bufferView);
     const VulkanTypedHandle obj_struct(bufferView, kVulkanObjectTypeBufferView);
@@ -544,6 +633,7 @@ void ValidationStateTracker::PreCallRecordDestroyBufferView(VkDevice device, VkB
 
 void ValidationStateTracker::PreCallRecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                         VkDeviceSize size, uint32_t data) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto buffer_state = GetBufferState(dstBuffer);
     // Update bindings between buffer and cmd buffer
@@ -553,6 +643,7 @@ void ValidationStateTracker::PreCallRecordCmdFillBuffer(VkCommandBuffer commandB
 void ValidationStateTracker::PreCallRecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage,
                                                                VkImageLayout srcImageLayout, VkBuffer dstBuffer,
                                                                uint32_t regionCount, const VkBufferImageCopy *pRegions) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto src_image_state = GetImageState(srcImage);
     auto dst_buffer_state = GetBufferState(dstBuffer);
@@ -565,6 +656,7 @@ void ValidationStateTracker::PreCallRecordCmdCopyImageToBuffer(VkCommandBuffer c
 void ValidationStateTracker::PreCallRecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
                                                                VkImageLayout dstImageLayout, uint32_t regionCount,
                                                                const VkBufferImageCopy *pRegions) {
+    if (shared_state_source) return;
     auto cb_node = GetCBState(commandBuffer);
     auto src_buffer_state = GetBufferState(srcBuffer);
     auto dst_image_state = GetImageState(dstImage);
@@ -649,32 +741,36 @@ void ValidationStateTracker::RemoveAliasingImages(const std::unordered_set<VkIma
 }
 
 const EVENT_STATE *ValidationStateTracker::GetEventState(VkEvent event) const {
-    auto it = eventMap.find(event);
-    if (it == eventMap.end()) {
+    auto &event_map = StateOwner()->eventMap;
+    auto it = event_map.find(event);
+    if (it == event_map.end()) {
         return nullptr;
     }
     return &it->second;
 }
 
 EVENT_STATE *ValidationStateTracker::GetEventState(VkEvent event) {
-    auto it = eventMap.find(event);
-    if (it == eventMap.end()) {
+    auto &event_map = StateOwner()->eventMap;
+    auto it = event_map.find(event);
+    if (it == event_map.end()) {
         return nullptr;
     }
     return &it->second;
 }
 
 const QUEUE_STATE *ValidationStateTracker::GetQueueState(VkQueue queue) const {
-    auto it = queueMap.find(queue);
-    if (it == queueMap.cend()) {
+    auto &queue_map = StateOwner()->queueMap;
+    auto it = queue_map.find(queue);
+    if (it == queue_map.cend()) {
         return nullptr;
     }
     return &it->second;
 }
 
 QUEUE_STATE *ValidationStateTracker::GetQueueState(VkQueue queue) {
-    auto it = queueMap.find(queue);
-    if (it == queueMap.end()) {
+    auto &queue_map = StateOwner()->queueMap;
+    auto it = queue_map.find(queue);
+    if (it == queue_map.end()) {
         return nullptr;
     }
     return &it->second;
@@ -1035,6 +1131,15 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, CMD_TYP
     if (!pPipe->vertex_binding_descriptions_.empty()) {
         cb_state->vertex_buffer_used = true;
     }
+
+    // Groups whose checks passed without logging anything hold until their state changes again. Groups that logged are kept
+    // dirty, so later draws report them again even if the callback did not skip this one. See
+    // CoreChecks::ValidateCmdBufDrawState.
+    state.draw_dirty_mask &= ~cb_state->draw_validated_mask;
+    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) {
+        cb_state->draw_dirty_mask &= ~cb_state->draw_validated_mask;
+    }
+    cb_state->draw_validated_mask = CBDIRTY_NONE;
 }
 
 // Remove set from setMap and delete the set
@@ -1179,6 +1284,9 @@ bool ValidationStateTracker::AddCommandBufferBinding(small_unordered_map<CMD_BUF
     if (disabled[command_buffer_state]) {
         return false;
     }
+    // The bound object may be referenced by command buffers recorded concurrently on other threads
+    std::unique_lock<std::mutex> lock(cb_binding_mutex, std::defer_lock);
+    if (fine_grained_locking_enabled) lock.lock();
     // Insert the cb_binding with a default 'index' of -1. Then push the obj into the object_bindings
     // vector, and update cb_bindings[cb_node] with the index of that element of the vector.
     auto inserted = cb_bindings.insert({cb_node, -1});
@@ -1216,6 +1324,8 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         pCB->image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
         pCB->status = 0;
         pCB->static_status = 0;
+        pCB->draw_dirty_mask = CBDIRTY_ALL;
+        pCB->draw_validated_mask = CBDIRTY_NONE;
         pCB->viewportMask = 0;
         pCB->viewportWithCountMask = 0;
         pCB->scissorMask = 0;
@@ -1250,7 +1360,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
             pSubCB->linkedCommandBuffers.erase(pCB);
         }
         pCB->linkedCommandBuffers.clear();
-        pCB->queue_submit_functions.clear();
+        pCB->submit_time_barrier_checks.clear();
         pCB->cmd_execute_commands_functions.clear();
         pCB->eventUpdates.clear();
         pCB->queryUpdates.clear();
@@ -1275,6 +1385,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         ResetCmdDebugUtilsLabel(report_data, pCB->commandBuffer);
         pCB->debug_label.Reset();
         pCB->validate_descriptorsets_in_queuesubmit.clear();
+        pCB->submit_validation_cache.Reset();
 
         // Best practices info
         pCB->small_indexed_draw_call_count = 0;
@@ -1284,6 +1395,11 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
     if (command_buffer_reset_callback) {
         (*command_buffer_reset_callback)(cb);
     }
+    for (auto *reader : shared_state_readers) {
+        if (reader->command_buffer_reset_callback) {
+            (*reader->command_buffer_reset_callback)(cb);
+        }
+    }
 }
 
 void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
@@ -1813,6 +1929,7 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
 }
 
 void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!device) return;
 
     // Reset all command buffers before destroying them, to unlink object_bindings.
@@ -1830,6 +1947,8 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
     descriptorSetLayoutMap.clear();
     imageViewMap.clear();
     imageMap.clear();
+    image_layout_slots.clear();
+    free_image_layout_slots.clear();
     bufferViewMap.clear();
     bufferMap.clear();
     // Queues persist until device is destroyed
@@ -1873,78 +1992,92 @@ void ValidationStateTracker::DecrementBoundResources(CMD_BUFFER_STATE const *cb_
     }
 }
 
-void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq) {
-    std::unordered_map<VkQueue, uint64_t> otherQueueSeqs;
-
-    // Roll this queue forward, one submission at a time.
-    while (pQueue->seq < seq) {
-        auto &submission = pQueue->submissions.front();
+// Queue pQueue for retirement up to seq, merging with any not-yet-processed entry for the same queue.
+static void AddRetireTarget(small_vector<std::pair<QUEUE_STATE *, uint64_t>, 4> *pending, uint32_t first_unprocessed,
+                            QUEUE_STATE *pQueue, uint64_t seq) {
+    if (!pQueue || pQueue->seq >= seq) return;
+    for (uint32_t i = first_unprocessed; i < pending->size(); ++i) {
+        auto &target = (*pending)[i];
+        if (target.first == pQueue) {
+            target.second = std::max(target.second, seq);
+            return;
+        }
+    }
+    pending->emplace_back(pQueue, seq);
+}
 
-        for (auto &wait : submission.waitSemaphores) {
-            auto pSemaphore = GetSemaphoreState(wait.semaphore);
-            if (pSemaphore) {
-                pSemaphore->in_use.fetch_sub(1);
+void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq) {
+    // Queues still to be rolled forward. Waits on other queues append to this list rather than recursing, so a retire chain
+    // across queues is handled iteratively and, for the usual one or two queues, without allocating.
+    small_vector<std::pair<QUEUE_STATE *, uint64_t>, 4> pending;
+    QueryMap localQueryToStateMap;
+    AddRetireTarget(&pending, 0, pQueue, seq);
+
+    for (uint32_t pending_index = 0; pending_index < pending.size(); ++pending_index) {
+        QUEUE_STATE *queue_state = pending[pending_index].first;
+        const uint64_t target_seq = pending[pending_index].second;
+        if (queue_state->seq >= target_seq) continue;
+
+        // Roll this queue forward over the whole span of submissions, then drop the span in one go.
+        auto retire_end = queue_state->submissions.begin() + static_cast<size_t>(target_seq - queue_state->seq);
+        for (auto submission = queue_state->submissions.begin(); submission != retire_end; ++submission) {
+            for (auto &wait : submission->waitSemaphores) {
+                if (wait.semaphore_state) {
+                    wait.semaphore_state->in_use.fetch_sub(1);
+                }
+                AddRetireTarget(&pending, pending_index + 1, wait.queue_state, wait.seq);
             }
-            auto &lastSeq = otherQueueSeqs[wait.queue];
-            lastSeq = std::max(lastSeq, wait.seq);
-        }
 
-        for (auto &signal : submission.signalSemaphores) {
-            auto pSemaphore = GetSemaphoreState(signal.semaphore);
-            if (pSemaphore) {
-                pSemaphore->in_use.fetch_sub(1);
-                if (pSemaphore->type == VK_SEMAPHORE_TYPE_TIMELINE_KHR && pSemaphore->payload < signal.payload) {
-                    pSemaphore->payload = signal.payload;
+            for (auto &signal : submission->signalSemaphores) {
+                auto pSemaphore = signal.semaphore_state.get();
+                if (pSemaphore) {
+                    pSemaphore->in_use.fetch_sub(1);
+                    if (pSemaphore->type == VK_SEMAPHORE_TYPE_TIMELINE_KHR && pSemaphore->payload < signal.payload) {
+                        pSemaphore->payload = signal.payload;
+                    }
                 }
             }
-        }
 
-        for (auto &semaphore : submission.externalSemaphores) {
-            auto pSemaphore = GetSemaphoreState(semaphore);
-            if (pSemaphore) {
+            for (auto &pSemaphore : submission->external_semaphore_states) {
                 pSemaphore->in_use.fetch_sub(1);
             }
-        }
 
-        for (auto cb : submission.cbs) {
-            auto cb_node = GetCBState(cb);
-            if (!cb_node) {
-                continue;
-            }
-            // First perform decrement on general case bound objects
-            DecrementBoundResources(cb_node);
-            for (auto event : cb_node->writeEventsBeforeWait) {
-                auto eventNode = eventMap.find(event);
-                if (eventNode != eventMap.end()) {
-                    eventNode->second.write_in_use--;
+            for (auto &cb_node : submission->cb_states) {
+                // A command buffer freed while in flight has already dropped its bindings
+                if (!cb_node || cb_node->destroyed) {
+                    continue;
                 }
-            }
-            QueryMap localQueryToStateMap;
-            VkQueryPool first_pool = VK_NULL_HANDLE;
-            for (auto &function : cb_node->queryUpdates) {
-                function(nullptr, /*do_validate*/ false, first_pool, submission.perf_submit_pass, &localQueryToStateMap);
-            }
+                // First perform decrement on general case bound objects
+                DecrementBoundResources(cb_node.get());
+                for (auto event : cb_node->writeEventsBeforeWait) {
+                    auto eventNode = eventMap.find(event);
+                    if (eventNode != eventMap.end()) {
+                        eventNode->second.write_in_use--;
+                    }
+                }
+                if (!cb_node->queryUpdates.empty()) {
+                    localQueryToStateMap.clear();
+                    for (const auto &update : cb_node->queryUpdates) {
+                        ApplyQueryUpdate(update, submission->perf_submit_pass, &localQueryToStateMap);
+                    }
 
-            for (auto queryStatePair : localQueryToStateMap) {
-                if (queryStatePair.second == QUERYSTATE_ENDED) {
-                    queryToStateMap[queryStatePair.first] = QUERYSTATE_AVAILABLE;
+                    for (auto queryStatePair : localQueryToStateMap) {
+                        if (queryStatePair.second == QUERYSTATE_ENDED) {
+                            queryToStateMap[queryStatePair.first] = QUERYSTATE_AVAILABLE;
+                        }
+                    }
                 }
+                cb_node->in_use.fetch_sub(1);
             }
-            cb_node->in_use.fetch_sub(1);
-        }
 
-        auto pFence = GetFenceState(submission.fence);
-        if (pFence && pFence->scope == kSyncScopeInternal) {
-            pFence->state = FENCE_RETIRED;
+            auto pFence = submission->fence_state.get();
+            if (pFence && pFence->scope == kSyncScopeInternal) {
+                pFence->state = FENCE_RETIRED;
+            }
         }
 
-        pQueue->submissions.pop_front();
-        pQueue->seq++;
-    }
-
-    // Roll other queues forward to the highest seq we saw a wait for
-    for (auto qs : otherQueueSeqs) {
-        RetireWorkOnQueue(GetQueueState(qs.first), qs.second);
+        queue_state->submissions.erase(queue_state->submissions.begin(), retire_end);
+        queue_state->seq = target_seq;
     }
 }
 
@@ -1958,6 +2091,7 @@ static void SubmitFence(QUEUE_STATE *pQueue, FENCE_STATE *pFence, uint64_t submi
 
 void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                                        VkFence fence, VkResult result) {
+    if (shared_state_source) return;
     if (result != VK_SUCCESS) return;
     uint64_t early_retire_seq = 0;
     auto pQueue = GetQueueState(queue);
@@ -1973,6 +2107,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                 // its completion.
                 pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), std::vector<SEMAPHORE_WAIT>(),
                                                  std::vector<SEMAPHORE_SIGNAL>(), std::vector<VkSemaphore>(), fence, 0);
+                pQueue->submissions.back().fence_state = GetShared<FENCE_STATE>(fence);
             }
         } else {
             // Retire work up until this fence early, we will not see the wait that corresponds to this signal
@@ -1987,18 +2122,23 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
         vector<SEMAPHORE_WAIT> semaphore_waits;
         vector<SEMAPHORE_SIGNAL> semaphore_signals;
         vector<VkSemaphore> semaphore_externals;
+        vector<std::shared_ptr<SEMAPHORE_STATE>> external_semaphore_states;
+        vector<std::shared_ptr<CMD_BUFFER_STATE>> cb_states;
         const uint64_t next_seq = pQueue->seq + pQueue->submissions.size() + 1;
         auto *timeline_semaphore_submit = lvl_find_in_chain<VkTimelineSemaphoreSubmitInfoKHR>(submit->pNext);
         for (uint32_t i = 0; i < submit->waitSemaphoreCount; ++i) {
             VkSemaphore semaphore = submit->pWaitSemaphores[i];
-            auto pSemaphore = GetSemaphoreState(semaphore);
+            auto semaphore_state = GetShared<SEMAPHORE_STATE>(semaphore);
+            auto pSemaphore = semaphore_state.get();
             if (pSemaphore) {
                 if (pSemaphore->scope == kSyncScopeInternal) {
                     SEMAPHORE_WAIT wait;
                     wait.semaphore = semaphore;
+                    wait.semaphore_state = semaphore_state;
                     if (pSemaphore->type == VK_SEMAPHORE_TYPE_BINARY_KHR) {
                         if (pSemaphore->signaler.first != VK_NULL_HANDLE) {
                             wait.queue = pSemaphore->signaler.first;
+                            wait.queue_state = GetQueueState(wait.queue);
                             wait.seq = pSemaphore->signaler.second;
                             semaphore_waits.push_back(wait);
                             pSemaphore->in_use.fetch_add(1);
@@ -2007,6 +2147,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                         pSemaphore->signaled = false;
                     } else if (pSemaphore->payload < timeline_semaphore_submit->pWaitSemaphoreValues[i]) {
                         wait.queue = queue;
+                        wait.queue_state = pQueue;
                         wait.seq = next_seq;
                         wait.payload = timeline_semaphore_submit->pWaitSemaphoreValues[i];
                         semaphore_waits.push_back(wait);
@@ -2014,6 +2155,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                     }
                 } else {
                     semaphore_externals.push_back(semaphore);
+                    external_semaphore_states.push_back(semaphore_state);
                     pSemaphore->in_use.fetch_add(1);
                     if (pSemaphore->scope == kSyncScopeExternalTemporary) {
                         pSemaphore->scope = kSyncScopeInternal;
@@ -2023,11 +2165,13 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
         }
         for (uint32_t i = 0; i < submit->signalSemaphoreCount; ++i) {
             VkSemaphore semaphore = submit->pSignalSemaphores[i];
-            auto pSemaphore = GetSemaphoreState(semaphore);
+            auto semaphore_state = GetShared<SEMAPHORE_STATE>(semaphore);
+            auto pSemaphore = semaphore_state.get();
             if (pSemaphore) {
                 if (pSemaphore->scope == kSyncScopeInternal) {
                     SEMAPHORE_SIGNAL signal;
                     signal.semaphore = semaphore;
+                    signal.semaphore_state = semaphore_state;
                     signal.seq = next_seq;
                     if (pSemaphore->type == VK_SEMAPHORE_TYPE_BINARY_KHR) {
                         pSemaphore->signaler.first = queue;
@@ -2037,7 +2181,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
                         signal.payload = timeline_semaphore_submit->pSignalSemaphoreValues[i];
                     }
                     pSemaphore->in_use.fetch_add(1);
-                    semaphore_signals.push_back(signal);
+                    semaphore_signals.push_back(std::move(signal));
                 } else {
                     // Retire work up until this submit early, we will not see the wait that corresponds to this signal
                     early_retire_seq = std::max(early_retire_seq, next_seq);
@@ -2048,28 +2192,30 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
         uint32_t perf_pass = perf_submit ? perf_submit->counterPassIndex : 0;
 
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            auto cb_node = GetCBState(submit->pCommandBuffers[i]);
+            auto cb_shared = GetShared<CMD_BUFFER_STATE>(submit->pCommandBuffers[i]);
+            auto cb_node = cb_shared.get();
             if (cb_node) {
                 cbs.push_back(submit->pCommandBuffers[i]);
+                cb_states.push_back(std::move(cb_shared));
                 for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
                     cbs.push_back(secondaryCmdBuffer->commandBuffer);
+                    cb_states.push_back(GetShared<CMD_BUFFER_STATE>(secondaryCmdBuffer->commandBuffer));
                     IncrementResources(secondaryCmdBuffer);
                 }
                 IncrementResources(cb_node);
 
-                VkQueryPool first_pool = VK_NULL_HANDLE;
                 EventToStageMap localEventToStageMap;
                 QueryMap localQueryToStateMap;
-                for (auto &function : cb_node->queryUpdates) {
-                    function(nullptr, /*do_validate*/ false, first_pool, perf_pass, &localQueryToStateMap);
+                for (const auto &update : cb_node->queryUpdates) {
+                    ApplyQueryUpdate(update, perf_pass, &localQueryToStateMap);
                 }
 
                 for (auto queryStatePair : localQueryToStateMap) {
                     queryToStateMap[queryStatePair.first] = queryStatePair.second;
                 }
 
-                for (auto &function : cb_node->eventUpdates) {
-                    function(nullptr, /*do_validate*/ false, &localEventToStageMap);
+                for (const auto &update : cb_node->eventUpdates) {
+                    ApplyEventUpdate(update, &localEventToStageMap);
                 }
 
                 for (auto eventStagePair : localEventToStageMap) {
@@ -2078,8 +2224,13 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
             }
         }
 
-        pQueue->submissions.emplace_back(cbs, semaphore_waits, semaphore_signals, semaphore_externals,
-                                         submit_idx == submitCount - 1 ? fence : (VkFence)VK_NULL_HANDLE, perf_pass);
+        const bool last_submit = submit_idx == submitCount - 1;
+        pQueue->submissions.emplace_back(std::move(cbs), std::move(semaphore_waits), std::move(semaphore_signals),
+                                         std::move(semaphore_externals), last_submit ? fence : (VkFence)VK_NULL_HANDLE, perf_pass);
+        auto &submission = pQueue->submissions.back();
+        submission.cb_states = std::move(cb_states);
+        submission.external_semaphore_states = std::move(external_semaphore_states);
+        if (last_submit) submission.fence_state = GetShared<FENCE_STATE>(fence);
     }
 
     if (early_retire_seq) {
@@ -2090,6 +2241,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
 void ValidationStateTracker::PostCallRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
                                                           const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory,
                                                           VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS == result) {
         AddMemObjInfo(device, *pMemory, pAllocateInfo);
     }
@@ -2097,6 +2249,7 @@ void ValidationStateTracker::PostCallRecordAllocateMemory(VkDevice device, const
 }
 
 void ValidationStateTracker::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!mem) return;
     DEVICE_MEMORY_STATE *mem_info = GetDevMemState(mem);
     const VulkanTypedHandle obj_struct(mem, kVulkanObjectTypeDeviceMemory);
@@ -2146,6 +2299,7 @@ void ValidationStateTracker::PreCallRecordFreeMemory(VkDevice device, VkDeviceMe
 
 void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo,
                                                            VkFence fence, VkResult result) {
+    if (shared_state_source) return;
     if (result != VK_SUCCESS) return;
     uint64_t early_retire_seq = 0;
     auto pFence = GetFenceState(fence);
@@ -2158,6 +2312,7 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
                 // No work to do, just dropping a fence in the queue by itself.
                 pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), std::vector<SEMAPHORE_WAIT>(),
                                                  std::vector<SEMAPHORE_SIGNAL>(), std::vector<VkSemaphore>(), fence, 0);
+                pQueue->submissions.back().fence_state = GetShared<FENCE_STATE>(fence);
             }
         } else {
             // Retire work up until this fence early, we will not see the wait that corresponds to this signal
@@ -2195,19 +2350,29 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
         std::vector<SEMAPHORE_WAIT> semaphore_waits;
         std::vector<SEMAPHORE_SIGNAL> semaphore_signals;
         std::vector<VkSemaphore> semaphore_externals;
+        std::vector<std::shared_ptr<SEMAPHORE_STATE>> external_semaphore_states;
         for (uint32_t i = 0; i < bindInfo.waitSemaphoreCount; ++i) {
             VkSemaphore semaphore = bindInfo.pWaitSemaphores[i];
-            auto pSemaphore = GetSemaphoreState(semaphore);
+            auto semaphore_state = GetShared<SEMAPHORE_STATE>(semaphore);
+            auto pSemaphore = semaphore_state.get();
             if (pSemaphore) {
                 if (pSemaphore->scope == kSyncScopeInternal) {
                     if (pSemaphore->signaler.first != VK_NULL_HANDLE) {
-                        semaphore_waits.push_back({semaphore, pSemaphore->signaler.first, pSemaphore->signaler.second});
+                        SEMAPHORE_WAIT wait;
+                        wait.semaphore = semaphore;
+                        wait.queue = pSemaphore->signaler.first;
+                        wait.payload = 0;
+                        wait.seq = pSemaphore->signaler.second;
+                        wait.semaphore_state = semaphore_state;
+                        wait.queue_state = GetQueueState(wait.queue);
+                        semaphore_waits.push_back(std::move(wait));
                         pSemaphore->in_use.fetch_add(1);
                     }
                     pSemaphore->signaler.first = VK_NULL_HANDLE;
                     pSemaphore->signaled = false;
                 } else {
                     semaphore_externals.push_back(semaphore);
+                    external_semaphore_states.push_back(semaphore_state);
                     pSemaphore->in_use.fetch_add(1);
                     if (pSemaphore->scope == kSyncScopeExternalTemporary) {
                         pSemaphore->scope = kSyncScopeInternal;
@@ -2217,7 +2382,8 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
         }
         for (uint32_t i = 0; i < bindInfo.signalSemaphoreCount; ++i) {
             VkSemaphore semaphore = bindInfo.pSignalSemaphores[i];
-            auto pSemaphore = GetSemaphoreState(semaphore);
+            auto semaphore_state = GetShared<SEMAPHORE_STATE>(semaphore);
+            auto pSemaphore = semaphore_state.get();
             if (pSemaphore) {
                 if (pSemaphore->scope == kSyncScopeInternal) {
                     pSemaphore->signaler.first = queue;
@@ -2228,7 +2394,8 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
                     SEMAPHORE_SIGNAL signal;
                     signal.semaphore = semaphore;
                     signal.seq = pSemaphore->signaler.second;
-                    semaphore_signals.push_back(signal);
+                    signal.semaphore_state = semaphore_state;
+                    semaphore_signals.push_back(std::move(signal));
                 } else {
                     // Retire work up until this submit early, we will not see the wait that corresponds to this signal
                     early_retire_seq = std::max(early_retire_seq, pQueue->seq + pQueue->submissions.size() + 1);
@@ -2236,8 +2403,12 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
             }
         }
 
-        pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), semaphore_waits, semaphore_signals, semaphore_externals,
-                                         bindIdx == bindInfoCount - 1 ? fence : (VkFence)VK_NULL_HANDLE, 0);
+        const bool last_bind = bindIdx == bindInfoCount - 1;
+        pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), std::move(semaphore_waits), std::move(semaphore_signals),
+                                         std::move(semaphore_externals), last_bind ? fence : (VkFence)VK_NULL_HANDLE, 0);
+        auto &submission = pQueue->submissions.back();
+        submission.external_semaphore_states = std::move(external_semaphore_states);
+        if (last_bind) submission.fence_state = GetShared<FENCE_STATE>(fence);
     }
 
     if (early_retire_seq) {
@@ -2248,6 +2419,7 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
 void ValidationStateTracker::PostCallRecordCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo *pCreateInfo,
                                                            const VkAllocationCallbacks *pAllocator, VkSemaphore *pSemaphore,
                                                            VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto semaphore_state = std::make_shared<SEMAPHORE_STATE>();
     semaphore_state->signaler.first = VK_NULL_HANDLE;
@@ -2279,6 +2451,7 @@ void ValidationStateTracker::RecordImportSemaphoreState(VkSemaphore semaphore, V
 
 void ValidationStateTracker::PostCallRecordSignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfoKHR *pSignalInfo,
                                                               VkResult result) {
+    if (shared_state_source) return;
     auto *pSemaphore = GetSemaphoreState(pSignalInfo->semaphore);
     pSemaphore->payload = pSignalInfo->value;
 }
@@ -2308,6 +2481,7 @@ void ValidationStateTracker::RetireFence(VkFence fence) {
 
 void ValidationStateTracker::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences,
                                                          VkBool32 waitAll, uint64_t timeout, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
 
     // When we know that all fences are complete we can clean/remove their CBs
@@ -2354,15 +2528,18 @@ void ValidationStateTracker::RecordWaitSemaphores(VkDevice device, const VkSemap
 
 void ValidationStateTracker::PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
                                                           VkResult result) {
+    if (shared_state_source) return;
     RecordWaitSemaphores(device, pWaitInfo, timeout, result);
 }
 
 void ValidationStateTracker::PostCallRecordWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo,
                                                              uint64_t timeout, VkResult result) {
+    if (shared_state_source) return;
     RecordWaitSemaphores(device, pWaitInfo, timeout, result);
 }
 
 void ValidationStateTracker::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RetireFence(fence);
 }
@@ -2380,20 +2557,24 @@ void ValidationStateTracker::RecordGetDeviceQueueState(uint32_t queue_family_ind
 
 void ValidationStateTracker::PostCallRecordGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex,
                                                           VkQueue *pQueue) {
+    if (shared_state_source) return;
     RecordGetDeviceQueueState(queueFamilyIndex, *pQueue);
 }
 
 void ValidationStateTracker::PostCallRecordGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *pQueueInfo, VkQueue *pQueue) {
+    if (shared_state_source) return;
     RecordGetDeviceQueueState(pQueueInfo->queueFamilyIndex, *pQueue);
 }
 
 void ValidationStateTracker::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     QUEUE_STATE *queue_state = GetQueueState(queue);
     RetireWorkOnQueue(queue_state, queue_state->seq + queue_state->submissions.size());
 }
 
 void ValidationStateTracker::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     for (auto &queue : queueMap) {
         RetireWorkOnQueue(&queue.second, queue.second.seq + queue.second.submissions.size());
@@ -2401,6 +2582,7 @@ void ValidationStateTracker::PostCallRecordDeviceWaitIdle(VkDevice device, VkRes
 }
 
 void ValidationStateTracker::PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!fence) return;
     auto fence_state = GetFenceState(fence);
     fence_state->destroyed = true;
@@ -2409,6 +2591,7 @@ void ValidationStateTracker::PreCallRecordDestroyFence(VkDevice device, VkFence
 
 void ValidationStateTracker::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore,
                                                            const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!semaphore) return;
     auto semaphore_state = GetSemaphoreState(semaphore);
     semaphore_state->destroyed = true;
@@ -2416,6 +2599,7 @@ void ValidationStateTracker::PreCallRecordDestroySemaphore(VkDevice device, VkSe
 }
 
 void ValidationStateTracker::PreCallRecordDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!event) return;
     EVENT_STATE *event_state = GetEventState(event);
     const VulkanTypedHandle obj_struct(event, kVulkanObjectTypeEvent);
@@ -2425,6 +2609,7 @@ void ValidationStateTracker::PreCallRecordDestroyEvent(VkDevice device, VkEvent
 
 void ValidationStateTracker::PreCallRecordDestroyQueryPool(VkDevice device, VkQueryPool queryPool,
                                                            const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!queryPool) return;
     QUERY_POOL_STATE *qp_state = GetQueryPoolState(queryPool);
     const VulkanTypedHandle obj_struct(queryPool, kVulkanObjectTypeQueryPool);
@@ -2505,12 +2690,14 @@ void ValidationStateTracker::UpdateBindBufferMemoryState(VkBuffer buffer, VkDevi
 
 void ValidationStateTracker::PostCallRecordBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory mem,
                                                             VkDeviceSize memoryOffset, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     UpdateBindBufferMemoryState(buffer, mem, memoryOffset);
 }
 
 void ValidationStateTracker::PostCallRecordBindBufferMemory2(VkDevice device, uint32_t bindInfoCount,
                                                              const VkBindBufferMemoryInfoKHR *pBindInfos, VkResult result) {
+    if (shared_state_source) return;
     for (uint32_t i = 0; i < bindInfoCount; i++) {
         UpdateBindBufferMemoryState(pBindInfos[i].buffer, pBindInfos[i].memory, pBindInfos[i].memoryOffset);
     }
@@ -2518,6 +2705,7 @@ void ValidationStateTracker::PostCallRecordBindBufferMemory2(VkDevice device, ui
 
 void ValidationStateTracker::PostCallRecordBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount,
                                                                 const VkBindBufferMemoryInfoKHR *pBindInfos, VkResult result) {
+    if (shared_state_source) return;
     for (uint32_t i = 0; i < bindInfoCount; i++) {
         UpdateBindBufferMemoryState(pBindInfos[i].buffer, pBindInfos[i].memory, pBindInfos[i].memoryOffset);
     }
@@ -2532,18 +2720,21 @@ void ValidationStateTracker::RecordGetBufferMemoryRequirementsState(VkBuffer buf
 
 void ValidationStateTracker::PostCallRecordGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer,
                                                                        VkMemoryRequirements *pMemoryRequirements) {
+    if (shared_state_source) return;
     RecordGetBufferMemoryRequirementsState(buffer);
 }
 
 void ValidationStateTracker::PostCallRecordGetBufferMemoryRequirements2(VkDevice device,
                                                                         const VkBufferMemoryRequirementsInfo2KHR *pInfo,
                                                                         VkMemoryRequirements2KHR *pMemoryRequirements) {
+    if (shared_state_source) return;
     RecordGetBufferMemoryRequirementsState(pInfo->buffer);
 }
 
 void ValidationStateTracker::PostCallRecordGetBufferMemoryRequirements2KHR(VkDevice device,
                                                                            const VkBufferMemoryRequirementsInfo2KHR *pInfo,
                                                                            VkMemoryRequirements2KHR *pMemoryRequirements) {
+    if (shared_state_source) return;
     RecordGetBufferMemoryRequirementsState(pInfo->buffer);
 }
 
@@ -2571,17 +2762,20 @@ void ValidationStateTracker::RecordGetImageMemoryRequirementsState(VkImage image
 
 void ValidationStateTracker::PostCallRecordGetImageMemoryRequirements(VkDevice device, VkImage image,
                                                                       VkMemoryRequirements *pMemoryRequirements) {
+    if (shared_state_source) return;
     RecordGetImageMemoryRequirementsState(image, nullptr);
 }
 
 void ValidationStateTracker::PostCallRecordGetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2 *pInfo,
                                                                        VkMemoryRequirements2 *pMemoryRequirements) {
+    if (shared_state_source) return;
     RecordGetImageMemoryRequirementsState(pInfo->image, pInfo);
 }
 
 void ValidationStateTracker::PostCallRecordGetImageMemoryRequirements2KHR(VkDevice device,
                                                                           const VkImageMemoryRequirementsInfo2 *pInfo,
                                                                           VkMemoryRequirements2 *pMemoryRequirements) {
+    if (shared_state_source) return;
     RecordGetImageMemoryRequirementsState(pInfo->image, pInfo);
 }
 
@@ -2596,6 +2790,7 @@ static void RecordGetImageSparseMemoryRequirementsState(IMAGE_STATE *image_state
 void ValidationStateTracker::PostCallRecordGetImageSparseMemoryRequirements(
     VkDevice device, VkImage image, uint32_t *pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements *pSparseMemoryRequirements) {
+    if (shared_state_source) return;
     auto image_state = GetImageState(image);
     image_state->get_sparse_reqs_called = true;
     if (!pSparseMemoryRequirements) return;
@@ -2607,6 +2802,7 @@ void ValidationStateTracker::PostCallRecordGetImageSparseMemoryRequirements(
 void ValidationStateTracker::PostCallRecordGetImageSparseMemoryRequirements2(
     VkDevice device, const VkImageSparseMemoryRequirementsInfo2KHR *pInfo, uint32_t *pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements2KHR *pSparseMemoryRequirements) {
+    if (shared_state_source) return;
     auto image_state = GetImageState(pInfo->image);
     image_state->get_sparse_reqs_called = true;
     if (!pSparseMemoryRequirements) return;
@@ -2619,6 +2815,7 @@ void ValidationStateTracker::PostCallRecordGetImageSparseMemoryRequirements2(
 void ValidationStateTracker::PostCallRecordGetImageSparseMemoryRequirements2KHR(
     VkDevice device, const VkImageSparseMemoryRequirementsInfo2KHR *pInfo, uint32_t *pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements2KHR *pSparseMemoryRequirements) {
+    if (shared_state_source) return;
     auto image_state = GetImageState(pInfo->image);
     image_state->get_sparse_reqs_called = true;
     if (!pSparseMemoryRequirements) return;
@@ -2630,6 +2827,7 @@ void ValidationStateTracker::PostCallRecordGetImageSparseMemoryRequirements2KHR(
 
 void ValidationStateTracker::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
                                                               const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!shaderModule) return;
     auto shader_module_state = GetShaderModuleState(shaderModule);
     shader_module_state->destroyed = true;
@@ -2638,6 +2836,7 @@ void ValidationStateTracker::PreCallRecordDestroyShaderModule(VkDevice device, V
 
 void ValidationStateTracker::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline,
                                                           const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!pipeline) return;
     PIPELINE_STATE *pipeline_state = GetPipelineState(pipeline);
     const VulkanTypedHandle obj_struct(pipeline, kVulkanObjectTypePipeline);
@@ -2649,6 +2848,7 @@ void ValidationStateTracker::PreCallRecordDestroyPipeline(VkDevice device, VkPip
 
 void ValidationStateTracker::PreCallRecordDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
                                                                 const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!pipelineLayout) return;
     auto pipeline_layout_state = GetPipelineLayout(pipelineLayout);
     pipeline_layout_state->destroyed = true;
@@ -2657,6 +2857,7 @@ void ValidationStateTracker::PreCallRecordDestroyPipelineLayout(VkDevice device,
 
 void ValidationStateTracker::PreCallRecordDestroySampler(VkDevice device, VkSampler sampler,
                                                          const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!sampler) return;
     SAMPLER_STATE *sampler_state = GetSamplerState(sampler);
     const VulkanTypedHandle obj_struct(sampler, kVulkanObjectTypeSampler);
@@ -2676,6 +2877,7 @@ void ValidationStateTracker::PreCallRecordDestroySampler(VkDevice device, VkSamp
 
 void ValidationStateTracker::PreCallRecordDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
                                                                      const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!descriptorSetLayout) return;
     auto layout_it = descriptorSetLayoutMap.find(descriptorSetLayout);
     if (layout_it != descriptorSetLayoutMap.end()) {
@@ -2686,6 +2888,7 @@ void ValidationStateTracker::PreCallRecordDestroyDescriptorSetLayout(VkDevice de
 
 void ValidationStateTracker::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                                 const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!descriptorPool) return;
     DESCRIPTOR_POOL_STATE *desc_pool_state = GetDescriptorPoolState(descriptorPool);
     const VulkanTypedHandle obj_struct(descriptorPool, kVulkanObjectTypeDescriptorPool);
@@ -2709,6 +2912,11 @@ void ValidationStateTracker::FreeCommandBufferStates(COMMAND_POOL_STATE *pool_st
         if (command_buffer_free_callback) {
             (*command_buffer_free_callback)(command_buffers[i]);
         }
+        for (auto *reader : shared_state_readers) {
+            if (reader->command_buffer_free_callback) {
+                (*reader->command_buffer_free_callback)(command_buffers[i]);
+            }
+        }
 
         auto cb_state = GetCBState(command_buffers[i]);
         // Remove references to command buffer's state and delete
@@ -2729,6 +2937,7 @@ void ValidationStateTracker::FreeCommandBufferStates(COMMAND_POOL_STATE *pool_st
 
 void ValidationStateTracker::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool,
                                                              uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers) {
+    if (shared_state_source) return;
     auto pPool = GetCommandPoolState(commandPool);
     FreeCommandBufferStates(pPool, commandBufferCount, pCommandBuffers);
 }
@@ -2736,6 +2945,7 @@ void ValidationStateTracker::PreCallRecordFreeCommandBuffers(VkDevice device, Vk
 void ValidationStateTracker::PostCallRecordCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
                                                              const VkAllocationCallbacks *pAllocator, VkCommandPool *pCommandPool,
                                                              VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     VkCommandPool command_pool = *pCommandPool;
     auto cmd_pool_state = std::make_shared<COMMAND_POOL_STATE>();
@@ -2749,6 +2959,7 @@ void ValidationStateTracker::PostCallRecordCreateCommandPool(VkDevice device, co
 void ValidationStateTracker::PostCallRecordCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo,
                                                            const VkAllocationCallbacks *pAllocator, VkQueryPool *pQueryPool,
                                                            VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto query_pool_state = std::make_shared<QUERY_POOL_STATE>();
     query_pool_state->createInfo = *pCreateInfo;
@@ -2786,6 +2997,7 @@ void ValidationStateTracker::PostCallRecordCreateQueryPool(VkDevice device, cons
 
 void ValidationStateTracker::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                              const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!commandPool) return;
     COMMAND_POOL_STATE *cp_state = GetCommandPoolState(commandPool);
     // Remove cmdpool from cmdpoolmap, after freeing layer data for the command buffers
@@ -2801,6 +3013,7 @@ void ValidationStateTracker::PreCallRecordDestroyCommandPool(VkDevice device, Vk
 
 void ValidationStateTracker::PostCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool,
                                                             VkCommandPoolResetFlags flags, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     // Reset all of the CBs allocated from this pool
     auto command_pool_state = GetCommandPoolState(commandPool);
@@ -2811,6 +3024,7 @@ void ValidationStateTracker::PostCallRecordResetCommandPool(VkDevice device, VkC
 
 void ValidationStateTracker::PostCallRecordResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences,
                                                        VkResult result) {
+    if (shared_state_source) return;
     for (uint32_t i = 0; i < fenceCount; ++i) {
         auto pFence = GetFenceState(pFences[i]);
         if (pFence) {
@@ -2872,6 +3086,7 @@ void ValidationStateTracker::InvalidateLinkedCommandBuffers(std::unordered_set<C
 
 void ValidationStateTracker::PreCallRecordDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer,
                                                              const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!framebuffer) return;
     FRAMEBUFFER_STATE *framebuffer_state = GetFramebufferState(framebuffer);
     const VulkanTypedHandle obj_struct(framebuffer, kVulkanObjectTypeFramebuffer);
@@ -2882,6 +3097,7 @@ void ValidationStateTracker::PreCallRecordDestroyFramebuffer(VkDevice device, Vk
 
 void ValidationStateTracker::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass,
                                                             const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!renderPass) return;
     RENDER_PASS_STATE *rp_state = GetRenderPassState(renderPass);
     const VulkanTypedHandle obj_struct(renderPass, kVulkanObjectTypeRenderPass);
@@ -2892,6 +3108,7 @@ void ValidationStateTracker::PreCallRecordDestroyRenderPass(VkDevice device, VkR
 
 void ValidationStateTracker::PostCallRecordCreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator, VkFence *pFence, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto fence_state = std::make_shared<FENCE_STATE>();
     fence_state->fence = *pFence;
@@ -2916,15 +3133,48 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
     return false;
 }
 
+// utility function to set collective state for pipeline
+void SetPipelineState(PIPELINE_STATE *pPipe) {
+    // If any attachment used by this pipeline has blendEnable, set top-level blendEnable
+    if (pPipe->graphicsPipelineCI.pColorBlendState) {
+        for (size_t i = 0; i < pPipe->attachments.size(); ++i) {
+            if (VK_TRUE == pPipe->attachments[i].blendEnable) {
+                if (((pPipe->attachments[i].dstAlphaBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
+                     (pPipe->attachments[i].dstAlphaBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
+                    ((pPipe->attachments[i].dstColorBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
+                     (pPipe->attachments[i].dstColorBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
+                    ((pPipe->attachments[i].srcAlphaBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
+                     (pPipe->attachments[i].srcAlphaBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
+                    ((pPipe->attachments[i].srcColorBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
+                     (pPipe->attachments[i].srcColorBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA))) {
+                    pPipe->blendConstantsEnabled = true;
+                }
+            }
+        }
+    }
+    // Check if sample location is enabled
+    if (pPipe->graphicsPipelineCI.pMultisampleState) {
+        const VkPipelineSampleLocationsStateCreateInfoEXT *sample_location_state =
+            lvl_find_in_chain<VkPipelineSampleLocationsStateCreateInfoEXT>(pPipe->graphicsPipelineCI.pMultisampleState->pNext);
+        if (sample_location_state != nullptr) {
+            pPipe->sample_location_enabled = sample_location_state->sampleLocationsEnable;
+        }
+    }
+}
+
 void ValidationStateTracker::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                                    const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                                    const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                                    VkResult result, void *cgpl_state_data) {
+    if (shared_state_source) return;
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
     // This API may create pipelines regardless of the return value
     for (uint32_t i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             (cgpl_state->pipe_state)[i]->pipeline = pPipelines[i];
+            // Derived from the create info alone, so set once here rather than by every bind, which may run concurrently with
+            // fine grained locking
+            SetPipelineState((cgpl_state->pipe_state)[i].get());
             pipelineMap[pPipelines[i]] = std::move((cgpl_state->pipe_state)[i]);
         }
     }
@@ -2951,6 +3201,7 @@ void ValidationStateTracker::PostCallRecordCreateComputePipelines(VkDevice devic
                                                                   const VkComputePipelineCreateInfo *pCreateInfos,
                                                                   const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                                   VkResult result, void *ccpl_state_data) {
+    if (shared_state_source) return;
     create_compute_pipeline_api_state *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
 
     // This API may create pipelines regardless of the return value
@@ -2982,6 +3233,7 @@ bool ValidationStateTracker::PreCallValidateCreateRayTracingPipelinesNV(VkDevice
 void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(
     VkDevice device, VkPipelineCache pipelineCache, uint32_t count, const VkRayTracingPipelineCreateInfoNV *pCreateInfos,
     const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines, VkResult result, void *crtpl_state_data) {
+    if (shared_state_source) return;
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_api_state *>(crtpl_state_data);
     // This API may create pipelines regardless of the return value
     for (uint32_t i = 0; i < count; i++) {
@@ -3012,6 +3264,7 @@ bool ValidationStateTracker::PreCallValidateCreateRayTracingPipelinesKHR(VkDevic
 void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(
     VkDevice device, VkPipelineCache pipelineCache, uint32_t count, const VkRayTracingPipelineCreateInfoKHR *pCreateInfos,
     const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines, VkResult result, void *crtpl_state_data) {
+    if (shared_state_source) return;
     auto *crtpl_state = reinterpret_cast<create_ray_tracing_pipeline_khr_api_state *>(crtpl_state_data);
     // This API may create pipelines regardless of the return value
     for (uint32_t i = 0; i < count; i++) {
@@ -3026,6 +3279,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(
 void ValidationStateTracker::PostCallRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
                                                          const VkAllocationCallbacks *pAllocator, VkSampler *pSampler,
                                                          VkResult result) {
+    if (shared_state_source) return;
     samplerMap[*pSampler] = std::make_shared<SAMPLER_STATE>(pSampler, pCreateInfo);
     if (pCreateInfo->borderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT || pCreateInfo->borderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT)
         custom_border_color_sampler_count++;
@@ -3035,6 +3289,7 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorSetLayout(VkDevice de
                                                                      const VkDescriptorSetLayoutCreateInfo *pCreateInfo,
                                                                      const VkAllocationCallbacks *pAllocator,
                                                                      VkDescriptorSetLayout *pSetLayout, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     descriptorSetLayoutMap[*pSetLayout] = std::make_shared<cvdescriptorset::DescriptorSetLayout>(pCreateInfo, *pSetLayout);
 }
@@ -3090,6 +3345,7 @@ static PipelineLayoutCompatId GetCanonicalId(const uint32_t set_index, const Pus
 void ValidationStateTracker::PostCallRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
                                                                 const VkAllocationCallbacks *pAllocator,
                                                                 VkPipelineLayout *pPipelineLayout, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
 
     auto pipeline_layout_state = std::make_shared<PIPELINE_LAYOUT_STATE>();
@@ -3117,12 +3373,14 @@ void ValidationStateTracker::PostCallRecordCreatePipelineLayout(VkDevice device,
 void ValidationStateTracker::PostCallRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
                                                                 const VkAllocationCallbacks *pAllocator,
                                                                 VkDescriptorPool *pDescriptorPool, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     descriptorPoolMap[*pDescriptorPool] = std::make_shared<DESCRIPTOR_POOL_STATE>(*pDescriptorPool, pCreateInfo);
 }
 
 void ValidationStateTracker::PostCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                                VkDescriptorPoolResetFlags flags, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     DESCRIPTOR_POOL_STATE *pPool = GetDescriptorPoolState(descriptorPool);
     // TODO: validate flags
@@ -3153,6 +3411,7 @@ bool ValidationStateTracker::PreCallValidateAllocateDescriptorSets(VkDevice devi
 void ValidationStateTracker::PostCallRecordAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                                                   VkDescriptorSet *pDescriptorSets, VkResult result,
                                                                   void *ads_state_data) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     // All the updates are contained in a single cvdescriptorset function
     cvdescriptorset::AllocateDescriptorSetsData *ads_state =
@@ -3162,6 +3421,7 @@ void ValidationStateTracker::PostCallRecordAllocateDescriptorSets(VkDevice devic
 
 void ValidationStateTracker::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t count,
                                                              const VkDescriptorSet *pDescriptorSets) {
+    if (shared_state_source) return;
     DESCRIPTOR_POOL_STATE *pool_state = GetDescriptorPoolState(descriptorPool);
     // Update available descriptor sets in pool
     pool_state->availableSets += count;
@@ -3186,12 +3446,14 @@ void ValidationStateTracker::PreCallRecordUpdateDescriptorSets(VkDevice device,
                                                                const VkWriteDescriptorSet *pDescriptorWrites,
                                                                uint32_t descriptorCopyCount,
                                                                const VkCopyDescriptorSet *pDescriptorCopies) {
+    if (shared_state_source) return;
     cvdescriptorset::PerformUpdateDescriptorSets(this, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
                                                  pDescriptorCopies);
 }
 
 void ValidationStateTracker::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pCreateInfo,
                                                                   VkCommandBuffer *pCommandBuffer, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto pPool = GetCommandPoolShared(pCreateInfo->commandPool);
     if (pPool) {
@@ -3226,6 +3488,7 @@ void ValidationStateTracker::AddFramebufferBinding(CMD_BUFFER_STATE *cb_state, F
 
 void ValidationStateTracker::PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer,
                                                              const VkCommandBufferBeginInfo *pBeginInfo) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (!cb_state) return;
     if (cb_state->createInfo.level != VK_COMMAND_BUFFER_LEVEL_PRIMARY) {
@@ -3256,6 +3519,7 @@ void ValidationStateTracker::PreCallRecordBeginCommandBuffer(VkCommandBuffer com
             (cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
             cb_state->activeRenderPass = GetShared<RENDER_PASS_STATE>(cb_state->beginInfo.pInheritanceInfo->renderPass);
             cb_state->activeSubpass = cb_state->beginInfo.pInheritanceInfo->subpass;
+            cb_state->draw_dirty_mask |= CBDIRTY_SUBPASS;
             if (cb_state->beginInfo.pInheritanceInfo->framebuffer) {
                 cb_state->activeFramebuffer = GetShared<FRAMEBUFFER_STATE>(cb_state->beginInfo.pInheritanceInfo->framebuffer);
                 if (cb_state->activeFramebuffer) cb_state->framebuffers.insert(cb_state->activeFramebuffer);
@@ -3274,6 +3538,7 @@ void ValidationStateTracker::PreCallRecordBeginCommandBuffer(VkCommandBuffer com
 }
 
 void ValidationStateTracker::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (!cb_state) return;
     // Cached validation is specific to a specific recording of a specific command buffer.
@@ -3288,6 +3553,7 @@ void ValidationStateTracker::PostCallRecordEndCommandBuffer(VkCommandBuffer comm
 
 void ValidationStateTracker::PostCallRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags,
                                                               VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS == result) {
         ResetCommandBufferState(commandBuffer);
     }
@@ -3386,37 +3652,10 @@ CBStatusFlags MakeStaticStateMask(VkPipelineDynamicStateCreateInfo const *ds) {
 
 // Validation cache:
 // CV is the bottommost implementor of this extension. Don't pass calls down.
-// utility function to set collective state for pipeline
-void SetPipelineState(PIPELINE_STATE *pPipe) {
-    // If any attachment used by this pipeline has blendEnable, set top-level blendEnable
-    if (pPipe->graphicsPipelineCI.pColorBlendState) {
-        for (size_t i = 0; i < pPipe->attachments.size(); ++i) {
-            if (VK_TRUE == pPipe->attachments[i].blendEnable) {
-                if (((pPipe->attachments[i].dstAlphaBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
-                     (pPipe->attachments[i].dstAlphaBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
-                    ((pPipe->attachments[i].dstColorBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
-                     (pPipe->attachments[i].dstColorBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
-                    ((pPipe->attachments[i].srcAlphaBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
-                     (pPipe->attachments[i].srcAlphaBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA)) ||
-                    ((pPipe->attachments[i].srcColorBlendFactor >= VK_BLEND_FACTOR_CONSTANT_COLOR) &&
-                     (pPipe->attachments[i].srcColorBlendFactor <= VK_BLEND_FACTOR_ONE_MINUS_CONSTANT_ALPHA))) {
-                    pPipe->blendConstantsEnabled = true;
-                }
-            }
-        }
-    }
-    // Check if sample location is enabled
-    if (pPipe->graphicsPipelineCI.pMultisampleState) {
-        const VkPipelineSampleLocationsStateCreateInfoEXT *sample_location_state =
-            lvl_find_in_chain<VkPipelineSampleLocationsStateCreateInfoEXT>(pPipe->graphicsPipelineCI.pMultisampleState->pNext);
-        if (sample_location_state != nullptr) {
-            pPipe->sample_location_enabled = sample_location_state->sampleLocationsEnable;
-        }
-    }
-}
 
 void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                           VkPipeline pipeline) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     assert(cb_state);
 
@@ -3427,31 +3666,37 @@ void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer comman
         cb_state->status |= cb_state->static_status;
     }
     ResetCommandBufferPushConstantDataIfIncompatible(cb_state, pipe_state->pipeline_layout->layout);
-    cb_state->lastBound[pipelineBindPoint].pipeline_state = pipe_state;
-    SetPipelineState(pipe_state);
+    auto &last_bound = cb_state->lastBound[pipelineBindPoint];
+    last_bound.pipeline_state = pipe_state;
+    last_bound.draw_dirty_mask |= CBDIRTY_PIPELINE;
     AddCommandBufferBinding(pipe_state->cb_bindings, VulkanTypedHandle(pipeline, kVulkanObjectTypePipeline), cb_state);
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport,
                                                          uint32_t viewportCount, const VkViewport *pViewports) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->viewportMask |= ((1u << viewportCount) - 1u) << firstViewport;
     cb_state->status |= CBSTATUS_VIEWPORT_SET;
     cb_state->static_status &= ~CBSTATUS_VIEWPORT_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor,
                                                                    uint32_t exclusiveScissorCount,
                                                                    const VkRect2D *pExclusiveScissors) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     // TODO: We don't have VUIDs for validating that all exclusive scissors have been set.
     // cb_state->exclusiveScissorMask |= ((1u << exclusiveScissorCount) - 1u) << firstExclusiveScissor;
     cb_state->status |= CBSTATUS_EXCLUSIVE_SCISSOR_SET;
     cb_state->static_status &= ~CBSTATUS_EXCLUSIVE_SCISSOR_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView,
                                                                     VkImageLayout imageLayout) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
 
     if (imageView != VK_NULL_HANDLE) {
@@ -3463,11 +3708,13 @@ void ValidationStateTracker::PreCallRecordCmdBindShadingRateImageNV(VkCommandBuf
 void ValidationStateTracker::PreCallRecordCmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer, uint32_t firstViewport,
                                                                              uint32_t viewportCount,
                                                                              const VkShadingRatePaletteNV *pShadingRatePalettes) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     // TODO: We don't have VUIDs for validating that all shading rate palettes have been set.
     // cb_state->shadingRatePaletteMask |= ((1u << viewportCount) - 1u) << firstViewport;
     cb_state->status |= CBSTATUS_SHADING_RATE_PALETTE_SET;
     cb_state->static_status &= ~CBSTATUS_SHADING_RATE_PALETTE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PostCallRecordCreateAccelerationStructureNV(VkDevice device,
@@ -3475,6 +3722,7 @@ void ValidationStateTracker::PostCallRecordCreateAccelerationStructureNV(VkDevic
                                                                          const VkAllocationCallbacks *pAllocator,
                                                                          VkAccelerationStructureNV *pAccelerationStructure,
                                                                          VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto as_state = std::make_shared<ACCELERATION_STRUCTURE_STATE>(*pAccelerationStructure, pCreateInfo);
 
@@ -3507,6 +3755,7 @@ void ValidationStateTracker::PostCallRecordCreateAccelerationStructureKHR(VkDevi
                                                                           const VkAllocationCallbacks *pAllocator,
                                                                           VkAccelerationStructureKHR *pAccelerationStructure,
                                                                           VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto as_state = std::make_shared<ACCELERATION_STRUCTURE_STATE>(*pAccelerationStructure, pCreateInfo);
 
@@ -3539,6 +3788,7 @@ void ValidationStateTracker::PostCallRecordCreateAccelerationStructureKHR(VkDevi
 
 void ValidationStateTracker::PostCallRecordGetAccelerationStructureMemoryRequirementsNV(
     VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV *pInfo, VkMemoryRequirements2KHR *pMemoryRequirements) {
+    if (shared_state_source) return;
     ACCELERATION_STRUCTURE_STATE *as_state = GetAccelerationStructureState(pInfo->accelerationStructure);
     if (as_state != nullptr) {
         if (pInfo->type == VK_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_TYPE_OBJECT_NV) {
@@ -3557,6 +3807,7 @@ void ValidationStateTracker::PostCallRecordGetAccelerationStructureMemoryRequire
 void ValidationStateTracker::PostCallRecordBindAccelerationStructureMemoryCommon(
     VkDevice device, uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoKHR *pBindInfos, VkResult result,
     bool isNV) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     for (uint32_t i = 0; i < bindInfoCount; i++) {
         const VkBindAccelerationStructureMemoryInfoKHR &info = pBindInfos[i];
@@ -3583,17 +3834,20 @@ void ValidationStateTracker::PostCallRecordBindAccelerationStructureMemoryCommon
 
 void ValidationStateTracker::PostCallRecordBindAccelerationStructureMemoryNV(
     VkDevice device, uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoNV *pBindInfos, VkResult result) {
+    if (shared_state_source) return;
     PostCallRecordBindAccelerationStructureMemoryCommon(device, bindInfoCount, pBindInfos, result, true);
 }
 
 void ValidationStateTracker::PostCallRecordBindAccelerationStructureMemoryKHR(
     VkDevice device, uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoKHR *pBindInfos, VkResult result) {
+    if (shared_state_source) return;
     PostCallRecordBindAccelerationStructureMemoryCommon(device, bindInfoCount, pBindInfos, result, false);
 }
 
 void ValidationStateTracker::PostCallRecordCmdBuildAccelerationStructureNV(
     VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV *pInfo, VkBuffer instanceData, VkDeviceSize instanceOffset,
     VkBool32 update, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch, VkDeviceSize scratchOffset) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (cb_state == nullptr) {
         return;
@@ -3616,6 +3870,7 @@ void ValidationStateTracker::PostCallRecordCmdCopyAccelerationStructureNV(VkComm
                                                                           VkAccelerationStructureNV dst,
                                                                           VkAccelerationStructureNV src,
                                                                           VkCopyAccelerationStructureModeNV mode) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (cb_state) {
         ACCELERATION_STRUCTURE_STATE *src_as_state = GetAccelerationStructureState(src);
@@ -3632,6 +3887,7 @@ void ValidationStateTracker::PostCallRecordCmdCopyAccelerationStructureNV(VkComm
 void ValidationStateTracker::PreCallRecordDestroyAccelerationStructureKHR(VkDevice device,
                                                                           VkAccelerationStructureKHR accelerationStructure,
                                                                           const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!accelerationStructure) return;
     auto *as_state = GetAccelerationStructureState(accelerationStructure);
     if (as_state) {
@@ -3649,77 +3905,98 @@ void ValidationStateTracker::PreCallRecordDestroyAccelerationStructureKHR(VkDevi
 void ValidationStateTracker::PreCallRecordDestroyAccelerationStructureNV(VkDevice device,
                                                                          VkAccelerationStructureNV accelerationStructure,
                                                                          const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     PreCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport,
                                                                    uint32_t viewportCount,
                                                                    const VkViewportWScalingNV *pViewportWScalings) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_VIEWPORT_W_SCALING_SET;
     cb_state->static_status &= ~CBSTATUS_VIEWPORT_W_SCALING_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_LINE_WIDTH_SET;
     cb_state->static_status &= ~CBSTATUS_LINE_WIDTH_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
                                                                uint16_t lineStipplePattern) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_LINE_STIPPLE_SET;
     cb_state->static_status &= ~CBSTATUS_LINE_STIPPLE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor,
                                                           float depthBiasClamp, float depthBiasSlopeFactor) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_DEPTH_BIAS_SET;
     cb_state->static_status &= ~CBSTATUS_DEPTH_BIAS_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
                                                         const VkRect2D *pScissors) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->scissorMask |= ((1u << scissorCount) - 1u) << firstScissor;
     cb_state->status |= CBSTATUS_SCISSOR_SET;
     cb_state->static_status &= ~CBSTATUS_SCISSOR_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_BLEND_CONSTANTS_SET;
     cb_state->static_status &= ~CBSTATUS_BLEND_CONSTANTS_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds,
                                                             float maxDepthBounds) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_DEPTH_BOUNDS_SET;
     cb_state->static_status &= ~CBSTATUS_DEPTH_BOUNDS_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                                    uint32_t compareMask) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_STENCIL_READ_MASK_SET;
     cb_state->static_status &= ~CBSTATUS_STENCIL_READ_MASK_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                                  uint32_t writeMask) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_STENCIL_WRITE_MASK_SET;
     cb_state->static_status &= ~CBSTATUS_STENCIL_WRITE_MASK_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                                  uint32_t reference) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_STENCIL_REFERENCE_SET;
     cb_state->static_status &= ~CBSTATUS_STENCIL_REFERENCE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 // Update pipeline_layout bind points applying the "Pipeline Layout Compatibility" rules.
@@ -3743,6 +4020,7 @@ void ValidationStateTracker::UpdateLastBoundDescriptorSets(CMD_BUFFER_STATE *cb_
     auto &last_bound = cb_state->lastBound[pipeline_bind_point];
     auto &pipe_compat_ids = pipeline_layout->compat_for_set;
     const uint32_t current_size = static_cast<uint32_t>(last_bound.per_set.size());
+    last_bound.draw_dirty_mask |= CBDIRTY_DESCRIPTOR_SETS;
 
     // We need this three times in this function, but nowhere else
     auto push_descriptor_cleanup = [&last_bound](const cvdescriptorset::DescriptorSet *ds) -> bool {
@@ -3811,6 +4089,10 @@ void ValidationStateTracker::UpdateLastBoundDescriptorSets(CMD_BUFFER_STATE *cb_
             if (!descriptor_set->IsPushDescriptor()) {
                 // Can't cache validation of push_descriptors
                 cb_state->validated_descriptor_sets.insert(descriptor_set);
+                if (set_dynamic_descriptor_count) {
+                    // New dynamic offsets, so dynamic buffer bindings validated for earlier binds are stale
+                    descriptor_set->ClearCachedDynamicDescriptorValidation(cb_state);
+                }
             }
         }
     }
@@ -3822,6 +4104,7 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorSets(VkCommandBuffer
                                                                 uint32_t firstSet, uint32_t setCount,
                                                                 const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
                                                                 const uint32_t *pDynamicOffsets) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     auto pipeline_layout = GetPipelineLayout(layout);
 
@@ -3867,6 +4150,7 @@ void ValidationStateTracker::PreCallRecordCmdPushDescriptorSetKHR(VkCommandBuffe
                                                                   VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout,
                                                                   uint32_t set, uint32_t descriptorWriteCount,
                                                                   const VkWriteDescriptorSet *pDescriptorWrites) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     RecordCmdPushDescriptorSetState(cb_state, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
 }
@@ -3874,6 +4158,7 @@ void ValidationStateTracker::PreCallRecordCmdPushDescriptorSetKHR(VkCommandBuffe
 void ValidationStateTracker::PostCallRecordCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
                                                             VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size,
                                                             const void *pValues) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (cb_state != nullptr) {
         ResetCommandBufferPushConstantDataIfIncompatible(cb_state, layout);
@@ -3886,6 +4171,7 @@ void ValidationStateTracker::PostCallRecordCmdPushConstants(VkCommandBuffer comm
 
 void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                              VkIndexType indexType) {
+    if (shared_state_source) return;
     auto buffer_state = GetBufferState(buffer);
     auto cb_state = GetCBState(commandBuffer);
 
@@ -3902,7 +4188,9 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer com
 void ValidationStateTracker::PreCallRecordCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding,
                                                                uint32_t bindingCount, const VkBuffer *pBuffers,
                                                                const VkDeviceSize *pOffsets) {
+    if (shared_state_source) return;
     auto cb_state = GetCBState(commandBuffer);
+    cb_state->draw_dirty_mask |= CBDIRTY_VERTEX_BUFFERS;
 
     uint32_t end = firstBinding + bindingCount;
     if (cb_state->current_vertex_buffer_binding_info.vertex_buffer_bindings.size() < end) {
@@ -3924,6 +4212,7 @@ void ValidationStateTracker::PreCallRecordCmdBindVertexBuffers(VkCommandBuffer c
 
 void ValidationStateTracker::PostCallRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer,
                                                            VkDeviceSize dstOffset, VkDeviceSize dataSize, const void *pData) {
+    if (shared_state_source) return;
     auto cb_state = GetCBState(commandBuffer);
     auto dst_buffer_state = GetBufferState(dstBuffer);
 
@@ -3939,6 +4228,7 @@ bool ValidationStateTracker::SetEventStageMask(VkEvent event, VkPipelineStageFla
 
 void ValidationStateTracker::PreCallRecordCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event,
                                                       VkPipelineStageFlags stageMask) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     auto event_state = GetEventState(event);
     if (event_state) {
@@ -3948,14 +4238,12 @@ void ValidationStateTracker::PreCallRecordCmdSetEvent(VkCommandBuffer commandBuf
     if (!cb_state->waitedEvents.count(event)) {
         cb_state->writeEventsBeforeWait.push_back(event);
     }
-    cb_state->eventUpdates.emplace_back(
-        [event, stageMask](const ValidationStateTracker *device_data, bool do_validate, EventToStageMap *localEventToStageMap) {
-            return SetEventStageMask(event, stageMask, localEventToStageMap);
-        });
+    cb_state->eventUpdates.emplace_back(EventUpdate::SetStageMask(event, stageMask));
 }
 
 void ValidationStateTracker::PreCallRecordCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event,
                                                         VkPipelineStageFlags stageMask) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     auto event_state = GetEventState(event);
     if (event_state) {
@@ -3966,10 +4254,7 @@ void ValidationStateTracker::PreCallRecordCmdResetEvent(VkCommandBuffer commandB
         cb_state->writeEventsBeforeWait.push_back(event);
     }
 
-    cb_state->eventUpdates.emplace_back(
-        [event](const ValidationStateTracker *, bool do_validate, EventToStageMap *localEventToStageMap) {
-            return SetEventStageMask(event, VkPipelineStageFlags(0), localEventToStageMap);
-        });
+    cb_state->eventUpdates.emplace_back(EventUpdate::SetStageMask(event, VkPipelineStageFlags(0)));
 }
 
 void ValidationStateTracker::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
@@ -3979,6 +4264,7 @@ void ValidationStateTracker::PreCallRecordCmdWaitEvents(VkCommandBuffer commandB
                                                         const VkBufferMemoryBarrier *pBufferMemoryBarriers,
                                                         uint32_t imageMemoryBarrierCount,
                                                         const VkImageMemoryBarrier *pImageMemoryBarriers) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     for (uint32_t i = 0; i < eventCount; ++i) {
         auto event_state = GetEventState(pEvents[i]);
@@ -4005,6 +4291,26 @@ bool ValidationStateTracker::SetQueryStateMulti(VkQueryPool queryPool, uint32_t
     return false;
 }
 
+void ValidationStateTracker::ApplyEventUpdate(const EventUpdate &update, EventToStageMap *localEventToStageMap) {
+    if (update.type == EventUpdate::kSetStageMask) {
+        SetEventStageMask(update.event, update.stage_mask, localEventToStageMap);
+    }
+}
+
+void ValidationStateTracker::ApplyQueryUpdate(const QueryUpdate &update, uint32_t perfPass, QueryMap *localQueryToStateMap) {
+    switch (update.type) {
+        case QueryUpdate::kSetState:
+            SetQueryState(QueryObject(update.query, perfPass), update.state, localQueryToStateMap);
+            break;
+        case QueryUpdate::kSetStateRange:
+            SetQueryStateMulti(update.query.pool, update.query.query, update.query_count, perfPass, update.state,
+                               localQueryToStateMap);
+            break;
+        default:
+            break;
+    }
+}
+
 QueryState ValidationStateTracker::GetQueryState(const QueryMap *localQueryToStateMap, VkQueryPool queryPool, uint32_t queryIndex,
                                                  uint32_t perfPass) const {
     QueryObject query = QueryObject(QueryObject(queryPool, queryIndex), perfPass);
@@ -4019,12 +4325,7 @@ void ValidationStateTracker::RecordCmdBeginQuery(CMD_BUFFER_STATE *cb_state, con
     if (disabled[query_validation]) return;
     cb_state->activeQueries.insert(query_obj);
     cb_state->startedQueries.insert(query_obj);
-    cb_state->queryUpdates.emplace_back([query_obj](const ValidationStateTracker *device_data, bool do_validate,
-                                                    VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                    QueryMap *localQueryToStateMap) {
-        SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_RUNNING, localQueryToStateMap);
-        return false;
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::SetState(query_obj, QUERYSTATE_RUNNING));
     auto pool_state = GetQueryPoolState(query_obj.pool);
     AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(query_obj.pool, kVulkanObjectTypeQueryPool, pool_state),
                             cb_state);
@@ -4032,6 +4333,7 @@ void ValidationStateTracker::RecordCmdBeginQuery(CMD_BUFFER_STATE *cb_state, con
 
 void ValidationStateTracker::PostCallRecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot,
                                                          VkFlags flags) {
+    if (shared_state_source) return;
     if (disabled[query_validation]) return;
     QueryObject query = {queryPool, slot};
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
@@ -4041,17 +4343,14 @@ void ValidationStateTracker::PostCallRecordCmdBeginQuery(VkCommandBuffer command
 void ValidationStateTracker::RecordCmdEndQuery(CMD_BUFFER_STATE *cb_state, const QueryObject &query_obj) {
     if (disabled[query_validation]) return;
     cb_state->activeQueries.erase(query_obj);
-    cb_state->queryUpdates.emplace_back([query_obj](const ValidationStateTracker *device_data, bool do_validate,
-                                                    VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                    QueryMap *localQueryToStateMap) {
-        return SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_ENDED, localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::SetState(query_obj, QUERYSTATE_ENDED));
     auto pool_state = GetQueryPoolState(query_obj.pool);
     AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(query_obj.pool, kVulkanObjectTypeQueryPool, pool_state),
                             cb_state);
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot) {
+    if (shared_state_source) return;
     if (disabled[query_validation]) return;
     QueryObject query_obj = {queryPool, slot};
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
@@ -4060,6 +4359,7 @@ void ValidationStateTracker::PostCallRecordCmdEndQuery(VkCommandBuffer commandBu
 
 void ValidationStateTracker::PostCallRecordCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
                                                              uint32_t firstQuery, uint32_t queryCount) {
+    if (shared_state_source) return;
     if (disabled[query_validation]) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
 
@@ -4068,12 +4368,7 @@ void ValidationStateTracker::PostCallRecordCmdResetQueryPool(VkCommandBuffer com
         cb_state->resetQueries.insert(query);
     }
 
-    cb_state->queryUpdates.emplace_back([queryPool, firstQuery, queryCount](const ValidationStateTracker *device_data,
-                                                                            bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                                                            uint32_t perfQueryPass,
-                                                                            QueryMap *localQueryToStateMap) {
-        return SetQueryStateMulti(queryPool, firstQuery, queryCount, perfQueryPass, QUERYSTATE_RESET, localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::SetStateRange(queryPool, firstQuery, queryCount, QUERYSTATE_RESET));
     auto pool_state = GetQueryPoolState(queryPool);
     AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool, pool_state),
                             cb_state);
@@ -4083,6 +4378,7 @@ void ValidationStateTracker::PostCallRecordCmdCopyQueryPoolResults(VkCommandBuff
                                                                    uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer,
                                                                    VkDeviceSize dstOffset, VkDeviceSize stride,
                                                                    VkQueryResultFlags flags) {
+    if (shared_state_source) return;
     if (disabled[query_validation]) return;
     auto cb_state = GetCBState(commandBuffer);
     auto dst_buff_state = GetBufferState(dstBuffer);
@@ -4094,22 +4390,20 @@ void ValidationStateTracker::PostCallRecordCmdCopyQueryPoolResults(VkCommandBuff
 
 void ValidationStateTracker::PostCallRecordCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
                                                              VkQueryPool queryPool, uint32_t slot) {
+    if (shared_state_source) return;
     if (disabled[query_validation]) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     auto pool_state = GetQueryPoolState(queryPool);
     AddCommandBufferBinding(pool_state->cb_bindings, VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool, pool_state),
                             cb_state);
     QueryObject query = {queryPool, slot};
-    cb_state->queryUpdates.emplace_back([query](const ValidationStateTracker *device_data, bool do_validate,
-                                                VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                QueryMap *localQueryToStateMap) {
-        return SetQueryState(QueryObject(query, perfQueryPass), QUERYSTATE_ENDED, localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::SetState(query, QUERYSTATE_ENDED));
 }
 
 void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo,
                                                              const VkAllocationCallbacks *pAllocator, VkFramebuffer *pFramebuffer,
                                                              VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     // Shadow create info and store in map
     auto fb_state = std::make_shared<FRAMEBUFFER_STATE>(*pFramebuffer, pCreateInfo, GetRenderPassShared(pCreateInfo->renderPass));
@@ -4352,6 +4646,7 @@ void ValidationStateTracker::RecordCreateRenderPassState(RenderPassCreateVersion
 void ValidationStateTracker::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
                                                             const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                             VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto render_pass_state = std::make_shared<RENDER_PASS_STATE>(pCreateInfo);
     RecordCreateRenderPassState(RENDER_PASS_VERSION_1, render_pass_state, pRenderPass);
@@ -4368,12 +4663,14 @@ void ValidationStateTracker::RecordCreateRenderPass2(VkDevice device, const VkRe
 void ValidationStateTracker::PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR *pCreateInfo,
                                                                 const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                                 VkResult result) {
+    if (shared_state_source) return;
     RecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
 }
 
 void ValidationStateTracker::PostCallRecordCreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2KHR *pCreateInfo,
                                                              const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                              VkResult result) {
+    if (shared_state_source) return;
     RecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
 }
 
@@ -4390,6 +4687,7 @@ void ValidationStateTracker::RecordCmdBeginRenderPassState(VkCommandBuffer comma
         cb_state->activeRenderPassBeginInfo = safe_VkRenderPassBeginInfo(pRenderPassBegin);
         cb_state->activeSubpass = 0;
         cb_state->activeSubpassContents = contents;
+        cb_state->draw_dirty_mask |= CBDIRTY_SUBPASS;
         if (framebuffer) cb_state->framebuffers.insert(framebuffer);
         // Connect this framebuffer and its children to this cmdBuffer
         AddFramebufferBinding(cb_state, framebuffer.get());
@@ -4419,12 +4717,14 @@ void ValidationStateTracker::RecordCmdBeginRenderPassState(VkCommandBuffer comma
 void ValidationStateTracker::PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer,
                                                              const VkRenderPassBeginInfo *pRenderPassBegin,
                                                              VkSubpassContents contents) {
+    if (shared_state_source) return;
     RecordCmdBeginRenderPassState(commandBuffer, pRenderPassBegin, contents);
 }
 
 void ValidationStateTracker::PreCallRecordCmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
                                                                  const VkRenderPassBeginInfo *pRenderPassBegin,
                                                                  const VkSubpassBeginInfoKHR *pSubpassBeginInfo) {
+    if (shared_state_source) return;
     RecordCmdBeginRenderPassState(commandBuffer, pRenderPassBegin, pSubpassBeginInfo->contents);
 }
 
@@ -4432,6 +4732,7 @@ void ValidationStateTracker::PostCallRecordCmdBeginTransformFeedbackEXT(VkComman
                                                                         uint32_t counterBufferCount,
                                                                         const VkBuffer *pCounterBuffers,
                                                                         const VkDeviceSize *pCounterBufferOffsets) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
 
     cb_state->transform_feedback_active = true;
@@ -4440,6 +4741,7 @@ void ValidationStateTracker::PostCallRecordCmdBeginTransformFeedbackEXT(VkComman
 void ValidationStateTracker::PostCallRecordCmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer,
                                                                       uint32_t counterBufferCount, const VkBuffer *pCounterBuffers,
                                                                       const VkDeviceSize *pCounterBufferOffsets) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
 
     cb_state->transform_feedback_active = false;
@@ -4448,6 +4750,7 @@ void ValidationStateTracker::PostCallRecordCmdEndTransformFeedbackEXT(VkCommandB
 void ValidationStateTracker::PreCallRecordCmdBeginRenderPass2(VkCommandBuffer commandBuffer,
                                                               const VkRenderPassBeginInfo *pRenderPassBegin,
                                                               const VkSubpassBeginInfoKHR *pSubpassBeginInfo) {
+    if (shared_state_source) return;
     RecordCmdBeginRenderPassState(commandBuffer, pRenderPassBegin, pSubpassBeginInfo->contents);
 }
 
@@ -4455,21 +4758,25 @@ void ValidationStateTracker::RecordCmdNextSubpass(VkCommandBuffer commandBuffer,
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->activeSubpass++;
     cb_state->activeSubpassContents = contents;
+    cb_state->draw_dirty_mask |= CBDIRTY_SUBPASS;
 }
 
 void ValidationStateTracker::PostCallRecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+    if (shared_state_source) return;
     RecordCmdNextSubpass(commandBuffer, contents);
 }
 
 void ValidationStateTracker::PostCallRecordCmdNextSubpass2KHR(VkCommandBuffer commandBuffer,
                                                               const VkSubpassBeginInfoKHR *pSubpassBeginInfo,
                                                               const VkSubpassEndInfoKHR *pSubpassEndInfo) {
+    if (shared_state_source) return;
     RecordCmdNextSubpass(commandBuffer, pSubpassBeginInfo->contents);
 }
 
 void ValidationStateTracker::PostCallRecordCmdNextSubpass2(VkCommandBuffer commandBuffer,
                                                            const VkSubpassBeginInfoKHR *pSubpassBeginInfo,
                                                            const VkSubpassEndInfoKHR *pSubpassEndInfo) {
+    if (shared_state_source) return;
     RecordCmdNextSubpass(commandBuffer, pSubpassBeginInfo->contents);
 }
 
@@ -4479,23 +4786,28 @@ void ValidationStateTracker::RecordCmdEndRenderPassState(VkCommandBuffer command
     cb_state->activeSubpass = 0;
     cb_state->activeFramebuffer = VK_NULL_HANDLE;
     cb_state->imagelessFramebufferAttachments.clear();
+    cb_state->draw_dirty_mask |= CBDIRTY_SUBPASS;
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+    if (shared_state_source) return;
     RecordCmdEndRenderPassState(commandBuffer);
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer,
                                                                 const VkSubpassEndInfoKHR *pSubpassEndInfo) {
+    if (shared_state_source) return;
     RecordCmdEndRenderPassState(commandBuffer);
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer,
                                                              const VkSubpassEndInfoKHR *pSubpassEndInfo) {
+    if (shared_state_source) return;
     RecordCmdEndRenderPassState(commandBuffer);
 }
 void ValidationStateTracker::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBuffersCount,
                                                              const VkCommandBuffer *pCommandBuffers) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
 
     CMD_BUFFER_STATE *sub_cb_state = NULL;
@@ -4515,35 +4827,40 @@ void ValidationStateTracker::PreCallRecordCmdExecuteCommands(VkCommandBuffer com
         // ValidationStateTracker these maps will be empty, so leaving the propagation in the the state tracker should be a no-op
         // for those other classes.
         for (const auto &sub_layout_map_entry : sub_cb_state->image_layout_map) {
-            const auto image = sub_layout_map_entry.first;
-            const auto *image_state = GetImageState(image);
+            const auto *image_state = GetImageStateFromLayoutSlot(sub_layout_map_entry.slot, sub_layout_map_entry.image);
             if (!image_state) continue;  // Can't set layouts of a dead image
 
             auto *cb_subres_map = GetImageSubresourceLayoutMap(cb_state, *image_state);
-            const auto *sub_cb_subres_map = sub_layout_map_entry.second.get();
+            const auto *sub_cb_subres_map = sub_layout_map_entry.layout_map.get();
             assert(cb_subres_map && sub_cb_subres_map);  // Non const get and map traversal should never be null
             cb_subres_map->UpdateFrom(*sub_cb_subres_map);
         }
 
-        sub_cb_state->primaryCommandBuffer = cb_state->commandBuffer;
-        cb_state->linkedCommandBuffers.insert(sub_cb_state);
-        sub_cb_state->linkedCommandBuffers.insert(cb_state);
-        for (auto &function : sub_cb_state->queryUpdates) {
-            cb_state->queryUpdates.push_back(function);
-        }
-        for (auto &function : sub_cb_state->queue_submit_functions) {
-            cb_state->queue_submit_functions.push_back(function);
+        {
+            // Simultaneous use secondaries can be executed by primaries being recorded on other threads
+            std::unique_lock<std::mutex> lock(cb_binding_mutex, std::defer_lock);
+            if (fine_grained_locking_enabled) lock.lock();
+            sub_cb_state->primaryCommandBuffer = cb_state->commandBuffer;
+            cb_state->linkedCommandBuffers.insert(sub_cb_state);
+            sub_cb_state->linkedCommandBuffers.insert(cb_state);
         }
+        cb_state->queryUpdates.insert(cb_state->queryUpdates.end(), sub_cb_state->queryUpdates.cbegin(),
+                                      sub_cb_state->queryUpdates.cend());
+        cb_state->submit_time_barrier_checks.insert(cb_state->submit_time_barrier_checks.end(),
+                                                    sub_cb_state->submit_time_barrier_checks.cbegin(),
+                                                    sub_cb_state->submit_time_barrier_checks.cend());
     }
 }
 
 void ValidationStateTracker::PostCallRecordMapMemory(VkDevice device, VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size,
                                                      VkFlags flags, void **ppData, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordMappedMemory(mem, offset, size, ppData);
 }
 
 void ValidationStateTracker::PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory mem) {
+    if (shared_state_source) return;
     auto mem_info = GetDevMemState(mem);
     if (mem_info) {
         mem_info->mapped_range = MemRange();
@@ -4585,6 +4902,7 @@ void ValidationStateTracker::UpdateBindImageMemoryState(const VkBindImageMemoryI
 
 void ValidationStateTracker::PostCallRecordBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory mem,
                                                            VkDeviceSize memoryOffset, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     VkBindImageMemoryInfo bindInfo = {};
     bindInfo.sType = VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO;
@@ -4596,6 +4914,7 @@ void ValidationStateTracker::PostCallRecordBindImageMemory(VkDevice device, VkIm
 
 void ValidationStateTracker::PostCallRecordBindImageMemory2(VkDevice device, uint32_t bindInfoCount,
                                                             const VkBindImageMemoryInfoKHR *pBindInfos, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     for (uint32_t i = 0; i < bindInfoCount; i++) {
         UpdateBindImageMemoryState(pBindInfos[i]);
@@ -4604,6 +4923,7 @@ void ValidationStateTracker::PostCallRecordBindImageMemory2(VkDevice device, uin
 
 void ValidationStateTracker::PostCallRecordBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount,
                                                                const VkBindImageMemoryInfoKHR *pBindInfos, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     for (uint32_t i = 0; i < bindInfoCount; i++) {
         UpdateBindImageMemoryState(pBindInfos[i]);
@@ -4611,6 +4931,7 @@ void ValidationStateTracker::PostCallRecordBindImageMemory2KHR(VkDevice device,
 }
 
 void ValidationStateTracker::PreCallRecordSetEvent(VkDevice device, VkEvent event) {
+    if (shared_state_source) return;
     auto event_state = GetEventState(event);
     if (event_state) {
         event_state->stageMask = VK_PIPELINE_STAGE_HOST_BIT;
@@ -4620,6 +4941,7 @@ void ValidationStateTracker::PreCallRecordSetEvent(VkDevice device, VkEvent even
 void ValidationStateTracker::PostCallRecordImportSemaphoreFdKHR(VkDevice device,
                                                                 const VkImportSemaphoreFdInfoKHR *pImportSemaphoreFdInfo,
                                                                 VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordImportSemaphoreState(pImportSemaphoreFdInfo->semaphore, pImportSemaphoreFdInfo->handleType,
                                pImportSemaphoreFdInfo->flags);
@@ -4637,6 +4959,7 @@ void ValidationStateTracker::RecordGetExternalSemaphoreState(VkSemaphore semapho
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 void ValidationStateTracker::PostCallRecordImportSemaphoreWin32HandleKHR(
     VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR *pImportSemaphoreWin32HandleInfo, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordImportSemaphoreState(pImportSemaphoreWin32HandleInfo->semaphore, pImportSemaphoreWin32HandleInfo->handleType,
                                pImportSemaphoreWin32HandleInfo->flags);
@@ -4645,12 +4968,14 @@ void ValidationStateTracker::PostCallRecordImportSemaphoreWin32HandleKHR(
 void ValidationStateTracker::PostCallRecordGetSemaphoreWin32HandleKHR(VkDevice device,
                                                                       const VkSemaphoreGetWin32HandleInfoKHR *pGetWin32HandleInfo,
                                                                       HANDLE *pHandle, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordGetExternalSemaphoreState(pGetWin32HandleInfo->semaphore, pGetWin32HandleInfo->handleType);
 }
 
 void ValidationStateTracker::PostCallRecordImportFenceWin32HandleKHR(
     VkDevice device, const VkImportFenceWin32HandleInfoKHR *pImportFenceWin32HandleInfo, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordImportFenceState(pImportFenceWin32HandleInfo->fence, pImportFenceWin32HandleInfo->handleType,
                            pImportFenceWin32HandleInfo->flags);
@@ -4659,6 +4984,7 @@ void ValidationStateTracker::PostCallRecordImportFenceWin32HandleKHR(
 void ValidationStateTracker::PostCallRecordGetFenceWin32HandleKHR(VkDevice device,
                                                                   const VkFenceGetWin32HandleInfoKHR *pGetWin32HandleInfo,
                                                                   HANDLE *pHandle, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordGetExternalFenceState(pGetWin32HandleInfo->fence, pGetWin32HandleInfo->handleType);
 }
@@ -4666,6 +4992,7 @@ void ValidationStateTracker::PostCallRecordGetFenceWin32HandleKHR(VkDevice devic
 
 void ValidationStateTracker::PostCallRecordGetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR *pGetFdInfo, int *pFd,
                                                              VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordGetExternalSemaphoreState(pGetFdInfo->semaphore, pGetFdInfo->handleType);
 }
@@ -4685,6 +5012,7 @@ void ValidationStateTracker::RecordImportFenceState(VkFence fence, VkExternalFen
 
 void ValidationStateTracker::PostCallRecordImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR *pImportFenceFdInfo,
                                                             VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordImportFenceState(pImportFenceFdInfo->fence, pImportFenceFdInfo->handleType, pImportFenceFdInfo->flags);
 }
@@ -4704,12 +5032,14 @@ void ValidationStateTracker::RecordGetExternalFenceState(VkFence fence, VkExtern
 
 void ValidationStateTracker::PostCallRecordGetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR *pGetFdInfo, int *pFd,
                                                          VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordGetExternalFenceState(pGetFdInfo->fence, pGetFdInfo->handleType);
 }
 
 void ValidationStateTracker::PostCallRecordCreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator, VkEvent *pEvent, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     eventMap[*pEvent].write_in_use = 0;
     eventMap[*pEvent].stageMask = VkPipelineStageFlags(0);
@@ -4739,6 +5069,7 @@ void ValidationStateTracker::RecordCreateSwapchainState(VkResult result, const V
 void ValidationStateTracker::PostCallRecordCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
                                                               const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain,
                                                               VkResult result) {
+    if (shared_state_source) return;
     auto surface_state = GetSurfaceState(pCreateInfo->surface);
     auto old_swapchain_state = GetSwapchainState(pCreateInfo->oldSwapchain);
     RecordCreateSwapchainState(result, pCreateInfo, pSwapchain, surface_state, old_swapchain_state);
@@ -4746,11 +5077,14 @@ void ValidationStateTracker::PostCallRecordCreateSwapchainKHR(VkDevice device, c
 
 void ValidationStateTracker::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
                                                               const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!swapchain) return;
     auto swapchain_data = GetSwapchainState(swapchain);
     if (swapchain_data) {
         for (const auto &swapchain_image : swapchain_data->images) {
             ClearMemoryObjectBindings(VulkanTypedHandle(swapchain_image.image, kVulkanObjectTypeImage));
+            auto image_state = GetImageState(swapchain_image.image);
+            if (image_state) ReleaseImageLayoutSlot(image_state);
             imageMap.erase(swapchain_image.image);
             RemoveAliasingImages(swapchain_image.bound_images);
         }
@@ -4765,6 +5099,7 @@ void ValidationStateTracker::PreCallRecordDestroySwapchainKHR(VkDevice device, V
 }
 
 void ValidationStateTracker::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo, VkResult result) {
+    if (shared_state_source) return;
     // Semaphore waits occur before error generation, if the call reached the ICD. (Confirm?)
     for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
         auto pSemaphore = GetSemaphoreState(pPresentInfo->pWaitSemaphores[i]);
@@ -4800,6 +5135,7 @@ void ValidationStateTracker::PostCallRecordCreateSharedSwapchainsKHR(VkDevice de
                                                                      const VkSwapchainCreateInfoKHR *pCreateInfos,
                                                                      const VkAllocationCallbacks *pAllocator,
                                                                      VkSwapchainKHR *pSwapchains, VkResult result) {
+    if (shared_state_source) return;
     if (pCreateInfos) {
         for (uint32_t i = 0; i < swapchainCount; i++) {
             auto surface_state = GetSurfaceState(pCreateInfos[i].surface);
@@ -4842,12 +5178,14 @@ void ValidationStateTracker::RecordAcquireNextImageState(VkDevice device, VkSwap
 void ValidationStateTracker::PostCallRecordAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
                                                                VkSemaphore semaphore, VkFence fence, uint32_t *pImageIndex,
                                                                VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_SUBOPTIMAL_KHR != result)) return;
     RecordAcquireNextImageState(device, swapchain, timeout, semaphore, fence, pImageIndex);
 }
 
 void ValidationStateTracker::PostCallRecordAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR *pAcquireInfo,
                                                                 uint32_t *pImageIndex, VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_SUBOPTIMAL_KHR != result)) return;
     RecordAcquireNextImageState(device, pAcquireInfo->swapchain, pAcquireInfo->timeout, pAcquireInfo->semaphore,
                                 pAcquireInfo->fence, pImageIndex);
@@ -4855,6 +5193,7 @@ void ValidationStateTracker::PostCallRecordAcquireNextImage2KHR(VkDevice device,
 
 void ValidationStateTracker::PostCallRecordEnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount,
                                                                     VkPhysicalDevice *pPhysicalDevices, VkResult result) {
+    if (shared_state_source) return;
     if ((NULL != pPhysicalDevices) && ((result == VK_SUCCESS || result == VK_INCOMPLETE))) {
         for (uint32_t i = 0; i < *pPhysicalDeviceCount; i++) {
             auto &phys_device_state = physical_device_map[pPhysicalDevices[i]];
@@ -4886,6 +5225,7 @@ static void StateUpdateCommonGetPhysicalDeviceQueueFamilyProperties(PHYSICAL_DEV
 void ValidationStateTracker::PostCallRecordGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice,
                                                                                   uint32_t *pQueueFamilyPropertyCount,
                                                                                   VkQueueFamilyProperties *pQueueFamilyProperties) {
+    if (shared_state_source) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     assert(physical_device_state);
     VkQueueFamilyProperties2KHR *pqfp = nullptr;
@@ -4904,6 +5244,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceQueueFamilyPropertie
 
 void ValidationStateTracker::PostCallRecordGetPhysicalDeviceQueueFamilyProperties2(
     VkPhysicalDevice physicalDevice, uint32_t *pQueueFamilyPropertyCount, VkQueueFamilyProperties2KHR *pQueueFamilyProperties) {
+    if (shared_state_source) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     assert(physical_device_state);
     StateUpdateCommonGetPhysicalDeviceQueueFamilyProperties(physical_device_state, *pQueueFamilyPropertyCount,
@@ -4912,6 +5253,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceQueueFamilyPropertie
 
 void ValidationStateTracker::PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(
     VkPhysicalDevice physicalDevice, uint32_t *pQueueFamilyPropertyCount, VkQueueFamilyProperties2KHR *pQueueFamilyProperties) {
+    if (shared_state_source) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     assert(physical_device_state);
     StateUpdateCommonGetPhysicalDeviceQueueFamilyProperties(physical_device_state, *pQueueFamilyPropertyCount,
@@ -4919,6 +5261,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceQueueFamilyPropertie
 }
 void ValidationStateTracker::PreCallRecordDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface,
                                                             const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!surface) return;
     auto surface_state = GetSurfaceState(surface);
     surface_state->destroyed = true;
@@ -4933,6 +5276,7 @@ void ValidationStateTracker::PostCallRecordCreateDisplayPlaneSurfaceKHR(VkInstan
                                                                         const VkDisplaySurfaceCreateInfoKHR *pCreateInfo,
                                                                         const VkAllocationCallbacks *pAllocator,
                                                                         VkSurfaceKHR *pSurface, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -4942,6 +5286,7 @@ void ValidationStateTracker::PostCallRecordCreateAndroidSurfaceKHR(VkInstance in
                                                                    const VkAndroidSurfaceCreateInfoKHR *pCreateInfo,
                                                                    const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                    VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -4951,6 +5296,7 @@ void ValidationStateTracker::PostCallRecordCreateAndroidSurfaceKHR(VkInstance in
 void ValidationStateTracker::PostCallRecordCreateIOSSurfaceMVK(VkInstance instance, const VkIOSSurfaceCreateInfoMVK *pCreateInfo,
                                                                const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -4961,6 +5307,7 @@ void ValidationStateTracker::PostCallRecordCreateMacOSSurfaceMVK(VkInstance inst
                                                                  const VkMacOSSurfaceCreateInfoMVK *pCreateInfo,
                                                                  const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                  VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -4971,6 +5318,7 @@ void ValidationStateTracker::PostCallRecordCreateMetalSurfaceEXT(VkInstance inst
                                                                  const VkMetalSurfaceCreateInfoEXT *pCreateInfo,
                                                                  const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                  VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -4981,6 +5329,7 @@ void ValidationStateTracker::PostCallRecordCreateWaylandSurfaceKHR(VkInstance in
                                                                    const VkWaylandSurfaceCreateInfoKHR *pCreateInfo,
                                                                    const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                    VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -4991,6 +5340,7 @@ void ValidationStateTracker::PostCallRecordCreateWin32SurfaceKHR(VkInstance inst
                                                                  const VkWin32SurfaceCreateInfoKHR *pCreateInfo,
                                                                  const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                  VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -5000,6 +5350,7 @@ void ValidationStateTracker::PostCallRecordCreateWin32SurfaceKHR(VkInstance inst
 void ValidationStateTracker::PostCallRecordCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR *pCreateInfo,
                                                                const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -5009,6 +5360,7 @@ void ValidationStateTracker::PostCallRecordCreateXcbSurfaceKHR(VkInstance instan
 void ValidationStateTracker::PostCallRecordCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR *pCreateInfo,
                                                                 const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                 VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
@@ -5018,12 +5370,14 @@ void ValidationStateTracker::PostCallRecordCreateHeadlessSurfaceEXT(VkInstance i
                                                                     const VkHeadlessSurfaceCreateInfoEXT *pCreateInfo,
                                                                     const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface,
                                                                     VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordVulkanSurface(pSurface);
 }
 
 void ValidationStateTracker::PostCallRecordGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice,
                                                                      VkPhysicalDeviceFeatures *pFeatures) {
+    if (shared_state_source) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     physical_device_state->vkGetPhysicalDeviceFeaturesState = QUERY_DETAILS;
     // Reset the features2 safe struct before setting up the features field.
@@ -5033,6 +5387,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceFeatures(VkPhysicalD
 
 void ValidationStateTracker::PostCallRecordGetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice,
                                                                       VkPhysicalDeviceFeatures2 *pFeatures) {
+    if (shared_state_source) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     physical_device_state->vkGetPhysicalDeviceFeaturesState = QUERY_DETAILS;
     physical_device_state->features2.initialize(pFeatures);
@@ -5040,6 +5395,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceFeatures2(VkPhysical
 
 void ValidationStateTracker::PostCallRecordGetPhysicalDeviceFeatures2KHR(VkPhysicalDevice physicalDevice,
                                                                          VkPhysicalDeviceFeatures2 *pFeatures) {
+    if (shared_state_source) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     physical_device_state->vkGetPhysicalDeviceFeaturesState = QUERY_DETAILS;
     physical_device_state->features2.initialize(pFeatures);
@@ -5049,6 +5405,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceCapabilitiesK
                                                                                    VkSurfaceKHR surface,
                                                                                    VkSurfaceCapabilitiesKHR *pSurfaceCapabilities,
                                                                                    VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     physical_device_state->vkGetPhysicalDeviceSurfaceCapabilitiesKHRState = QUERY_DETAILS;
@@ -5059,6 +5416,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceCapabilitiesK
 void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(
     VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR *pSurfaceInfo,
     VkSurfaceCapabilities2KHR *pSurfaceCapabilities, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     physical_device_state->vkGetPhysicalDeviceSurfaceCapabilitiesKHRState = QUERY_DETAILS;
@@ -5070,6 +5428,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceCapabilities2
                                                                                     VkSurfaceKHR surface,
                                                                                     VkSurfaceCapabilities2EXT *pSurfaceCapabilities,
                                                                                     VkResult result) {
+    if (shared_state_source) return;
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
     physical_device_state->vkGetPhysicalDeviceSurfaceCapabilitiesKHRState = QUERY_DETAILS;
     physical_device_state->vkGetPhysicalDeviceSurfaceCapabilitiesKHR_called = true;
@@ -5088,6 +5447,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceCapabilities2
 void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice,
                                                                               uint32_t queueFamilyIndex, VkSurfaceKHR surface,
                                                                               VkBool32 *pSupported, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     auto surface_state = GetSurfaceState(surface);
     surface_state->gpu_queue_support[{physicalDevice, queueFamilyIndex}] = (*pSupported == VK_TRUE);
@@ -5098,6 +5458,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfacePresentModesK
                                                                                    uint32_t *pPresentModeCount,
                                                                                    VkPresentModeKHR *pPresentModes,
                                                                                    VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_INCOMPLETE != result)) return;
 
     // TODO: This isn't quite right -- available modes may differ by surface AND physical device.
@@ -5121,6 +5482,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceFormatsKHR(Vk
                                                                               uint32_t *pSurfaceFormatCount,
                                                                               VkSurfaceFormatKHR *pSurfaceFormats,
                                                                               VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_INCOMPLETE != result)) return;
 
     auto physical_device_state = GetPhysicalDeviceState(physicalDevice);
@@ -5144,6 +5506,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceFormats2KHR(V
                                                                                uint32_t *pSurfaceFormatCount,
                                                                                VkSurfaceFormat2KHR *pSurfaceFormats,
                                                                                VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_INCOMPLETE != result)) return;
 
     auto physicalDeviceState = GetPhysicalDeviceState(physicalDevice);
@@ -5166,15 +5529,18 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceSurfaceFormats2KHR(V
 
 void ValidationStateTracker::PreCallRecordCmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer,
                                                                      const VkDebugUtilsLabelEXT *pLabelInfo) {
+    if (shared_state_source) return;
     BeginCmdDebugUtilsLabel(report_data, commandBuffer, pLabelInfo);
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) {
+    if (shared_state_source) return;
     EndCmdDebugUtilsLabel(report_data, commandBuffer);
 }
 
 void ValidationStateTracker::PreCallRecordCmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer,
                                                                       const VkDebugUtilsLabelEXT *pLabelInfo) {
+    if (shared_state_source) return;
     InsertCmdDebugUtilsLabel(report_data, commandBuffer, pLabelInfo);
 
     // Squirrel away an easily accessible copy.
@@ -5200,6 +5566,7 @@ void ValidationStateTracker::RecordEnumeratePhysicalDeviceGroupsState(
 void ValidationStateTracker::PostCallRecordEnumeratePhysicalDeviceGroups(
     VkInstance instance, uint32_t *pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupPropertiesKHR *pPhysicalDeviceGroupProperties,
     VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_INCOMPLETE != result)) return;
     RecordEnumeratePhysicalDeviceGroupsState(pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
 }
@@ -5207,6 +5574,7 @@ void ValidationStateTracker::PostCallRecordEnumeratePhysicalDeviceGroups(
 void ValidationStateTracker::PostCallRecordEnumeratePhysicalDeviceGroupsKHR(
     VkInstance instance, uint32_t *pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupPropertiesKHR *pPhysicalDeviceGroupProperties,
     VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_INCOMPLETE != result)) return;
     RecordEnumeratePhysicalDeviceGroupsState(pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
 }
@@ -5230,16 +5598,19 @@ void ValidationStateTracker::RecordEnumeratePhysicalDeviceQueueFamilyPerformance
 void ValidationStateTracker::PostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(
     VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, uint32_t *pCounterCount, VkPerformanceCounterKHR *pCounters,
     VkPerformanceCounterDescriptionKHR *pCounterDescriptions, VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_INCOMPLETE != result)) return;
     RecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCounters(physicalDevice, queueFamilyIndex, pCounterCount, pCounters);
 }
 
 void ValidationStateTracker::PostCallRecordAcquireProfilingLockKHR(VkDevice device, const VkAcquireProfilingLockInfoKHR *pInfo,
                                                                    VkResult result) {
+    if (shared_state_source) return;
     if (result == VK_SUCCESS) performance_lock_acquired = true;
 }
 
 void ValidationStateTracker::PostCallRecordReleaseProfilingLockKHR(VkDevice device) {
+    if (shared_state_source) return;
     performance_lock_acquired = false;
     for (auto &cmd_buffer : commandBufferMap) {
         cmd_buffer.second->performance_lock_released = true;
@@ -5249,6 +5620,7 @@ void ValidationStateTracker::PostCallRecordReleaseProfilingLockKHR(VkDevice devi
 void ValidationStateTracker::PreCallRecordDestroyDescriptorUpdateTemplate(VkDevice device,
                                                                           VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
                                                                           const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!descriptorUpdateTemplate) return;
     auto template_state = GetDescriptorTemplateState(descriptorUpdateTemplate);
     template_state->destroyed = true;
@@ -5258,6 +5630,7 @@ void ValidationStateTracker::PreCallRecordDestroyDescriptorUpdateTemplate(VkDevi
 void ValidationStateTracker::PreCallRecordDestroyDescriptorUpdateTemplateKHR(VkDevice device,
                                                                              VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
                                                                              const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!descriptorUpdateTemplate) return;
     auto template_state = GetDescriptorTemplateState(descriptorUpdateTemplate);
     template_state->destroyed = true;
@@ -5274,6 +5647,7 @@ void ValidationStateTracker::RecordCreateDescriptorUpdateTemplateState(const VkD
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(
     VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator,
     VkDescriptorUpdateTemplateKHR *pDescriptorUpdateTemplate, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordCreateDescriptorUpdateTemplateState(pCreateInfo, pDescriptorUpdateTemplate);
 }
@@ -5281,6 +5655,7 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplateKHR(
     VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator,
     VkDescriptorUpdateTemplateKHR *pDescriptorUpdateTemplate, VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordCreateDescriptorUpdateTemplateState(pCreateInfo, pDescriptorUpdateTemplate);
 }
@@ -5303,18 +5678,21 @@ void ValidationStateTracker::RecordUpdateDescriptorSetWithTemplateState(VkDescri
 void ValidationStateTracker::PreCallRecordUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
                                                                           VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                                           const void *pData) {
+    if (shared_state_source) return;
     RecordUpdateDescriptorSetWithTemplateState(descriptorSet, descriptorUpdateTemplate, pData);
 }
 
 void ValidationStateTracker::PreCallRecordUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet,
                                                                              VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
                                                                              const void *pData) {
+    if (shared_state_source) return;
     RecordUpdateDescriptorSetWithTemplateState(descriptorSet, descriptorUpdateTemplate, pData);
 }
 
 void ValidationStateTracker::PreCallRecordCmdPushDescriptorSetWithTemplateKHR(
     VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set,
     const void *pData) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
 
     const auto template_state = GetDescriptorTemplateState(descriptorUpdateTemplate);
@@ -5355,6 +5733,7 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceDisplayPlaneProperti
                                                                                       uint32_t *pPropertyCount,
                                                                                       VkDisplayPlanePropertiesKHR *pProperties,
                                                                                       VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_INCOMPLETE != result)) return;
     RecordGetPhysicalDeviceDisplayPlanePropertiesState(physicalDevice, pPropertyCount, pProperties);
 }
@@ -5363,12 +5742,14 @@ void ValidationStateTracker::PostCallRecordGetPhysicalDeviceDisplayPlaneProperti
                                                                                        uint32_t *pPropertyCount,
                                                                                        VkDisplayPlaneProperties2KHR *pProperties,
                                                                                        VkResult result) {
+    if (shared_state_source) return;
     if ((VK_SUCCESS != result) && (VK_INCOMPLETE != result)) return;
     RecordGetPhysicalDeviceDisplayPlanePropertiesState(physicalDevice, pPropertyCount, pProperties);
 }
 
 void ValidationStateTracker::PostCallRecordCmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
                                                                    uint32_t query, VkQueryControlFlags flags, uint32_t index) {
+    if (shared_state_source) return;
     QueryObject query_obj = {queryPool, query, index};
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     RecordCmdBeginQuery(cb_state, query_obj);
@@ -5376,6 +5757,7 @@ void ValidationStateTracker::PostCallRecordCmdBeginQueryIndexedEXT(VkCommandBuff
 
 void ValidationStateTracker::PostCallRecordCmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
                                                                  uint32_t query, uint32_t index) {
+    if (shared_state_source) return;
     QueryObject query_obj = {queryPool, query, index};
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     RecordCmdEndQuery(cb_state, query_obj);
@@ -5406,6 +5788,7 @@ void ValidationStateTracker::PostCallRecordCreateSamplerYcbcrConversion(VkDevice
                                                                         const VkAllocationCallbacks *pAllocator,
                                                                         VkSamplerYcbcrConversion *pYcbcrConversion,
                                                                         VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordCreateSamplerYcbcrConversionState(pCreateInfo, *pYcbcrConversion);
 }
@@ -5415,6 +5798,7 @@ void ValidationStateTracker::PostCallRecordCreateSamplerYcbcrConversionKHR(VkDev
                                                                            const VkAllocationCallbacks *pAllocator,
                                                                            VkSamplerYcbcrConversion *pYcbcrConversion,
                                                                            VkResult result) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     RecordCreateSamplerYcbcrConversionState(pCreateInfo, *pYcbcrConversion);
 }
@@ -5431,6 +5815,7 @@ void ValidationStateTracker::RecordDestroySamplerYcbcrConversionState(VkSamplerY
 
 void ValidationStateTracker::PostCallRecordDestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion,
                                                                          const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!ycbcrConversion) return;
     RecordDestroySamplerYcbcrConversionState(ycbcrConversion);
 }
@@ -5438,6 +5823,7 @@ void ValidationStateTracker::PostCallRecordDestroySamplerYcbcrConversion(VkDevic
 void ValidationStateTracker::PostCallRecordDestroySamplerYcbcrConversionKHR(VkDevice device,
                                                                             VkSamplerYcbcrConversion ycbcrConversion,
                                                                             const VkAllocationCallbacks *pAllocator) {
+    if (shared_state_source) return;
     if (!ycbcrConversion) return;
     RecordDestroySamplerYcbcrConversionState(ycbcrConversion);
 }
@@ -5468,11 +5854,13 @@ void ValidationStateTracker::RecordResetQueryPool(VkDevice device, VkQueryPool q
 
 void ValidationStateTracker::PostCallRecordResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
                                                              uint32_t queryCount) {
+    if (shared_state_source) return;
     RecordResetQueryPool(device, queryPool, firstQuery, queryCount);
 }
 
 void ValidationStateTracker::PostCallRecordResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
                                                           uint32_t queryCount) {
+    if (shared_state_source) return;
     RecordResetQueryPool(device, queryPool, firstQuery, queryCount);
 }
 
@@ -5544,6 +5932,7 @@ void ValidationStateTracker::UpdateStateCmdDrawType(CMD_BUFFER_STATE *cb_state,
 
 void ValidationStateTracker::PostCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                                    uint32_t firstVertex, uint32_t firstInstance) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     UpdateStateCmdDrawType(cb_state, CMD_DRAW, VK_PIPELINE_BIND_POINT_GRAPHICS, "vkCmdDraw()");
 }
@@ -5551,12 +5940,14 @@ void ValidationStateTracker::PostCallRecordCmdDraw(VkCommandBuffer commandBuffer
 void ValidationStateTracker::PostCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount,
                                                           uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset,
                                                           uint32_t firstInstance) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     UpdateStateCmdDrawType(cb_state, CMD_DRAWINDEXED, VK_PIPELINE_BIND_POINT_GRAPHICS, "vkCmdDrawIndexed()");
 }
 
 void ValidationStateTracker::PostCallRecordCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                            uint32_t count, uint32_t stride) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     BUFFER_STATE *buffer_state = GetBufferState(buffer);
     UpdateStateCmdDrawType(cb_state, CMD_DRAWINDIRECT, VK_PIPELINE_BIND_POINT_GRAPHICS, "vkCmdDrawIndirect()");
@@ -5565,6 +5956,7 @@ void ValidationStateTracker::PostCallRecordCmdDrawIndirect(VkCommandBuffer comma
 
 void ValidationStateTracker::PostCallRecordCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                   VkDeviceSize offset, uint32_t count, uint32_t stride) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     BUFFER_STATE *buffer_state = GetBufferState(buffer);
     UpdateStateCmdDrawType(cb_state, CMD_DRAWINDEXEDINDIRECT, VK_PIPELINE_BIND_POINT_GRAPHICS, "vkCmdDrawIndexedIndirect()");
@@ -5572,12 +5964,14 @@ void ValidationStateTracker::PostCallRecordCmdDrawIndexedIndirect(VkCommandBuffe
 }
 
 void ValidationStateTracker::PostCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     UpdateStateCmdDrawDispatchType(cb_state, CMD_DISPATCH, VK_PIPELINE_BIND_POINT_COMPUTE, "vkCmdDispatch()");
 }
 
 void ValidationStateTracker::PostCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                VkDeviceSize offset) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     UpdateStateCmdDrawDispatchType(cb_state, CMD_DISPATCHINDIRECT, VK_PIPELINE_BIND_POINT_COMPUTE, "vkCmdDispatchIndirect()");
     BUFFER_STATE *buffer_state = GetBufferState(buffer);
@@ -5599,6 +5993,7 @@ void ValidationStateTracker::PreCallRecordCmdDrawIndirectCountKHR(VkCommandBuffe
                                                                   VkDeviceSize offset, VkBuffer countBuffer,
                                                                   VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                                   uint32_t stride) {
+    if (shared_state_source) return;
     RecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride,
                                "vkCmdDrawIndirectCountKHR()");
 }
@@ -5606,6 +6001,7 @@ void ValidationStateTracker::PreCallRecordCmdDrawIndirectCountKHR(VkCommandBuffe
 void ValidationStateTracker::PreCallRecordCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                                VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                                uint32_t maxDrawCount, uint32_t stride) {
+    if (shared_state_source) return;
     RecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride,
                                "vkCmdDrawIndirectCount()");
 }
@@ -5625,6 +6021,7 @@ void ValidationStateTracker::PreCallRecordCmdDrawIndexedIndirectCountKHR(VkComma
                                                                          VkDeviceSize offset, VkBuffer countBuffer,
                                                                          VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                                          uint32_t stride) {
+    if (shared_state_source) return;
     RecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride,
                                       "vkCmdDrawIndexedIndirectCountKHR()");
 }
@@ -5633,18 +6030,21 @@ void ValidationStateTracker::PreCallRecordCmdDrawIndexedIndirectCount(VkCommandB
                                                                       VkDeviceSize offset, VkBuffer countBuffer,
                                                                       VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                                       uint32_t stride) {
+    if (shared_state_source) return;
     RecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride,
                                       "vkCmdDrawIndexedIndirectCount()");
 }
 
 void ValidationStateTracker::PreCallRecordCmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount,
                                                              uint32_t firstTask) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     UpdateStateCmdDrawType(cb_state, CMD_DRAWMESHTASKSNV, VK_PIPELINE_BIND_POINT_GRAPHICS, "vkCmdDrawMeshTasksNV()");
 }
 
 void ValidationStateTracker::PreCallRecordCmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                      VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     UpdateStateCmdDrawType(cb_state, CMD_DRAWMESHTASKSINDIRECTNV, VK_PIPELINE_BIND_POINT_GRAPHICS,
                            "vkCmdDrawMeshTasksIndirectNV()");
@@ -5658,6 +6058,7 @@ void ValidationStateTracker::PreCallRecordCmdDrawMeshTasksIndirectCountNV(VkComm
                                                                           VkDeviceSize offset, VkBuffer countBuffer,
                                                                           VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                                           uint32_t stride) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     BUFFER_STATE *buffer_state = GetBufferState(buffer);
     BUFFER_STATE *count_buffer_state = GetBufferState(countBuffer);
@@ -5675,14 +6076,30 @@ void ValidationStateTracker::PostCallRecordCreateShaderModule(VkDevice device, c
                                                               const VkAllocationCallbacks *pAllocator,
                                                               VkShaderModule *pShaderModule, VkResult result,
                                                               void *csm_state_data) {
+    if (shared_state_source) return;
     if (VK_SUCCESS != result) return;
     create_shader_module_api_state *csm_state = reinterpret_cast<create_shader_module_api_state *>(csm_state_data);
 
     spv_target_env spirv_environment = PickSpirvEnv(api_version, (device_extensions.vk_khr_spirv_1_4 != kNotEnabled));
     bool is_spirv = (pCreateInfo->pCode[0] == spv::MagicNumber);
-    auto new_shader_module = is_spirv ? std::make_shared<SHADER_MODULE_STATE>(pCreateInfo, *pShaderModule, spirv_environment,
-                                                                              csm_state->unique_shader_id)
-                                      : std::make_shared<SHADER_MODULE_STATE>();
+    std::shared_ptr<SHADER_MODULE_STATE> new_shader_module;
+    if (is_spirv) {
+        // Reuse the parsing done for identical code, by this or by an earlier run of the application
+        auto cache = GetValidationCacheInfo(pCreateInfo);
+        uint64_t hash = 0;
+        std::shared_ptr<SHADER_MODULE_STATE::StaticData> cached_data;
+        if (cache) {
+            hash = ValidationCache::MakeShaderHash(pCreateInfo, spirv_environment);
+            cached_data = cache->GetStaticData(hash);
+        }
+        new_shader_module = std::make_shared<SHADER_MODULE_STATE>(pCreateInfo, *pShaderModule, spirv_environment,
+                                                                  csm_state->unique_shader_id, cached_data);
+        if (cache && (new_shader_module->static_data != cached_data)) {
+            cache->InsertStaticData(hash, new_shader_module->static_data);
+        }
+    } else {
+        new_shader_module = std::make_shared<SHADER_MODULE_STATE>();
+    }
     shaderModuleMap[*pShaderModule] = std::move(new_shader_module);
 }
 
@@ -5699,11 +6116,13 @@ void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCrea
     stage_state->stage_flag = pStage->stage;
 
     // Mark accessible ids
-    stage_state->accessible_ids = MarkAccessibleIds(module, entrypoint);
+    auto resources = module->GetEntryPointResources(entrypoint);
+    stage_state->accessible_ids = resources->accessible_ids;
     ProcessExecutionModes(module, entrypoint, pipeline);
 
-    stage_state->descriptor_uses = CollectInterfaceByDescriptorSlot(
-        module, stage_state->accessible_ids, &stage_state->has_writable_descriptor, &stage_state->has_atomic_descriptor);
+    stage_state->descriptor_uses = resources->descriptor_uses;
+    stage_state->has_writable_descriptor = resources->has_writable_descriptor;
+    stage_state->has_atomic_descriptor = resources->has_atomic_descriptor;
     // Capture descriptor uses for the pipeline
     for (auto use : stage_state->descriptor_uses) {
         // While validating shaders capture which slots are used by the pipeline
@@ -5743,6 +6162,7 @@ void ValidationStateTracker::ResetCommandBufferPushConstantDataIfIncompatible(CM
 void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain,
                                                                  uint32_t *pSwapchainImageCount, VkImage *pSwapchainImages,
                                                                  VkResult result) {
+    if (shared_state_source) return;
     if ((result != VK_SUCCESS) && (result != VK_INCOMPLETE)) return;
     auto swapchain_state = GetSwapchainState(swapchain);
 
@@ -5786,6 +6206,7 @@ void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device
 
             imageMap[pSwapchainImages[i]] = std::make_shared<IMAGE_STATE>(device, pSwapchainImages[i], &image_ci);
             auto &image_state = imageMap[pSwapchainImages[i]];
+            AllocateImageLayoutSlot(image_state.get());
             image_state->valid = false;
             image_state->create_from_swapchain = swapchain;
             image_state->bind_swapchain = swapchain;
@@ -5809,6 +6230,7 @@ void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device
 void ValidationStateTracker::PostCallRecordCmdBuildAccelerationStructureKHR(
     VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
     const VkAccelerationStructureBuildOffsetInfoKHR *const *ppOffsetInfos) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (cb_state == nullptr) {
         return;
@@ -5830,6 +6252,7 @@ void ValidationStateTracker::PostCallRecordCmdBuildAccelerationStructureKHR(
 
 void ValidationStateTracker::PostCallRecordCmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer,
                                                                            const VkCopyAccelerationStructureInfoKHR *pInfo) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (cb_state) {
         ACCELERATION_STRUCTURE_STATE *src_as_state = GetAccelerationStructureState(pInfo->src);
@@ -5844,50 +6267,62 @@ void ValidationStateTracker::PostCallRecordCmdCopyAccelerationStructureKHR(VkCom
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_CULL_MODE_SET;
     cb_state->static_status &= ~CBSTATUS_CULL_MODE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_FRONT_FACE_SET;
     cb_state->static_status &= ~CBSTATUS_FRONT_FACE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer,
                                                                      VkPrimitiveTopology primitiveTopology) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->primitiveTopology = primitiveTopology;
     cb_state->status |= CBSTATUS_PRIMITIVE_TOPOLOGY_SET;
     cb_state->static_status &= ~CBSTATUS_PRIMITIVE_TOPOLOGY_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount,
                                                                      const VkViewport *pViewports) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->viewportWithCountMask |= (1u << viewportCount) - 1u;
     cb_state->status |= CBSTATUS_VIEWPORT_WITH_COUNT_SET;
     cb_state->static_status &= ~CBSTATUS_VIEWPORT_WITH_COUNT_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount,
                                                                     const VkRect2D *pScissors) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->scissorWithCountMask |= (1u << scissorCount) - 1u;
     cb_state->status |= CBSTATUS_SCISSOR_WITH_COUNT_SET;
     cb_state->static_status &= ~CBSTATUS_SCISSOR_WITH_COUNT_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding,
                                                                    uint32_t bindingCount, const VkBuffer *pBuffers,
                                                                    const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes,
                                                                    const VkDeviceSize *pStrides) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (pStrides) {
         cb_state->status |= CBSTATUS_VERTEX_INPUT_BINDING_STRIDE_SET;
         cb_state->static_status &= ~CBSTATUS_VERTEX_INPUT_BINDING_STRIDE_SET;
     }
+    cb_state->draw_dirty_mask |= CBDIRTY_VERTEX_BUFFERS;
 
     uint32_t end = firstBinding + bindingCount;
     if (cb_state->current_vertex_buffer_binding_info.vertex_buffer_bindings.size() < end) {
@@ -5908,39 +6343,51 @@ void ValidationStateTracker::PreCallRecordCmdBindVertexBuffers2EXT(VkCommandBuff
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_DEPTH_TEST_ENABLE_SET;
     cb_state->static_status &= ~CBSTATUS_DEPTH_TEST_ENABLE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_DEPTH_WRITE_ENABLE_SET;
     cb_state->static_status &= ~CBSTATUS_DEPTH_WRITE_ENABLE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_DEPTH_COMPARE_OP_SET;
     cb_state->static_status &= ~CBSTATUS_DEPTH_COMPARE_OP_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer,
                                                                          VkBool32 depthBoundsTestEnable) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_DEPTH_BOUNDS_TEST_ENABLE_SET;
     cb_state->static_status &= ~CBSTATUS_DEPTH_BOUNDS_TEST_ENABLE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 void ValidationStateTracker::PreCallRecordCmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_STENCIL_TEST_ENABLE_SET;
     cb_state->static_status &= ~CBSTATUS_STENCIL_TEST_ENABLE_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                              VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp,
                                                              VkCompareOp compareOp) {
+    if (shared_state_source) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_STENCIL_OP_SET;
     cb_state->static_status &= ~CBSTATUS_STENCIL_OP_SET;
+    cb_state->draw_dirty_mask |= CBDIRTY_DYNAMIC_STATE;
 }
@@ -381,6 +381,21 @@ class ValidationStateTracker : public ValidationObject {
     // Override base class, we have some extra work to do here
     void InitDeviceValidationObject(bool add_obj, ValidationObject* inst_obj, ValidationObject* dev_obj);
 
+    // With fine grained locking the vkCmd* hooks hold the object-wide lock shared and lock only the target command buffer,
+    // so distinct command buffers can be recorded concurrently. Object creation/destruction and queue operations still take
+    // the object-wide lock exclusively, as do the vkCmd* commands whose recording updates objects shared between command
+    // buffers (exclusive_record_commands in layer_chassis_generator.py). Derived classes opt in only if their own vkCmd* hooks
+    // touch no other unsynchronized state.
+    bool fine_grained_locking_enabled = false;
+    virtual CmdBufferLockGuard cmd_buffer_read_lock(VkCommandBuffer command_buffer);
+    virtual CmdBufferLockGuard cmd_buffer_write_lock(VkCommandBuffer command_buffer);
+    // With shared state tracking, the state read by this tracker is guarded by the lock of the tracker owning it
+    virtual read_lock_guard_t read_lock();
+    virtual write_lock_guard_t write_lock();
+    // Guards the state shared between command buffers that is updated while recording (cb_bindings of bound objects,
+    // primary/secondary command buffer links) when fine grained locking is enabled.
+    std::mutex cb_binding_mutex;
+
     VALSTATETRACK_MAP_AND_TRAITS(VkRenderPass, RENDER_PASS_STATE, renderPassMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorSetLayout, cvdescriptorset::DescriptorSetLayout, descriptorSetLayoutMap)
     VALSTATETRACK_MAP_AND_TRAITS(VkSampler, SAMPLER_STATE, samplerMap)
@@ -406,17 +421,24 @@ class ValidationStateTracker : public ValidationObject {
     VALSTATETRACK_MAP_AND_TRAITS(VkAccelerationStructureNV, ACCELERATION_STRUCTURE_STATE, accelerationStructureMap)
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkSurfaceKHR, SURFACE_STATE, surface_map)
 
+    // The live image states by IMAGE_STATE::layout_slot, and the slots released for reuse by later images
+    std::vector<IMAGE_STATE*> image_layout_slots;
+    std::vector<uint32_t> free_image_layout_slots;
+
     void AddAliasingImage(IMAGE_STATE* image_state);
     void RemoveAliasingImage(IMAGE_STATE* image_state);
     void RemoveAliasingImages(const std::unordered_set<VkImage>& bound_images);
+    void AllocateImageLayoutSlot(IMAGE_STATE* image_state);
+    void ReleaseImageLayoutSlot(IMAGE_STATE* image_state);
 
   public:
     template <typename State>
     typename AccessorTraits<State>::ReturnType Get(typename AccessorTraits<State>::HandleType handle) {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
+        const auto* owner = StateOwner();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (owner->*map_member).size() == 0) ? instance_state->*map_member : owner->*map_member;
 
         const auto found_it = map.find(handle);
         if (found_it == map.end()) {
@@ -429,8 +451,9 @@ class ValidationStateTracker : public ValidationObject {
     const typename AccessorTraits<State>::ReturnType Get(typename AccessorTraits<State>::HandleType handle) const {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
+        const auto* owner = StateOwner();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (owner->*map_member).size() == 0) ? instance_state->*map_member : owner->*map_member;
 
         const auto found_it = map.find(handle);
         if (found_it == map.cend()) {
@@ -443,8 +466,9 @@ class ValidationStateTracker : public ValidationObject {
     typename AccessorTraits<State>::SharedType GetShared(typename AccessorTraits<State>::HandleType handle) {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
+        const auto* owner = StateOwner();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (owner->*map_member).size() == 0) ? instance_state->*map_member : owner->*map_member;
 
         const auto found_it = map.find(handle);
         if (found_it == map.end()) {
@@ -457,8 +481,9 @@ class ValidationStateTracker : public ValidationObject {
     typename AccessorTraits<State>::ConstSharedType GetShared(typename AccessorTraits<State>::HandleType handle) const {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
+        const auto* owner = StateOwner();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (owner->*map_member).size() == 0) ? instance_state->*map_member : owner->*map_member;
 
         const auto found_it = map.find(handle);
         if (found_it == map.cend()) {
@@ -473,8 +498,9 @@ class ValidationStateTracker : public ValidationObject {
     typename AccessorTraits<State>::SharedType GetConstCastShared(typename AccessorTraits<State>::HandleType handle) const {
         using Traits = AccessorTraits<State>;
         auto map_member = Traits::Map();
+        const auto* owner = StateOwner();
         const typename Traits::MapType& map =
-            (Traits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
+            (Traits::kInstanceScope && (owner->*map_member).size() == 0) ? instance_state->*map_member : owner->*map_member;
 
         const auto found_it = map.find(handle);
         if (found_it == map.cend()) {
@@ -515,6 +541,17 @@ class ValidationStateTracker : public ValidationObject {
     std::shared_ptr<IMAGE_STATE> GetImageShared(VkImage image) { return GetShared<IMAGE_STATE>(image); }
     const IMAGE_STATE* GetImageState(VkImage image) const { return Get<IMAGE_STATE>(image); }
     IMAGE_STATE* GetImageState(VkImage image) { return Get<IMAGE_STATE>(image); }
+    // The live image state of a CommandBufferImageLayoutMap entry, without a handle lookup. Null if the image was destroyed.
+    const IMAGE_STATE* GetImageStateFromLayoutSlot(uint32_t slot, VkImage image) const {
+        const auto& slots = StateOwner()->image_layout_slots;
+        const IMAGE_STATE* image_state = (slot < slots.size()) ? slots[slot] : nullptr;
+        return (image_state && (image_state->image == image)) ? image_state : nullptr;
+    }
+    IMAGE_STATE* GetImageStateFromLayoutSlot(uint32_t slot, VkImage image) {
+        const auto& slots = StateOwner()->image_layout_slots;
+        IMAGE_STATE* image_state = (slot < slots.size()) ? slots[slot] : nullptr;
+        return (image_state && (image_state->image == image)) ? image_state : nullptr;
+    }
 
     std::shared_ptr<const BUFFER_VIEW_STATE> GetBufferViewShared(VkBufferView buffer_view) const {
         return GetShared<BUFFER_VIEW_STATE>(buffer_view);
@@ -612,6 +649,15 @@ class ValidationStateTracker : public ValidationObject {
 
     // Link for derived device objects back to their parent instance object
     ValidationStateTracker* instance_state;
+    // With shared state tracking, the first state tracker of the device (in dispatch order). It alone records the device
+    // object state, which any later trackers read from its maps under its lock. Null for the first tracker, or without the
+    // setting.
+    ValidationStateTracker* shared_state_source = nullptr;
+    ValidationStateTracker* StateOwner() { return shared_state_source ? shared_state_source : this; }
+    const ValidationStateTracker* StateOwner() const { return shared_state_source ? shared_state_source : this; }
+    // The trackers reading the state of this one. They record nothing themselves, so their command buffer callbacks are
+    // called from here.
+    std::vector<ValidationStateTracker*> shared_state_readers;
 
     const PHYSICAL_DEVICE_STATE* GetPhysicalDeviceState(VkPhysicalDevice phys) const;
     PHYSICAL_DEVICE_STATE* GetPhysicalDeviceState(VkPhysicalDevice phys);
@@ -1265,6 +1311,9 @@ class ValidationStateTracker : public ValidationObject {
     void RecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout, VkResult result);
     void RetireWorkOnQueue(QUEUE_STATE* pQueue, uint64_t seq);
     static bool SetEventStageMask(VkEvent event, VkPipelineStageFlags stageMask, EventToStageMap* localEventToStageMap);
+    // Apply the state updates of the deferred event and query operations, skipping the checks (see CoreChecks)
+    static void ApplyEventUpdate(const EventUpdate& update, EventToStageMap* localEventToStageMap);
+    static void ApplyQueryUpdate(const QueryUpdate& update, uint32_t perfPass, QueryMap* localQueryToStateMap);
     void ResetCommandBufferPushConstantDataIfIncompatible(CMD_BUFFER_STATE* cb_state, VkPipelineLayout layout);
     void SetMemBinding(VkDeviceMemory mem, BINDABLE* mem_binding, VkDeviceSize memory_offset,
                        const VulkanTypedHandle& typed_handle);
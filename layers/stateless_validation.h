@@ -55,18 +55,81 @@ extern const VkSampleCountFlags AllVkSampleCountFlagBits;
 extern const VkBuildAccelerationStructureFlagsNV AllVkBuildAccelerationStructureFlagBitsNV;
 extern const VkGeometryFlagsKHR AllVkGeometryFlagBitsKHR;
 
-extern const std::vector<VkGeometryTypeKHR> AllVkGeometryTypeKHREnums;
-extern const std::vector<VkCompareOp> AllVkCompareOpEnums;
-extern const std::vector<VkStencilOp> AllVkStencilOpEnums;
-extern const std::vector<VkBlendFactor> AllVkBlendFactorEnums;
-extern const std::vector<VkBlendOp> AllVkBlendOpEnums;
-extern const std::vector<VkLogicOp> AllVkLogicOpEnums;
-extern const std::vector<VkBorderColor> AllVkBorderColorEnums;
-extern const std::vector<VkImageLayout> AllVkImageLayoutEnums;
-extern const std::vector<VkFormat> AllVkFormatEnums;
-extern const std::vector<VkVertexInputRate> AllVkVertexInputRateEnums;
-extern const std::vector<VkPrimitiveTopology> AllVkPrimitiveTopologyEnums;
-extern const std::vector<VkIndexType> AllVkIndexTypeEnums;
+// Set of the valid tokens of a Vulkan enumeration, built once from the generated token lists. Core tokens are a dense range
+// starting at 0, and extension tokens are 1000000000 + (extension number - 1) * 1000 + a small offset, so both are kept as
+// bitmaps and a lookup is a range check plus a bit test. Anything else (negative or unusually large values) is kept in a
+// sorted list.
+template <typename T>
+class ValidEnumValues {
+  public:
+    ValidEnumValues(std::initializer_list<T> values) {
+        for (const auto value : values) {
+            Add(static_cast<int32_t>(value));
+        }
+        std::sort(other_values_.begin(), other_values_.end());
+    }
+
+    bool contains(T value) const {
+        const int32_t token = static_cast<int32_t>(value);
+        if (token >= 0 && token < kExtensionBase) {
+            if (static_cast<uint32_t>(token) < kMaxCoreToken) return TestBit(core_bits_, static_cast<uint32_t>(token));
+        } else if (token >= kExtensionBase) {
+            const uint32_t extension_token = static_cast<uint32_t>(token - kExtensionBase);
+            const uint32_t offset = extension_token % kExtensionBlockSize;
+            if (offset < 64) {
+                const uint32_t block = extension_token / kExtensionBlockSize;
+                return (block < extension_bits_.size()) && ((extension_bits_[block] >> offset) & 1);
+            }
+        }
+        return std::binary_search(other_values_.begin(), other_values_.end(), token);
+    }
+
+  private:
+    static const int32_t kExtensionBase = 1000000000;
+    static const uint32_t kExtensionBlockSize = 1000;
+    static const uint32_t kMaxCoreToken = 4096;
+
+    static bool TestBit(const std::vector<uint64_t> &bits, uint32_t index) {
+        return ((index >> 6) < bits.size()) && ((bits[index >> 6] >> (index & 63)) & 1);
+    }
+
+    void Add(int32_t token) {
+        if (token >= 0 && token < kExtensionBase && static_cast<uint32_t>(token) < kMaxCoreToken) {
+            const uint32_t word = static_cast<uint32_t>(token) >> 6;
+            if (word >= core_bits_.size()) core_bits_.resize(word + 1, 0);
+            core_bits_[word] |= uint64_t(1) << (token & 63);
+            return;
+        }
+        if (token >= kExtensionBase) {
+            const uint32_t extension_token = static_cast<uint32_t>(token - kExtensionBase);
+            const uint32_t offset = extension_token % kExtensionBlockSize;
+            if (offset < 64) {
+                const uint32_t block = extension_token / kExtensionBlockSize;
+                if (block >= extension_bits_.size()) extension_bits_.resize(block + 1, 0);
+                extension_bits_[block] |= uint64_t(1) << offset;
+                return;
+            }
+        }
+        other_values_.push_back(token);
+    }
+
+    std::vector<uint64_t> core_bits_;       // Core tokens, one bit per value
+    std::vector<uint64_t> extension_bits_;  // One word per extension number, one bit per offset
+    std::vector<int32_t> other_values_;
+};
+
+extern const ValidEnumValues<VkGeometryTypeKHR> AllVkGeometryTypeKHREnums;
+extern const ValidEnumValues<VkCompareOp> AllVkCompareOpEnums;
+extern const ValidEnumValues<VkStencilOp> AllVkStencilOpEnums;
+extern const ValidEnumValues<VkBlendFactor> AllVkBlendFactorEnums;
+extern const ValidEnumValues<VkBlendOp> AllVkBlendOpEnums;
+extern const ValidEnumValues<VkLogicOp> AllVkLogicOpEnums;
+extern const ValidEnumValues<VkBorderColor> AllVkBorderColorEnums;
+extern const ValidEnumValues<VkImageLayout> AllVkImageLayoutEnums;
+extern const ValidEnumValues<VkFormat> AllVkFormatEnums;
+extern const ValidEnumValues<VkVertexInputRate> AllVkVertexInputRateEnums;
+extern const ValidEnumValues<VkPrimitiveTopology> AllVkPrimitiveTopologyEnums;
+extern const ValidEnumValues<VkIndexType> AllVkIndexTypeEnums;
 
 extern std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info;
 
@@ -84,6 +147,39 @@ const uint32_t ExtEnumBaseValue = 1000000000;
 // The value of all VK_xxx_MAX_ENUM tokens
 const uint32_t MaxEnumValue = 0x7FFFFFFF;
 
+// Records the pNext pointers and structure types seen while walking a pNext chain, to detect cycles and duplicate sTypes.
+// Chains are nearly always a handful of structures long, so both are searched linearly in inline storage; only chains longer
+// than kMaxLinearEntries fall back to hash sets.
+class PnextChainChecker {
+  public:
+    // Return false if the pointer was already seen
+    bool InsertNext(const void *next) { return Insert(next, nexts_, next_set_); }
+    // Return false if the structure type was already seen
+    bool InsertType(VkStructureType stype) { return Insert(static_cast<int>(stype), stypes_, stype_set_); }
+
+  private:
+    static const uint32_t kInlineEntries = 8;
+    static const uint32_t kMaxLinearEntries = 32;
+
+    template <typename T>
+    static bool Insert(T value, small_vector<T, kInlineEntries> &seen, std::unique_ptr<std::unordered_set<T>> &seen_set) {
+        if (seen_set) return seen_set->insert(value).second;
+        if (std::find(seen.begin(), seen.end(), value) != seen.end()) return false;
+        if (seen.size() < kMaxLinearEntries) {
+            seen.push_back(value);
+        } else {
+            seen_set.reset(new std::unordered_set<T>(seen.begin(), seen.end()));
+            seen_set->insert(value);
+        }
+        return true;
+    }
+
+    small_vector<const void *, kInlineEntries> nexts_;
+    small_vector<int, kInlineEntries> stypes_;
+    std::unique_ptr<std::unordered_set<const void *>> next_set_;
+    std::unique_ptr<std::unordered_set<int>> stype_set_;
+};
+
 class StatelessValidation : public ValidationObject {
   public:
     VkPhysicalDeviceLimits device_limits = {};
@@ -503,9 +599,6 @@ class StatelessValidation : public ValidationObject {
         bool skip_call = false;
 
         if (next != NULL) {
-            std::unordered_set<const void *> cycle_check;
-            std::unordered_set<VkStructureType, std::hash<int>> unique_stype_check;
-
             const char *disclaimer =
                 "This error is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
                 "you are using a struct from a private extension or an extension that was added to a later version of the Vulkan "
@@ -520,31 +613,29 @@ class StatelessValidation : public ValidationObject {
                 const VkStructureType *start = allowed_types;
                 const VkStructureType *end = allowed_types + allowed_type_count;
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
+                // The loader chains its own structures into the create infos of these two calls
+                const size_t api_name_length = strlen(api_name);
+                const bool is_create_instance = strncmp(api_name, "vkCreateInstance", api_name_length) == 0;
+                const bool is_create_device = strncmp(api_name, "vkCreateDevice", api_name_length) == 0;
+                PnextChainChecker chain_checker;
 
-                cycle_check.insert(next);
+                chain_checker.InsertNext(next);
 
                 while (current != NULL) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        if (cycle_check.find(current->pNext) != cycle_check.end()) {
+                    if ((!is_create_instance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
+                        (!is_create_device || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
+                        if (!chain_checker.InsertNext(current->pNext)) {
                             std::string message = "%s: %s chain contains a cycle -- pNext pointer %" PRIx64 " is repeated.";
                             skip_call |= LogError(device, kVUID_PVError_InvalidStructPNext, message.c_str(), api_name,
                                                   parameter_name.get_name().c_str(), reinterpret_cast<uint64_t>(next));
                             break;
-                        } else {
-                            cycle_check.insert(current->pNext);
                         }
 
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end()) {
+                        if (!chain_checker.InsertType(current->sType)) {
                             // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                             std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
                             skip_call |= LogError(device, stype_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
-                                                  type_name.c_str());
-                        } else {
-                            unique_stype_check.insert(current->sType);
+                                                  string_VkStructureType(current->sType));
                         }
 
                         // Search custom stype list -- if sType found, skip this entirely
@@ -557,6 +648,7 @@ class StatelessValidation : public ValidationObject {
                         }
                         if (!custom) {
                             if (std::find(start, end, current->sType) == end) {
+                                const std::string type_name = string_VkStructureType(current->sType);
                                 if (type_name.compare(UnsupportedStructureTypeString) == 0) {
                                     std::string message =
                                         "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures "
@@ -620,16 +712,16 @@ class StatelessValidation : public ValidationObject {
      * @param apiName Name of API call being validated.
      * @param parameterName Name of parameter being validated.
      * @param enumName Name of the enumeration being validated.
-     * @param valid_values The list of valid values for the enumeration.
+     * @param valid_values The set of valid values for the enumeration.
      * @param value Enumeration value to validate.
      * @return Boolean value indicating that the call should be skipped.
      */
     template <typename T>
     bool validate_ranged_enum(const char *apiName, const ParameterName &parameterName, const char *enumName,
-                              const std::vector<T> &valid_values, T value, const char *vuid) const {
+                              const ValidEnumValues<T> &valid_values, T value, const char *vuid) const {
         bool skip = false;
 
-        if (std::find(valid_values.begin(), valid_values.end(), value) == valid_values.end()) {
+        if (!valid_values.contains(value)) {
             skip |=
                 LogError(device, vuid,
                          "%s: value of %s (%d) does not fall within the begin..end range of the core %s enumeration tokens and is "
@@ -654,7 +746,7 @@ class StatelessValidation : public ValidationObject {
      * @param countName Name of count parameter.
      * @param arrayName Name of array parameter.
      * @param enumName Name of the enumeration being validated.
-     * @param valid_values The list of valid values for the enumeration.
+     * @param valid_values The set of valid values for the enumeration.
      * @param count Number of enumeration values in the array.
      * @param array Array of enumeration values to validate.
      * @param countRequired The 'count' parameter may not be 0 when true.
@@ -663,7 +755,7 @@ class StatelessValidation : public ValidationObject {
      */
     template <typename T>
     bool validate_ranged_enum_array(const char *apiName, const ParameterName &countName, const ParameterName &arrayName,
-                                    const char *enumName, const std::vector<T> &valid_values, uint32_t count, const T *array,
+                                    const char *enumName, const ValidEnumValues<T> &valid_values, uint32_t count, const T *array,
                                     bool countRequired, bool arrayRequired) const {
         bool skip_call = false;
 
@@ -672,7 +764,7 @@ class StatelessValidation : public ValidationObject {
                                         kVUIDUndefined);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
-                if (std::find(valid_values.begin(), valid_values.end(), array[i]) == valid_values.end()) {
+                if (!valid_values.contains(array[i])) {
                     skip_call |= LogError(device, kVUID_PVError_UnrecognizedValue,
                                           "%s: value of %s[%d] (%d) does not fall within the begin..end range of the core %s "
                                           "enumeration tokens and is not an extension added token",
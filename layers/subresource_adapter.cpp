@@ -271,7 +271,7 @@ ImageRangeEncoder::ImageRangeEncoder(const IMAGE_STATE& image)
     : ImageRangeEncoder(image, AspectParameters::Get(image.full_range.aspectMask)) {}
 
 ImageRangeEncoder::ImageRangeEncoder(const IMAGE_STATE& image, const AspectParameters* param)
-    : RangeEncoder(image.full_range, param), image_(&image) {
+    : RangeEncoder(image.full_range, param), image_(&image), total_size_(0) {
     if (image_->createInfo.extent.depth > 1) {
         limits_.arrayLayer = image_->createInfo.extent.depth;
     }
@@ -319,6 +319,7 @@ ImageRangeEncoder::ImageRangeEncoder(const IMAGE_STATE& image, const AspectParam
                 }
                 subres_layouts_.push_back(layout);
             }
+            total_size_ += static_cast<IndexType>(subres_layouts_.back().size);
         }
     }
 }
@@ -395,14 +396,19 @@ void ImageRangeGenerator::SetPos() {
             if (range_arraylayer_base_ == 0 && range_layer_count_ == limits.arrayLayer) {
                 mip_count_ = 1;
                 if (subres_range_.baseMipLevel == 0 && subres_range_.levelCount == limits.mipLevel) {
-                    for (uint32_t aspect_index = aspect_index_; aspect_index < aspect_count_;) {
-                        subres.aspectMask = static_cast<VkImageAspectFlags>(encoder_->AspectBit(aspect_index));
-                        for (uint32_t mip_index = 0; mip_index < limits.mipLevel; ++mip_index) {
-                            subres.mipLevel = mip_index;
-                            const VkSubresourceLayout& subres_layout = encoder_->SubresourceLayout(subres);
-                            pos_.end += subres_layout.size;
+                    if (subres_range_.aspectMask == limits.aspectMask) {
+                        // The whole image, the size of which the encoder sums up front
+                        pos_.end += encoder_->TotalSize();
+                    } else {
+                        for (uint32_t aspect_index = aspect_index_; aspect_index < aspect_count_;) {
+                            subres.aspectMask = static_cast<VkImageAspectFlags>(encoder_->AspectBit(aspect_index));
+                            for (uint32_t mip_index = 0; mip_index < limits.mipLevel; ++mip_index) {
+                                subres.mipLevel = mip_index;
+                                const VkSubresourceLayout& subres_layout = encoder_->SubresourceLayout(subres);
+                                pos_.end += subres_layout.size;
+                            }
+                            aspect_index = encoder_->LowerBoundFromMask(subres_range_.aspectMask, aspect_index + 1);
                         }
-                        aspect_index = encoder_->LowerBoundFromMask(subres_range_.aspectMask, aspect_index + 1);
                     }
                     aspect_count_ = 1;
                 } else {
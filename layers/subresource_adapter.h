@@ -333,7 +333,7 @@ class RangeGenerator {
 class ImageRangeEncoder : public RangeEncoder {
   public:
     // The default constructor for default iterators
-    ImageRangeEncoder() : image_(nullptr) {}
+    ImageRangeEncoder() : image_(nullptr), total_size_(0) {}
 
     ImageRangeEncoder(const IMAGE_STATE& image, const AspectParameters* param);
     ImageRangeEncoder(const IMAGE_STATE& image);
@@ -348,6 +348,8 @@ class ImageRangeEncoder : public RangeEncoder {
     }
     inline const double& TexelSize(int aspect_index) const { return texel_sizes_[aspect_index]; }
     inline bool IsLinearImage() const { return linear_image; }
+    // The summed size of all subresources, i.e. the extent of the (single) range of a whole image access
+    inline IndexType TotalSize() const { return total_size_; }
 
   private:
     bool linear_image;
@@ -355,6 +357,7 @@ class ImageRangeEncoder : public RangeEncoder {
     std::vector<double> texel_sizes_;
     std::vector<VkExtent3D> subres_extents_;
     std::vector<VkSubresourceLayout> subres_layouts_;
+    IndexType total_size_;
 };
 
 class ImageRangeGenerator {
@@ -534,8 +537,9 @@ class ConstMapView {
 enum BothRangeMapMode { kTristate, kSmall, kBig };
 template <typename T, size_t N>
 class BothRangeMap {
-    using BigMap = sparse_container::range_map<IndexType, T>;
     using RangeType = sparse_container::range<IndexType>;
+    // The values are small (layouts and pointers) and read far more often than they are split, so use the block based ImplMap
+    using BigMap = sparse_container::range_map<IndexType, T, RangeType, sparse_container::btree_range_map<IndexType, T, RangeType>>;
     using SmallMap = sparse_container::small_range_map<IndexType, T, RangeType, N>;
     using SmallMapIterator = typename SmallMap::iterator;
     using SmallMapConstIterator = typename SmallMap::const_iterator;
@@ -509,10 +509,16 @@ HazardResult AccessContext::DetectHazard(AddressType type, const Detector &detec
         }
     }
 
-    const bool detect_prev = (static_cast<uint32_t>(options) & DetectOptions::kDetectPrevious) != 0;
+    // Without previous contexts there is nothing to descend into for the gaps
+    const bool detect_prev = ((static_cast<uint32_t>(options) & DetectOptions::kDetectPrevious) != 0) && HasPreviousContexts();
 
     const auto &accesses = GetAccessStateMap(type);
     const auto from = accesses.lower_bound(range);
+    if (range.non_empty() && (from != accesses.end()) && from->first.includes(range)) {
+        // Whole resource fast path: a single entry spans the range, as is the case for a resource so far only accessed as a
+        // whole. There are no gaps to descend into, and no need to bound the walk.
+        return detector.Detect(from);
+    }
     const auto to = accesses.upper_bound(range);
     ResourceAccessRange gap = {range.begin, range.begin};
 
@@ -551,6 +557,9 @@ template <typename Detector>
 HazardResult AccessContext::DetectAsyncHazard(AddressType type, const Detector &detector, const ResourceAccessRange &range) const {
     auto &accesses = GetAccessStateMap(type);
     const auto from = accesses.lower_bound(range);
+    if (range.non_empty() && (from != accesses.end()) && from->first.includes(range)) {
+        return detector.DetectAsync(from);  // Whole resource fast path, as above
+    }
     const auto to = accesses.upper_bound(range);
 
     HazardResult hazard;
@@ -1110,6 +1119,11 @@ void UpdateMemoryAccessState(ResourceAccessRangeMap *accesses, const ResourceAcc
     // TODO: Optimization for operations that do a pure overwrite (i.e. WRITE usages which rewrite the state, vs READ usages
     //       that do incrementalupdates
     auto pos = accesses->lower_bound(range);
+    if ((pos != accesses->end()) && (pos->first == range)) {
+        // Whole resource fast path: the range is exactly one entry, so there is nothing to split or infill
+        action(accesses, pos);
+        return;
+    }
     if (pos == accesses->end() || !pos->first.intersects(range)) {
         // The range is empty, fill it with a default value.
         pos = action.Infill(accesses, pos, range);
@@ -2195,9 +2209,8 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index)
         // Otherwise test against last_write
         //
         // Look for casus belli for WAR
-        if (last_read_count) {
-            for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-                const auto &read_access = last_reads[read_index];
+        if (!last_reads.empty()) {
+            for (const auto &read_access : last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
                     hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
                     break;
@@ -2241,12 +2254,11 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
 
     } else {
         // Only check for WAW if there are no reads since last_write
-        if (last_read_count) {
+        if (!last_reads.empty()) {
             // Ignore ordered read stages (which represent frame-buffer local operations, except input attachment
             const auto unordered_reads = last_read_stages & ~ordering.exec_scope;
             // Look for any WAR hazards outside the ordered set of stages
-            for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-                const auto &read_access = last_reads[read_index];
+            for (const auto &read_access : last_reads) {
                 if ((read_access.stage & unordered_reads) && IsReadHazard(usage_stage, read_access)) {
                     hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
                     break;
@@ -2278,7 +2290,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_i
     } else {
         if (last_write != 0) {
             hazard.Set(this, usage_index, WRITE_RACING_WRITE, last_write, write_tag);
-        } else if (last_read_count > 0) {
+        } else if (!last_reads.empty()) {
             hazard.Set(this, usage_index, WRITE_RACING_READ, last_reads[0].access, last_reads[0].tag);
         } else if (input_attachment_barriers != kNoAttachmentRead) {
             hazard.Set(this, usage_index, WRITE_RACING_READ, SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ, input_attachment_tag);
@@ -2294,10 +2306,9 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
     HazardResult hazard;
     // only test for WAW if there no intervening read operations.
     // See DetectHazard(SyncStagetAccessIndex) above for more details.
-    if (last_read_count) {
+    if (!last_reads.empty()) {
         // Look at the reads if any
-        for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-            const auto &read_access = last_reads[read_index];
+        for (const auto &read_access : last_reads) {
             // If the read stage is not in the src sync sync
             // *AND* not execution chained with an existing sync barrier (that's the or)
             // then the barrier access is unsafe (R/W after R)
@@ -2351,13 +2362,11 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
         }
         // The else clause is that only this has an attachment read and no merge is needed
 
-        for (uint32_t other_read_index = 0; other_read_index < other.last_read_count; other_read_index++) {
-            auto &other_read = other.last_reads[other_read_index];
+        for (const auto &other_read : other.last_reads) {
             if (last_read_stages & other_read.stage) {
                 // Merge in the barriers for read stages that exist in *both* this and other
                 // TODO: This is N^2 with stages... perhaps the ReadStates should be by stage index.
-                for (uint32_t my_read_index = 0; my_read_index < last_read_count; my_read_index++) {
-                    auto &my_read = last_reads[my_read_index];
+                for (auto &my_read : last_reads) {
                     if (other_read.stage == my_read.stage) {
                         if (my_read.tag.IsBefore(other_read.tag)) {
                             my_read.tag = other_read.tag;
@@ -2369,8 +2378,7 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
                 }
             } else {
                 // The other read stage doesn't exist in this, so add it.
-                last_reads[last_read_count] = other_read;
-                last_read_count++;
+                last_reads.push_back(other_read);
                 last_read_stages |= other_read.stage;
             }
         }
@@ -2391,8 +2399,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, const Resourc
         // However, for purposes of barrier tracking, only one read per pipeline stage matters
         const auto usage_stage = PipelineStageBit(usage_index);
         if (usage_stage & last_read_stages) {
-            for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-                ReadState &access = last_reads[read_index];
+            for (auto &access : last_reads) {
                 if (access.stage == usage_stage) {
                     access.access = usage_bit;
                     access.barriers = 0;
@@ -2402,8 +2409,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, const Resourc
             }
         } else {
             // We don't have this stage in the list yet...
-            assert(last_read_count < last_reads.size());
-            ReadState &access = last_reads[last_read_count++];
+            ReadState &access = last_reads.emplace_back();
             access.stage = usage_stage;
             access.access = usage_bit;
             access.barriers = 0;
@@ -2416,7 +2422,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, const Resourc
         // Clobber last read and all barriers... because all we have is DANGER, DANGER, WILL ROBINSON!!!
         // if the last_reads/last_write were unsafe, we've reported them,
         // in either case the prior access is irrelevant, we can overwrite them as *this* write is now after them
-        last_read_count = 0;
+        last_reads.clear();
         last_read_stages = 0;
         read_execution_barriers = 0;
 
@@ -2432,8 +2438,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, const Resourc
 
 void ResourceAccessState::ApplyExecutionBarrier(VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask) {
     // Execution Barriers only protect read operations
-    for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-        ReadState &access = last_reads[read_index];
+    for (auto &access : last_reads) {
         // The | implements the "dependency chain" logic for this access, as the barriers field stores the second sync scope
         if (srcStageMask & (access.stage | access.barriers)) {
             access.barriers |= dstStageMask;
@@ -2466,8 +2471,7 @@ VkPipelineStageFlags ResourceAccessState::GetReadBarriers(SyncStageAccessFlags u
     if (usage_bit & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT) {
         barriers = input_attachment_barriers;
     } else {
-        for (uint32_t read_index = 0; read_index < last_read_count; read_index++) {
-            const auto &read_access = last_reads[read_index];
+        for (const auto &read_access : last_reads) {
             if (read_access.access & usage_bit) {
                 barriers = read_access.barriers;
                 break;
@@ -118,8 +118,8 @@ class ResourceAccessState : public SyncStageAccess {
     // and applicable one for hazard detection
     struct ReadState {
         VkPipelineStageFlagBits stage;  // The stage of this read
-        SyncStageAccessFlags access;    // TODO: Change to FlagBits when we have a None bit enum
         VkPipelineStageFlags barriers;  // all applicable barriered stages
+        SyncStageAccessFlags access;    // TODO: Change to FlagBits when we have a None bit enum
         ResourceUsageTag tag;
         bool operator==(const ReadState &rhs) const {
             bool same = (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) && (tag == rhs.tag);
@@ -145,23 +145,23 @@ class ResourceAccessState : public SyncStageAccess {
 
     ResourceAccessState()
         : write_barriers(~SyncStageAccessFlags(0)),
-          write_dependency_chain(0),
-          write_tag(),
           last_write(0),
-          input_attachment_barriers(kNoAttachmentRead),
+          write_tag(),
           input_attachment_tag(),
-          last_read_count(0),
+          write_dependency_chain(0),
+          input_attachment_barriers(kNoAttachmentRead),
           last_read_stages(0),
-          read_execution_barriers(0) {}
+          read_execution_barriers(0),
+          last_reads() {}
 
     bool HasWriteOp() const { return last_write != 0; }
     bool operator==(const ResourceAccessState &rhs) const {
         bool same = (write_barriers == rhs.write_barriers) && (write_dependency_chain == rhs.write_dependency_chain) &&
-                    (last_read_count == rhs.last_read_count) && (last_read_stages == rhs.last_read_stages) &&
+                    (last_reads.size() == rhs.last_reads.size()) && (last_read_stages == rhs.last_read_stages) &&
                     (write_tag == rhs.write_tag) && (input_attachment_barriers == rhs.input_attachment_barriers) &&
                     ((input_attachment_barriers == kNoAttachmentRead) || input_attachment_tag == rhs.input_attachment_tag) &&
                     (read_execution_barriers == rhs.read_execution_barriers);
-        for (uint32_t i = 0; same && i < last_read_count; i++) {
+        for (uint32_t i = 0; same && i < last_reads.size(); i++) {
             same |= last_reads[i] == rhs.last_reads[i];
         }
         return same;
@@ -190,26 +190,31 @@ class ResourceAccessState : public SyncStageAccess {
 
     // TODO: Add a NONE (zero) enum to SyncStageAccessFlagBits for input_attachment_read and last_write
 
+    // The members are ordered by size, s.t. the state (which is copied on every resolve, and stored per range in the access
+    // maps) has no padding.
+
     // With reads, each must be "safe" relative to it's prior write, so we need only
     // save the most recent write operation (as anything *transitively* unsafe would arleady
     // be included
-    SyncStageAccessFlags write_barriers;          // union of applicable barrier masks since last write
-    VkPipelineStageFlags write_dependency_chain;  // intiially zero, but accumulating the dstStages of barriers if they chain.
+    SyncStageAccessFlags write_barriers;  // union of applicable barrier masks since last write
+    SyncStageAccessFlags last_write;      // only the most recent write
     ResourceUsageTag write_tag;
-    SyncStageAccessFlags last_write;  // only the most recent write
 
     // This is special as it's a framebuffer-local read from a framebuffer-global pipeline stage
     // As the only possible state for the input attachment stage/access is SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT,
     // encode the presence with the barriers mask, ~0 denotes no pending input attachment. Zero -- is the no-barrier state,
     // otherwise reflects the barrier/dependency chain information.
-    VkPipelineStageFlags input_attachment_barriers;
     ResourceUsageTag input_attachment_tag;
 
-    uint32_t last_read_count;
+    VkPipelineStageFlags write_dependency_chain;  // intiially zero, but accumulating the dstStages of barriers if they chain.
+    VkPipelineStageFlags input_attachment_barriers;
+
     VkPipelineStageFlags last_read_stages;
     VkPipelineStageFlags read_execution_barriers;
-    static constexpr size_t kStageCount = 32;  // TODO: The manual count was 28 real stages. Add stage count to codegen
-    std::array<ReadState, kStageCount> last_reads;
+    // There is at most one read per stage, but there are rarely more than a couple outstanding between writes, so only those
+    // are stored inline. The rest go to the heap.
+    static constexpr size_t kInlineReadCount = 2;
+    small_vector<ReadState, kInlineReadCount> last_reads;
 };
 
 using ResourceAccessRangeMap = sparse_container::range_map<VkDeviceSize, ResourceAccessState>;
@@ -356,6 +361,7 @@ class AccessContext {
                                    uint32_t subpass) const;
 
   private:
+    bool HasPreviousContexts() const { return !prev_.empty() || (src_external_.context != nullptr); }
     HazardResult DetectHazard(AddressType type, SyncStageAccessIndex usage_index, const ResourceAccessRange &range) const;
     HazardResult DetectBarrierHazard(AddressType type, SyncStageAccessIndex current_usage, VkPipelineStageFlags src_exec_scope,
                                      SyncStageAccessFlags src_access_scope, const ResourceAccessRange &range,
@@ -38,7 +38,10 @@ struct VULKAN_FORMAT_INFO {
 
 // Set up data structure with size(bytes) and number of channels for each Vulkan format
 // For compressed and multi-plane formats, size is bytes per compressed or shared block
-const std::map<VkFormat, VULKAN_FORMAT_INFO> vk_format_table = {
+static const struct {
+    VkFormat format;
+    VULKAN_FORMAT_INFO info;
+} vk_format_info_list[] = {
     {VK_FORMAT_UNDEFINED,                   {0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT }},
     {VK_FORMAT_R4G4_UNORM_PACK8,            {1, 2, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
     {VK_FORMAT_R4G4B4A4_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
@@ -293,8 +296,208 @@ const std::map<VkFormat, VULKAN_FORMAT_INFO> vk_format_table = {
 // Renable formatting
 // clang-format on
 
+// Classification helpers used to fill the format table, defined below
+static bool ComputeFormatIsCompressed_ETC2_EAC(VkFormat format);
+static bool ComputeFormatIsCompressed_ASTC_LDR(VkFormat format);
+static bool ComputeFormatIsCompressed_ASTC_HDR(VkFormat format);
+static bool ComputeFormatIsCompressed_BC(VkFormat format);
+static bool ComputeFormatIsCompressed_PVRTC(VkFormat format);
+static bool ComputeFormatIsSinglePlane_422(VkFormat format);
+static bool ComputeFormatIsPacked(VkFormat format);
+static bool ComputeFormatIsDepthAndStencil(VkFormat format);
+static bool ComputeFormatIsStencilOnly(VkFormat format);
+static bool ComputeFormatIsDepthOnly(VkFormat format);
+static bool ComputeFormatIsNorm(VkFormat format);
+static bool ComputeFormatIsUNorm(VkFormat format);
+static bool ComputeFormatIsSNorm(VkFormat format);
+static bool ComputeFormatIsUInt(VkFormat format);
+static bool ComputeFormatIsSInt(VkFormat format);
+static bool ComputeFormatIsFloat(VkFormat format);
+static bool ComputeFormatIsSRGB(VkFormat format);
+static bool ComputeFormatIsUScaled(VkFormat format);
+static bool ComputeFormatIsSScaled(VkFormat format);
+static bool ComputeFormatRequiresYcbcrConversion(VkFormat format);
+static bool ComputeFormatIsXChromaSubsampled(VkFormat format);
+static bool ComputeFormatIsYChromaSubsampled(VkFormat format);
+static VkExtent3D ComputeFormatTexelBlockExtent(VkFormat format);
+static uint32_t ComputeFormatPlaneCount(VkFormat format);
+
+enum FormatFlagBits : uint32_t {
+    FORMAT_COMPRESSED_ETC2_EAC = 1u << 0,
+    FORMAT_COMPRESSED_ASTC_LDR = 1u << 1,
+    FORMAT_COMPRESSED_ASTC_HDR = 1u << 2,
+    FORMAT_COMPRESSED_BC = 1u << 3,
+    FORMAT_COMPRESSED_PVRTC = 1u << 4,
+    FORMAT_SINGLE_PLANE_422 = 1u << 5,
+    FORMAT_PACKED = 1u << 6,
+    FORMAT_DEPTH_AND_STENCIL = 1u << 7,
+    FORMAT_STENCIL_ONLY = 1u << 8,
+    FORMAT_DEPTH_ONLY = 1u << 9,
+    FORMAT_NORM = 1u << 10,
+    FORMAT_UNORM = 1u << 11,
+    FORMAT_SNORM = 1u << 12,
+    FORMAT_UINT = 1u << 13,
+    FORMAT_SINT = 1u << 14,
+    FORMAT_FLOAT = 1u << 15,
+    FORMAT_SRGB = 1u << 16,
+    FORMAT_USCALED = 1u << 17,
+    FORMAT_SSCALED = 1u << 18,
+    FORMAT_REQUIRES_YCBCR_CONVERSION = 1u << 19,
+    FORMAT_X_CHROMA_SUBSAMPLED = 1u << 20,
+    FORMAT_Y_CHROMA_SUBSAMPLED = 1u << 21,
+
+    FORMAT_COMPRESSED_ASTC = FORMAT_COMPRESSED_ASTC_LDR | FORMAT_COMPRESSED_ASTC_HDR,
+    FORMAT_COMPRESSED = FORMAT_COMPRESSED_ETC2_EAC | FORMAT_COMPRESSED_ASTC | FORMAT_COMPRESSED_BC | FORMAT_COMPRESSED_PVRTC,
+    FORMAT_DEPTH_OR_STENCIL = FORMAT_DEPTH_AND_STENCIL | FORMAT_STENCIL_ONLY | FORMAT_DEPTH_ONLY,
+    FORMAT_INT = FORMAT_UINT | FORMAT_SINT,
+    FORMAT_SAMPLED_FLOAT = FORMAT_UNORM | FORMAT_SNORM | FORMAT_USCALED | FORMAT_SSCALED | FORMAT_FLOAT | FORMAT_SRGB,
+};
+
+struct VULKAN_FORMAT_PROPERTIES {
+    VULKAN_FORMAT_INFO info;
+    uint32_t flags;
+    uint32_t plane_count;
+    VkExtent3D block_extent;
+};
+
+// Format enums are contiguous within the core range and within each extension's block. Each range is mapped onto its own
+// slice of one dense index space, with a final entry shared by all formats not in any range.
+struct VULKAN_FORMAT_RANGE {
+    VkFormat first;
+    VkFormat last;
+};
+
+static const VULKAN_FORMAT_RANGE vk_format_ranges[] = {
+    {VK_FORMAT_UNDEFINED, VK_FORMAT_ASTC_12x12_SRGB_BLOCK},
+    {VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG, VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG},
+    {VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK_EXT, VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK_EXT},
+    {VK_FORMAT_G8B8G8R8_422_UNORM, VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM},
+};
+
+class FormatPropertiesTable {
+  public:
+    FormatPropertiesTable() {
+        uint32_t count = 0;
+        for (const auto &range : vk_format_ranges) count += range.last - range.first + 1;
+        unknown_index_ = count;
+        table_.resize(count + 1);
+
+        for (const auto &range : vk_format_ranges) {
+            for (uint32_t value = range.first; value <= static_cast<uint32_t>(range.last); ++value) {
+                const VkFormat format = static_cast<VkFormat>(value);
+                Compute(format, &table_[Index(format)]);
+            }
+        }
+        // Formats outside all of the ranges get the defaults of the classification helpers
+        Compute(VK_FORMAT_MAX_ENUM, &table_[unknown_index_]);
+
+        for (const auto &entry : vk_format_info_list) {
+            table_[Index(entry.format)].info = entry.info;
+        }
+    }
+
+    const VULKAN_FORMAT_PROPERTIES &Get(VkFormat format) const { return table_[Index(format)]; }
+
+  private:
+    uint32_t Index(VkFormat format) const {
+        // Core formats are the first range and map to themselves
+        if (static_cast<uint32_t>(format) <= static_cast<uint32_t>(vk_format_ranges[0].last)) return format;
+        uint32_t base = 0;
+        for (const auto &range : vk_format_ranges) {
+            if (format >= range.first && format <= range.last) return base + (format - range.first);
+            base += range.last - range.first + 1;
+        }
+        return unknown_index_;
+    }
+
+    static void Compute(VkFormat format, VULKAN_FORMAT_PROPERTIES *props) {
+        props->info = {0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT};
+        props->flags = 0;
+        if (ComputeFormatIsCompressed_ETC2_EAC(format)) props->flags |= FORMAT_COMPRESSED_ETC2_EAC;
+        if (ComputeFormatIsCompressed_ASTC_LDR(format)) props->flags |= FORMAT_COMPRESSED_ASTC_LDR;
+        if (ComputeFormatIsCompressed_ASTC_HDR(format)) props->flags |= FORMAT_COMPRESSED_ASTC_HDR;
+        if (ComputeFormatIsCompressed_BC(format)) props->flags |= FORMAT_COMPRESSED_BC;
+        if (ComputeFormatIsCompressed_PVRTC(format)) props->flags |= FORMAT_COMPRESSED_PVRTC;
+        if (ComputeFormatIsSinglePlane_422(format)) props->flags |= FORMAT_SINGLE_PLANE_422;
+        if (ComputeFormatIsPacked(format)) props->flags |= FORMAT_PACKED;
+        if (ComputeFormatIsDepthAndStencil(format)) props->flags |= FORMAT_DEPTH_AND_STENCIL;
+        if (ComputeFormatIsStencilOnly(format)) props->flags |= FORMAT_STENCIL_ONLY;
+        if (ComputeFormatIsDepthOnly(format)) props->flags |= FORMAT_DEPTH_ONLY;
+        if (ComputeFormatIsNorm(format)) props->flags |= FORMAT_NORM;
+        if (ComputeFormatIsUNorm(format)) props->flags |= FORMAT_UNORM;
+        if (ComputeFormatIsSNorm(format)) props->flags |= FORMAT_SNORM;
+        if (ComputeFormatIsUInt(format)) props->flags |= FORMAT_UINT;
+        if (ComputeFormatIsSInt(format)) props->flags |= FORMAT_SINT;
+        if (ComputeFormatIsFloat(format)) props->flags |= FORMAT_FLOAT;
+        if (ComputeFormatIsSRGB(format)) props->flags |= FORMAT_SRGB;
+        if (ComputeFormatIsUScaled(format)) props->flags |= FORMAT_USCALED;
+        if (ComputeFormatIsSScaled(format)) props->flags |= FORMAT_SSCALED;
+        if (ComputeFormatRequiresYcbcrConversion(format)) props->flags |= FORMAT_REQUIRES_YCBCR_CONVERSION;
+        if (ComputeFormatIsXChromaSubsampled(format)) props->flags |= FORMAT_X_CHROMA_SUBSAMPLED;
+        if (ComputeFormatIsYChromaSubsampled(format)) props->flags |= FORMAT_Y_CHROMA_SUBSAMPLED;
+        props->plane_count = ComputeFormatPlaneCount(format);
+        props->block_extent = ComputeFormatTexelBlockExtent(format);
+    }
+
+    std::vector<VULKAN_FORMAT_PROPERTIES> table_;
+    uint32_t unknown_index_;
+};
+
+static const VULKAN_FORMAT_PROPERTIES &GetFormatProperties(VkFormat format) {
+    static const FormatPropertiesTable table;
+    return table.Get(format);
+}
+
+static inline bool FormatHasFlags(VkFormat format, uint32_t flags) { return (GetFormatProperties(format).flags & flags) != 0; }
+
+VK_LAYER_EXPORT bool FormatIsCompressed_ETC2_EAC(VkFormat format) { return FormatHasFlags(format, FORMAT_COMPRESSED_ETC2_EAC); }
+VK_LAYER_EXPORT bool FormatIsCompressed_ASTC(VkFormat format) { return FormatHasFlags(format, FORMAT_COMPRESSED_ASTC); }
+VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_LDR(VkFormat format) { return FormatHasFlags(format, FORMAT_COMPRESSED_ASTC_LDR); }
+VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_HDR(VkFormat format) { return FormatHasFlags(format, FORMAT_COMPRESSED_ASTC_HDR); }
+VK_LAYER_EXPORT bool FormatIsCompressed_BC(VkFormat format) { return FormatHasFlags(format, FORMAT_COMPRESSED_BC); }
+VK_LAYER_EXPORT bool FormatIsCompressed_PVRTC(VkFormat format) { return FormatHasFlags(format, FORMAT_COMPRESSED_PVRTC); }
+VK_LAYER_EXPORT bool FormatIsSinglePlane_422(VkFormat format) { return FormatHasFlags(format, FORMAT_SINGLE_PLANE_422); }
+VK_LAYER_EXPORT bool FormatIsCompressed(VkFormat format) { return FormatHasFlags(format, FORMAT_COMPRESSED); }
+VK_LAYER_EXPORT bool FormatIsPacked(VkFormat format) { return FormatHasFlags(format, FORMAT_PACKED); }
+VK_LAYER_EXPORT bool FormatIsDepthOrStencil(VkFormat format) { return FormatHasFlags(format, FORMAT_DEPTH_OR_STENCIL); }
+VK_LAYER_EXPORT bool FormatIsDepthAndStencil(VkFormat format) { return FormatHasFlags(format, FORMAT_DEPTH_AND_STENCIL); }
+VK_LAYER_EXPORT bool FormatIsStencilOnly(VkFormat format) { return FormatHasFlags(format, FORMAT_STENCIL_ONLY); }
+VK_LAYER_EXPORT bool FormatIsDepthOnly(VkFormat format) { return FormatHasFlags(format, FORMAT_DEPTH_ONLY); }
+VK_LAYER_EXPORT bool FormatIsNorm(VkFormat format) { return FormatHasFlags(format, FORMAT_NORM); }
+VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) { return FormatHasFlags(format, FORMAT_UNORM); }
+VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) { return FormatHasFlags(format, FORMAT_SNORM); }
+VK_LAYER_EXPORT bool FormatIsInt(VkFormat format) { return FormatHasFlags(format, FORMAT_INT); }
+VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) { return FormatHasFlags(format, FORMAT_UINT); }
+VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) { return FormatHasFlags(format, FORMAT_SINT); }
+VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) { return FormatHasFlags(format, FORMAT_FLOAT); }
+VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) { return FormatHasFlags(format, FORMAT_SRGB); }
+VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) { return FormatHasFlags(format, FORMAT_USCALED); }
+VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) { return FormatHasFlags(format, FORMAT_SSCALED); }
+// Types from "Interpretation of Numeric Format" table
+VK_LAYER_EXPORT bool FormatIsSampledInt(VkFormat format) { return FormatHasFlags(format, FORMAT_INT); }
+VK_LAYER_EXPORT bool FormatIsSampledFloat(VkFormat format) { return FormatHasFlags(format, FORMAT_SAMPLED_FLOAT); }
+VK_LAYER_EXPORT bool FormatRequiresYcbcrConversion(VkFormat format) {
+    return FormatHasFlags(format, FORMAT_REQUIRES_YCBCR_CONVERSION);
+}
+VK_LAYER_EXPORT bool FormatIsXChromaSubsampled(VkFormat format) { return FormatHasFlags(format, FORMAT_X_CHROMA_SUBSAMPLED); }
+VK_LAYER_EXPORT bool FormatIsYChromaSubsampled(VkFormat format) { return FormatHasFlags(format, FORMAT_Y_CHROMA_SUBSAMPLED); }
+
+// Return true if format is 'normal', with one texel per format element
+VK_LAYER_EXPORT bool FormatElementIsTexel(VkFormat format) {
+    const auto &props = GetFormatProperties(format);
+    return !(props.flags & (FORMAT_PACKED | FORMAT_COMPRESSED | FORMAT_SINGLE_PLANE_422)) && props.plane_count <= 1;
+}
+
+// Return texel block sizes for all formats
+// Uncompressed formats return {1, 1, 1}
+// Compressed formats return the compression block extents
+// Multiplane formats return the 'shared' extent of their low-res channel(s)
+VK_LAYER_EXPORT VkExtent3D FormatTexelBlockExtent(VkFormat format) { return GetFormatProperties(format).block_extent; }
+
+VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) { return GetFormatProperties(format).plane_count; }
+
 // Return true if format is an ETC2 or EAC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_ETC2_EAC(VkFormat format) {
+static bool ComputeFormatIsCompressed_ETC2_EAC(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -316,13 +519,8 @@ VK_LAYER_EXPORT bool FormatIsCompressed_ETC2_EAC(VkFormat format) {
     return found;
 }
 
-// Return true if format is either a LDR or HDR ASTC compressed textyre format
-VK_LAYER_EXPORT bool FormatIsCompressed_ASTC(VkFormat format) {
-    return (FormatIsCompressed_ASTC_LDR(format) || FormatIsCompressed_ASTC_HDR(format));
-}
-
 // Return true if format is an LDR ASTC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_LDR(VkFormat format) {
+static bool ComputeFormatIsCompressed_ASTC_LDR(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -363,7 +561,7 @@ VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_LDR(VkFormat format) {
 }
 
 // Return true if format is an HDR ASTC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_HDR(VkFormat format) {
+static bool ComputeFormatIsCompressed_ASTC_HDR(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -390,7 +588,7 @@ VK_LAYER_EXPORT bool FormatIsCompressed_ASTC_HDR(VkFormat format) {
 }
 
 // Return true if format is a BC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_BC(VkFormat format) {
+static bool ComputeFormatIsCompressed_BC(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -419,7 +617,7 @@ VK_LAYER_EXPORT bool FormatIsCompressed_BC(VkFormat format) {
 }
 
 // Return true if format is a PVRTC compressed texture format
-VK_LAYER_EXPORT bool FormatIsCompressed_PVRTC(VkFormat format) {
+static bool ComputeFormatIsCompressed_PVRTC(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -440,7 +638,7 @@ VK_LAYER_EXPORT bool FormatIsCompressed_PVRTC(VkFormat format) {
 }
 
 // Single-plane "_422" formats are treated as 2x1 compressed (for copies)
-VK_LAYER_EXPORT bool FormatIsSinglePlane_422(VkFormat format) {
+static bool ComputeFormatIsSinglePlane_422(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -460,13 +658,8 @@ VK_LAYER_EXPORT bool FormatIsSinglePlane_422(VkFormat format) {
     return found;
 }
 
-// Return true if format is compressed
-VK_LAYER_EXPORT bool FormatIsCompressed(VkFormat format) {
-    return (FormatIsCompressed_ASTC(format) || FormatIsCompressed_BC(format) || FormatIsCompressed_ETC2_EAC(format) ||
-            FormatIsCompressed_PVRTC(format));
-}
 // Return true if format is packed
-VK_LAYER_EXPORT bool FormatIsPacked(VkFormat format) {
+static bool ComputeFormatIsPacked(VkFormat format) {
     bool found = false;
 
     switch (format) {
@@ -528,22 +721,8 @@ VK_LAYER_EXPORT bool FormatIsPacked(VkFormat format) {
     return found;
 }
 
-// Return true if format is 'normal', with one texel per format element
-VK_LAYER_EXPORT bool FormatElementIsTexel(VkFormat format) {
-    if (FormatIsPacked(format) || FormatIsCompressed(format) || FormatIsSinglePlane_422(format) || FormatIsMultiplane(format)) {
-        return false;
-    } else {
-        return true;
-    }
-}
-
-// Return true if format is a depth or stencil format
-VK_LAYER_EXPORT bool FormatIsDepthOrStencil(VkFormat format) {
-    return (FormatIsDepthAndStencil(format) || FormatIsDepthOnly(format) || FormatIsStencilOnly(format));
-}
-
 // Return true if format contains depth and stencil information
-VK_LAYER_EXPORT bool FormatIsDepthAndStencil(VkFormat format) {
+static bool ComputeFormatIsDepthAndStencil(VkFormat format) {
     bool is_ds = false;
 
     switch (format) {
@@ -559,10 +738,10 @@ VK_LAYER_EXPORT bool FormatIsDepthAndStencil(VkFormat format) {
 }
 
 // Return true if format is a stencil-only format
-VK_LAYER_EXPORT bool FormatIsStencilOnly(VkFormat format) { return (format == VK_FORMAT_S8_UINT); }
+static bool ComputeFormatIsStencilOnly(VkFormat format) { return (format == VK_FORMAT_S8_UINT); }
 
 // Return true if format is a depth-only format
-VK_LAYER_EXPORT bool FormatIsDepthOnly(VkFormat format) {
+static bool ComputeFormatIsDepthOnly(VkFormat format) {
     bool is_depth = false;
 
     switch (format) {
@@ -579,7 +758,7 @@ VK_LAYER_EXPORT bool FormatIsDepthOnly(VkFormat format) {
 }
 
 // Return true if format is of type NORM
-VK_LAYER_EXPORT bool FormatIsNorm(VkFormat format) {
+static bool ComputeFormatIsNorm(VkFormat format) {
     bool is_norm = false;
 
     switch (format) {
@@ -654,7 +833,7 @@ VK_LAYER_EXPORT bool FormatIsNorm(VkFormat format) {
 }
 
 // Return true if format is of type UNORM
-VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) {
+static bool ComputeFormatIsUNorm(VkFormat format) {
     bool is_unorm = false;
 
     switch (format) {
@@ -742,7 +921,7 @@ VK_LAYER_EXPORT bool FormatIsUNorm(VkFormat format) {
 }
 
 // Return true if format is of type SNORM
-VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) {
+static bool ComputeFormatIsSNorm(VkFormat format) {
     bool is_snorm = false;
 
     switch (format) {
@@ -773,10 +952,8 @@ VK_LAYER_EXPORT bool FormatIsSNorm(VkFormat format) {
 }
 
 // Return true if format is an integer format
-VK_LAYER_EXPORT bool FormatIsInt(VkFormat format) { return (FormatIsSInt(format) || FormatIsUInt(format)); }
-
 // Return true if format is an unsigned integer format
-VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) {
+static bool ComputeFormatIsUInt(VkFormat format) {
     bool is_uint = false;
 
     switch (format) {
@@ -812,7 +989,7 @@ VK_LAYER_EXPORT bool FormatIsUInt(VkFormat format) {
 }
 
 // Return true if format is a signed integer format
-VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) {
+static bool ComputeFormatIsSInt(VkFormat format) {
     bool is_sint = false;
 
     switch (format) {
@@ -847,7 +1024,7 @@ VK_LAYER_EXPORT bool FormatIsSInt(VkFormat format) {
 }
 
 // Return true if format is a floating-point format
-VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) {
+static bool ComputeFormatIsFloat(VkFormat format) {
     bool is_float = false;
 
     switch (format) {
@@ -877,7 +1054,7 @@ VK_LAYER_EXPORT bool FormatIsFloat(VkFormat format) {
 }
 
 // Return true if format is in the SRGB colorspace
-VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) {
+static bool ComputeFormatIsSRGB(VkFormat format) {
     bool is_srgb = false;
 
     switch (format) {
@@ -919,7 +1096,7 @@ VK_LAYER_EXPORT bool FormatIsSRGB(VkFormat format) {
 }
 
 // Return true if format is a USCALED format
-VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) {
+static bool ComputeFormatIsUScaled(VkFormat format) {
     bool is_uscaled = false;
 
     switch (format) {
@@ -946,7 +1123,7 @@ VK_LAYER_EXPORT bool FormatIsUScaled(VkFormat format) {
 }
 
 // Return true if format is a SSCALED format
-VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) {
+static bool ComputeFormatIsSScaled(VkFormat format) {
     bool is_sscaled = false;
 
     switch (format) {
@@ -972,18 +1149,7 @@ VK_LAYER_EXPORT bool FormatIsSScaled(VkFormat format) {
     return is_sscaled;
 }
 
-// Types from "Interpretation of Numeric Format" table
-VK_LAYER_EXPORT bool FormatIsSampledInt(VkFormat format) { return FormatIsInt(format); }
-VK_LAYER_EXPORT bool FormatIsSampledFloat(VkFormat format) {
-    return (FormatIsUNorm(format) || FormatIsSNorm(format) || FormatIsUScaled(format) || FormatIsSScaled(format) ||
-            FormatIsFloat(format) || FormatIsSRGB(format));
-}
-
-// Return texel block sizes for all formats
-// Uncompressed formats return {1, 1, 1}
-// Compressed formats return the compression block extents
-// Multiplane formats return the 'shared' extent of their low-res channel(s)
-VK_LAYER_EXPORT VkExtent3D FormatTexelBlockExtent(VkFormat format) {
+static VkExtent3D ComputeFormatTexelBlockExtent(VkFormat format) {
     VkExtent3D block_size = {1, 1, 1};
     switch (format) {
         case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
@@ -1212,7 +1378,7 @@ VK_LAYER_EXPORT VkFormatNumericalType FormatStencilNumericalType(VkFormat format
     return numerical_type;
 }
 
-VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) {
+static uint32_t ComputeFormatPlaneCount(VkFormat format) {
     switch (format) {
         case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
         case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
@@ -1246,11 +1412,7 @@ VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) {
 
 // Return format class of the specified format
 VK_LAYER_EXPORT VkFormatCompatibilityClass FormatCompatibilityClass(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.format_class;
-    }
-    return VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT;
+    return GetFormatProperties(format).info.format_class;
 }
 
 // Return size, in bytes, of one element of the specified format
@@ -1277,11 +1439,7 @@ VK_LAYER_EXPORT uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags a
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.size;
-    }
-    return 0;
+    return GetFormatProperties(format).info.size;
 }
 
 // Return the size in bytes of one texel of given foramt
@@ -1298,11 +1456,7 @@ VK_LAYER_EXPORT double FormatTexelSize(VkFormat format, VkImageAspectFlags aspec
 
 // Return the number of channels for a given format
 uint32_t FormatChannelCount(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.channel_count;
-    }
-    return 0;
+    return GetFormatProperties(format).info.channel_count;
 }
 
 // Perform a zero-tolerant modulo operation
@@ -1500,12 +1654,12 @@ const std::set<VkFormat> vk_formats_requiring_ycbcr_conversion{VK_FORMAT_G8B8G8R
                                                                VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,
                                                                VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM};
 
-VK_LAYER_EXPORT bool FormatRequiresYcbcrConversion(VkFormat format) {
+static bool ComputeFormatRequiresYcbcrConversion(VkFormat format) {
     auto it = vk_formats_requiring_ycbcr_conversion.find(format);
     return (it != vk_formats_requiring_ycbcr_conversion.end());
 }
 
-VK_LAYER_EXPORT bool FormatIsXChromaSubsampled(VkFormat format) {
+static bool ComputeFormatIsXChromaSubsampled(VkFormat format) {
     bool is_x_chroma_subsampled = false;
 
     switch (format) {
@@ -1542,7 +1696,7 @@ VK_LAYER_EXPORT bool FormatIsXChromaSubsampled(VkFormat format) {
     return is_x_chroma_subsampled;
 }
 
-VK_LAYER_EXPORT bool FormatIsYChromaSubsampled(VkFormat format) {
+static bool ComputeFormatIsYChromaSubsampled(VkFormat format) {
     bool is_y_chroma_subsampled = false;
 
     switch (format) {
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -187,6 +188,82 @@ struct LoggingLabelState {
     }
 };
 
+// Occurrence counts of reported message ids, used to enforce duplicate_message_limit. Each slot packs the message id with its
+// count so that a message can be counted, or found to be over the limit, with a single atomic operation and without taking
+// debug_output_mutex. Ids that do not fit in the table fall back to a mutex protected map.
+class LogMessageCounts {
+  public:
+    LogMessageCounts() {
+        for (auto &slot : slots_) {
+            slot.store(kEmptySlot, std::memory_order_relaxed);
+        }
+    }
+
+    // Returns true if message_id has already been counted limit times
+    bool OverLimit(uint32_t message_id, int32_t limit) const {
+        bool table_full = false;
+        const auto *slot = FindSlot(message_id, false, &table_full);
+        if (slot) {
+            return SlotCount(slot->load(std::memory_order_relaxed)) >= static_cast<uint32_t>(limit);
+        } else if (!table_full) {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(overflow_mutex_);
+        auto count_it = overflow_counts_.find(message_id);
+        return (count_it != overflow_counts_.end()) && (count_it->second >= limit);
+    }
+
+    // Counts an occurrence of message_id. Returns TRUE if the message was already at the limit, in which case it is not counted.
+    bool Increment(uint32_t message_id, int32_t limit) {
+        bool table_full = false;
+        auto *slot = FindSlot(message_id, true, &table_full);
+        if (slot) {
+            uint64_t value = slot->load(std::memory_order_relaxed);
+            do {
+                if (SlotCount(value) >= static_cast<uint32_t>(limit)) return true;
+            } while (!slot->compare_exchange_weak(value, value + 1, std::memory_order_relaxed));
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(overflow_mutex_);
+        auto &count = overflow_counts_[message_id];
+        if (count >= limit) return true;
+        count++;
+        return false;
+    }
+
+  private:
+    static const uint32_t kSlotCount = 1024;  // Must be a power of two
+    static const uint64_t kEmptySlot = 0;
+
+    // The low word holds count + 1, so a claimed slot is never equal to kEmptySlot
+    static uint64_t MakeSlot(uint32_t message_id) { return (static_cast<uint64_t>(message_id) << 32) | 1; }
+    static uint32_t SlotId(uint64_t value) { return static_cast<uint32_t>(value >> 32); }
+    static uint32_t SlotCount(uint64_t value) { return static_cast<uint32_t>(value) - 1; }
+
+    // Message ids are already hashes, so the low bits are used directly to start a linear probe. Slots are never released, so
+    // once table_full is reported every id not in the table lives in overflow_counts_.
+    std::atomic<uint64_t> *FindSlot(uint32_t message_id, bool insert, bool *table_full) const {
+        for (uint32_t probe = 0; probe < kSlotCount; probe++) {
+            auto &slot = slots_[(message_id + probe) & (kSlotCount - 1)];
+            uint64_t value = slot.load(std::memory_order_acquire);
+            if (value == kEmptySlot) {
+                if (!insert) return nullptr;
+                if (slot.compare_exchange_strong(value, MakeSlot(message_id), std::memory_order_acq_rel)) {
+                    return &slot;
+                }
+                // Lost the race for this slot, value now holds the winner
+            }
+            if (SlotId(value) == message_id) return &slot;
+        }
+        *table_full = true;
+        return nullptr;
+    }
+
+    mutable std::array<std::atomic<uint64_t>, kSlotCount> slots_;
+    mutable std::mutex overflow_mutex_;
+    std::unordered_map<uint32_t, int32_t> overflow_counts_;
+};
+
 typedef struct _debug_report_data {
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
     VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
@@ -197,12 +274,13 @@ typedef struct _debug_report_data {
     std::unordered_map<uint64_t, std::string> debugUtilsObjectNameMap;
     std::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debugUtilsQueueLabels;
     std::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debugUtilsCmdBufLabels;
+    // Sorted, and only written while processing settings at instance creation
     std::vector<uint32_t> filter_message_ids{};
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     int32_t duplicate_message_limit = 0;
-    mutable std::unordered_map<uint32_t, int32_t> duplicate_message_count_map{};
+    mutable LogMessageCounts duplicate_message_counts{};
     const void *instance_pnext_chain{};
 
     void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
@@ -338,18 +416,47 @@ static inline void RemoveAllMessageCallbacks(debug_report_data *debug_data, std:
 
 // Returns TRUE if the number of times this message has been logged is over the set limit
 static inline bool UpdateLogMsgCounts(const debug_report_data *debug_data, int32_t vuid_hash) {
-    auto vuid_count_it = debug_data->duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == debug_data->duplicate_message_count_map.end()) {
-        debug_data->duplicate_message_count_map.insert({vuid_hash, 1});
+    return debug_data->duplicate_message_counts.Increment(static_cast<uint32_t>(vuid_hash), debug_data->duplicate_message_limit);
+}
+
+// Threads that validate speculatively (see CoreChecks::ValidateUpdateDescriptorSets) point this at a flag. Messages such a
+// thread would report are dropped and the flag is set instead, so that the caller can repeat that work on its own thread.
+// Not static, so that every translation unit shares the one thread_local.
+inline bool *&SpeculativeLogMsgFlag() {
+    static thread_local bool *deferred = nullptr;
+    return deferred;
+}
+
+// Messages reported by this thread, whatever the callbacks returned. A check compares it before and after running to tell
+// whether it logged anything, even when the application asked not to skip the call.
+inline uint64_t &ThreadLoggedMsgCount() {
+    static thread_local uint64_t count = 0;
+    return count;
+}
+
+static inline bool DeferSpeculativeLogMsg() {
+    bool *deferred = SpeculativeLogMsgFlag();
+    if (!deferred) return false;
+    *deferred = true;
+    return true;
+}
+
+// Returns FALSE if the message is filtered or has already been reported duplicate_message_limit times. Neither the filter list
+// nor the message counts need debug_output_mutex, so the Log* helpers call this before taking the lock.
+static inline bool LogMsgEnabled(const debug_report_data *debug_data, const std::string &vuid_text) {
+    const bool filtering = !debug_data->filter_message_ids.empty();
+    const bool limiting = debug_data->duplicate_message_limit > 0;
+    if (!filtering && !limiting) return !DeferSpeculativeLogMsg();
+
+    const uint32_t message_id = XXH32(vuid_text.c_str(), vuid_text.size(), 8);
+    if (filtering &&
+        std::binary_search(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(), message_id)) {
+        return false;
+    }
+    if (limiting && debug_data->duplicate_message_counts.OverLimit(message_id, debug_data->duplicate_message_limit)) {
         return false;
-    } else {
-        if (vuid_count_it->second >= debug_data->duplicate_message_limit) {
-            return true;
-        } else {
-            vuid_count_it->second++;
-            return false;
-        }
     }
+    return !DeferSpeculativeLogMsg();
 }
 
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
@@ -411,6 +518,7 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
             return false;
         }
     }
+    ++ThreadLoggedMsgCount();
 
     VkDebugUtilsMessengerCallbackDataEXT callback_data;
     callback_data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
@@ -653,9 +761,11 @@ static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg
 
     // If message is in filter list, bail out very early
     size_t message_id = XXH32(vuid_text.c_str(), strlen(vuid_text.c_str()), 8);
-    if (std::find(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(),
-                  static_cast<uint32_t>(message_id)) != debug_data->filter_message_ids.end())
+    if (std::binary_search(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(),
+                           static_cast<uint32_t>(message_id))) {
+        free(err_msg);
         return false;
+    }
 
     // Append the spec error text to the error message, unless it's an UNASSIGNED or UNDEFINED vuid
     if ((vuid_text.find("UNASSIGNED-") == std::string::npos) && (vuid_text.find(kVUIDUndefined) == std::string::npos) &&
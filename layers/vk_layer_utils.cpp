@@ -226,3 +226,62 @@ VK_LAYER_EXPORT VkLayerDeviceCreateInfo *get_chain_info(const VkDeviceCreateInfo
     assert(chain_info != NULL);
     return chain_info;
 }
+
+ValidationWorkerPool::ValidationWorkerPool(uint32_t worker_count)
+    : task_(nullptr), task_count_(0), next_task_(0), busy_workers_(0), generation_(0), shutdown_(false) {
+    workers_.reserve(worker_count);
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back(&ValidationWorkerPool::WorkerLoop, this);
+    }
+}
+
+ValidationWorkerPool::~ValidationWorkerPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        shutdown_ = true;
+    }
+    work_ready_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void ValidationWorkerPool::Run(uint32_t task_count, const std::function<void(uint32_t)> &task) {
+    std::lock_guard<std::mutex> run_guard(run_lock_);
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        task_ = &task;
+        task_count_ = task_count;
+        next_task_ = 0;
+        busy_workers_ = WorkerCount();
+        ++generation_;
+    }
+    work_ready_.notify_all();
+    RunTasks();
+
+    std::unique_lock<std::mutex> guard(lock_);
+    work_done_.wait(guard, [this] { return busy_workers_ == 0; });
+    task_ = nullptr;
+}
+
+void ValidationWorkerPool::RunTasks() {
+    for (uint32_t index = next_task_++; index < task_count_; index = next_task_++) {
+        (*task_)(index);
+    }
+}
+
+void ValidationWorkerPool::WorkerLoop() {
+    uint64_t seen_generation = 0;
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        work_ready_.wait(guard, [this, &seen_generation] { return shutdown_ || (generation_ != seen_generation); });
+        if (shutdown_) return;
+        seen_generation = generation_;
+        guard.unlock();
+        RunTasks();
+        guard.lock();
+        if (--busy_workers_ == 0) {
+            work_done_.notify_one();
+        }
+    }
+}
@@ -29,6 +29,11 @@
 #include <vector>
 #include <set>
 #include <iomanip>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <thread>
 #include "cast_utils.h"
 #include "vk_format_utils.h"
 #include "vk_layer_logging.h"
@@ -240,6 +245,8 @@ static inline int u_ffs(int val) {
 #if defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918 && NTDDI_VERSION > NTDDI_WIN10_RS2 && \
     (!defined(_LIBCPP_VERSION) || __cplusplus >= 201703)
 #include <shared_mutex>
+#elif !defined(_WIN32)
+#include <pthread.h>
 #endif
 
 class ReadWriteLock {
@@ -247,6 +254,35 @@ class ReadWriteLock {
 #if defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918 && NTDDI_VERSION > NTDDI_WIN10_RS2 && \
     (!defined(_LIBCPP_VERSION) || __cplusplus >= 201703)
     typedef std::shared_mutex lock_t;
+#elif !defined(_WIN32)
+    // std::shared_mutex is not available to C++11 builds, use the POSIX reader/writer lock so that lock_shared() is
+    // actually shared. Exclusive lock() behaves exactly as the std::mutex it replaces. Shared locking is only used with
+    // fine-grained locking enabled, and glibc prefers readers by default, so ask for writer preference to keep the
+    // exclusive (record/create/destroy) side from starving behind sustained shared traffic.
+    class lock_t {
+      public:
+        lock_t() {
+            pthread_rwlockattr_t attr;
+            pthread_rwlockattr_init(&attr);
+#if defined(__GLIBC__) && defined(__USE_GNU)
+            pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+            pthread_rwlock_init(&m_rwlock, &attr);
+            pthread_rwlockattr_destroy(&attr);
+        }
+        ~lock_t() { pthread_rwlock_destroy(&m_rwlock); }
+        lock_t(const lock_t &) = delete;
+        lock_t &operator=(const lock_t &) = delete;
+        void lock() { pthread_rwlock_wrlock(&m_rwlock); }
+        bool try_lock() { return pthread_rwlock_trywrlock(&m_rwlock) == 0; }
+        void unlock() { pthread_rwlock_unlock(&m_rwlock); }
+        void lock_shared() { pthread_rwlock_rdlock(&m_rwlock); }
+        bool try_lock_shared() { return pthread_rwlock_tryrdlock(&m_rwlock) == 0; }
+        void unlock_shared() { pthread_rwlock_unlock(&m_rwlock); }
+
+      private:
+        pthread_rwlock_t m_rwlock;
+    };
 #else
     typedef std::mutex lock_t;
 #endif
@@ -255,8 +291,9 @@ class ReadWriteLock {
     void lock() { m_lock.lock(); }
     bool try_lock() { return m_lock.try_lock(); }
     void unlock() { m_lock.unlock(); }
-#if defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918 && NTDDI_VERSION > NTDDI_WIN10_RS2 && \
-    (!defined(_LIBCPP_VERSION) || __cplusplus >= 201703)
+#if (defined(_MSC_FULL_VER) && _MSC_FULL_VER >= 190023918 && NTDDI_VERSION > NTDDI_WIN10_RS2 && \
+     (!defined(_LIBCPP_VERSION) || __cplusplus >= 201703)) || \
+    !defined(_WIN32)
     void lock_shared() { m_lock.lock_shared(); }
     bool try_lock_shared() { return m_lock.try_lock_shared(); }
     void unlock_shared() { m_lock.unlock_shared(); }
@@ -278,6 +315,46 @@ typedef std::unique_lock<ReadWriteLock> read_lock_guard_t;
 typedef std::unique_lock<ReadWriteLock> write_lock_guard_t;
 #endif
 
+// Scoped shared ownership of a ReadWriteLock. Unlike read_lock_guard_t, which falls back to exclusive ownership where
+// std::shared_lock is unavailable, this always uses lock_shared().
+class SharedLockGuard {
+  public:
+    SharedLockGuard() : lock_(nullptr) {}
+    explicit SharedLockGuard(ReadWriteLock &lock) : lock_(&lock) { lock_->lock_shared(); }
+    SharedLockGuard(SharedLockGuard &&other) : lock_(other.lock_) { other.lock_ = nullptr; }
+    SharedLockGuard &operator=(SharedLockGuard &&other) {
+        if (this != &other) {
+            unlock();
+            lock_ = other.lock_;
+            other.lock_ = nullptr;
+        }
+        return *this;
+    }
+    SharedLockGuard(const SharedLockGuard &) = delete;
+    SharedLockGuard &operator=(const SharedLockGuard &) = delete;
+    ~SharedLockGuard() { unlock(); }
+
+    void unlock() {
+        if (lock_) {
+            lock_->unlock_shared();
+            lock_ = nullptr;
+        }
+    }
+
+  private:
+    ReadWriteLock *lock_;
+};
+
+// Lock held by the chassis around the hooks of vkCmd* commands. Holds either one of the validation object's object-wide
+// locks, or -- for objects using fine grained locking -- shared ownership of the object-wide lock together with exclusive
+// ownership of the target command buffer. Members are released in reverse order of declaration.
+struct CmdBufferLockGuard {
+    read_lock_guard_t object_read_lock;
+    write_lock_guard_t object_write_lock;
+    SharedLockGuard object_shared_lock;
+    std::unique_lock<std::mutex> cmd_buffer_lock;
+};
+
 // Limited concurrent_unordered_map that supports internally-synchronized
 // insert/erase/access. Splits locking across N buckets and uses shared_mutex
 // for read/write locking. Iterators are not supported. The following
@@ -419,3 +496,371 @@ class vl_concurrent_unordered_map {
         return hash;
     }
 };
+
+// Concurrent map from unique 64-bit ids to small trivially copyable values, for read-mostly tables such as the handle
+// unwrapping map. Supports the same insert_or_assign/insert/erase/contains/find/pop interface as
+// vl_concurrent_unordered_map (no snapshot).
+//
+// Lookups never block: the table is open-addressed with linear probing and every slot is a pair of atomics, so a reader
+// only loads the current table pointer and probes. Writers are serialized by a mutex. Erased slots are marked and reused
+// by later inserts. When too few empty slots remain the live entries are rehashed into a new table, which is published
+// atomically; the old table is freed once no reader can still be probing it. Readers announce themselves in one of two
+// epoch counter sets (spread across cache lines by thread), and the rehashing writer flips the epoch and waits for the
+// old set to drain before deleting the old table.
+//
+// Key values 0 and ~0 are reserved for empty and erased slots and are never found; unique handle ids never take them.
+template <typename Key, typename T>
+class vl_concurrent_id_map {
+  public:
+    typedef typename vl_concurrent_unordered_map<Key, T>::FindResult FindResult;
+
+    vl_concurrent_id_map() : table_(new Table(kInitialCapacity)) {}
+    ~vl_concurrent_id_map() { delete table_.load(); }
+
+    void insert_or_assign(const Key &key, const T &value) {
+        const uint64_t id = ToId(key);
+        assert(!IsReserved(id));
+        std::lock_guard<std::mutex> lock(write_lock_);
+        Slot *slot = FindSlot(id);
+        if (slot) {
+            slot->value.store(value, std::memory_order_release);
+        } else {
+            InsertNew(id, value);
+        }
+    }
+
+    bool insert(const Key &key, const T &value) {
+        const uint64_t id = ToId(key);
+        assert(!IsReserved(id));
+        std::lock_guard<std::mutex> lock(write_lock_);
+        if (FindSlot(id)) return false;
+        InsertNew(id, value);
+        return true;
+    }
+
+    // returns size_type
+    size_t erase(const Key &key) {
+        std::lock_guard<std::mutex> lock(write_lock_);
+        Slot *slot = FindSlot(ToId(key));
+        if (!slot) return 0;
+        slot->key.store(kErased, std::memory_order_release);
+        --live_count_;
+        return 1;
+    }
+
+    bool contains(const Key &key) const { return find(key) != end(); }
+
+    FindResult end() const { return FindResult(false, T()); }
+
+    FindResult find(const Key &key) const {
+        const uint64_t id = ToId(key);
+        if (IsReserved(id)) return end();
+
+        std::atomic<uint32_t> &reader = EnterRead();
+        const Table *table = table_.load(std::memory_order_seq_cst);
+        FindResult result = end();
+        for (size_t i = table->Home(id);; i = (i + 1) & table->mask) {
+            const uint64_t slot_key = table->slots[i].key.load(std::memory_order_acquire);
+            if (slot_key == id) {
+                result = FindResult(true, table->slots[i].value.load(std::memory_order_acquire));
+                break;
+            }
+            if (slot_key == kEmpty) break;
+        }
+        reader.fetch_sub(1, std::memory_order_release);
+        return result;
+    }
+
+    FindResult pop(const Key &key) {
+        std::lock_guard<std::mutex> lock(write_lock_);
+        Slot *slot = FindSlot(ToId(key));
+        if (!slot) return end();
+        FindResult ret(true, slot->value.load(std::memory_order_relaxed));
+        slot->key.store(kErased, std::memory_order_release);
+        --live_count_;
+        return ret;
+    }
+
+  private:
+    static const uint64_t kEmpty = 0;
+    static const uint64_t kErased = ~uint64_t(0);
+    static const size_t kInitialCapacity = 1024;
+    static const size_t kReaderSlots = 16;
+
+    struct Slot {
+        std::atomic<uint64_t> key;
+        std::atomic<T> value;
+    };
+
+    struct Table {
+        explicit Table(size_t capacity) : mask(capacity - 1), slots(new Slot[capacity]) {
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].key.store(kEmpty, std::memory_order_relaxed);
+                slots[i].value.store(T(), std::memory_order_relaxed);
+            }
+        }
+        size_t Capacity() const { return mask + 1; }
+        // Mix all the id bits, the unique ids are a counter in the low bits and a hash in the high bits.
+        size_t Home(uint64_t id) const { return static_cast<size_t>((id * 0x9E3779B97F4A7C15ULL) >> 32) & mask; }
+
+        const size_t mask;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    struct ReaderCount {
+        std::atomic<uint32_t> count;
+        // Each counter on its own cache line to avoid false sharing between reader threads.
+        char padding[(-int(sizeof(std::atomic<uint32_t>))) & 63];
+    };
+
+    static uint64_t ToId(const Key &key) { return reinterpret_cast<const uint64_t &>(key); }
+    static bool IsReserved(uint64_t id) { return id == kEmpty || id == kErased; }
+
+    static size_t ReaderSlot() {
+        static std::atomic<size_t> next_slot(0);
+        static thread_local size_t slot = next_slot++ % kReaderSlots;
+        return slot;
+    }
+
+    std::atomic<uint32_t> &EnterRead() const {
+        const size_t slot = ReaderSlot();
+        for (;;) {
+            const uint32_t epoch = epoch_.load(std::memory_order_seq_cst);
+            std::atomic<uint32_t> &reader = readers_[epoch & 1][slot].count;
+            reader.fetch_add(1, std::memory_order_seq_cst);
+            // If the epoch flipped in between, the writer may already have drained this counter set.
+            if (epoch_.load(std::memory_order_seq_cst) == epoch) return reader;
+            reader.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    // Called with write_lock_ held
+    Slot *FindSlot(uint64_t id) const {
+        if (IsReserved(id)) return nullptr;
+        Table *table = table_.load(std::memory_order_relaxed);
+        for (size_t i = table->Home(id);; i = (i + 1) & table->mask) {
+            const uint64_t slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == id) return &table->slots[i];
+            if (slot_key == kEmpty) return nullptr;
+        }
+    }
+
+    // Called with write_lock_ held, id is known not to be in the table
+    void InsertNew(uint64_t id, const T &value) {
+        Table *table = table_.load(std::memory_order_relaxed);
+        // Keep at least half the slots empty so probe sequences stay short and always terminate.
+        if ((used_count_ + 1) * 2 > table->Capacity()) {
+            Rehash();
+            table = table_.load(std::memory_order_relaxed);
+        }
+        for (size_t i = table->Home(id);; i = (i + 1) & table->mask) {
+            Slot &slot = table->slots[i];
+            const uint64_t slot_key = slot.key.load(std::memory_order_relaxed);
+            if (slot_key == kEmpty || slot_key == kErased) {
+                // Publish the value before the key, readers match on the key and then read the value.
+                slot.value.store(value, std::memory_order_relaxed);
+                slot.key.store(id, std::memory_order_release);
+                if (slot_key == kEmpty) ++used_count_;
+                ++live_count_;
+                return;
+            }
+        }
+    }
+
+    // Called with write_lock_ held
+    void Rehash() {
+        Table *old_table = table_.load(std::memory_order_relaxed);
+        size_t capacity = kInitialCapacity;
+        while (capacity < (live_count_ + 1) * 4) capacity *= 2;
+
+        Table *new_table = new Table(capacity);
+        for (size_t i = 0; i < old_table->Capacity(); ++i) {
+            const uint64_t id = old_table->slots[i].key.load(std::memory_order_relaxed);
+            if (IsReserved(id)) continue;
+            size_t j = new_table->Home(id);
+            while (new_table->slots[j].key.load(std::memory_order_relaxed) != kEmpty) j = (j + 1) & new_table->mask;
+            new_table->slots[j].value.store(old_table->slots[i].value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            new_table->slots[j].key.store(id, std::memory_order_relaxed);
+        }
+        used_count_ = live_count_;
+        table_.store(new_table, std::memory_order_seq_cst);
+
+        // Readers that entered before the flip may still hold old_table; wait for their counter set to drain.
+        const uint32_t old_epoch = epoch_.fetch_add(1, std::memory_order_seq_cst) & 1;
+        for (size_t slot = 0; slot < kReaderSlots; ++slot) {
+            while (readers_[old_epoch][slot].count.load(std::memory_order_seq_cst) != 0) std::this_thread::yield();
+        }
+        delete old_table;
+    }
+
+    std::mutex write_lock_;
+    std::atomic<Table *> table_;
+    size_t used_count_ = 0;  // Slots not empty, including erased ones (current table)
+    size_t live_count_ = 0;
+    std::atomic<uint32_t> epoch_{0};
+    mutable ReaderCount readers_[2][kReaderSlots] = {};
+};
+
+// A vector with storage for the first N elements inside the object itself, for collections that are usually small, and
+// frequently copied. Elements beyond N move to heap storage, which is kept (and reused) until the small_vector is destroyed.
+template <typename T, size_t N, typename SizeType = uint32_t>
+class small_vector {
+  public:
+    typedef T value_type;
+    typedef SizeType size_type;
+    typedef T *iterator;
+    typedef const T *const_iterator;
+
+    small_vector() : size_(0), capacity_(N) {}
+    small_vector(const small_vector &other) : size_(0), capacity_(N) {
+        reserve(other.size_);
+        for (const auto &value : other) {
+            new (GetStore() + size_) T(value);
+            ++size_;
+        }
+    }
+    small_vector(small_vector &&other) : size_(0), capacity_(N) { MoveFrom(other); }
+    small_vector &operator=(const small_vector &other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            for (const auto &value : other) {
+                new (GetStore() + size_) T(value);
+                ++size_;
+            }
+        }
+        return *this;
+    }
+    small_vector &operator=(small_vector &&other) {
+        if (this != &other) {
+            clear();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+    ~small_vector() { clear(); }
+
+    bool operator==(const small_vector &rhs) const {
+        if (size_ != rhs.size_) return false;
+        for (size_type i = 0; i < size_; ++i) {
+            if ((*this)[i] != rhs[i]) return false;
+        }
+        return true;
+    }
+    bool operator!=(const small_vector &rhs) const { return !(*this == rhs); }
+
+    void reserve(size_type new_cap) {
+        if (new_cap <= capacity_) return;
+        std::unique_ptr<BackingStore[]> new_store(new BackingStore[new_cap]);
+        T *new_values = reinterpret_cast<T *>(new_store.get());
+        T *values = GetStore();
+        for (size_type i = 0; i < size_; ++i) {
+            new (new_values + i) T(std::move(values[i]));
+            values[i].~T();
+        }
+        large_store_ = std::move(new_store);
+        capacity_ = new_cap;
+    }
+
+    void push_back(const T &value) { emplace_back(value); }
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+    template <typename... Args>
+    T &emplace_back(Args &&... args) {
+        if (size_ == capacity_) reserve(capacity_ * 2);
+        T *value = new (GetStore() + size_) T(std::forward<Args>(args)...);
+        ++size_;
+        return *value;
+    }
+
+    // Keeps the capacity, as with std::vector
+    void clear() {
+        T *values = GetStore();
+        for (size_type i = 0; i < size_; ++i) {
+            values[i].~T();
+        }
+        size_ = 0;
+    }
+
+    size_type size() const { return size_; }
+    size_type capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+
+    T &operator[](size_type pos) {
+        assert(pos < size_);
+        return GetStore()[pos];
+    }
+    const T &operator[](size_type pos) const {
+        assert(pos < size_);
+        return GetStore()[pos];
+    }
+    T *data() { return GetStore(); }
+    const T *data() const { return GetStore(); }
+
+    iterator begin() { return GetStore(); }
+    const_iterator begin() const { return GetStore(); }
+    const_iterator cbegin() const { return GetStore(); }
+    iterator end() { return GetStore() + size_; }
+    const_iterator end() const { return GetStore() + size_; }
+    const_iterator cend() const { return GetStore() + size_; }
+
+  private:
+    struct alignas(alignof(T)) BackingStore {
+        uint8_t data[sizeof(T)];
+    };
+
+    T *GetStore() { return reinterpret_cast<T *>(large_store_ ? large_store_.get() : small_store_); }
+    const T *GetStore() const { return reinterpret_cast<const T *>(large_store_ ? large_store_.get() : small_store_); }
+
+    // Takes the heap storage of other when it has any, leaving other empty, otherwise moves the elements
+    void MoveFrom(small_vector &other) {
+        if (other.large_store_ && (other.capacity_ >= capacity_)) {
+            large_store_ = std::move(other.large_store_);
+            capacity_ = other.capacity_;
+            size_ = other.size_;
+            other.capacity_ = N;
+            other.size_ = 0;
+        } else {
+            reserve(other.size_);
+            for (auto &value : other) {
+                new (GetStore() + size_) T(std::move(value));
+                ++size_;
+            }
+            other.clear();
+        }
+    }
+
+    size_type size_;
+    size_type capacity_;
+    BackingStore small_store_[N];
+    std::unique_ptr<BackingStore[]> large_store_;
+};
+
+// Fixed set of threads for splitting a batch of independent, read-only validation work. Run() hands task indices out to the
+// workers and to the calling thread, and returns once every task has finished.
+class ValidationWorkerPool {
+  public:
+    explicit ValidationWorkerPool(uint32_t worker_count);
+    ~ValidationWorkerPool();
+    ValidationWorkerPool(const ValidationWorkerPool &) = delete;
+    ValidationWorkerPool &operator=(const ValidationWorkerPool &) = delete;
+
+    uint32_t WorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+    // Calls task(i) once for each i in [0, task_count), in no particular order or thread. Concurrent Run() calls are serialized.
+    void Run(uint32_t task_count, const std::function<void(uint32_t)> &task);
+
+  private:
+    void WorkerLoop();
+    void RunTasks();
+
+    std::vector<std::thread> workers_;
+    std::mutex run_lock_;
+    std::mutex lock_;
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+    const std::function<void(uint32_t)> *task_;
+    uint32_t task_count_;
+    std::atomic<uint32_t> next_task_;
+    uint32_t busy_workers_;
+    uint64_t generation_;
+    bool shutdown_;
+};
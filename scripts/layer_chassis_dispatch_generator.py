@@ -155,6 +155,107 @@ class LayerChassisDispatchOutputGenerator(OutputGenerator):
 
 #define DISPATCH_MAX_STACK_ALLOCATIONS 32
 
+// Per-thread bump allocator for the temporary unwrapped copies of API parameters. A Dispatch function opens a
+// DispatchScratchScope and allocates its copies from it; when the scope closes the copies are destroyed and their memory
+// is handed back to the arena. Scopes nest, so dispatch calls made by validation objects while an outer call is still in
+// flight work too. Blocks are kept for reuse, so once warmed up the arena does not touch the heap.
+class DispatchScratchArena {
+  public:
+    struct Destructor {
+        void (*destroy)(void *objects, size_t count);
+        void *objects;
+        size_t count;
+        Destructor *next;
+    };
+    struct Mark {
+        size_t block;
+        size_t offset;
+        Destructor *destructors;
+    };
+
+    Mark GetMark() const { return {block_, offset_, destructors_}; }
+
+    void Release(const Mark &mark) {
+        while (destructors_ != mark.destructors) {
+            destructors_->destroy(destructors_->objects, destructors_->count);
+            destructors_ = destructors_->next;
+        }
+        block_ = mark.block;
+        offset_ = mark.offset;
+    }
+
+    void *Allocate(size_t size, size_t alignment) {
+        while (block_ < blocks_.size()) {
+            const size_t offset = (offset_ + alignment - 1) & ~(alignment - 1);
+            if (offset + size <= blocks_[block_].size) {
+                offset_ = offset + size;
+                return blocks_[block_].data.get() + offset;
+            }
+            // Blocks are only ever appended or inserted, so everything past block_ is free
+            if (block_ + 1 < blocks_.size() && blocks_[block_ + 1].size < size + alignment) {
+                blocks_.insert(blocks_.begin() + block_ + 1, Block(size + alignment));
+            }
+            ++block_;
+            offset_ = 0;
+        }
+        blocks_.emplace_back(size + alignment > kBlockSize ? size + alignment : kBlockSize);
+        offset_ = 0;
+        return Allocate(size, alignment);
+    }
+
+    template <typename T>
+    T *NewArray(size_t count) {
+        T *objects = static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+        for (size_t i = 0; i < count; ++i) new (&objects[i]) T();
+        if (!std::is_trivially_destructible<T>::value) {
+            auto destructor = static_cast<Destructor *>(Allocate(sizeof(Destructor), alignof(Destructor)));
+            destructor->destroy = [](void *objects, size_t count) {
+                for (size_t i = 0; i < count; ++i) static_cast<T *>(objects)[i].~T();
+            };
+            destructor->objects = objects;
+            destructor->count = count;
+            destructor->next = destructors_;
+            destructors_ = destructor;
+        }
+        return objects;
+    }
+
+  private:
+    static const size_t kBlockSize = 64 * 1024;
+    struct Block {
+        explicit Block(size_t block_size) : size(block_size), data(new uint8_t[block_size]) {}
+        size_t size;
+        std::unique_ptr<uint8_t[]> data;
+    };
+
+    std::vector<Block> blocks_;
+    size_t block_ = 0;
+    size_t offset_ = 0;
+    Destructor *destructors_ = nullptr;
+};
+
+class DispatchScratchScope {
+  public:
+    DispatchScratchScope() : arena_(GetArena()), mark_(arena_.GetMark()) {}
+    ~DispatchScratchScope() { arena_.Release(mark_); }
+    DispatchScratchScope(const DispatchScratchScope &) = delete;
+    DispatchScratchScope &operator=(const DispatchScratchScope &) = delete;
+
+    template <typename T>
+    T *NewArray(size_t count) {
+        return arena_.NewArray<T>(count);
+    }
+
+  private:
+    static DispatchScratchArena &GetArena() {
+        static thread_local DispatchScratchArena arena;
+        return arena;
+    }
+
+    DispatchScratchArena &arena_;
+    const DispatchScratchArena::Mark mark_;
+};
+
 // The VK_EXT_pipeline_creation_feedback extension returns data from the driver -- we've created a copy of the pnext chain, so
 // copy the returned data to the caller before freeing the copy's data.
 void CopyCreatePipelineFeedbackData(const void *src_chain, const void *dst_chain) {
@@ -174,9 +275,10 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateGraphicsPipelines(device, pipelineCache, createInfoCount,
                                                                                            pCreateInfos, pAllocator, pPipelines);
+    DispatchScratchScope scratch;
     safe_VkGraphicsPipelineCreateInfo *local_pCreateInfos = nullptr;
     if (pCreateInfos) {
-        local_pCreateInfos = new safe_VkGraphicsPipelineCreateInfo[createInfoCount];
+        local_pCreateInfos = scratch.NewArray<safe_VkGraphicsPipelineCreateInfo>(createInfoCount);
         read_lock_guard_t lock(dispatch_lock);
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             bool uses_color_attachment = false;
@@ -224,7 +326,6 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
         }
     }
 
-    delete[] local_pCreateInfos;
     {
         for (uint32_t i = 0; i < createInfoCount; ++i) {
             if (pPipelines[i] != VK_NULL_HANDLE) {
@@ -235,6 +336,140 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
     return result;
 }
 
+// Streaming descriptor updates are hot, so rather than deep copying the writes through safe structs this makes shallow
+// copies in the scratch arena and only replaces the handle arrays. Writes with a pNext chain (which may carry handles)
+// fall back to a deep copy of that write.
+void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
+                                  uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
+                                                                      descriptorCopyCount, pDescriptorCopies);
+    DispatchScratchScope scratch;
+    VkWriteDescriptorSet *local_pDescriptorWrites = nullptr;
+    VkCopyDescriptorSet *local_pDescriptorCopies = nullptr;
+    if (pDescriptorWrites) {
+        local_pDescriptorWrites = scratch.NewArray<VkWriteDescriptorSet>(descriptorWriteCount);
+        for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
+            const VkWriteDescriptorSet &write = pDescriptorWrites[index0];
+            VkWriteDescriptorSet &local_write = local_pDescriptorWrites[index0];
+            if (write.pNext) {
+                auto safe_write = scratch.NewArray<safe_VkWriteDescriptorSet>(1);
+                safe_write->initialize(&write);
+                WrapPnextChainHandles(layer_data, safe_write->pNext);
+                local_write = *safe_write->ptr();
+            } else {
+                local_write = write;
+            }
+            if (write.dstSet) {
+                local_write.dstSet = layer_data->Unwrap(write.dstSet);
+            }
+            switch (write.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    if (write.descriptorCount && write.pImageInfo) {
+                        auto local_image_info = scratch.NewArray<VkDescriptorImageInfo>(write.descriptorCount);
+                        for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                            local_image_info[index1] = write.pImageInfo[index1];
+                            if (write.pImageInfo[index1].sampler) {
+                                local_image_info[index1].sampler = layer_data->Unwrap(write.pImageInfo[index1].sampler);
+                            }
+                            if (write.pImageInfo[index1].imageView) {
+                                local_image_info[index1].imageView = layer_data->Unwrap(write.pImageInfo[index1].imageView);
+                            }
+                        }
+                        local_write.pImageInfo = local_image_info;
+                    }
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    if (write.descriptorCount && write.pBufferInfo) {
+                        auto local_buffer_info = scratch.NewArray<VkDescriptorBufferInfo>(write.descriptorCount);
+                        for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                            local_buffer_info[index1] = write.pBufferInfo[index1];
+                            if (write.pBufferInfo[index1].buffer) {
+                                local_buffer_info[index1].buffer = layer_data->Unwrap(write.pBufferInfo[index1].buffer);
+                            }
+                        }
+                        local_write.pBufferInfo = local_buffer_info;
+                    }
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    if (write.descriptorCount && write.pTexelBufferView) {
+                        auto local_texel_buffer_view = scratch.NewArray<VkBufferView>(write.descriptorCount);
+                        for (uint32_t index1 = 0; index1 < write.descriptorCount; ++index1) {
+                            local_texel_buffer_view[index1] = layer_data->Unwrap(write.pTexelBufferView[index1]);
+                        }
+                        local_write.pTexelBufferView = local_texel_buffer_view;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    if (pDescriptorCopies) {
+        local_pDescriptorCopies = scratch.NewArray<VkCopyDescriptorSet>(descriptorCopyCount);
+        for (uint32_t index0 = 0; index0 < descriptorCopyCount; ++index0) {
+            local_pDescriptorCopies[index0] = pDescriptorCopies[index0];
+            if (pDescriptorCopies[index0].srcSet) {
+                local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(pDescriptorCopies[index0].srcSet);
+            }
+            if (pDescriptorCopies[index0].dstSet) {
+                local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(pDescriptorCopies[index0].dstSet);
+            }
+        }
+    }
+    layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, local_pDescriptorWrites,
+                                                           descriptorCopyCount, local_pDescriptorCopies);
+}
+
+// Submits are hot too, so they get the same treatment as descriptor writes: shallow copies in the scratch arena with only
+// the semaphore arrays replaced. A submit with a pNext chain (which may carry handles) falls back to a deep copy.
+VkResult DispatchQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    DispatchScratchScope scratch;
+    VkSubmitInfo *local_pSubmits = nullptr;
+    if (pSubmits) {
+        local_pSubmits = scratch.NewArray<VkSubmitInfo>(submitCount);
+        for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
+            const VkSubmitInfo &submit = pSubmits[index0];
+            VkSubmitInfo &local_submit = local_pSubmits[index0];
+            if (submit.pNext) {
+                auto safe_submit = scratch.NewArray<safe_VkSubmitInfo>(1);
+                safe_submit->initialize(&submit);
+                WrapPnextChainHandles(layer_data, safe_submit->pNext);
+                local_submit = *safe_submit->ptr();
+            } else {
+                local_submit = submit;
+            }
+            if (submit.waitSemaphoreCount && submit.pWaitSemaphores) {
+                auto local_wait_semaphores = scratch.NewArray<VkSemaphore>(submit.waitSemaphoreCount);
+                for (uint32_t index1 = 0; index1 < submit.waitSemaphoreCount; ++index1) {
+                    local_wait_semaphores[index1] = layer_data->Unwrap(submit.pWaitSemaphores[index1]);
+                }
+                local_submit.pWaitSemaphores = local_wait_semaphores;
+            }
+            if (submit.signalSemaphoreCount && submit.pSignalSemaphores) {
+                auto local_signal_semaphores = scratch.NewArray<VkSemaphore>(submit.signalSemaphoreCount);
+                for (uint32_t index1 = 0; index1 < submit.signalSemaphoreCount; ++index1) {
+                    local_signal_semaphores[index1] = layer_data->Unwrap(submit.pSignalSemaphores[index1]);
+                }
+                local_submit.pSignalSemaphores = local_signal_semaphores;
+            }
+        }
+    }
+    fence = layer_data->Unwrap(fence);
+    return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, local_pSubmits, fence);
+}
+
 template <typename T>
 static void UpdateCreateRenderPassState(ValidationObject *layer_data, const T *pCreateInfo, VkRenderPass renderPass) {
     auto &renderpass_state = layer_data->renderpasses_states[renderPass];
@@ -315,16 +550,18 @@ VkResult DispatchCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfo
                                     const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
-    safe_VkSwapchainCreateInfoKHR *local_pCreateInfo = NULL;
+    // None of the members behind pointers hold handles, so a shallow copy is enough
+    VkSwapchainCreateInfoKHR local_create_info;
+    const VkSwapchainCreateInfoKHR *local_pCreateInfo = nullptr;
     if (pCreateInfo) {
-        local_pCreateInfo = new safe_VkSwapchainCreateInfoKHR(pCreateInfo);
-        local_pCreateInfo->oldSwapchain = layer_data->Unwrap(pCreateInfo->oldSwapchain);
+        local_create_info = *pCreateInfo;
+        local_create_info.oldSwapchain = layer_data->Unwrap(pCreateInfo->oldSwapchain);
         // Surface is instance-level object
-        local_pCreateInfo->surface = layer_data->Unwrap(pCreateInfo->surface);
+        local_create_info.surface = layer_data->Unwrap(pCreateInfo->surface);
+        local_pCreateInfo = &local_create_info;
     }
 
-    VkResult result = layer_data->device_dispatch_table.CreateSwapchainKHR(device, local_pCreateInfo->ptr(), pAllocator, pSwapchain);
-    delete local_pCreateInfo;
+    VkResult result = layer_data->device_dispatch_table.CreateSwapchainKHR(device, local_pCreateInfo, pAllocator, pSwapchain);
 
     if (VK_SUCCESS == result) {
         *pSwapchain = layer_data->WrapNew(*pSwapchain);
@@ -338,25 +575,23 @@ VkResult DispatchCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCo
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator,
                                                                            pSwapchains);
-    safe_VkSwapchainCreateInfoKHR *local_pCreateInfos = NULL;
-    {
-        if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkSwapchainCreateInfoKHR[swapchainCount];
-            for (uint32_t i = 0; i < swapchainCount; ++i) {
-                local_pCreateInfos[i].initialize(&pCreateInfos[i]);
-                if (pCreateInfos[i].surface) {
-                    // Surface is instance-level object
-                    local_pCreateInfos[i].surface = layer_data->Unwrap(pCreateInfos[i].surface);
-                }
-                if (pCreateInfos[i].oldSwapchain) {
-                    local_pCreateInfos[i].oldSwapchain = layer_data->Unwrap(pCreateInfos[i].oldSwapchain);
-                }
+    DispatchScratchScope scratch;
+    VkSwapchainCreateInfoKHR *local_pCreateInfos = nullptr;
+    if (pCreateInfos) {
+        local_pCreateInfos = scratch.NewArray<VkSwapchainCreateInfoKHR>(swapchainCount);
+        for (uint32_t i = 0; i < swapchainCount; ++i) {
+            local_pCreateInfos[i] = pCreateInfos[i];
+            if (pCreateInfos[i].surface) {
+                // Surface is instance-level object
+                local_pCreateInfos[i].surface = layer_data->Unwrap(pCreateInfos[i].surface);
+            }
+            if (pCreateInfos[i].oldSwapchain) {
+                local_pCreateInfos[i].oldSwapchain = layer_data->Unwrap(pCreateInfos[i].oldSwapchain);
             }
         }
     }
-    VkResult result = layer_data->device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, local_pCreateInfos->ptr(),
+    VkResult result = layer_data->device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, local_pCreateInfos,
                                                                                   pAllocator, pSwapchains);
-    delete[] local_pCreateInfos;
     if (VK_SUCCESS == result) {
         for (uint32_t i = 0; i < swapchainCount; i++) {
             pSwapchains[i] = layer_data->WrapNew(pSwapchains[i]);
@@ -418,33 +653,29 @@ void DispatchDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, cons
 VkResult DispatchQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueuePresentKHR(queue, pPresentInfo);
-    safe_VkPresentInfoKHR *local_pPresentInfo = NULL;
-    {
-        if (pPresentInfo) {
-            local_pPresentInfo = new safe_VkPresentInfoKHR(pPresentInfo);
-            if (local_pPresentInfo->pWaitSemaphores) {
-                for (uint32_t index1 = 0; index1 < local_pPresentInfo->waitSemaphoreCount; ++index1) {
-                    local_pPresentInfo->pWaitSemaphores[index1] = layer_data->Unwrap(pPresentInfo->pWaitSemaphores[index1]);
-                }
-            }
-            if (local_pPresentInfo->pSwapchains) {
-                for (uint32_t index1 = 0; index1 < local_pPresentInfo->swapchainCount; ++index1) {
-                    local_pPresentInfo->pSwapchains[index1] = layer_data->Unwrap(pPresentInfo->pSwapchains[index1]);
-                }
+    // A shallow copy with only the handle arrays replaced, which also leaves pResults pointing at the caller's array
+    DispatchScratchScope scratch;
+    VkPresentInfoKHR local_present_info;
+    const VkPresentInfoKHR *local_pPresentInfo = nullptr;
+    if (pPresentInfo) {
+        local_present_info = *pPresentInfo;
+        if (pPresentInfo->waitSemaphoreCount && pPresentInfo->pWaitSemaphores) {
+            auto local_wait_semaphores = scratch.NewArray<VkSemaphore>(pPresentInfo->waitSemaphoreCount);
+            for (uint32_t index1 = 0; index1 < pPresentInfo->waitSemaphoreCount; ++index1) {
+                local_wait_semaphores[index1] = layer_data->Unwrap(pPresentInfo->pWaitSemaphores[index1]);
             }
+            local_present_info.pWaitSemaphores = local_wait_semaphores;
         }
-    }
-    VkResult result = layer_data->device_dispatch_table.QueuePresentKHR(queue, local_pPresentInfo->ptr());
-
-    // pResults is an output array embedded in a structure. The code generator neglects to copy back from the safe_* version,
-    // so handle it as a special case here:
-    if (pPresentInfo && pPresentInfo->pResults) {
-        for (uint32_t i = 0; i < pPresentInfo->swapchainCount; i++) {
-            pPresentInfo->pResults[i] = local_pPresentInfo->pResults[i];
+        if (pPresentInfo->swapchainCount && pPresentInfo->pSwapchains) {
+            auto local_swapchains = scratch.NewArray<VkSwapchainKHR>(pPresentInfo->swapchainCount);
+            for (uint32_t index1 = 0; index1 < pPresentInfo->swapchainCount; ++index1) {
+                local_swapchains[index1] = layer_data->Unwrap(pPresentInfo->pSwapchains[index1]);
+            }
+            local_present_info.pSwapchains = local_swapchains;
         }
+        local_pPresentInfo = &local_present_info;
     }
-    delete local_pPresentInfo;
-    return result;
+    return layer_data->device_dispatch_table.QueuePresentKHR(queue, local_pPresentInfo);
 }
 
 void DispatchDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks *pAllocator) {
@@ -495,25 +726,24 @@ VkResult DispatchAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAl
                                         VkDescriptorSet *pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
-    safe_VkDescriptorSetAllocateInfo *local_pAllocateInfo = NULL;
-    {
-        if (pAllocateInfo) {
-            local_pAllocateInfo = new safe_VkDescriptorSetAllocateInfo(pAllocateInfo);
-            if (pAllocateInfo->descriptorPool) {
-                local_pAllocateInfo->descriptorPool = layer_data->Unwrap(pAllocateInfo->descriptorPool);
-            }
-            if (local_pAllocateInfo->pSetLayouts) {
-                for (uint32_t index1 = 0; index1 < local_pAllocateInfo->descriptorSetCount; ++index1) {
-                    local_pAllocateInfo->pSetLayouts[index1] = layer_data->Unwrap(local_pAllocateInfo->pSetLayouts[index1]);
-                }
+    DispatchScratchScope scratch;
+    VkDescriptorSetAllocateInfo local_allocate_info;
+    const VkDescriptorSetAllocateInfo *local_pAllocateInfo = nullptr;
+    if (pAllocateInfo) {
+        local_allocate_info = *pAllocateInfo;
+        if (pAllocateInfo->descriptorPool) {
+            local_allocate_info.descriptorPool = layer_data->Unwrap(pAllocateInfo->descriptorPool);
+        }
+        if (pAllocateInfo->descriptorSetCount && pAllocateInfo->pSetLayouts) {
+            auto local_set_layouts = scratch.NewArray<VkDescriptorSetLayout>(pAllocateInfo->descriptorSetCount);
+            for (uint32_t index1 = 0; index1 < pAllocateInfo->descriptorSetCount; ++index1) {
+                local_set_layouts[index1] = layer_data->Unwrap(pAllocateInfo->pSetLayouts[index1]);
             }
+            local_allocate_info.pSetLayouts = local_set_layouts;
         }
+        local_pAllocateInfo = &local_allocate_info;
     }
-    VkResult result = layer_data->device_dispatch_table.AllocateDescriptorSets(
-        device, (const VkDescriptorSetAllocateInfo *)local_pAllocateInfo, pDescriptorSets);
-    if (local_pAllocateInfo) {
-        delete local_pAllocateInfo;
-    }
+    VkResult result = layer_data->device_dispatch_table.AllocateDescriptorSets(device, local_pAllocateInfo, pDescriptorSets);
     if (VK_SUCCESS == result) {
         write_lock_guard_t lock(dispatch_lock);
         auto &pool_descriptor_sets = layer_data->pool_descriptor_sets_map[pAllocateInfo->descriptorPool];
@@ -530,12 +760,13 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles)
         return layer_data->device_dispatch_table.FreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+    DispatchScratchScope scratch;
     VkDescriptorSet *local_pDescriptorSets = NULL;
     VkDescriptorPool local_descriptor_pool = VK_NULL_HANDLE;
     {
         local_descriptor_pool = layer_data->Unwrap(descriptorPool);
         if (pDescriptorSets) {
-            local_pDescriptorSets = new VkDescriptorSet[descriptorSetCount];
+            local_pDescriptorSets = scratch.NewArray<VkDescriptorSet>(descriptorSetCount);
             for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
                 local_pDescriptorSets[index0] = layer_data->Unwrap(pDescriptorSets[index0]);
             }
@@ -543,7 +774,6 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
     }
     VkResult result = layer_data->device_dispatch_table.FreeDescriptorSets(device, local_descriptor_pool, descriptorSetCount,
                                                                            (const VkDescriptorSet *)local_pDescriptorSets);
-    if (local_pDescriptorSets) delete[] local_pDescriptorSets;
     if ((VK_SUCCESS == result) && (pDescriptorSets)) {
         write_lock_guard_t lock(dispatch_lock);
         auto &pool_descriptor_sets = layer_data->pool_descriptor_sets_map[descriptorPool];
@@ -1078,7 +1308,9 @@ void DispatchGetPrivateDataEXT(
             'vkGetSwapchainImagesKHR',
             'vkDestroySwapchainKHR',
             'vkQueuePresentKHR',
+            'vkQueueSubmit',
             'vkCreateGraphicsPipelines',
+            'vkUpdateDescriptorSets',
             'vkResetDescriptorPool',
             'vkDestroyDescriptorPool',
             'vkAllocateDescriptorSets',
@@ -1522,14 +1754,6 @@ void DispatchGetPrivateDataEXT(
 
     #
     # Clean up local declarations
-    def cleanUpLocalDeclarations(self, indent, prefix, name, len, index):
-        cleanup = ''
-        if len is not None:
-            cleanup = '%sif (local_%s%s) {\n' % (indent, prefix, name)
-            cleanup += '%s    delete[] local_%s%s;\n' % (indent, prefix, name)
-            cleanup += "%s}\n" % (indent)
-        return cleanup
-    #
     # Output UO code for a single NDO (ndo_count is NULL) or a counted list of NDOs
     def outputNDOs(self, ndo_type, ndo_name, ndo_count, prefix, index, indent, destroy_func, destroy_array, top_level):
         decl_code = ''
@@ -1542,7 +1766,7 @@ void DispatchGetPrivateDataEXT(
             pre_call_code += '%s    if (%s%s) {\n' % (indent, prefix, ndo_name)
             indent = self.incIndent(indent)
             if top_level == True:
-                pre_call_code += '%s    local_%s%s = %s > DISPATCH_MAX_STACK_ALLOCATIONS ? new %s[%s] : var_local_%s%s;\n' % (indent, prefix, ndo_name, ndo_count, ndo_type, ndo_count, prefix, ndo_name)
+                pre_call_code += '%s    local_%s%s = %s > DISPATCH_MAX_STACK_ALLOCATIONS ? scratch.NewArray<%s>(%s) : var_local_%s%s;\n' % (indent, prefix, ndo_name, ndo_count, ndo_type, ndo_count, prefix, ndo_name)
                 pre_call_code += '%s    for (uint32_t %s = 0; %s < %s; ++%s) {\n' % (indent, index, index, ndo_count, index)
                 indent = self.incIndent(indent)
                 pre_call_code += '%s    local_%s%s[%s] = layer_data->Unwrap(%s[%s]);\n' % (indent, prefix, ndo_name, index, ndo_name, index)
@@ -1554,10 +1778,6 @@ void DispatchGetPrivateDataEXT(
             pre_call_code += '%s    }\n' % indent
             indent = self.decIndent(indent)
             pre_call_code += '%s    }\n' % indent
-            if top_level == True:
-                post_call_code += '%sif (local_%s%s != var_local_%s%s)\n' % (indent, prefix, ndo_name, prefix, ndo_name)
-                indent = self.incIndent(indent)
-                post_call_code += '%sdelete[] local_%s;\n' % (indent, ndo_name)
         else:
             if top_level == True:
                 if (destroy_func == False) or (destroy_array == True):
@@ -1619,7 +1839,7 @@ void DispatchGetPrivateDataEXT(
                         pre_code += '%s    if (%s%s) {\n' % (indent, prefix, member.name)
                         indent = self.incIndent(indent)
                         if first_level_param == True:
-                            pre_code += '%s    %s = new %s[%s];\n' % (indent, new_prefix, safe_type, member.len)
+                            pre_code += '%s    %s = scratch.NewArray<%s>(%s);\n' % (indent, new_prefix, safe_type, member.len)
                         pre_code += '%s    for (uint32_t %s = 0; %s < %s%s; ++%s) {\n' % (indent, index, index, prefix, member.len, index)
                         indent = self.incIndent(indent)
                         if first_level_param == True:
@@ -1639,8 +1859,6 @@ void DispatchGetPrivateDataEXT(
                         pre_code += '%s    }\n' % indent
                         indent = self.decIndent(indent)
                         pre_code += '%s    }\n' % indent
-                        if first_level_param == True:
-                            post_code += self.cleanUpLocalDeclarations(indent, prefix, member.name, member.len, index)
                     # Single Struct
                     elif member.ispointer:
                         # Update struct prefix
@@ -1668,8 +1886,6 @@ void DispatchGetPrivateDataEXT(
                             pre_code += '%s    WrapPnextChainHandles(layer_data, local_%s%s->pNext);\n' % (indent, prefix, member.name)
                         indent = self.decIndent(indent)
                         pre_code += '%s    }\n' % indent
-                        if first_level_param == True:
-                            post_code += self.cleanUpLocalDeclarations(indent, prefix, member.name, member.len, index)
                     else:
                         # Update struct prefix
                         if first_level_param == True:
@@ -1711,6 +1927,9 @@ void DispatchGetPrivateDataEXT(
             create_func = True if create_ndo_code else False
             destroy_func = True if destroy_ndo_code else False
             (paramdecl, param_pre_code, param_post_code) = self.uniquify_members(cmd_info, indent, '', 0, create_func, destroy_func, destroy_array, True)
+            # Temporary copies of parameter arrays come from the per-thread scratch arena
+            if 'scratch.NewArray' in param_pre_code:
+                paramdecl = '%sDispatchScratchScope scratch;\n%s' % (indent, paramdecl)
             param_post_code += create_ndo_code
             if destroy_ndo_code:
                 if destroy_array == True:
@@ -166,6 +166,15 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkGetPhysicalDeviceToolPropertiesEXT',
         ]
 
+    exclusive_record_commands = [
+        # vkCmd* functions whose state recording also updates objects shared with other command buffers. Their record hooks take
+        # the object-wide lock exclusively even when the rest of command buffer recording is locked per command buffer.
+        'vkCmdBuildAccelerationStructureNV',
+        'vkCmdCopyAccelerationStructureNV',
+        'vkCmdBuildAccelerationStructureKHR',
+        'vkCmdCopyAccelerationStructureKHR',
+        ]
+
     alt_ret_codes = [
         # Include functions here which must tolerate VK_INCOMPLETE as a return code
         'vkEnumeratePhysicalDevices',
@@ -209,6 +218,7 @@ class LayerChassisOutputGenerator(OutputGenerator):
     precallvalidate_loop = "for (auto intercept : layer_data->object_dispatch) {"
     precallrecord_loop = precallvalidate_loop
     postcallrecord_loop = "for (auto intercept : layer_data->object_dispatch) {"
+    intercept_loop = "for (auto intercept : layer_data->intercept_vectors[InterceptId%s%s]) {"
 
     inline_custom_header_preamble = """
 #include <atomic>
@@ -221,6 +231,7 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include <unordered_set>
 #include <algorithm>
 #include <memory>
+#include <typeinfo>
 
 #include "vk_loader_platform.h"
 #include "vulkan/vulkan.h"
@@ -255,7 +266,7 @@ struct HashedUint64 {
     }
 };
 
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vl_concurrent_id_map<uint64_t, uint64_t> unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -308,6 +319,10 @@ typedef enum ValidationCheckDisables {
 typedef enum ValidationCheckEnables {
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM,
     VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ALL,
+    VALIDATION_CHECK_ENABLE_FINE_GRAINED_LOCKING,
+    VALIDATION_CHECK_ENABLE_GPU_DEFERRED_READBACK,
+    VALIDATION_CHECK_ENABLE_PARALLEL_DESCRIPTOR_UPDATES,
+    VALIDATION_CHECK_ENABLE_SHARED_STATE_TRACKING,
 } ValidationCheckEnables;
 
 typedef enum VkValidationFeatureEnable {
@@ -342,6 +357,10 @@ typedef enum EnableFlags {
     vendor_specific_arm,
     debug_printf,
     sync_validation,
+    fine_grained_locking,
+    gpu_deferred_readback,
+    parallel_descriptor_updates,
+    shared_state_tracking,
     // Insert new enables above this line
     kMaxEnableFlags,
 } EnableFlags;
@@ -369,6 +388,8 @@ class ValidationObject {
         LAYER_PHYS_DEV_PROPERTIES phys_dev_properties = {};
 
         std::vector<ValidationObject*> object_dispatch;
+        // Per-intercept subsets of object_dispatch, holding only the objects that override that particular hook
+        std::vector<std::vector<ValidationObject*>> intercept_vectors;
         LayerObjectTypeId container_type;
 
         std::string layer_name = "CHASSIS";
@@ -385,6 +406,14 @@ class ValidationObject {
         virtual write_lock_guard_t write_lock() {
             return write_lock_guard_t(validation_object_mutex);
         }
+        // Locks taken around the hooks of vkCmd* commands. By default these are the object-wide locks, validation objects
+        // that synchronize their per command buffer state themselves can narrow them to the target command buffer.
+        virtual CmdBufferLockGuard cmd_buffer_read_lock(VkCommandBuffer command_buffer) {
+            return CmdBufferLockGuard{read_lock()};
+        }
+        virtual CmdBufferLockGuard cmd_buffer_write_lock(VkCommandBuffer command_buffer) {
+            return CmdBufferLockGuard{read_lock_guard_t(), write_lock()};
+        }
 
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
@@ -418,6 +447,8 @@ class ValidationObject {
             }
         }
 
+        void InitObjectDispatchVectors();
+
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
             for (auto validation_object : object_dispatch) {
                 if (validation_object->container_type == object_type) {
@@ -429,6 +460,7 @@ class ValidationObject {
 
         // Debug Logging Helpers
         bool LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
@@ -447,6 +479,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool LogError(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ||
@@ -466,6 +499,7 @@ class ValidationObject {
         };
 
         bool LogWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
@@ -484,6 +518,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
@@ -502,6 +537,7 @@ class ValidationObject {
         };
 
         bool LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
@@ -520,6 +556,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ||
@@ -538,6 +575,7 @@ class ValidationObject {
         };
 
         bool LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
@@ -556,6 +594,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            if (!LogMsgEnabled(report_data, vuid_text)) return false;
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!(report_data->active_severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) ||
@@ -672,7 +711,7 @@ small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+vl_concurrent_id_map<uint64_t, uint64_t> unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -688,6 +727,7 @@ bool wrap_handles = true;
 #include "stateless_validation.h"
 #include "synchronization_validation.h"
 #include "thread_safety.h"
+#include "command_counter.h"
 
 // Global list of sType,size identifiers
 std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info{};
@@ -959,6 +999,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
 
     framework->object_dispatch = local_object_dispatch;
     framework->container_type = LayerObjectTypeInstance;
+    framework->InitObjectDispatchVectors();
     framework->disabled = local_disables;
     framework->enabled = local_enables;
 
@@ -1137,6 +1178,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         }
     }
 
+    device_interceptor->InitObjectDispatchVectors();
+
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
@@ -1638,6 +1681,79 @@ VKAPI_ATTR VkResult VKAPI_CALL GetValidationCacheDataEXT(
         };
 """
 
+    init_object_dispatch_vector_preamble = """
+// Build the per-intercept dispatch vectors. An object is only added to the vector for a given hook if its class (or
+// one of its bases other than ValidationObject) overrides that hook -- a pointer-to-member that still resolves to the
+// ValidationObject declaration has the same type as the base one, any override has a different class type.
+void ValidationObject::InitObjectDispatchVectors() {
+
+#define BUILD_DISPATCH_VECTOR(name) \\
+    init_object_dispatch_vector(InterceptId ## name, \\
+                                typeid(&ValidationObject::name), \\
+                                typeid(&ThreadSafety::name), \\
+                                typeid(&StatelessValidation::name), \\
+                                typeid(&ObjectLifetimes::name), \\
+                                typeid(&CoreChecks::name), \\
+                                typeid(&BestPractices::name), \\
+                                typeid(&GpuAssisted::name), \\
+                                typeid(&DebugPrintf::name), \\
+                                typeid(&SyncValidator::name), \\
+                                typeid(&CommandCounter::name));
+
+    auto init_object_dispatch_vector = [this](InterceptId id,
+                                              const std::type_info& vo_typeid,
+                                              const std::type_info& tt_typeid,
+                                              const std::type_info& tpv_typeid,
+                                              const std::type_info& tot_typeid,
+                                              const std::type_info& tcv_typeid,
+                                              const std::type_info& tbp_typeid,
+                                              const std::type_info& tga_typeid,
+                                              const std::type_info& tdp_typeid,
+                                              const std::type_info& tsv_typeid,
+                                              const std::type_info& tcc_typeid) {
+        auto &intercept_vector = this->intercept_vectors[id];
+        for (auto item : this->object_dispatch) {
+            switch (item->container_type) {
+            case LayerObjectTypeThreading:
+                if (tt_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeParameterValidation:
+                if (tpv_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeObjectTracker:
+                if (tot_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeCoreValidation:
+                if (tcv_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeBestPractices:
+                if (tbp_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeGpuAssisted:
+                if (tga_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeDebugPrintf:
+                if (tdp_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeSyncValidation:
+                if (tsv_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            case LayerObjectTypeCommandCounter:
+                if (tcc_typeid != vo_typeid) intercept_vector.push_back(item);
+                break;
+            default:
+                // Chassis codegen needs to be updated for unknown validation object type
+                assert(0);
+                intercept_vector.push_back(item);
+                break;
+            }
+        }
+    };
+
+    intercept_vectors.clear();
+    intercept_vectors.resize(InterceptIdCount);
+"""
+
     inline_custom_source_postamble = """
 // loader-layer interface v0, just wrappers since there is only a layer
 
@@ -1702,6 +1818,8 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Internal state - accumulators for different inner block text
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
         self.intercepts = []
+        self.intercept_ids = []                     # InterceptId enumerants, one per generated pre/post call hook
+        self.build_dispatch_vectors = []            # Calls populating the per-intercept dispatch vectors
         self.layer_factory = ''                     # String containing base layer factory class definition
 
     # Check if the parameter passed in is a pointer to an array
@@ -1749,8 +1867,17 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             write('};\n', file=self.outFile)
             self.newline()
             write('} // namespace vulkan_layer_chassis', file=self.outFile)
+            write(self.init_object_dispatch_vector_preamble, file=self.outFile)
+            write('\n'.join(self.build_dispatch_vectors), file=self.outFile)
+            write('}\n', file=self.outFile)
         if self.header:
             self.newline()
+            # Output the intercept ids used to index the per-intercept dispatch vectors
+            write('// Intercept identifiers, used to index ValidationObject::intercept_vectors', file=self.outFile)
+            write('typedef enum InterceptId {', file=self.outFile)
+            write('\n'.join(self.intercept_ids), file=self.outFile)
+            write('    InterceptIdCount,', file=self.outFile)
+            write('} InterceptId;', file=self.outFile)
             # Output Layer Factory Class Definitions
             self.layer_factory += self.inline_custom_validation_class_definitions
             self.layer_factory += '};\n\n'
@@ -1861,6 +1988,14 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.layer_factory += self.BaseClassCdecl(cmdinfo.elem, name)
             if (self.featureExtraProtect != None):
                 self.layer_factory += '#endif\n'
+            # Manually implemented intercepts keep walking the full object_dispatch list
+            if name not in self.manual_functions:
+                if (self.featureExtraProtect != None):
+                    self.intercept_ids += [ '#ifdef %s' % self.featureExtraProtect ]
+                for hook in ['PreCallValidate', 'PreCallRecord', 'PostCallRecord']:
+                    self.intercept_ids += [ '    InterceptId%s%s,' % (hook, name[2:]) ]
+                if (self.featureExtraProtect != None):
+                    self.intercept_ids += [ '#endif' ]
             return
 
         dispatchable_type = cmdinfo.elem.find('param/type').text
@@ -1891,6 +2026,13 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if (self.featureExtraProtect != None):
             self.intercepts += [ '#endif' ]
         OutputGenerator.genCmd(self, cmdinfo, name, alias)
+        # Populate the per-intercept dispatch vectors for this command
+        if (self.featureExtraProtect != None):
+            self.build_dispatch_vectors += [ '#ifdef %s' % self.featureExtraProtect ]
+        for hook in ['PreCallValidate', 'PreCallRecord', 'PostCallRecord']:
+            self.build_dispatch_vectors += [ '    BUILD_DISPATCH_VECTOR(%s%s);' % (hook, name[2:]) ]
+        if (self.featureExtraProtect != None):
+            self.build_dispatch_vectors += [ '#endif' ]
         #
         decls = self.makeCDecls(cmdinfo.elem)
         self.appendSection('command', '')
@@ -1918,19 +2060,28 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if (resulttype.text != 'void'):
             assignresult = resulttype.text + ' result = '
 
-        # Set up skip and locking
+        # Set up skip and locking. Command buffer recording can be locked at command buffer granularity.
         self.appendSection('command', '    bool skip = false;')
+        if name.startswith('vkCmd') and dispatchable_type == 'VkCommandBuffer':
+            read_lock = 'intercept->cmd_buffer_read_lock(%s)' % dispatchable_name
+            if name in self.exclusive_record_commands:
+                write_lock = 'intercept->write_lock()'
+            else:
+                write_lock = 'intercept->cmd_buffer_write_lock(%s)' % dispatchable_name
+        else:
+            read_lock = 'intercept->read_lock()'
+            write_lock = 'intercept->write_lock()'
 
         # Generate pre-call validation source code
-        self.appendSection('command', '    %s' % self.precallvalidate_loop)
-        self.appendSection('command', '        auto lock = intercept->read_lock();')
+        self.appendSection('command', '    %s' % self.intercept_loop % ('PreCallValidate', api_function_name[2:]))
+        self.appendSection('command', '        auto lock = %s;' % read_lock)
         self.appendSection('command', '        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
         self.appendSection('command', '    }')
 
         # Generate pre-call state recording source code
-        self.appendSection('command', '    %s' % self.precallrecord_loop)
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        self.appendSection('command', '    %s' % self.intercept_loop % ('PreCallRecord', api_function_name[2:]))
+        self.appendSection('command', '        auto lock = %s;' % write_lock)
         self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '    }')
 
@@ -1946,11 +2097,11 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             self.appendSection('command', '    %s' % self.post_dispatch_debug_utils_functions[name])
 
         # Generate post-call object processing source code
-        self.appendSection('command', '    %s' % self.postcallrecord_loop)
+        self.appendSection('command', '    %s' % self.intercept_loop % ('PostCallRecord', api_function_name[2:]))
         returnparam = ''
         if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
             returnparam = ', result'
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        self.appendSection('command', '        auto lock = %s;' % write_lock)
         self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
         self.appendSection('command', '    }')
         # Return result variable, if any.
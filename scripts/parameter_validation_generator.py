@@ -501,7 +501,7 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                             print("Error in parameter_validation_generator.py CodeGen.")
                         norm_ext_name = ext_name_define[:-15].lower()
                         if table_type == 'device':
-                            pnext_check += '            if ((!SupportedByPdev(physical_device, %s)) && !%s_extensions.%s) {\n' % (ext_name_define, table_type, norm_ext_name.lower())
+                            pnext_check += '            if (!%s_extensions.%s && (!SupportedByPdev(physical_device, %s))) {\n' % (table_type, norm_ext_name.lower(), ext_name_define)
                         else:
                             pnext_check += '            if (!%s_extensions.%s) {\n' % (table_type, norm_ext_name.lower())
                         pnext_check += '                skip |= LogError(\n'
@@ -768,7 +768,7 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                     enum_entry = '\n#ifdef %s\n' % self.featureExtraProtect
                 else:
                     enum_entry = ''
-                enum_entry += 'const std::vector<%s> All%sEnums = {' % (groupName, groupName)
+                enum_entry += 'const ValidEnumValues<%s> All%sEnums = {' % (groupName, groupName)
                 for enum in groupElem:
                     name = enum.get('name')
                     if name is not None and enum.get('supported') != 'disabled':
@@ -216,7 +216,7 @@ public:
         int64_t count;
     };
 
-    ObjectUseData() : thread(0), writer_reader_count(0) {
+    ObjectUseData() : thread(0), writer_reader_count(0), owner(0) {
         // silence -Wunused-private-field warning
         padding[0] = 0;
     }
@@ -241,6 +241,17 @@ public:
         return WriteReadCount(writer_reader_count);
     }
 
+    // A record is handed to a new object only once no thread counts itself as using it, so the counts are already zero.
+    bool IsIdle() const { return writer_reader_count.load() == 0; }
+    void Reset(uint64_t object_id) {
+        thread.store(0, std::memory_order_relaxed);
+        owner.store(object_id);
+    }
+    void Release() { owner.store(0); }
+    // A thread that found the record just before its object was destroyed checks this after counting itself in, and backs out
+    // if the record has since been released or handed to another object.
+    bool IsOwnedBy(uint64_t object_id) const { return owner.load() == object_id; }
+
     void WaitForObjectIdle(bool is_writer)  {
         // Wait for thread-safe access to object instead of skipping call.
         while (GetCount().GetReadCount() > (int)(!is_writer) || GetCount().GetWriteCount() > (int)is_writer) {
@@ -254,12 +265,188 @@ private:
     // need to update write and read counts atomically. Writer in high
     // 32 bits, reader in low 32 bits.
     std::atomic<int64_t> writer_reader_count;
+    // The handle of the object the record belongs to, 0 while the record is free.
+    std::atomic<uint64_t> owner;
 
     // Put each lock on its own cache line to avoid false cache line sharing.
-    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>))) & 63];
+    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>) +
+                       sizeof(std::atomic<uint64_t>))) & 63];
 };
 
 
+// Table of the ObjectUseData of every object of one handle type. Lookups take no lock and do no atomic read-modify-write:
+// the table is open-addressed with linear probing and every slot is a pair of atomics, so a reader only loads the current
+// table pointer and probes. Inserts and erases, which only happen when objects are created and destroyed, are serialized
+// by a mutex.
+//
+// Records are allocated in blocks owned by the table and recycled through a free list, so a record found by a reader stays
+// valid even if its object is destroyed concurrently. A record is only reused once it is idle, and it carries the handle of
+// its object so that a reader holding a record that has moved on to another object can tell. An erased slot keeps its handle with a null record until it is reused,
+// or until no probe sequence needs to pass it any more. When too few empty slots remain the live entries are rehashed into
+// a table of twice the size. Readers may still be probing the old table, so it is kept until the table is destroyed; as
+// every rehash doubles the capacity, the retired tables never take more memory than the current one.
+template <typename T>
+class ObjectUseTable {
+public:
+    ObjectUseTable() {
+        tables_.emplace_back(new Table(kInitialCapacity));
+        table_.store(tables_.back().get(), std::memory_order_release);
+    }
+
+    void Insert(T object) {
+        const uint64_t id = CastToUint64(object);
+        if (id == kEmpty) return;
+        std::lock_guard<std::mutex> lock(write_lock_);
+        if (FindSlot(id)) return;
+        Table *table = table_.load(std::memory_order_relaxed);
+        // Keep at least half the slots empty so probe sequences stay short and always terminate.
+        if ((used_count_ + 1) * 2 > table->Capacity()) {
+            Rehash();
+            table = table_.load(std::memory_order_relaxed);
+        }
+        ObjectUseData *record = AllocateRecord(id);
+        for (size_t i = table->Home(id);; i = (i + 1) & table->mask) {
+            Slot &slot = table->slots[i];
+            const uint64_t slot_key = slot.key.load(std::memory_order_relaxed);
+            if (slot_key == kEmpty || !slot.record.load(std::memory_order_relaxed)) {
+                // Publish the record before the handle, readers match on the handle and then read the record.
+                slot.record.store(record, std::memory_order_relaxed);
+                slot.key.store(id, std::memory_order_release);
+                if (slot_key == kEmpty) ++used_count_;
+                ++live_count_;
+                return;
+            }
+        }
+    }
+
+    void Erase(T object) {
+        const uint64_t id = CastToUint64(object);
+        std::lock_guard<std::mutex> lock(write_lock_);
+        Slot *slot = FindSlot(id);
+        if (!slot) return;
+        ObjectUseData *record = slot->record.load(std::memory_order_relaxed);
+        slot->record.store(nullptr, std::memory_order_release);
+        record->Release();
+        free_records_.push_back(record);
+        --live_count_;
+
+        // Erased slots directly followed by an empty one are on no live entry's probe sequence, so they can be emptied.
+        Table *table = table_.load(std::memory_order_relaxed);
+        size_t i = static_cast<size_t>(slot - table->slots.get());
+        if (table->slots[(i + 1) & table->mask].key.load(std::memory_order_relaxed) != kEmpty) return;
+        while (table->slots[i].key.load(std::memory_order_relaxed) != kEmpty &&
+               !table->slots[i].record.load(std::memory_order_relaxed)) {
+            table->slots[i].key.store(kEmpty, std::memory_order_release);
+            --used_count_;
+            i = (i - 1) & table->mask;
+        }
+    }
+
+    ObjectUseData *Find(T object) const {
+        const uint64_t id = CastToUint64(object);
+        if (id == kEmpty) return nullptr;
+        const Table *table = table_.load(std::memory_order_acquire);
+        for (size_t i = table->Home(id);; i = (i + 1) & table->mask) {
+            const uint64_t slot_key = table->slots[i].key.load(std::memory_order_acquire);
+            if (slot_key == id) {
+                ObjectUseData *record = table->slots[i].record.load(std::memory_order_acquire);
+                if (record) return record;
+            } else if (slot_key == kEmpty) {
+                return nullptr;
+            }
+        }
+    }
+
+private:
+    static const uint64_t kEmpty = 0;
+    static const size_t kInitialCapacity = 64;
+    static const size_t kRecordsPerBlock = 64;
+    static const size_t kFreeRecordsChecked = 4;
+
+    struct Slot {
+        std::atomic<uint64_t> key;
+        std::atomic<ObjectUseData *> record;
+    };
+
+    struct Table {
+        explicit Table(size_t capacity) : mask(capacity - 1), slots(new Slot[capacity]) {
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].key.store(kEmpty, std::memory_order_relaxed);
+                slots[i].record.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        size_t Capacity() const { return mask + 1; }
+        size_t Home(uint64_t id) const { return static_cast<size_t>((id * 0x9E3779B97F4A7C15ULL) >> 32) & mask; }
+
+        const size_t mask;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    // Called with write_lock_ held
+    Slot *FindSlot(uint64_t id) const {
+        if (id == kEmpty) return nullptr;
+        Table *table = table_.load(std::memory_order_relaxed);
+        for (size_t i = table->Home(id);; i = (i + 1) & table->mask) {
+            const uint64_t slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == id && table->slots[i].record.load(std::memory_order_relaxed)) return &table->slots[i];
+            if (slot_key == kEmpty) return nullptr;
+        }
+    }
+
+    // Called with write_lock_ held. Free records still counted as in use, by a thread that is backing out or by a use that
+    // overlapped the destruction of their object, are skipped. Only the last few are looked at, so records that never
+    // become idle cost a new block now and then rather than a scan on every insert.
+    ObjectUseData *AllocateRecord(uint64_t id) {
+        ObjectUseData *record = nullptr;
+        const size_t last = free_records_.size() > kFreeRecordsChecked ? free_records_.size() - kFreeRecordsChecked : 0;
+        for (size_t i = free_records_.size(); i > last; --i) {
+            if (free_records_[i - 1]->IsIdle()) {
+                record = free_records_[i - 1];
+                free_records_.erase(free_records_.begin() + (i - 1));
+                break;
+            }
+        }
+        if (!record) {
+            record_blocks_.emplace_back(new ObjectUseData[kRecordsPerBlock]);
+            for (size_t i = kRecordsPerBlock; i > 1; --i) {
+                free_records_.push_back(&record_blocks_.back()[i - 1]);
+            }
+            record = &record_blocks_.back()[0];
+        }
+        record->Reset(id);
+        return record;
+    }
+
+    // Called with write_lock_ held
+    void Rehash() {
+        const Table *old_table = table_.load(std::memory_order_relaxed);
+        size_t capacity = old_table->Capacity() * 2;
+        while (capacity < (live_count_ + 1) * 4) capacity *= 2;
+
+        Table *new_table = new Table(capacity);
+        for (size_t i = 0; i < old_table->Capacity(); ++i) {
+            const uint64_t id = old_table->slots[i].key.load(std::memory_order_relaxed);
+            ObjectUseData *record = old_table->slots[i].record.load(std::memory_order_relaxed);
+            if (id == kEmpty || !record) continue;
+            size_t j = new_table->Home(id);
+            while (new_table->slots[j].key.load(std::memory_order_relaxed) != kEmpty) j = (j + 1) & new_table->mask;
+            new_table->slots[j].record.store(record, std::memory_order_relaxed);
+            new_table->slots[j].key.store(id, std::memory_order_relaxed);
+        }
+        used_count_ = live_count_;
+        tables_.emplace_back(new_table);
+        table_.store(new_table, std::memory_order_release);
+    }
+
+    std::mutex write_lock_;
+    std::atomic<Table *> table_;
+    std::vector<std::unique_ptr<Table>> tables_;  // The current table and every table it replaced
+    size_t used_count_ = 0;  // Slots not empty, including erased ones (current table)
+    size_t live_count_ = 0;
+    std::vector<std::unique_ptr<ObjectUseData[]>> record_blocks_;
+    std::vector<ObjectUseData *> free_records_;
+};
+
 template <typename T>
 class counter {
 public:
@@ -267,23 +454,23 @@ public:
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vl_concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    ObjectUseTable<T> object_table;
 
     void CreateObject(T object) {
-        object_table.insert(object, std::make_shared<ObjectUseData>());
+        object_table.Insert(object);
     }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            object_table.Erase(object);
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object) {
-        assert(object_table.contains(object));
-        auto iter = std::move(object_table.find(object));
-        if (iter != object_table.end()) {
-            return std::move(iter->second);
+    ObjectUseData *FindObject(T object) {
+        ObjectUseData *use_data = object_table.Find(object);
+        assert(use_data);
+        if (use_data) {
+            return use_data;
         } else {
             object_data->LogError(object, kVUID_Threading_Info,
                     "Couldn't find %s Object 0x%" PRIxLEAST64
@@ -305,10 +492,15 @@ public:
             return;
         }
         const ObjectUseData::WriteReadCount prevCount = use_data->AddWriter();
+        if (!use_data->IsOwnedBy(CastToUint64(object))) {
+            // The object was destroyed after the record was found
+            use_data->RemoveWriter();
+            return;
+        }
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
             // There is no current use of the object.  Record writer thread.
-            use_data->thread = tid;
+            use_data->thread.store(tid, std::memory_order_relaxed);
         } else {
             if (prevCount.GetReadCount() == 0) {
                 assert(prevCount.GetWriteCount() != 0);
@@ -379,10 +571,15 @@ public:
             return;
         }
         const ObjectUseData::WriteReadCount prevCount = use_data->AddReader();
+        if (!use_data->IsOwnedBy(CastToUint64(object))) {
+            // The object was destroyed after the record was found
+            use_data->RemoveReader();
+            return;
+        }
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
             // There is no current use of the object.
-            use_data->thread = tid;
+            use_data->thread.store(tid, std::memory_order_relaxed);
         } else if (prevCount.GetWriteCount() > 0 && use_data->thread != tid) {
             // There is a writer of the object.
             skip |= object_data->LogError(object, kVUID_Threading_MultipleThreads,
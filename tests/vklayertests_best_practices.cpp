@@ -628,6 +628,78 @@ TEST_F(VkBestPracticesLayerTest, ClearAttachmentsAfterLoad) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkBestPracticesLayerTest, SharedStateTrackingReadsCoreState) {
+    TEST_DESCRIPTION("With shared state tracking, best practices checks the object state recorded only by core validation.");
+
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray =
+        "VALIDATION_CHECK_ENABLE_SHARED_STATE_TRACKING,VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT";
+    enables_value.arrayString.count = sizeof(enables_value.arrayString.pCharArray);
+    VkLayerSettingValueEXT enables_setting = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &enables_setting};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &layer_settings));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkBufferCreateInfo buffer_ci = {};
+    buffer_ci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_ci.size = 1024;
+    buffer_ci.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+
+    // Retrieving the memory requirements is recorded in the buffer state by core validation only
+    vk_testing::Buffer queried_buffer;
+    queried_buffer.init_no_mem(*m_device, buffer_ci);
+    const auto alloc_info = vk_testing::DeviceMemory::get_resource_alloc_info(*m_device, queried_buffer.memory_requirements(), 0);
+    vk_testing::DeviceMemory queried_memory;
+    queried_memory.init(*m_device, alloc_info);
+    m_errorMonitor->ExpectSuccess(kWarningBit);
+    vk::BindBufferMemory(device(), queried_buffer.handle(), queried_memory.handle(), 0);
+    m_errorMonitor->VerifyNotFound();
+
+    vk_testing::Buffer unqueried_buffer;
+    unqueried_buffer.init_no_mem(*m_device, buffer_ci);
+    vk_testing::DeviceMemory unqueried_memory;
+    unqueried_memory.init(*m_device, alloc_info);
+    m_errorMonitor->SetDesiredFailureMsg(kWarningBit, "UNASSIGNED-BestPractices-vkBindBufferMemory-requirements-not-retrieved");
+    vk::BindBufferMemory(device(), unqueried_buffer.handle(), unqueried_memory.handle(), 0);
+    m_errorMonitor->VerifyFound();
+
+    // The active render pass and draw history of the command buffer are also recorded by core validation only
+    VkClearAttachment color_attachment = {VK_IMAGE_ASPECT_COLOR_BIT, 0, {}};
+    VkClearRect clear_rect = {{{0, 0}, {(uint32_t)m_width, (uint32_t)m_height}}, 0, 1};
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "UNASSIGNED-BestPractices-DrawState-ClearCmdBeforeDraw");
+    vk::CmdClearAttachments(m_commandBuffer->handle(), 1, &color_attachment, 1, &clear_rect);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->EndRenderPass();
+
+    // Had each tracker recorded vkCmdNextSubpass into the shared command buffer state, the subpass index would run past the
+    // last subpass and core validation would report vkCmdEndRenderPass as called before it
+    VkSubpassDescription subpasses[2] = {};
+    subpasses[0].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpasses[1].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkRenderPassCreateInfo rp_ci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, nullptr, 0, 0, nullptr, 2, subpasses, 0, nullptr};
+    VkRenderPass render_pass;
+    ASSERT_VK_SUCCESS(vk::CreateRenderPass(device(), &rp_ci, nullptr, &render_pass));
+    VkFramebufferCreateInfo fb_ci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, nullptr, 0, render_pass, 0, nullptr, 32, 32, 1};
+    VkFramebuffer framebuffer;
+    ASSERT_VK_SUCCESS(vk::CreateFramebuffer(device(), &fb_ci, nullptr, &framebuffer));
+
+    m_errorMonitor->ExpectSuccess();
+    VkRenderPassBeginInfo rp_begin = {
+        VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, nullptr, render_pass, framebuffer, {{0, 0}, {32, 32}}, 0, nullptr};
+    vk::CmdBeginRenderPass(m_commandBuffer->handle(), &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+    vk::CmdNextSubpass(m_commandBuffer->handle(), VK_SUBPASS_CONTENTS_INLINE);
+    vk::CmdEndRenderPass(m_commandBuffer->handle());
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroyFramebuffer(device(), framebuffer, nullptr);
+    vk::DestroyRenderPass(device(), render_pass, nullptr);
+}
+
 // Tests for Arm-specific best practices
 
 TEST_F(VkArmBestPracticesLayerTest, TooManySamples) {
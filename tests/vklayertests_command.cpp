@@ -985,6 +985,188 @@ TEST_F(VkLayerTest, InvalidVertexAttributeAlignment) {
     m_commandBuffer->end();
 }
 
+TEST_F(VkLayerTest, DrawTimeStateRevalidatedAfterChange) {
+    TEST_DESCRIPTION("Draws without intervening state changes skip revalidation, but a changed vertex binding is caught");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    const VkPipelineLayoutObj pipeline_layout(m_device);
+
+    const float vbo_data[8] = {};
+    VkConstantBufferObj vbo(m_device, static_cast<int>(sizeof(vbo_data)), reinterpret_cast<const void *>(vbo_data),
+                            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+
+    VkVertexInputBindingDescription input_binding = {0, 4 * sizeof(float), VK_VERTEX_INPUT_RATE_VERTEX};
+    VkVertexInputAttributeDescription input_attrib = {0, 0, VK_FORMAT_R32G32B32A32_SFLOAT, 0};
+
+    char const *vsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location = 0) in vec4 input0;"
+        "\n"
+        "void main(){\n"
+        "   gl_Position = input0;\n"
+        "}\n";
+
+    VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, bindStateFragShaderText, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    VkPipelineObj pipe(m_device);
+    pipe.AddDefaultColorAttachment();
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddVertexInputBindings(&input_binding, 1);
+    pipe.AddVertexInputAttribs(&input_attrib, 1);
+    pipe.SetViewport(m_viewports);
+    pipe.SetScissor(m_scissors);
+    pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass());
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+
+    VkDeviceSize offset = 0;
+    vk::CmdBindVertexBuffers(m_commandBuffer->handle(), 0, 1, &vbo.handle(), &offset);
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // Rebinding the vertex buffer after a clean draw must rerun the vertex input checks
+    offset = 1;
+    vk::CmdBindVertexBuffers(m_commandBuffer->handle(), 0, 1, &vbo.handle(), &offset);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Invalid attribAddress alignment for vertex attribute 0");
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    // The failed draw was not recorded, so the next draw still sees the bad binding
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Invalid attribAddress alignment for vertex attribute 0");
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    offset = 0;
+    vk::CmdBindVertexBuffers(m_commandBuffer->handle(), 0, 1, &vbo.handle(), &offset);
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
+TEST_F(VkLayerTest, DrawTimeErrorsRepeatWhenNotSkipped) {
+    TEST_DESCRIPTION("Draw time errors logged without skipping the draw are reported again by the next draw, for each state group");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // While nothing is monitored the callback returns VK_FALSE, so each failing draw below is logged and still recorded
+    const VkPipelineLayoutObj pipeline_layout(m_device);
+    VkShaderObj vs(m_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, bindStateFragShaderText, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    // Dynamic state: the viewport is dynamic but never set
+    VkPipelineObj dynamic_viewport_pipe(m_device);
+    dynamic_viewport_pipe.AddDefaultColorAttachment();
+    dynamic_viewport_pipe.AddShader(&vs);
+    dynamic_viewport_pipe.AddShader(&fs);
+    dynamic_viewport_pipe.SetViewport(m_viewports);
+    dynamic_viewport_pipe.SetScissor(m_scissors);
+    dynamic_viewport_pipe.MakeDynamic(VK_DYNAMIC_STATE_VIEWPORT);
+    dynamic_viewport_pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass());
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, dynamic_viewport_pipe.handle());
+    m_commandBuffer->Draw(3, 1, 0, 0);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit,
+                                         "Dynamic viewport(s) 0 are used by pipeline state object, but were not provided");
+    m_commandBuffer->Draw(3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, m_viewports.data());
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->Draw(3, 1, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+
+    // Subpass: a pipeline built for subpass 0 is still bound in subpass 1
+    VkSubpassDescription subpasses[2] = {};
+    subpasses[0].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpasses[1].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkRenderPassCreateInfo rp_ci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, nullptr, 0, 0, nullptr, 2, subpasses, 0, nullptr};
+    VkRenderPass render_pass;
+    ASSERT_VK_SUCCESS(vk::CreateRenderPass(device(), &rp_ci, nullptr, &render_pass));
+    const uint32_t width = static_cast<uint32_t>(m_width);
+    const uint32_t height = static_cast<uint32_t>(m_height);
+    VkFramebufferCreateInfo fb_ci = {
+        VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, nullptr, 0, render_pass, 0, nullptr, width, height, 1};
+    VkFramebuffer framebuffer;
+    ASSERT_VK_SUCCESS(vk::CreateFramebuffer(device(), &fb_ci, nullptr, &framebuffer));
+
+    char const *fsSource =
+        "#version 450\n"
+        "void main(){\n"
+        "}\n";
+    VkShaderObj no_output_fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj subpass_pipe(m_device);
+    subpass_pipe.AddShader(&vs);
+    subpass_pipe.AddShader(&no_output_fs);
+    subpass_pipe.SetViewport(m_viewports);
+    subpass_pipe.SetScissor(m_scissors);
+    subpass_pipe.CreateVKPipeline(pipeline_layout.handle(), render_pass);
+
+    VkCommandBufferObj subpass_command_buffer(m_device, m_commandPool);
+    subpass_command_buffer.begin();
+    VkRenderPassBeginInfo rp_begin = {
+        VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, nullptr, render_pass, framebuffer, {{0, 0}, {width, height}}, 0, nullptr};
+    vk::CmdBeginRenderPass(subpass_command_buffer.handle(), &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+    vk::CmdBindPipeline(subpass_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, subpass_pipe.handle());
+    m_errorMonitor->ExpectSuccess();
+    subpass_command_buffer.Draw(3, 1, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    vk::CmdNextSubpass(subpass_command_buffer.handle(), VK_SUBPASS_CONTENTS_INLINE);
+    subpass_command_buffer.Draw(3, 1, 0, 0);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Pipeline was built for subpass 0 but used in subpass 1");
+    subpass_command_buffer.Draw(3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+    vk::CmdEndRenderPass(subpass_command_buffer.handle());
+    subpass_command_buffer.end();
+
+    // Descriptor sets: the bound set was never written
+    char const *csSource =
+        "#version 450\n"
+        "layout(set=0, binding=0) buffer ssbo { vec4 v; };\n"
+        "void main(){\n"
+        "   v = vec4(1.0);\n"
+        "}\n";
+    CreateComputePipelineHelper compute_pipe(*this);
+    compute_pipe.InitInfo();
+    compute_pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    compute_pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    compute_pipe.InitState();
+    compute_pipe.CreateComputePipeline();
+
+    VkCommandBufferObj compute_command_buffer(m_device, m_commandPool);
+    compute_command_buffer.begin();
+    vk::CmdBindPipeline(compute_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, compute_pipe.pipeline_);
+    vk::CmdBindDescriptorSets(compute_command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE,
+                              compute_pipe.pipeline_layout_.handle(), 0, 1, &compute_pipe.descriptor_set_->set_, 0, nullptr);
+    vk::CmdDispatch(compute_command_buffer.handle(), 1, 1, 1);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "binding #0 index 0 is being used in draw but has never been updated");
+    vk::CmdDispatch(compute_command_buffer.handle(), 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+    compute_command_buffer.end();
+
+    vk::DestroyFramebuffer(device(), framebuffer, nullptr);
+    vk::DestroyRenderPass(device(), render_pass, nullptr);
+}
+
 TEST_F(VkLayerTest, NonSimultaneousSecondaryMarksPrimary) {
     ASSERT_NO_FATAL_FAILURE(Init());
     const char *simultaneous_use_message = "UNASSIGNED-CoreValidation-DrawState-InvalidCommandBufferSimultaneousUse";
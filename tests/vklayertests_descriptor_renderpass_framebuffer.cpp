@@ -5068,6 +5068,54 @@ TEST_F(VkLayerTest, DSUsageBitsErrors) {
     }
 }
 
+TEST_F(VkLayerTest, ParallelDescriptorUpdateBatchErrors) {
+    TEST_DESCRIPTION("Report errors from a large vkUpdateDescriptorSets batch validated on the descriptor update worker pool.");
+
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = "VALIDATION_CHECK_ENABLE_PARALLEL_DESCRIPTOR_UPDATES";
+    enables_value.arrayString.count = sizeof(enables_value.arrayString.pCharArray);
+    VkLayerSettingValueEXT enables_setting = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &enables_setting};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &layer_settings));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Large enough to be split across the worker pool
+    constexpr uint32_t descriptor_count = 1024;
+    OneOffDescriptorSet ds(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptor_count, VK_SHADER_STAGE_ALL, nullptr}});
+    ASSERT_TRUE(ds.Initialized());
+
+    VkBufferObj uniform_buffer;
+    uniform_buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkBufferObj storage_buffer;
+    storage_buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos(descriptor_count, {uniform_buffer.handle(), 0, VK_WHOLE_SIZE});
+    std::vector<VkWriteDescriptorSet> writes(descriptor_count);
+    for (uint32_t i = 0; i < descriptor_count; ++i) {
+        writes[i] = {};
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = ds.set_;
+        writes[i].dstBinding = 0;
+        writes[i].dstArrayElement = i;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[i].pBufferInfo = &buffer_infos[i];
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    vk::UpdateDescriptorSets(m_device->device(), descriptor_count, writes.data(), 0, nullptr);
+    m_errorMonitor->VerifyNotFound();
+
+    // Bad writes in different chunks of the batch are each reported
+    buffer_infos[3].buffer = storage_buffer.handle();
+    buffer_infos[descriptor_count - 1].buffer = storage_buffer.handle();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkWriteDescriptorSet-descriptorType-00330");
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkWriteDescriptorSet-descriptorType-00330");
+    vk::UpdateDescriptorSets(m_device->device(), descriptor_count, writes.data(), 0, nullptr);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, DSBufferInfoErrors) {
     TEST_DESCRIPTION(
         "Attempt to update buffer descriptor set that has incorrect parameters in VkDescriptorBufferInfo struct. This includes:\n"
@@ -5764,6 +5812,129 @@ TEST_F(VkLayerTest, CopyDescriptorUpdateErrors) {
     vk::DestroySampler(m_device->device(), immutable_sampler, NULL);
 }
 
+TEST_F(VkLayerTest, CopyDescriptorUpdateRoundTrip) {
+    TEST_DESCRIPTION("Write every descriptor class, copy it to another set and dispatch with it, checking the copied contents.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT,
+               VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    VkImageView view = image.targetView(VK_FORMAT_R8G8B8A8_UNORM);
+
+    VkImageViewCreateInfo array_view_ci = {};
+    array_view_ci.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    array_view_ci.image = image.handle();
+    array_view_ci.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    array_view_ci.format = VK_FORMAT_R8G8B8A8_UNORM;
+    array_view_ci.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    vk_testing::ImageView array_view;
+    array_view.init(*m_device, array_view_ci);
+
+    vk_testing::Sampler sampler;
+    sampler.init(*m_device, SafeSaneSamplerCreateInfo());
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 1024, 0,
+                VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT |
+                    VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    vk_testing::BufferView buffer_view;
+    buffer_view.init(*m_device, vk_testing::BufferView::createInfo(buffer.handle(), VK_FORMAT_R32_SFLOAT));
+    VkBufferView texel_view = buffer_view.handle();
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(set=0, binding=0) uniform sampler s;\n"
+        "layout(set=0, binding=1) uniform sampler2D cis;\n"
+        "layout(set=0, binding=2) uniform texture2D t;\n"
+        "layout(set=0, binding=3, rgba8) uniform readonly image2D si;\n"
+        "layout(set=0, binding=4) uniform samplerBuffer utb;\n"
+        "layout(set=0, binding=5, r32f) uniform readonly imageBuffer stb;\n"
+        "layout(set=0, binding=6) uniform ubo { vec4 u; };\n"
+        "layout(set=0, binding=7) buffer ssbo { vec4 v; };\n"
+        "void main() {\n"
+        "    v = texture(sampler2D(t, s), vec2(0)) + texture(cis, vec2(0)) + imageLoad(si, ivec2(0)) + texelFetch(utb, 0) +\n"
+        "        imageLoad(stb, 0) + u;\n"
+        "}\n";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {
+        {0, VK_DESCRIPTOR_TYPE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {2, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {3, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {4, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {5, VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {6, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {7, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+    };
+    pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    pipe.InitState();
+    pipe.CreateComputePipeline();
+
+    OneOffDescriptorSet &src_set = *pipe.descriptor_set_;
+    src_set.WriteDescriptorImageInfo(0, VK_NULL_HANDLE, sampler.handle(), VK_DESCRIPTOR_TYPE_SAMPLER);
+    src_set.WriteDescriptorImageInfo(1, view, sampler.handle(), VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+    src_set.WriteDescriptorImageInfo(2, view, VK_NULL_HANDLE, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE);
+    src_set.WriteDescriptorImageInfo(3, view, VK_NULL_HANDLE, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_IMAGE_LAYOUT_GENERAL);
+    src_set.WriteDescriptorBufferView(4, texel_view, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER);
+    src_set.WriteDescriptorBufferView(5, texel_view, VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER);
+    src_set.WriteDescriptorBufferInfo(6, buffer.handle(), 16, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    src_set.WriteDescriptorBufferInfo(7, buffer.handle(), 16, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    src_set.UpdateDescriptorSets();
+
+    // One copy per binding, so every descriptor class goes through CopyUpdate
+    OneOffDescriptorSet dst_set(m_device, pipe.dsl_bindings_);
+    std::vector<VkCopyDescriptorSet> copies(pipe.dsl_bindings_.size());
+    for (uint32_t binding = 0; binding < copies.size(); ++binding) {
+        copies[binding] = {};
+        copies[binding].sType = VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET;
+        copies[binding].srcSet = src_set.set_;
+        copies[binding].srcBinding = binding;
+        copies[binding].dstSet = dst_set.set_;
+        copies[binding].dstBinding = binding;
+        copies[binding].descriptorCount = 1;
+    }
+    m_errorMonitor->ExpectSuccess();
+    vk::UpdateDescriptorSets(m_device->device(), 0, nullptr, static_cast<uint32_t>(copies.size()), copies.data());
+    m_errorMonitor->VerifyNotFound();
+
+    auto dispatch_with_dst_set = [&]() {
+        VkCommandBufferObj command_buffer(m_device, m_commandPool);
+        command_buffer.begin();
+        vk::CmdBindPipeline(command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+        vk::CmdBindDescriptorSets(command_buffer.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                                  &dst_set.set_, 0, nullptr);
+        vk::CmdDispatch(command_buffer.handle(), 1, 1, 1);
+        command_buffer.end();
+    };
+
+    m_errorMonitor->ExpectSuccess();
+    dispatch_with_dst_set();
+    m_errorMonitor->VerifyNotFound();
+
+    // A copied view must be the one written to the source, not just marked as updated
+    OneOffDescriptorSet array_set(m_device, pipe.dsl_bindings_);
+    array_set.WriteDescriptorImageInfo(2, array_view.handle(), VK_NULL_HANDLE, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE);
+    array_set.UpdateDescriptorSets();
+    copies[2].srcSet = array_set.set_;
+    vk::UpdateDescriptorSets(m_device->device(), 0, nullptr, 1, &copies[2]);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "requires an image view of type VK_IMAGE_VIEW_TYPE_2D but got");
+    dispatch_with_dst_set();
+    m_errorMonitor->VerifyFound();
+
+    // Restore binding 2, then copy a never updated storage buffer over binding 7, which resets it to not updated
+    copies[2].srcSet = src_set.set_;
+    copies[7].srcSet = array_set.set_;
+    VkCopyDescriptorSet reset_copies[] = {copies[2], copies[7]};
+    vk::UpdateDescriptorSets(m_device->device(), 0, nullptr, 2, reset_copies);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "binding #7 index 0 is being used in draw but has never been updated");
+    dispatch_with_dst_set();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, DrawWithPipelineIncompatibleWithRenderPass) {
     TEST_DESCRIPTION(
         "Hit RenderPass incompatible cases. Initial case is drawing with an active renderpass that's not compatible with the bound "
@@ -7243,6 +7414,106 @@ TEST_F(VkLayerTest, DescriptorIndexingUpdateAfterBind) {
     vk::DestroyPipelineLayout(m_device->handle(), pipeline_layout, NULL);
 }
 
+TEST_F(VkLayerTest, DescriptorIndexingUpdateAfterBindInvalidAfterCleanSubmit) {
+    TEST_DESCRIPTION("Write an invalid descriptor into an update after bind binding after a clean dispatch, and resubmit.");
+
+    if (InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+        m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    } else {
+        printf("%s %s Extension not supported, skipping tests\n", kSkipPrefix,
+               VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+        return;
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) &&
+        DeviceExtensionSupported(gpu(), nullptr, VK_KHR_MAINTENANCE3_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+        m_device_extension_names.push_back(VK_KHR_MAINTENANCE3_EXTENSION_NAME);
+    } else {
+        printf("%s Descriptor Indexing or Maintenance3 Extension not supported, skipping tests\n", kSkipPrefix);
+        return;
+    }
+
+    PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR =
+        (PFN_vkGetPhysicalDeviceFeatures2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceFeatures2KHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceFeatures2KHR != nullptr);
+
+    auto indexing_features = lvl_init_struct<VkPhysicalDeviceDescriptorIndexingFeaturesEXT>();
+    auto features2 = lvl_init_struct<VkPhysicalDeviceFeatures2KHR>(&indexing_features);
+    vkGetPhysicalDeviceFeatures2KHR(gpu(), &features2);
+
+    if (VK_FALSE == indexing_features.descriptorBindingStorageBufferUpdateAfterBind) {
+        printf("%s Test requires (unsupported) descriptorBindingStorageBufferUpdateAfterBind, skipping\n", kSkipPrefix);
+        return;
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2));
+
+    VkDescriptorBindingFlagsEXT flags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+    auto flags_create_info = lvl_init_struct<VkDescriptorSetLayoutBindingFlagsCreateInfoEXT>();
+    flags_create_info.bindingCount = 1;
+    flags_create_info.pBindingFlags = &flags;
+
+    OneOffDescriptorSet uab_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}},
+                                VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT, &flags_create_info,
+                                VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT);
+    ASSERT_TRUE(uab_set.Initialized());
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(set=0, binding=0) buffer ssbo { uint x; };\n"
+        "void main() {\n"
+        "    x = 1;\n"
+        "}\n";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    pipe.InitState();
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&uab_set.layout_});
+    pipe.CreateComputePipeline();
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    uab_set.WriteDescriptorBufferInfo(0, buffer.handle(), 256, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    uab_set.UpdateDescriptorSets();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &uab_set.set_, 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    // Clean submit, which leaves the submit time validation of the binding cached as clean
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    // Update after bind writes don't invalidate the command buffer, so the bad write must be caught when it is resubmitted
+    {
+        VkBufferObj doomed_buffer;
+        doomed_buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        uab_set.descriptor_writes.clear();
+        uab_set.WriteDescriptorBufferInfo(0, doomed_buffer.handle(), 256, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        uab_set.UpdateDescriptorSets();
+    }
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "that is invalid or has been destroyed");
+    m_commandBuffer->QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+
+    // Putting a valid buffer back makes the command buffer submittable again
+    uab_set.descriptor_writes.clear();
+    uab_set.WriteDescriptorBufferInfo(0, buffer.handle(), 256, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    uab_set.UpdateDescriptorSets();
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(VkLayerTest, AllocatePushDescriptorSet) {
     TEST_DESCRIPTION("Attempt to allocate a push descriptor set.");
     if (InstanceExtensionSupported(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
@@ -16,6 +16,15 @@
 
 #include "layer_validation_tests.h"
 
+#include <fstream>
+#ifdef _WIN32
+#include <direct.h>
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
 bool VkGpuAssistedLayerTest::InitGpuAssistedFramework(bool request_descriptor_indexing) {
     VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
     VkValidationFeatureDisableEXT disables[] = {
@@ -1581,6 +1590,513 @@ TEST_F(VkGpuAssistedLayerTest, GpuValidationAbort) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkGpuAssistedLayerTest, GpuValidationDeferredReadback) {
+    TEST_DESCRIPTION("GPU validation: Verify that deferred readback reports the same errors once the submission completes.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = "VALIDATION_CHECK_ENABLE_GPU_DEFERRED_READBACK";
+    enables_value.arrayString.count = sizeof(enables_value.arrayString.pCharArray);
+    VkLayerSettingValueEXT enables_setting = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &enables_setting};
+    VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
+    VkValidationFeatureDisableEXT disables[] = {
+        VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+        VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
+    VkValidationFeaturesEXT features = {};
+    features.sType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
+    features.pNext = &layer_settings;
+    features.enabledValidationFeatureCount = 1;
+    features.disabledValidationFeatureCount = 4;
+    features.pEnabledValidationFeatures = enables;
+    features.pDisabledValidationFeatures = disables;
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &features));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        printf("%s GPU-Assisted validation test requires Vulkan 1.1+.\n", kSkipPrefix);
+        return;
+    }
+    if (!m_device->phy().features().shaderSampledImageArrayDynamicIndexing) {
+        printf("%s shaderSampledImageArrayDynamicIndexing not supported, skipping test.\n", kSkipPrefix);
+        return;
+    }
+    // The mock ICD never executes the shader, so nothing is reported there; it still exercises the deferred fences.
+    const bool executes_shaders = !(IsPlatform(kMockICD) || DeviceSimulation());
+
+    VkBufferObj uniform_buffer;
+    uniform_buffer.init(*m_device, 1024, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkBufferObj storage_buffer;
+    storage_buffer.init(*m_device, 1024, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    VkTextureObj texture(m_device, nullptr);
+    VkSamplerObj sampler(m_device);
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(local_size_x = 1) in;\n"
+        "layout(set = 0, binding = 0) uniform ufoo { uint index; } u_index;\n"
+        "layout(set = 0, binding = 1) uniform sampler2D tex[6];\n"
+        "layout(set = 0, binding = 2) buffer StorageBuffer { vec4 color; } result;\n"
+        "void main() {\n"
+        "   result.color = textureLod(tex[u_index.index], vec2(0, 0), 0);\n"
+        "}\n";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                          {1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 6, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                          {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    pipe.InitState();
+    ASSERT_VK_SUCCESS(pipe.CreateComputePipeline());
+
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(0, uniform_buffer.handle(), sizeof(uint32_t));
+    pipe.descriptor_set_->WriteDescriptorImageInfo(1, texture.DescriptorImageInfo().imageView, sampler.handle(),
+                                                   VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 6);
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(2, storage_buffer.handle(), 4 * sizeof(float),
+                                                    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    pipe.descriptor_set_->UpdateDescriptorSets();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    uint32_t *data = (uint32_t *)uniform_buffer.memory().map();
+    data[0] = 25;
+    uniform_buffer.memory().unmap();
+
+    const char *expected_error = "Index of 25 used to index descriptor array of length 6.";
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+
+    // Nothing is read back by the submission itself.
+    m_errorMonitor->ExpectSuccess();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyNotFound();
+
+    // Waiting for the queue retires the readback and reports what the synchronous path would have.
+    if (executes_shaders) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, expected_error);
+    } else {
+        m_errorMonitor->ExpectSuccess();
+    }
+    vk::QueueWaitIdle(m_device->m_queue);
+    if (executes_shaders) {
+        m_errorMonitor->VerifyFound();
+    } else {
+        m_errorMonitor->VerifyNotFound();
+    }
+
+    // Resubmitting the command buffer reads back its previous submission first, so every submission is reported once.
+    VkFenceObj fence;
+    fence.init(*m_device, VkFenceObj::create_info());
+    const uint32_t submit_count = 20;
+    if (executes_shaders) {
+        for (uint32_t i = 0; i < submit_count; i++) {
+            m_errorMonitor->SetDesiredFailureMsg(kErrorBit, expected_error);
+        }
+    } else {
+        m_errorMonitor->ExpectSuccess();
+    }
+    for (uint32_t i = 0; i < submit_count; i++) {
+        vk::QueueSubmit(m_device->m_queue, 1, &submit_info, fence.handle());
+        vk::WaitForFences(m_device->device(), 1, &fence.handle(), VK_TRUE, UINT64_MAX);
+        vk::ResetFences(m_device->device(), 1, &fence.handle());
+    }
+    vk::DeviceWaitIdle(m_device->device());
+    if (executes_shaders) {
+        m_errorMonitor->VerifyFound();
+    } else {
+        m_errorMonitor->VerifyNotFound();
+    }
+}
+
+TEST_F(VkGpuAssistedLayerTest, GpuValidationDeferredReadbackBufferDeviceAddressOOB) {
+    TEST_DESCRIPTION("GPU validation: Verify that deferred readback reports an out of bounds write once the submission completes.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    m_instance_extension_names.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = "VALIDATION_CHECK_ENABLE_GPU_DEFERRED_READBACK";
+    enables_value.arrayString.count = sizeof(enables_value.arrayString.pCharArray);
+    VkLayerSettingValueEXT enables_setting = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &enables_setting};
+    VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
+    VkValidationFeatureDisableEXT disables[] = {
+        VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+        VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
+    VkValidationFeaturesEXT features = {};
+    features.sType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
+    features.pNext = &layer_settings;
+    features.enabledValidationFeatureCount = 1;
+    features.disabledValidationFeatureCount = 4;
+    features.pEnabledValidationFeatures = enables;
+    features.pDisabledValidationFeatures = disables;
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &features));
+    if (IsPlatform(kMockICD) || DeviceSimulation()) {
+        printf("%s GPU-Assisted validation test requires a driver that can draw.\n", kSkipPrefix);
+        return;
+    }
+    if (!InstanceExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) ||
+        !DeviceExtensionSupported(gpu(), nullptr, VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)) {
+        printf("%s Buffer Device Address extension not supported, skipping test\n", kSkipPrefix);
+        return;
+    }
+    m_device_extension_names.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+
+    auto bda_features = lvl_init_struct<VkPhysicalDeviceBufferDeviceAddressFeaturesKHR>();
+    auto features2 = lvl_init_struct<VkPhysicalDeviceFeatures2KHR>(&bda_features);
+    PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR =
+        (PFN_vkGetPhysicalDeviceFeatures2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceFeatures2KHR");
+    ASSERT_TRUE(vkGetPhysicalDeviceFeatures2KHR != nullptr);
+    vkGetPhysicalDeviceFeatures2KHR(gpu(), &features2);
+    if (!bda_features.bufferDeviceAddress) {
+        printf("%s Buffer Device Address feature not supported, skipping test\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2));
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        printf("%s GPU-Assisted validation test requires Vulkan 1.1+.\n", kSkipPrefix);
+        return;
+    }
+
+    // A uniform buffer holding the pointer and the write count, and the 16 byte buffer the shader writes through the pointer
+    VkBufferObj uniform_buffer;
+    uniform_buffer.init(*m_device, 16, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkBufferCreateInfo bci = {};
+    bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bci.usage = VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR;
+    bci.size = 4 * sizeof(uint32_t);
+    VkBuffer target_buffer;
+    ASSERT_VK_SUCCESS(vk::CreateBuffer(device(), &bci, NULL, &target_buffer));
+    VkMemoryRequirements mem_reqs = {};
+    vk::GetBufferMemoryRequirements(device(), target_buffer, &mem_reqs);
+    VkMemoryAllocateFlagsInfo alloc_flags = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO};
+    alloc_flags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT_KHR;
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.pNext = &alloc_flags;
+    alloc_info.allocationSize = mem_reqs.size;
+    m_device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, 0);
+    VkDeviceMemory target_memory;
+    ASSERT_VK_SUCCESS(vk::AllocateMemory(device(), &alloc_info, NULL, &target_memory));
+    vk::BindBufferMemory(device(), target_buffer, target_memory, 0);
+
+    VkBufferDeviceAddressInfoKHR bda_info = {};
+    bda_info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    bda_info.buffer = target_buffer;
+    auto vkGetBufferDeviceAddressKHR =
+        (PFN_vkGetBufferDeviceAddressKHR)vk::GetDeviceProcAddr(device(), "vkGetBufferDeviceAddressKHR");
+    ASSERT_TRUE(vkGetBufferDeviceAddressKHR != nullptr);
+    const VkDeviceAddress target_address = vkGetBufferDeviceAddressKHR(device(), &bda_info);
+
+    char const *csSource =
+        "#version 450\n"
+        "#extension GL_EXT_buffer_reference : enable\n"
+        "layout(local_size_x = 1) in;\n"
+        "layout(buffer_reference, buffer_reference_align = 16) buffer bufStruct;\n"
+        "layout(set = 0, binding = 0) uniform ufoo {\n"
+        "    bufStruct data;\n"
+        "    int nWrites;\n"
+        "} u_info;\n"
+        "layout(buffer_reference, std430) buffer bufStruct {\n"
+        "    int a[4];\n"
+        "};\n"
+        "void main() {\n"
+        "    for (int i = 0; i < u_info.nWrites; ++i) {\n"
+        "        u_info.data.a[i] = 0xdeadca71;\n"
+        "    }\n"
+        "}\n";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this, "main", true));
+    pipe.InitState();
+    ASSERT_VK_SUCCESS(pipe.CreateComputePipeline());
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(0, uniform_buffer.handle(), 16);
+    pipe.descriptor_set_->UpdateDescriptorSets();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    auto set_write_count = [&](uint32_t count) {
+        VkDeviceAddress *data = (VkDeviceAddress *)uniform_buffer.memory().map();
+        data[0] = target_address;
+        data[1] = count;
+        uniform_buffer.memory().unmap();
+    };
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    VkFenceObj fence;
+    fence.init(*m_device, VkFenceObj::create_info());
+
+    // Write one element past the end. The error is the one GpuBufferDeviceAddressOOB gets from the synchronous path, but it
+    // is only reported once the fence wait retires the readback.
+    set_write_count(5);
+    m_errorMonitor->ExpectSuccess();
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, fence.handle()));
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "access out of bounds");
+    ASSERT_VK_SUCCESS(vk::WaitForFences(device(), 1, &fence.handle(), VK_TRUE, UINT64_MAX));
+    m_errorMonitor->VerifyFound();
+    vk::ResetFences(device(), 1, &fence.handle());
+
+    // Same through a queue wait
+    m_errorMonitor->ExpectSuccess();
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE));
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "access out of bounds");
+    ASSERT_VK_SUCCESS(vk::QueueWaitIdle(m_device->m_queue));
+    m_errorMonitor->VerifyFound();
+
+    // Staying inside the buffer reports nothing at either point
+    set_write_count(4);
+    m_errorMonitor->ExpectSuccess();
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, fence.handle()));
+    ASSERT_VK_SUCCESS(vk::WaitForFences(device(), 1, &fence.handle(), VK_TRUE, UINT64_MAX));
+    ASSERT_VK_SUCCESS(vk::QueueWaitIdle(m_device->m_queue));
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroyBuffer(device(), target_buffer, NULL);
+    vk::FreeMemory(device(), target_memory, NULL);
+}
+
+// Sets the environment variable read by the layer when a device is created, or clears it if value is null
+static void SetInstrumentationCacheEnvironment(const char *value) {
+#ifdef _WIN32
+    _putenv_s("VK_LAYER_SHADER_INSTRUMENTATION_CACHE", value ? value : "");
+#else
+    if (value) {
+        setenv("VK_LAYER_SHADER_INSTRUMENTATION_CACHE", value, 1);
+    } else {
+        unsetenv("VK_LAYER_SHADER_INSTRUMENTATION_CACHE");
+    }
+#endif
+}
+
+// Returns the paths of the cache entries in directory, sorted
+static std::vector<std::string> ListInstrumentationCacheEntries(const std::string &directory) {
+    std::vector<std::string> entries;
+#ifdef _WIN32
+    WIN32_FIND_DATAA find_data;
+    HANDLE find = FindFirstFileA((directory + "/*.spv").c_str(), &find_data);
+    if (find != INVALID_HANDLE_VALUE) {
+        do {
+            entries.push_back(directory + "/" + find_data.cFileName);
+        } while (FindNextFileA(find, &find_data));
+        FindClose(find);
+    }
+#else
+    DIR *dir = opendir(directory.c_str());
+    if (dir) {
+        while (const dirent *entry = readdir(dir)) {
+            const std::string name = entry->d_name;
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".spv") == 0) entries.push_back(directory + "/" + name);
+        }
+        closedir(dir);
+    }
+#endif
+    std::sort(entries.begin(), entries.end());
+    return entries;
+}
+
+static std::vector<char> ReadInstrumentationCacheEntry(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+TEST_F(VkGpuAssistedLayerTest, GpuValidationInstrumentationCache) {
+    TEST_DESCRIPTION("GPU validation: Verify that the instrumentation cache hits only for the same code and options.");
+
+    // Start from an empty cache directory
+    const std::string cache_directory = "gpuav_instrumentation_cache_test";
+#ifdef _WIN32
+    _mkdir(cache_directory.c_str());
+#else
+    mkdir(cache_directory.c_str(), 0755);
+#endif
+    for (const auto &entry : ListInstrumentationCacheEntries(cache_directory)) {
+        remove(entry.c_str());
+    }
+    SetInstrumentationCacheEnvironment(cache_directory.c_str());
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    bool descriptor_indexing = InitGpuAssistedFramework(true);
+    if (IsPlatform(kNexusPlayer)) {
+        printf("%s This test should not run on Nexus Player\n", kSkipPrefix);
+        SetInstrumentationCacheEnvironment(nullptr);
+        return;
+    }
+    PFN_vkSetPhysicalDeviceLimitsEXT fpvkSetPhysicalDeviceLimitsEXT =
+        (PFN_vkSetPhysicalDeviceLimitsEXT)vk::GetInstanceProcAddr(instance(), "vkSetPhysicalDeviceLimitsEXT");
+    PFN_vkGetOriginalPhysicalDeviceLimitsEXT fpvkGetOriginalPhysicalDeviceLimitsEXT =
+        (PFN_vkGetOriginalPhysicalDeviceLimitsEXT)vk::GetInstanceProcAddr(instance(), "vkGetOriginalPhysicalDeviceLimitsEXT");
+    if (!(fpvkSetPhysicalDeviceLimitsEXT) || !(fpvkGetOriginalPhysicalDeviceLimitsEXT)) {
+        printf("%s Can't find device_profile_api functions; skipped.\n", kSkipPrefix);
+        SetInstrumentationCacheEnvironment(nullptr);
+        return;
+    }
+    // GPU-AV binds its descriptor set to the last slot, so the slot follows maxBoundDescriptorSets
+    VkPhysicalDeviceLimits limits;
+    fpvkGetOriginalPhysicalDeviceLimitsEXT(gpu(), &limits);
+    if (limits.maxBoundDescriptorSets < 4) {
+        printf("%s maxBoundDescriptorSets too small; skipped.\n", kSkipPrefix);
+        SetInstrumentationCacheEnvironment(nullptr);
+        return;
+    }
+    limits.maxBoundDescriptorSets = 4;
+    fpvkSetPhysicalDeviceLimitsEXT(gpu(), &limits);
+
+    // Leave descriptor indexing disabled on the test's device, and only turn it on for the device that checks option changes
+    std::vector<const char *> descriptor_indexing_extensions = m_device_extension_names;
+    m_device_extension_names.clear();
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        printf("%s GPU-Assisted validation test requires Vulkan 1.1+.\n", kSkipPrefix);
+        SetInstrumentationCacheEnvironment(nullptr);
+        return;
+    }
+    if (!m_device->phy().features().shaderSampledImageArrayDynamicIndexing) {
+        printf("%s shaderSampledImageArrayDynamicIndexing not supported, skipping test.\n", kSkipPrefix);
+        SetInstrumentationCacheEnvironment(nullptr);
+        return;
+    }
+    const bool executes_shaders = !(IsPlatform(kMockICD) || DeviceSimulation());
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(local_size_x = 1) in;\n"
+        "layout(set = 0, binding = 0) uniform ufoo { uint index; } u_index;\n"
+        "layout(set = 0, binding = 1) uniform sampler2D tex[6];\n"
+        "layout(set = 0, binding = 2) buffer StorageBuffer { vec4 color; } result;\n"
+        "void main() {\n"
+        "   result.color = textureLod(tex[u_index.index], vec2(0, 0), 0);\n"
+        "}\n";
+    std::vector<const char *> no_extensions;
+
+    // A miss instruments the code and stores one entry
+    {
+        VkDeviceObj first_device(0, gpu(), no_extensions);
+        VkShaderObj cs(&first_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this);
+    }
+    auto entries = ListInstrumentationCacheEntries(cache_directory);
+    ASSERT_EQ(entries.size(), 1u);
+    const auto instrumented = ReadInstrumentationCacheEntry(entries[0]);
+    ASSERT_FALSE(instrumented.empty());
+
+    // The same code on another device with the same options hits, whether the entry comes from disk or from memory, and the
+    // entry is left as it was
+    {
+        VkShaderObj cs(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this);
+        VkShaderObj cs_again(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this);
+    }
+    entries = ListInstrumentationCacheEntries(cache_directory);
+    ASSERT_EQ(entries.size(), 1u);
+    ASSERT_TRUE(ReadInstrumentationCacheEntry(entries[0]) == instrumented);
+
+    // Instrumenting the same code from scratch gives the same entry as the one the hits were served from
+    remove(entries[0].c_str());
+    {
+        VkDeviceObj fresh_device(0, gpu(), no_extensions);
+        VkShaderObj cs(&fresh_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this);
+    }
+    entries = ListInstrumentationCacheEntries(cache_directory);
+    ASSERT_EQ(entries.size(), 1u);
+    ASSERT_TRUE(ReadInstrumentationCacheEntry(entries[0]) == instrumented);
+
+    // A pipeline using a module served from the cache reports errors against the right shader
+    VkBufferObj uniform_buffer;
+    uniform_buffer.init(*m_device, 1024, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    VkBufferObj storage_buffer;
+    storage_buffer.init(*m_device, 1024, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    VkTextureObj texture(m_device, nullptr);
+    VkSamplerObj sampler(m_device);
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                          {1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 6, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                          {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.cs_.reset(new VkShaderObj(m_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this));
+    pipe.InitState();
+    ASSERT_VK_SUCCESS(pipe.CreateComputePipeline());
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(0, uniform_buffer.handle(), sizeof(uint32_t));
+    pipe.descriptor_set_->WriteDescriptorImageInfo(1, texture.DescriptorImageInfo().imageView, sampler.handle(),
+                                                   VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 6);
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(2, storage_buffer.handle(), 4 * sizeof(float),
+                                                    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    pipe.descriptor_set_->UpdateDescriptorSets();
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+    uint32_t *data = (uint32_t *)uniform_buffer.memory().map();
+    data[0] = 25;
+    uniform_buffer.memory().unmap();
+    if (executes_shaders) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Index of 25 used to index descriptor array of length 6.");
+    } else {
+        m_errorMonitor->ExpectSuccess();
+    }
+    m_commandBuffer->QueueCommandBuffer();
+    if (executes_shaders) {
+        m_errorMonitor->VerifyFound();
+    } else {
+        m_errorMonitor->VerifyNotFound();
+    }
+    ASSERT_EQ(ListInstrumentationCacheEntries(cache_directory).size(), 1u);
+
+    // Moving GPU-AV's descriptor set to another binding slot misses
+    limits.maxBoundDescriptorSets = 3;
+    fpvkSetPhysicalDeviceLimitsEXT(gpu(), &limits);
+    {
+        VkDeviceObj slot_device(0, gpu(), no_extensions);
+        VkShaderObj cs(&slot_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this);
+    }
+    limits.maxBoundDescriptorSets = 4;
+    fpvkSetPhysicalDeviceLimitsEXT(gpu(), &limits);
+    ASSERT_EQ(ListInstrumentationCacheEntries(cache_directory).size(), 2u);
+
+    // Changing the instrumentation options misses too
+    if (descriptor_indexing) {
+        auto indexing_features = lvl_init_struct<VkPhysicalDeviceDescriptorIndexingFeaturesEXT>();
+        auto features2 = lvl_init_struct<VkPhysicalDeviceFeatures2KHR>(&indexing_features);
+        PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR =
+            (PFN_vkGetPhysicalDeviceFeatures2KHR)vk::GetInstanceProcAddr(instance(), "vkGetPhysicalDeviceFeatures2KHR");
+        ASSERT_TRUE(vkGetPhysicalDeviceFeatures2KHR != nullptr);
+        vkGetPhysicalDeviceFeatures2KHR(gpu(), &features2);
+        VkDeviceObj indexing_device(0, gpu(), descriptor_indexing_extensions, nullptr, &features2);
+        VkShaderObj cs(&indexing_device, csSource, VK_SHADER_STAGE_COMPUTE_BIT, this);
+        ASSERT_EQ(ListInstrumentationCacheEntries(cache_directory).size(), 3u);
+    } else {
+        printf("%s Descriptor indexing not supported, not checking an instrumentation option change.\n", kSkipPrefix);
+    }
+
+    SetInstrumentationCacheEnvironment(nullptr);
+    for (const auto &entry : ListInstrumentationCacheEntries(cache_directory)) {
+        remove(entry.c_str());
+    }
+}
+
 TEST_F(VkGpuAssistedLayerTest, ValidationFeatures) {
     TEST_DESCRIPTION("Validate Validation Features");
     SetTargetApiVersion(VK_API_VERSION_1_1);
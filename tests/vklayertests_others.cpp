@@ -27,6 +27,10 @@
 #include "cast_utils.h"
 #include "layer_validation_tests.h"
 
+// Used to rewrite the checksums of tampered validation cache data
+#define XXH_PRIVATE_API
+#include "xxhash.h"
+
 class MessageIdFilter {
   public:
     MessageIdFilter(const char *filter_string) {
@@ -1252,6 +1256,22 @@ TEST_F(VkLayerTest, UnrecognizedValueMaxEnum) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, UnrecognizedValueExtensionRange) {
+    TEST_DESCRIPTION("Check enum tokens in the range reserved for an extension against the tokens it actually defines.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkFormatProperties format_properties;
+    m_errorMonitor->ExpectSuccess();
+    vk::GetPhysicalDeviceFormatProperties(gpu(), VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG, &format_properties);
+    m_errorMonitor->VerifyNotFound();
+
+    // One past the last token of VK_IMG_format_pvrtc, in the same extension block
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "does not fall within the begin..end range");
+    vk::GetPhysicalDeviceFormatProperties(gpu(), static_cast<VkFormat>(VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG + 1),
+                                          &format_properties);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, SubmitSignaledFence) {
     vk_testing::Fence testFence;
 
@@ -2644,6 +2664,200 @@ TEST_F(VkLayerTest, ValidationCacheTestBadMerge) {
     fpDestroyValidationCache(m_device->device(), validationCache, nullptr);
 }
 
+TEST_F(VkLayerTest, ValidationCacheRestoresShaderAnalysis) {
+    TEST_DESCRIPTION("Create a shader module through a validation cache loaded from serialized data and check its analysis.");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceExtensionSupported(gpu(), kValidationLayerName, VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
+    } else {
+        printf("%s %s not supported, skipping test\n", kSkipPrefix, VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    auto fpCreateValidationCache =
+        (PFN_vkCreateValidationCacheEXT)vk::GetDeviceProcAddr(m_device->device(), "vkCreateValidationCacheEXT");
+    auto fpDestroyValidationCache =
+        (PFN_vkDestroyValidationCacheEXT)vk::GetDeviceProcAddr(m_device->device(), "vkDestroyValidationCacheEXT");
+    auto fpGetValidationCacheData =
+        (PFN_vkGetValidationCacheDataEXT)vk::GetDeviceProcAddr(m_device->device(), "vkGetValidationCacheDataEXT");
+    if (!fpCreateValidationCache || !fpDestroyValidationCache || !fpGetValidationCacheData) {
+        printf("%s Failed to load function pointers for %s\n", kSkipPrefix, VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
+        return;
+    }
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(local_size_x=1) in;\n"
+        "layout(set=0, binding=0) buffer block { vec4 x; };\n"
+        "void main() {\n"
+        "   x = vec4(1);\n"
+        "}\n";
+    std::vector<unsigned int> spv;
+    this->GLSLtoSPV(&m_device->props.limits, VK_SHADER_STAGE_COMPUTE_BIT, csSource, spv);
+
+    // The pipeline layout is missing the binding used by the shader, which is only reported if the descriptor uses of the entry
+    // point are known
+    const VkPipelineLayoutObj pipeline_layout(m_device);
+    auto create_pipeline_with_cache = [&](VkValidationCacheEXT validation_cache) {
+        VkShaderModuleValidationCacheCreateInfoEXT cache_ci = {};
+        cache_ci.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT;
+        cache_ci.validationCache = validation_cache;
+        VkShaderModuleCreateInfo module_ci = {};
+        module_ci.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        module_ci.pNext = &cache_ci;
+        module_ci.codeSize = spv.size() * sizeof(unsigned int);
+        module_ci.pCode = spv.data();
+        VkShaderModule shader_module = VK_NULL_HANDLE;
+        ASSERT_VK_SUCCESS(vk::CreateShaderModule(m_device->device(), &module_ci, nullptr, &shader_module));
+
+        VkComputePipelineCreateInfo pipeline_ci = {};
+        pipeline_ci.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipeline_ci.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipeline_ci.stage.module = shader_module;
+        pipeline_ci.stage.pName = "main";
+        pipeline_ci.layout = pipeline_layout.handle();
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkComputePipelineCreateInfo-layout-00703");
+        vk::CreateComputePipelines(m_device->device(), VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipeline);
+        m_errorMonitor->VerifyFound();
+        vk::DestroyShaderModule(m_device->device(), shader_module, nullptr);
+    };
+
+    VkValidationCacheCreateInfoEXT validation_cache_ci = {};
+    validation_cache_ci.sType = VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT;
+    VkValidationCacheEXT validation_cache = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(fpCreateValidationCache(m_device->device(), &validation_cache_ci, nullptr, &validation_cache));
+    create_pipeline_with_cache(validation_cache);
+
+    size_t data_size = 0;
+    ASSERT_VK_SUCCESS(fpGetValidationCacheData(m_device->device(), validation_cache, &data_size, nullptr));
+    std::vector<uint8_t> data(data_size);
+    ASSERT_VK_SUCCESS(fpGetValidationCacheData(m_device->device(), validation_cache, &data_size, data.data()));
+    fpDestroyValidationCache(m_device->device(), validation_cache, nullptr);
+
+    // Same code again, now parsed only from the serialized cache
+    validation_cache_ci.initialDataSize = data_size;
+    validation_cache_ci.pInitialData = data.data();
+    ASSERT_VK_SUCCESS(fpCreateValidationCache(m_device->device(), &validation_cache_ci, nullptr, &validation_cache));
+    create_pipeline_with_cache(validation_cache);
+    fpDestroyValidationCache(m_device->device(), validation_cache, nullptr);
+}
+
+TEST_F(VkLayerTest, ValidationCacheIgnoresInconsistentShaderAnalysis) {
+    TEST_DESCRIPTION("Load a validation cache whose shader analysis doesn't match the module and check it is recomputed.");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceExtensionSupported(gpu(), kValidationLayerName, VK_EXT_VALIDATION_CACHE_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
+    } else {
+        printf("%s %s not supported, skipping test\n", kSkipPrefix, VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    auto fpCreateValidationCache =
+        (PFN_vkCreateValidationCacheEXT)vk::GetDeviceProcAddr(m_device->device(), "vkCreateValidationCacheEXT");
+    auto fpDestroyValidationCache =
+        (PFN_vkDestroyValidationCacheEXT)vk::GetDeviceProcAddr(m_device->device(), "vkDestroyValidationCacheEXT");
+    auto fpGetValidationCacheData =
+        (PFN_vkGetValidationCacheDataEXT)vk::GetDeviceProcAddr(m_device->device(), "vkGetValidationCacheDataEXT");
+    if (!fpCreateValidationCache || !fpDestroyValidationCache || !fpGetValidationCacheData) {
+        printf("%s Failed to load function pointers for %s\n", kSkipPrefix, VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
+        return;
+    }
+
+    char const *csSource =
+        "#version 450\n"
+        "layout(local_size_x=1) in;\n"
+        "layout(set=0, binding=0) buffer block { vec4 x; };\n"
+        "void main() {\n"
+        "   x = vec4(1);\n"
+        "}\n";
+    std::vector<unsigned int> spv;
+    this->GLSLtoSPV(&m_device->props.limits, VK_SHADER_STAGE_COMPUTE_BIT, csSource, spv);
+
+    // The missing binding is only reported if the descriptor uses of the entry point are right
+    const VkPipelineLayoutObj pipeline_layout(m_device);
+    auto create_pipeline_with_cache = [&](VkValidationCacheEXT validation_cache) {
+        VkShaderModuleValidationCacheCreateInfoEXT cache_ci = {};
+        cache_ci.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT;
+        cache_ci.validationCache = validation_cache;
+        VkShaderModuleCreateInfo module_ci = {};
+        module_ci.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        module_ci.pNext = &cache_ci;
+        module_ci.codeSize = spv.size() * sizeof(unsigned int);
+        module_ci.pCode = spv.data();
+        VkShaderModule shader_module = VK_NULL_HANDLE;
+        ASSERT_VK_SUCCESS(vk::CreateShaderModule(m_device->device(), &module_ci, nullptr, &shader_module));
+
+        VkComputePipelineCreateInfo pipeline_ci = {};
+        pipeline_ci.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipeline_ci.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipeline_ci.stage.module = shader_module;
+        pipeline_ci.stage.pName = "main";
+        pipeline_ci.layout = pipeline_layout.handle();
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkComputePipelineCreateInfo-layout-00703");
+        vk::CreateComputePipelines(m_device->device(), VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipeline);
+        m_errorMonitor->VerifyFound();
+        vk::DestroyShaderModule(m_device->device(), shader_module, nullptr);
+    };
+
+    VkValidationCacheCreateInfoEXT validation_cache_ci = {};
+    validation_cache_ci.sType = VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT;
+    VkValidationCacheEXT validation_cache = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(fpCreateValidationCache(m_device->device(), &validation_cache_ci, nullptr, &validation_cache));
+    create_pipeline_with_cache(validation_cache);
+
+    size_t data_size = 0;
+    ASSERT_VK_SUCCESS(fpGetValidationCacheData(m_device->device(), validation_cache, &data_size, nullptr));
+    std::vector<uint32_t> data(data_size / sizeof(uint32_t));
+    ASSERT_VK_SUCCESS(fpGetValidationCacheData(m_device->device(), validation_cache, &data_size, data.data()));
+    fpDestroyValidationCache(m_device->device(), validation_cache, nullptr);
+
+    // Header, magic, version and entry count, then the one entry: hash, flags, payload size, checksum and the payload. The
+    // payload has one entrypoint: its OpEntryPoint offset, flags, the accessible ids, then the descriptor uses. The parse flags
+    // follow, then the def index as (id, offset) pairs, the decorations and last the entry points as (name, offset, stage).
+    const size_t entry = (2 * sizeof(uint32_t) + VK_UUID_SIZE) / sizeof(uint32_t) + 3;
+    ASSERT_GE(data.size(), entry + 7);
+    ASSERT_EQ(data[entry - 1], 1u);
+    const size_t payload = entry + 6;
+    const uint32_t payload_size = data[entry + 3];
+    ASSERT_EQ(data.size(), payload + payload_size);
+    ASSERT_EQ(data[payload], 1u);
+    const size_t entry_point_key = payload + 1;
+    const size_t first_id = payload + 4;
+    const size_t use_count = first_id + data[payload + 3];
+    ASSERT_LT(use_count, data.size());
+    ASSERT_EQ(data[use_count], 1u);
+    const size_t use_binding = use_count + 2;
+    const size_t use_var_id = use_count + 3;
+    const size_t parse_flags = use_count + 1 + 7;
+    ASSERT_LT(parse_flags + 3, data.size());
+    ASSERT_EQ(data[parse_flags], 0u);
+    ASSERT_GE(data[parse_flags + 1], 1u);
+    const size_t first_def_offset = parse_flags + 3;
+    const size_t entry_point_offset = data.size() - 2;
+
+    // Each tampered word still comes with a valid checksum, so only the checks against the parsed module can reject it
+    const uint32_t bad_value = 0xfffffff0;
+    for (size_t tampered : {entry_point_key, first_id, use_binding, use_var_id, first_def_offset, entry_point_offset}) {
+        std::vector<uint32_t> tampered_data = data;
+        tampered_data[tampered] = bad_value;
+        const uint64_t checksum = XXH64(&tampered_data[payload], payload_size * sizeof(uint32_t), 0);
+        tampered_data[entry + 4] = static_cast<uint32_t>(checksum);
+        tampered_data[entry + 5] = static_cast<uint32_t>(checksum >> 32);
+
+        validation_cache_ci.initialDataSize = data_size;
+        validation_cache_ci.pInitialData = tampered_data.data();
+        ASSERT_VK_SUCCESS(fpCreateValidationCache(m_device->device(), &validation_cache_ci, nullptr, &validation_cache));
+        create_pipeline_with_cache(validation_cache);
+        fpDestroyValidationCache(m_device->device(), validation_cache, nullptr);
+    }
+}
+
 TEST_F(VkLayerTest, InvalidQueueFamilyIndex) {
     // Miscellaneous queueFamilyIndex validation tests
     ASSERT_NO_FATAL_FAILURE(Init());
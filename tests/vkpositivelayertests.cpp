@@ -27,6 +27,7 @@
 #include "layer_validation_tests.h"
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <mutex>
@@ -2068,6 +2069,61 @@ TEST_F(VkPositiveLayerTest, DeleteDescriptorSetLayoutsBeforeDescriptorSets) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(VkPositiveLayerTest, PoolChildObjectsReleasedInBulk) {
+    TEST_DESCRIPTION("Free, reset and reallocate descriptor sets and command buffers to exercise pool child object tracking.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    m_errorMonitor->ExpectSuccess();
+
+    constexpr uint32_t child_count = 64;
+
+    VkDescriptorPoolSize ds_type_count = {};
+    ds_type_count.type = VK_DESCRIPTOR_TYPE_SAMPLER;
+    ds_type_count.descriptorCount = child_count;
+
+    VkDescriptorPoolCreateInfo ds_pool_ci = {};
+    ds_pool_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    ds_pool_ci.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    ds_pool_ci.maxSets = child_count;
+    ds_pool_ci.poolSizeCount = 1;
+    ds_pool_ci.pPoolSizes = &ds_type_count;
+
+    VkDescriptorPool ds_pool;
+    VkResult err = vk::CreateDescriptorPool(m_device->device(), &ds_pool_ci, NULL, &ds_pool);
+    ASSERT_VK_SUCCESS(err);
+
+    const VkDescriptorSetLayoutObj ds_layout(m_device, {{0, VK_DESCRIPTOR_TYPE_SAMPLER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    std::vector<VkDescriptorSetLayout> set_layouts(child_count, ds_layout.handle());
+
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorSetCount = child_count;
+    alloc_info.descriptorPool = ds_pool;
+    alloc_info.pSetLayouts = set_layouts.data();
+
+    // Free half of the sets explicitly, then reset the pool and allocate the full count again
+    std::vector<VkDescriptorSet> sets(child_count);
+    err = vk::AllocateDescriptorSets(m_device->device(), &alloc_info, sets.data());
+    ASSERT_VK_SUCCESS(err);
+    vk::FreeDescriptorSets(m_device->device(), ds_pool, child_count / 2, sets.data());
+    vk::ResetDescriptorPool(m_device->device(), ds_pool, 0);
+    err = vk::AllocateDescriptorSets(m_device->device(), &alloc_info, sets.data());
+    ASSERT_VK_SUCCESS(err);
+    vk::DestroyDescriptorPool(m_device->device(), ds_pool, NULL);
+
+    VkCommandPoolObj command_pool(m_device, m_device->graphics_queue_node_index_);
+    VkCommandBufferAllocateInfo cb_alloc_info = vk_testing::CommandBuffer::create_info(command_pool.handle());
+    cb_alloc_info.commandBufferCount = child_count;
+
+    // Free half of the command buffers and allocate more, the pool is destroyed with all of those still allocated
+    std::vector<VkCommandBuffer> command_buffers(child_count);
+    err = vk::AllocateCommandBuffers(m_device->device(), &cb_alloc_info, command_buffers.data());
+    ASSERT_VK_SUCCESS(err);
+    vk::FreeCommandBuffers(m_device->device(), command_pool.handle(), child_count / 2, command_buffers.data());
+    err = vk::AllocateCommandBuffers(m_device->device(), &cb_alloc_info, command_buffers.data());
+    ASSERT_VK_SUCCESS(err);
+    m_errorMonitor->VerifyNotFound();
+}
 TEST_F(VkPositiveLayerTest, CommandPoolDeleteWithReferences) {
     TEST_DESCRIPTION("Ensure the validation layers bookkeeping tracks the implicit command buffer frees.");
     ASSERT_NO_FATAL_FAILURE(Init());
@@ -2254,6 +2310,102 @@ TEST_F(VkPositiveLayerTest, SecondaryCommandBufferImageLayoutTransitions) {
     vk::FreeCommandBuffers(m_device->device(), m_commandPool->handle(), 1, &primary_command_buffer);
 }
 
+TEST_F(VkPositiveLayerTest, ImageLayoutTrackingAcrossDestroyedImage) {
+    TEST_DESCRIPTION("Track image layouts in a command buffer re-recorded after the image it referenced was destroyed.");
+    m_errorMonitor->ExpectSuccess();
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkImageMemoryBarrier img_barrier = {};
+    img_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    img_barrier.srcAccessMask = 0;
+    img_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    img_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    img_barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    img_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    img_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    img_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+    {
+        VkImageObj image(m_device);
+        image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+        ASSERT_TRUE(image.initialized());
+        img_barrier.image = image.handle();
+        m_commandBuffer->begin();
+        vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                               0, nullptr, 0, nullptr, 1, &img_barrier);
+        m_commandBuffer->end();
+    }
+
+    // The new image can take over the tracking slot of the destroyed one
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    img_barrier.image = image.handle();
+    m_commandBuffer->begin();
+    vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                           nullptr, 0, nullptr, 1, &img_barrier);
+    img_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    img_barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    img_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                           nullptr, 0, nullptr, 1, &img_barrier);
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkPositiveLayerTest, SharedStateTrackingBetweenValidationObjects) {
+    TEST_DESCRIPTION("Draw with object state recorded by core validation and read by best practices validation.");
+
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray =
+        "VALIDATION_CHECK_ENABLE_SHARED_STATE_TRACKING,VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT";
+    enables_value.arrayString.count = sizeof(enables_value.arrayString.pCharArray);
+    VkLayerSettingValueEXT enables_setting = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &enables_setting};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &layer_settings));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+    m_errorMonitor->ExpectSuccess();
+
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    VkBufferObj buffer;
+    buffer.init(*m_device, 256, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 256);
+    descriptor_set.UpdateDescriptorSets();
+
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0) layout(binding=0) uniform foo { int x; int y; } bar;\n"
+        "void main(){\n"
+        "   x = vec4(bar.y);\n"
+        "}\n";
+    VkShaderObj vs(m_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    m_commandBuffer->Draw(3, 1, 0, 0);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+}
+
 // This is a positive test. No failures are expected.
 TEST_F(VkPositiveLayerTest, IgnoreUnrelatedDescriptor) {
     TEST_DESCRIPTION(
@@ -9513,6 +9665,191 @@ TEST_F(VkPositiveLayerTest, QueueThreading) {
     vk::QueueWaitIdle(queue_h);
 }
 
+#if GTEST_IS_THREADSAFE
+TEST_F(VkPositiveLayerTest, ThreadFineGrainedLockingCommandBufferRecording) {
+    TEST_DESCRIPTION("Record command buffers from many threads with fine-grained command buffer locking enabled");
+
+    using std::thread;
+
+    VkLayerSettingValueDataEXT enables_value{};
+    enables_value.arrayString.pCharArray = "VALIDATION_CHECK_ENABLE_FINE_GRAINED_LOCKING";
+    enables_value.arrayString.count = sizeof(enables_value.arrayString.pCharArray);
+    VkLayerSettingValueEXT enables_setting = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, enables_value};
+    VkLayerSettingsEXT layer_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                      &enables_setting};
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &layer_settings));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    constexpr uint32_t thread_count = 16;
+    constexpr uint32_t commands_per_thread = 500;
+    const auto queue_family = DeviceObj()->GetDefaultQueue()->get_family_index();
+
+    // Every thread shares the event, so its cb_bindings are updated concurrently, and fills its own buffer
+    VkEventCreateInfo event_create_info = {VK_STRUCTURE_TYPE_EVENT_CREATE_INFO, nullptr, 0};
+    VkEvent event;
+    ASSERT_VK_SUCCESS(vk::CreateEvent(m_device->device(), &event_create_info, nullptr, &event));
+
+    std::vector<std::unique_ptr<VkBufferObj>> buffers;
+    std::vector<std::unique_ptr<VkCommandPoolObj>> pools;
+    std::vector<std::unique_ptr<VkCommandBufferObj>> cbs;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        buffers.emplace_back(new VkBufferObj());
+        buffers.back()->init_as_dst(*m_device, 256, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        pools.emplace_back(new VkCommandPoolObj(m_device, queue_family));
+        cbs.emplace_back(new VkCommandBufferObj(m_device, pools.back().get()));
+    }
+
+    const auto &record = [&](uint32_t index) {
+        VkCommandBufferObj *cb = cbs[index].get();
+        cb->begin();
+        for (uint32_t i = 0; i < commands_per_thread; ++i) {
+            vk::CmdSetEvent(cb->handle(), event, VK_PIPELINE_STAGE_TRANSFER_BIT);
+            cb->FillBuffer(buffers[index]->handle(), 0, 256, index);
+            cb->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 0,
+                                nullptr);
+        }
+        cb->end();
+    };
+
+    m_errorMonitor->ExpectSuccess();
+    std::vector<thread> threads;
+    for (uint32_t i = 0; i < thread_count; ++i) threads.emplace_back(record, i);
+    for (auto &t : threads) t.join();
+    m_errorMonitor->VerifyNotFound();
+
+    // Each command buffer must have been tracked as a complete, bound, submittable recording
+    m_errorMonitor->ExpectSuccess();
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        cbs[i]->QueueCommandBuffer();
+    }
+    m_errorMonitor->VerifyNotFound();
+
+    // The shared event was bound to every command buffer, destroying it must invalidate all of them
+    vk::DestroyEvent(m_device->device(), event, nullptr);
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidCommandBuffer-VkEvent");
+        VkSubmitInfo submit_info = {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &cbs[i]->handle();
+        vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+        m_errorMonitor->VerifyFound();
+    }
+}
+#endif  // GTEST_IS_THREADSAFE
+
+TEST_F(VkPositiveLayerTest, ThreadHandleUnwrapWhileWrapping) {
+    TEST_DESCRIPTION("Unwrap handles from many threads while other handles are created and destroyed");
+
+    using namespace std::chrono;
+    using std::thread;
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    // Buffers of distinct sizes, so that unwrapping one handle to the driver handle of another changes the requirements
+    constexpr uint32_t buffer_count = 4;
+    VkMemoryPropertyFlags reqs = 0;
+    VkBufferObj buffers[buffer_count];
+    VkBuffer buffer_handles[buffer_count];
+    VkMemoryRequirements expected_reqs[buffer_count];
+    const VkDevice device_h = device();
+    for (uint32_t i = 0; i < buffer_count; ++i) {
+        buffers[i].init_as_dst(*m_device, 256 << (4 * i), reqs);
+        buffer_handles[i] = buffers[i].handle();
+        vk::GetBufferMemoryRequirements(device_h, buffer_handles[i], &expected_reqs[i]);
+    }
+
+    constexpr auto test_duration = milliseconds{500};
+    std::atomic<bool> done{false};
+
+    // The creating thread churns enough handles to make the unique id table grow and rehash under the readers.
+    const auto &churn_thread = [&]() {
+        const VkSamplerCreateInfo sampler_ci = SafeSaneSamplerCreateInfo();
+        std::vector<VkSampler> samplers(64);
+        for (auto timer_begin = steady_clock::now(); steady_clock::now() - timer_begin < test_duration;) {
+            for (auto &sampler : samplers) vk::CreateSampler(device_h, &sampler_ci, nullptr, &sampler);
+            for (auto &sampler : samplers) vk::DestroySampler(device_h, sampler, nullptr);
+        }
+        done = true;
+    };
+
+    std::atomic<uint64_t> unwraps{0};
+    std::atomic<uint64_t> mismatches{0};
+    const auto &unwrap_thread = [&]() {
+        uint64_t count = 0;
+        uint64_t bad = 0;
+        while (!done) {
+            const uint32_t index = count % buffer_count;
+            VkMemoryRequirements mem_reqs = {};
+            vk::GetBufferMemoryRequirements(device_h, buffer_handles[index], &mem_reqs);
+            if ((mem_reqs.size != expected_reqs[index].size) || (mem_reqs.alignment != expected_reqs[index].alignment) ||
+                (mem_reqs.memoryTypeBits != expected_reqs[index].memoryTypeBits)) {
+                ++bad;
+            }
+            ++count;
+        }
+        unwraps += count;
+        mismatches += bad;
+    };
+
+    m_errorMonitor->ExpectSuccess();
+    std::vector<thread> threads;
+    threads.emplace_back(churn_thread);
+    for (uint32_t i = 0; i < 8; ++i) threads.emplace_back(unwrap_thread);
+    for (auto &t : threads) t.join();
+    m_errorMonitor->VerifyNotFound();
+    ASSERT_GT(unwraps.load(), 0u);
+    ASSERT_EQ(mismatches.load(), 0u);
+}
+
+TEST_F(VkPositiveLayerTest, ThreadSafetyRecycledObjectRecords) {
+    TEST_DESCRIPTION("Destroy and recreate objects from several threads while others use theirs, recycling the threading records");
+
+    using namespace std::chrono;
+    using std::thread;
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const VkDevice device_h = device();
+    constexpr auto test_duration = milliseconds{500};
+    VkEventCreateInfo event_ci = {};
+    event_ci.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+
+    // Each churning thread frees records that the others pick up for their next events. A record handed on with a stale
+    // count or thread would make the next owner's use look concurrent.
+    std::atomic<uint32_t> failures{0};
+    const auto &churn_thread = [&]() {
+        std::vector<VkEvent> events(16);
+        for (auto timer_begin = steady_clock::now(); steady_clock::now() - timer_begin < test_duration;) {
+            for (auto &event : events) vk::CreateEvent(device_h, &event_ci, nullptr, &event);
+            for (auto &event : events) {
+                vk::SetEvent(device_h, event);
+                if (vk::GetEventStatus(device_h, event) != VK_EVENT_SET) ++failures;
+                vk::ResetEvent(device_h, event);
+            }
+            for (auto &event : events) vk::DestroyEvent(device_h, event, nullptr);
+        }
+    };
+
+    // Long-lived events, each used by one thread only, share the table with the churning ones
+    const auto &user_thread = [&]() {
+        VkEvent event;
+        vk::CreateEvent(device_h, &event_ci, nullptr, &event);
+        for (auto timer_begin = steady_clock::now(); steady_clock::now() - timer_begin < test_duration;) {
+            vk::SetEvent(device_h, event);
+            if (vk::GetEventStatus(device_h, event) != VK_EVENT_SET) ++failures;
+            vk::ResetEvent(device_h, event);
+        }
+        vk::DestroyEvent(device_h, event, nullptr);
+    };
+
+    m_errorMonitor->ExpectSuccess();
+    std::vector<thread> threads;
+    for (uint32_t i = 0; i < 4; ++i) threads.emplace_back(churn_thread);
+    for (uint32_t i = 0; i < 4; ++i) threads.emplace_back(user_thread);
+    for (auto &t : threads) t.join();
+    m_errorMonitor->VerifyNotFound();
+    ASSERT_EQ(failures.load(), 0u);
+}
+
 TEST_F(VkPositiveLayerTest, SwapchainImageFormatProps) {
     TEST_DESCRIPTION("Try using special format props on a swapchain image");
 